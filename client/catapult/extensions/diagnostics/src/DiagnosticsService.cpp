@@ -20,16 +20,41 @@
 **/
 
 #include "DiagnosticsService.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
+#include "catapult/model/DispatcherLatencyEntry.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/validators/StatelessValidationStatistics.h"
+#include <algorithm>
 
 namespace catapult { namespace diagnostics {
 
 	namespace {
-		thread::Task CreateLoggingTask(const std::vector<utils::DiagnosticCounter>& counters) {
-			return thread::CreateNamedTask("logging task", [counters]() {
+		constexpr auto Max_Logged_Validators = 10u;
+		constexpr auto Sampled_Stateless_Validator_Profile_Prefix = "stateless (sampled)::";
+		constexpr const char* Dispatcher_Service_Names[] = { "dispatcher.block", "dispatcher.transaction", "pt.dispatcher" };
+
+		auto TryGetStatelessValidationStatistics(const extensions::ServiceLocator& locator) {
+			return locator.tryService<validators::StatelessValidationStatistics>(validators::Stateless_Validation_Statistics_Service_Name);
+		}
+
+		void LogStatelessValidatorElapsedTimes(const validators::StatelessValidationStatistics& statistics) {
+			auto validatorElapsedTimes = statistics.validatorElapsedTimes();
+			if (validatorElapsedTimes.size() > Max_Logged_Validators)
+				validatorElapsedTimes.resize(Max_Logged_Validators);
+
+			std::ostringstream table;
+			table << "--- slowest stateless validators (" << statistics.numEntities() << " entities) ---";
+			for (const auto& validatorElapsedTime : validatorElapsedTimes)
+				table << std::endl << validatorElapsedTime.Name << " : " << validatorElapsedTime.ElapsedTime.count() << "us";
+
+			CATAPULT_LOG(info) << table.str();
+		}
+
+		thread::Task CreateLoggingTask(const std::vector<utils::DiagnosticCounter>& counters, const extensions::ServiceLocator& locator) {
+			return thread::CreateNamedTask("logging task", [counters, &locator]() {
 				std::ostringstream table;
 				table << "--- current counter values ---";
 				for (const auto& counter : counters) {
@@ -38,17 +63,95 @@ namespace catapult { namespace diagnostics {
 				}
 
 				CATAPULT_LOG(info) << table.str();
+
+				// stateless validation statistics are only available when the dispatcher service is registered
+				auto pStatistics = TryGetStatelessValidationStatistics(locator);
+				if (pStatistics)
+					LogStatelessValidatorElapsedTimes(*pStatistics);
+
 				return thread::make_ready_future(thread::TaskResult::Continue);
 			});
 		}
 
-		void AddDiagnosticHandlers(const std::vector<utils::DiagnosticCounter>& counters, extensions::ServiceState& state) {
+		std::vector<utils::ExecutionProfile::EntryValues> CollectExecutionProfile(
+				const utils::ExecutionProfile* pExecutionProfile,
+				const extensions::ServiceLocator& locator) {
+			std::vector<utils::ExecutionProfile::EntryValues> allEntryValues;
+			if (pExecutionProfile)
+				allEntryValues = pExecutionProfile->values();
+
+			// stateless validation statistics are registered after diagnostics and only when the dispatcher service is registered
+			auto pStatistics = TryGetStatelessValidationStatistics(locator);
+			if (!pStatistics)
+				return allEntryValues;
+
+			// sampled timings are estimates, so individual calls are not counted
+			for (const auto& validatorElapsedTime : pStatistics->validatorElapsedTimes()) {
+				auto elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(validatorElapsedTime.ElapsedTime);
+				allEntryValues.push_back({
+					Sampled_Stateless_Validator_Profile_Prefix + validatorElapsedTime.Name,
+					0,
+					static_cast<uint64_t>(elapsedNanoseconds.count()),
+					0
+				});
+			}
+
+			std::stable_sort(allEntryValues.begin(), allEntryValues.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.TotalElapsedNanoseconds > rhs.TotalElapsedNanoseconds;
+			});
+			return allEntryValues;
+		}
+
+		std::vector<handlers::DispatcherConsumerLatencies> CollectDispatcherLatencies(const extensions::ServiceLocator& locator) {
+			std::vector<handlers::DispatcherConsumerLatencies> allLatencies;
+			for (const auto* dispatcherServiceName : Dispatcher_Service_Names) {
+				// dispatchers are registered after diagnostics and only when the corresponding extensions are loaded
+				auto pDispatcher = locator.tryService<disruptor::ConsumerDispatcher>(dispatcherServiceName);
+				if (!pDispatcher)
+					continue;
+
+				const auto& statistics = pDispatcher->statistics();
+				for (auto level = 0u; level < statistics.numConsumers(); ++level) {
+					allLatencies.push_back({
+						dispatcherServiceName,
+						static_cast<uint16_t>(level),
+						statistics.waitTimes(level).summarize(),
+						statistics.processingTimes(level).summarize()
+					});
+				}
+
+				allLatencies.push_back({
+					dispatcherServiceName,
+					model::DispatcherLatencyEntry::Total_Consumer_Level,
+					utils::LatencySummary(),
+					statistics.totalTimes().summarize()
+				});
+			}
+
+			return allLatencies;
+		}
+
+		void AddDiagnosticHandlers(
+				const std::vector<utils::DiagnosticCounter>& counters,
+				const extensions::ServiceLocator& locator,
+				extensions::ServiceState& state) {
 			auto& handlers = state.packetHandlers();
 			handlers.setAllowedHosts(state.config().Node.TrustedHosts);
 
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
 			handlers::RegisterDiagnosticNodesHandler(handlers, state.nodes());
 			handlers::RegisterDiagnosticBlockStatementHandler(handlers, state.storage());
+
+			// execution profile is only available when execution profiling is enabled
+			const auto* pExecutionProfile = state.pluginManager().executionProfile();
+			handlers::RegisterDiagnosticExecutionProfileHandler(handlers, [pExecutionProfile, &locator]() {
+				return CollectExecutionProfile(pExecutionProfile, locator);
+			});
+
+			handlers::RegisterDiagnosticDispatcherLatenciesHandler(handlers, [&locator]() {
+				return CollectDispatcherLatencies(locator);
+			});
+
 			state.pluginManager().addDiagnosticHandlers(handlers, state.cache());
 
 			handlers.setAllowedHosts({});
@@ -70,10 +173,10 @@ namespace catapult { namespace diagnostics {
 				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
 
 				// add task
-				state.tasks().push_back(CreateLoggingTask(counters));
+				state.tasks().push_back(CreateLoggingTask(counters, locator));
 
 				// add packet handlers
-				AddDiagnosticHandlers(counters, state);
+				AddDiagnosticHandlers(counters, locator, state);
 			}
 		};
 	}
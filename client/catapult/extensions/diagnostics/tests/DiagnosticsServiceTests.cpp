@@ -20,7 +20,11 @@
 **/
 
 #include "diagnostics/src/DiagnosticsService.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DispatcherLatencyEntry.h"
+#include "catapult/model/ExecutionProfileEntry.h"
+#include "catapult/validators/StatelessValidationStatistics.h"
 #include "tests/test/core/HandlersTrustedHostTests.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -49,6 +53,40 @@ namespace catapult { namespace diagnostics {
 		test::AssertRegisteredTasks(TestContext(), { "logging task" });
 	}
 
+	namespace {
+		void AssertLoggingTaskContinues(TestContext& context) {
+			// Arrange:
+			context.boot();
+			const auto& tasks = context.testState().state().tasks();
+
+			// Act:
+			auto result = tasks[0].Callback().get();
+
+			// Assert:
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+		}
+	}
+
+	TEST(TEST_CLASS, LoggingTaskCanRunWithoutStatelessValidationStatistics) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		AssertLoggingTaskContinues(context);
+	}
+
+	TEST(TEST_CLASS, LoggingTaskCanRunWithStatelessValidationStatistics) {
+		// Arrange:
+		TestContext context;
+		auto pStatistics = std::make_shared<validators::StatelessValidationStatistics>(std::vector<std::string>{ "alpha", "beta" });
+		pStatistics->addBatch(3, std::chrono::milliseconds(2));
+		pStatistics->addValidatorElapsedTimes({ std::chrono::microseconds(100), std::chrono::microseconds(200) });
+		context.locator().registerRootedService(validators::Stateless_Validation_Statistics_Service_Name, pStatistics);
+
+		// Act + Assert:
+		AssertLoggingTaskContinues(context);
+	}
+
 	TEST(TEST_CLASS, PacketHandlersAreRegistered) {
 		// Arrange:
 		struct HookCapture {
@@ -69,11 +107,13 @@ namespace catapult { namespace diagnostics {
 		context.boot();
 		const auto& packetHandlers = context.testState().state().packetHandlers();
 
-		// Assert: three default handlers were added
-		EXPECT_EQ(4u, packetHandlers.size());
+		// Assert: five default handlers were added
+		EXPECT_EQ(6u, packetHandlers.size());
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Counters)); // the default (counters) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Infos)); // the default (nodes) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Block_Statement)); // the default (statements) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Dispatcher_Latencies)); // the default (latencies) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Execution_Profile)); // the default (profile) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Chain_Statistics)); // the diagnostic handler hook registered above
 
 		// - correct params were forwarded to callback
@@ -81,8 +121,141 @@ namespace catapult { namespace diagnostics {
 		EXPECT_EQ(&context.testState().state().cache(), capture.pCache);
 	}
 
+	namespace {
+		void ProcessExecutionProfileRequest(TestContext& context, ionet::ServerPacketHandlerContext& handlerContext) {
+			const auto& packetHandlers = context.testState().state().packetHandlers();
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Execution_Profile;
+			EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+		}
+	}
+
+	TEST(TEST_CLASS, ExecutionProfileIsEmptyWhenProfilingIsDisabledAndNoStatisticsAreRegistered) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		ProcessExecutionProfileRequest(context, handlerContext);
+
+		// Assert:
+		test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader), ionet::PacketType::Execution_Profile);
+		EXPECT_TRUE(handlerContext.response().buffers().empty());
+	}
+
+	TEST(TEST_CLASS, ExecutionProfileIsEmptyWhenProfilingIsEnabledAndNothingHasBeenProfiled) {
+		// Arrange:
+		TestContext context;
+		context.testState().pluginManager().enableExecutionProfiling();
+		context.boot();
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		ProcessExecutionProfileRequest(context, handlerContext);
+
+		// Assert:
+		test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader), ionet::PacketType::Execution_Profile);
+		EXPECT_TRUE(handlerContext.response().buffers().empty());
+	}
+
+	TEST(TEST_CLASS, ExecutionProfileIncludesStatelessValidationStatisticsRegisteredAfterBoot) {
+		// Arrange: register the statistics after booting because they are registered by the dispatcher service in a later phase
+		TestContext context;
+		context.boot();
+
+		auto pStatistics = std::make_shared<validators::StatelessValidationStatistics>(std::vector<std::string>{ "alpha", "beta" });
+		pStatistics->addValidatorElapsedTimes({ std::chrono::microseconds(100), std::chrono::microseconds(200) });
+		context.locator().registerRootedService(validators::Stateless_Validation_Statistics_Service_Name, pStatistics);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		ProcessExecutionProfileRequest(context, handlerContext);
+
+		// Assert: one entry is returned per validator sorted by decreasing elapsed time
+		constexpr auto Entry1_Size = sizeof(model::ExecutionProfileEntry) + 25;
+		constexpr auto Entry2_Size = sizeof(model::ExecutionProfileEntry) + 26;
+		auto expectedPacketSize = sizeof(ionet::PacketHeader) + Entry1_Size + Entry2_Size;
+		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Execution_Profile);
+
+		const auto* pData = test::GetSingleBufferData(handlerContext);
+		const auto& entry1 = reinterpret_cast<const model::ExecutionProfileEntry&>(*pData);
+		EXPECT_EQ(Entry1_Size, entry1.Size);
+		EXPECT_EQ("stateless (sampled)::beta", std::string(entry1.NamePtr(), entry1.NameSize));
+		EXPECT_EQ(0u, entry1.NumCalls);
+		EXPECT_EQ(200'000u, entry1.TotalElapsedNanoseconds);
+		EXPECT_EQ(0u, entry1.MaxElapsedNanoseconds);
+
+		const auto& entry2 = reinterpret_cast<const model::ExecutionProfileEntry&>(*(pData + Entry1_Size));
+		EXPECT_EQ(Entry2_Size, entry2.Size);
+		EXPECT_EQ("stateless (sampled)::alpha", std::string(entry2.NamePtr(), entry2.NameSize));
+		EXPECT_EQ(0u, entry2.NumCalls);
+		EXPECT_EQ(100'000u, entry2.TotalElapsedNanoseconds);
+		EXPECT_EQ(0u, entry2.MaxElapsedNanoseconds);
+	}
+
 	ADD_HANDLERS_TRUSTED_HOSTS_TESTS(TestContext, ionet::PacketType::Diagnostic_Counters)
 
+	namespace {
+		void ProcessDispatcherLatenciesRequest(TestContext& context, ionet::ServerPacketHandlerContext& handlerContext) {
+			const auto& packetHandlers = context.testState().state().packetHandlers();
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Dispatcher_Latencies;
+			EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+		}
+	}
+
+	TEST(TEST_CLASS, DispatcherLatenciesAreEmptyWhenNoDispatchersAreRegistered) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		ProcessDispatcherLatenciesRequest(context, handlerContext);
+
+		// Assert:
+		test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader), ionet::PacketType::Dispatcher_Latencies);
+		EXPECT_TRUE(handlerContext.response().buffers().empty());
+	}
+
+	TEST(TEST_CLASS, DispatcherLatenciesAreSourcedFromDispatchersRegisteredAfterBoot) {
+		// Arrange: register the dispatcher after booting because dispatchers are registered in a later phase
+		TestContext context;
+		context.boot();
+
+		auto options = disruptor::ConsumerDispatcherOptions{ "DiagnosticsServiceTests", 16u * 1024 };
+		auto pDispatcher = std::make_shared<disruptor::ConsumerDispatcher>(options, std::vector<disruptor::DisruptorConsumer>{
+			[](const auto&) { return disruptor::ConsumerResult::Continue(); },
+			[](const auto&) { return disruptor::ConsumerResult::Continue(); }
+		});
+		context.locator().registerService("dispatcher.transaction", pDispatcher);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		ProcessDispatcherLatenciesRequest(context, handlerContext);
+
+		// Assert: two consumer entries and one end-to-end entry are returned
+		constexpr auto Entry_Size = sizeof(model::DispatcherLatencyEntry) + 22;
+		auto expectedPacketSize = sizeof(ionet::PacketHeader) + 3 * Entry_Size;
+		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Dispatcher_Latencies);
+
+		const auto* pData = test::GetSingleBufferData(handlerContext);
+		for (auto expectedConsumerLevel : std::initializer_list<uint16_t>{ 0, 1, model::DispatcherLatencyEntry::Total_Consumer_Level }) {
+			const auto& entry = reinterpret_cast<const model::DispatcherLatencyEntry&>(*pData);
+			EXPECT_EQ(Entry_Size, entry.Size);
+			EXPECT_EQ("dispatcher.transaction", std::string(entry.NamePtr(), entry.NameSize));
+			EXPECT_EQ(expectedConsumerLevel, entry.ConsumerLevel);
+			EXPECT_EQ(0u, entry.ProcessingTimes.Count);
+			pData += entry.Size;
+		}
+
+		// Cleanup:
+		pDispatcher->shutdown();
+	}
+
 	TEST(TEST_CLASS, CountersAreSourcedFromLocatorAndState) {
 		// Arrange: add counters to different sources
 		constexpr auto Num_Counters = 2u;
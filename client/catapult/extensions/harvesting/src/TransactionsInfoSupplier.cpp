@@ -29,16 +29,11 @@ namespace catapult { namespace harvesting {
 	namespace {
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		template<SortDirection Direction>
 		struct MaxFeeMultiplierComparer {
 			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
 				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
 				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
+				return lhsMaxFeeMultiplier < rhsMaxFeeMultiplier;
 			}
 		};
 
@@ -83,13 +78,13 @@ namespace catapult { namespace harvesting {
 
 		auto GetFirstTransactionInfoPointers(
 				const SupplyInput& input,
-				const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+				cache::FeeMultiplierOrder order,
 				const predicate<const model::TransactionInfo&>& filter) {
 			return cache::GetFirstTransactionInfoPointers(
 					input.UtCacheView,
 					input.TransactionLimit,
 					input.EmbeddedCountRetriever,
-					sortComparer,
+					order,
 					filter);
 		}
 
@@ -102,8 +97,7 @@ namespace catapult { namespace harvesting {
 			// 2. pick the smallest multiplier so that all transactions pass validation
 			auto minFeeMultiplier = BlockFeeMultiplier();
 			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
+				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), MaxFeeMultiplierComparer());
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
 			}
 
@@ -111,9 +105,9 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMinimumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade](const auto& transactionInfo) {
+			// 1. get transactions with smallest multipliers from the ut cache
+			auto order = cache::FeeMultiplierOrder::Ascending;
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
@@ -126,10 +120,10 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+			// 1. get transactions with largest multipliers from the ut cache
+			auto order = cache::FeeMultiplierOrder::Descending;
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade, &maximizer](
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
@@ -60,6 +60,7 @@ namespace catapult { namespace partialtransaction {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -52,7 +52,10 @@ namespace catapult { namespace partialtransaction {
 				net::PacketWriters& packetWriters) {
 			const auto& ptCache = GetMemoryPtCache(locator);
 			const auto& serverHooks = GetPtServerHooks(locator);
-			auto ptSynchronizer = chain::CreatePtSynchronizer(
+			auto createPtSynchronizer = state.config().Node.EnableFilteredTransactionsPull
+					? chain::CreateFilteredPtSynchronizer
+					: chain::CreatePtSynchronizer;
+			auto ptSynchronizer = createPtSynchronizer(
 					state.timeSupplier(),
 					[&ptCache]() { return ptCache.view().shortHashPairs(); },
 					serverHooks.cosignedTransactionInfosConsumer(),
@@ -56,6 +56,12 @@ namespace catapult { namespace partialtransaction {
 					return ptCache.view().unknownTransactions(minDeadline, shortHashPairs);
 				});
 
+				handlers::RegisterPullFilteredPartialTransactionInfosHandler(state.packetHandlers(), [&ptCache](
+						auto minDeadline,
+						const auto& shortHashPairsFilter) {
+					return ptCache.view().filteredUnknownTransactions(minDeadline, shortHashPairsFilter);
+				});
+
 				handlers::RegisterPushCosignaturesHandler(state.packetHandlers(), hooks.cosignatureRangeConsumer());
 			}
 		};
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "catapult/cache_tx/ShortHashFilters.h"
 #include "catapult/cache_tx/ShortHashPair.h"
 #include "catapult/model/CosignedTransactionInfo.h"
 #include "catapult/functions.h"
@@ -33,6 +34,10 @@ namespace catapult { namespace partialtransaction {
 	/// Prototype for a function that retrieves partial transaction infos given a filter and a set of short hash pairs.
 	using CosignedTransactionInfosRetriever = std::function<CosignedTransactionInfos (Timestamp, const cache::ShortHashPairMap&)>;
 
+	/// Prototype for a function that retrieves partial transaction infos given a filter and a filter of known short hash pairs.
+	using FilteredCosignedTransactionInfosRetriever = std::function<
+			CosignedTransactionInfos (Timestamp, const cache::ShortHashPairFilter&)>;
+
 	/// Function signature for consuming a vector of cosigned transaction infos.
 	using CosignedTransactionInfosConsumer = consumer<CosignedTransactionInfos&&>;
 
@@ -52,6 +52,27 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct FilteredTransactionInfosTraits : public TransactionInfosTraits {
+		public:
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos;
+			static constexpr auto Friendly_Name = "pull filtered partial transaction infos";
+
+			static auto CreateRequestPacketPayload(Timestamp minDeadline, cache::ShortHashPairFilter&& knownShortHashPairsFilter) {
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendValue(minDeadline);
+				const auto& filter = knownShortHashPairsFilter;
+				for (const auto* pFilter : { &filter.TransactionShortHashes, &filter.ShortHashPairs }) {
+					builder.appendValue(pFilter->header());
+					builder.appendValues(pFilter->data());
+				}
+
+				return builder.build();
+			}
+
+		public:
+			using TransactionInfosTraits::TransactionInfosTraits;
+		};
+
 		// endregion
 
 		class DefaultRemotePtApi : public RemotePtApi {
@@ -73,6 +94,13 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(TransactionInfosTraits(m_registry), minDeadline, std::move(knownShortHashPairs));
 			}
 
+			FutureType<FilteredTransactionInfosTraits> filteredTransactionInfos(
+					Timestamp minDeadline,
+					cache::ShortHashPairFilter&& knownShortHashPairsFilter) const override {
+				auto traits = FilteredTransactionInfosTraits(m_registry);
+				return m_impl.dispatch(traits, minDeadline, std::move(knownShortHashPairsFilter));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -42,6 +42,12 @@ namespace catapult { namespace api {
 		virtual thread::future<partialtransaction::CosignedTransactionInfos> transactionInfos(
 				Timestamp minDeadline,
 				cache::ShortHashPairRange&& knownShortHashPairs) const = 0;
+
+		/// Gets all partial transaction infos from the remote that have a deadline at least \a minDeadline
+		/// and do not have a short hash pair in \a knownShortHashPairsFilter.
+		virtual thread::future<partialtransaction::CosignedTransactionInfos> filteredTransactionInfos(
+				Timestamp minDeadline,
+				cache::ShortHashPairFilter&& knownShortHashPairsFilter) const = 0;
 	};
 
 	/// Creates a partial transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
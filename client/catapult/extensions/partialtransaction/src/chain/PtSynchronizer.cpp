@@ -22,6 +22,7 @@
 #include "PtSynchronizer.h"
 #include "partialtransaction/src/api/RemotePtApi.h"
 #include "catapult/chain/EntitiesSynchronizer.h"
+#include "catapult/utils/RandomGenerator.h"
 
 namespace catapult { namespace chain {
 
@@ -50,11 +51,30 @@ namespace catapult { namespace chain {
 				m_transactionInfosConsumer(std::move(transactionInfos));
 			}
 
-		private:
+		protected:
 			TimeSupplier m_timeSupplier;
 			partialtransaction::ShortHashPairsSupplier m_shortHashPairsSupplier;
 			partialtransaction::CosignedTransactionInfosConsumer m_transactionInfosConsumer;
 		};
+
+		struct FilteredPtTraits : public PtTraits {
+		public:
+			using PtTraits::PtTraits;
+
+		public:
+			thread::future<partialtransaction::CosignedTransactionInfos> apiCall(const RemoteApiType& api) const {
+				// use a new seed for every request so that false positives are not repeated across rounds
+				auto seed = static_cast<uint32_t>(utils::LowEntropyRandomGenerator()());
+				auto filter = cache::CreateShortHashPairFilter(m_shortHashPairsSupplier(), seed);
+				return api.filteredTransactionInfos(m_timeSupplier(), std::move(filter));
+			}
+		};
+
+		template<typename TTraits>
+		RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(TTraits&& traits, const predicate<>& shouldExecute) {
+			auto pSynchronizer = std::make_shared<EntitiesSynchronizer<TTraits>>(std::move(traits));
+			return CreateConditionalRemoteNodeSynchronizer(pSynchronizer, shouldExecute);
+		}
 	}
 
 	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
@@ -62,8 +82,14 @@ namespace catapult { namespace chain {
 			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
 			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer,
 			const predicate<>& shouldExecute) {
-		auto traits = PtTraits(timeSupplier, shortHashPairsSupplier, transactionInfosConsumer);
-		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<PtTraits>>(std::move(traits));
-		return CreateConditionalRemoteNodeSynchronizer(pSynchronizer, shouldExecute);
+		return CreatePtSynchronizer(PtTraits(timeSupplier, shortHashPairsSupplier, transactionInfosConsumer), shouldExecute);
+	}
+
+	RemoteNodeSynchronizer<api::RemotePtApi> CreateFilteredPtSynchronizer(
+			const TimeSupplier& timeSupplier,
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer,
+			const predicate<>& shouldExecute) {
+		return CreatePtSynchronizer(FilteredPtTraits(timeSupplier, shortHashPairsSupplier, transactionInfosConsumer), shouldExecute);
 	}
 }}
@@ -37,4 +37,14 @@ namespace catapult { namespace chain {
 			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
 			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer,
 			const predicate<>& shouldExecute);
+
+	/// Creates a partial transactions synchronizer around the specified time supplier (\a timeSupplier),
+	/// short hash pairs supplier (\a shortHashPairsSupplier) and partial transaction infos consumer (\a transactionInfosConsumer).
+	/// \note Known short hash pairs are sent to the remote as (compact) bloom filters instead of as a list.
+	/// \note Remote operation is only initiated when \a shouldExecute returns \c true.
+	RemoteNodeSynchronizer<api::RemotePtApi> CreateFilteredPtSynchronizer(
+			const TimeSupplier& timeSupplier,
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer,
+			const predicate<>& shouldExecute);
 }}
@@ -83,8 +83,8 @@ namespace catapult { namespace handlers {
 			builder.appendRange(CosignatureRange::CopyFixed(pCosignaturesData, transactionInfo.Cosignatures.size()));
 		}
 
-		auto BuildPacket(const CosignedTransactionInfos& transactionInfos) {
-			ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Partial_Transaction_Infos);
+		auto BuildPacket(ionet::PacketType packetType, const CosignedTransactionInfos& transactionInfos) {
+			ionet::PacketPayloadBuilder builder(packetType);
 			for (const auto& transactionInfo : transactionInfos)
 				AppendTransactionInfo(builder, transactionInfo);
 
@@ -98,7 +98,38 @@ namespace catapult { namespace handlers {
 					return;
 
 				auto transactionInfos = transactionInfosRetriever(request.FilterValue, request.ShortHashPairs);
-				context.response(BuildPacket(transactionInfos));
+				context.response(BuildPacket(ionet::PacketType::Pull_Partial_Transaction_Infos, transactionInfos));
+			};
+		}
+
+		bool TryParseFilteredPullRequest(const ionet::Packet& packet, Timestamp& minDeadline, cache::ShortHashPairFilter& filter) {
+			auto dataSize = ionet::CalculatePacketDataSize(packet);
+			if (dataSize < sizeof(Timestamp))
+				return false;
+
+			// data is prepended with min deadline followed by transaction short hashes and short hash pairs filters
+			minDeadline = reinterpret_cast<const Timestamp&>(*packet.Data());
+			RawBuffer buffer{ packet.Data() + sizeof(Timestamp), dataSize - sizeof(Timestamp) };
+			for (auto* pFilter : { &filter.TransactionShortHashes, &filter.ShortHashPairs }) {
+				size_t numBytesConsumed;
+				if (!utils::TryParseBloomFilter(buffer, *pFilter, numBytesConsumed))
+					return false;
+
+				buffer = { buffer.pData + numBytesConsumed, buffer.Size - numBytesConsumed };
+			}
+
+			return 0 == buffer.Size;
+		}
+
+		auto CreatePullFilteredTransactionsHandler(const FilteredCosignedTransactionInfosRetriever& transactionInfosRetriever) {
+			return [transactionInfosRetriever](const auto& packet, auto& context) {
+				Timestamp minDeadline;
+				cache::ShortHashPairFilter filter;
+				if (!TryParseFilteredPullRequest(packet, minDeadline, filter))
+					return;
+
+				auto transactionInfos = transactionInfosRetriever(minDeadline, filter);
+				context.response(BuildPacket(ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos, transactionInfos));
 			};
 		}
 	}
@@ -121,4 +152,12 @@ namespace catapult { namespace handlers {
 				ionet::PacketType::Pull_Partial_Transaction_Infos,
 				CreatePullTransactionsHandler(transactionInfosRetriever));
 	}
+
+	void RegisterPullFilteredPartialTransactionInfosHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const FilteredCosignedTransactionInfosRetriever& transactionInfosRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos,
+				CreatePullFilteredTransactionsHandler(transactionInfosRetriever));
+	}
 }}
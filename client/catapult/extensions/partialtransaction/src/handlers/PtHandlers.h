@@ -38,4 +38,10 @@ namespace catapult { namespace handlers {
 	void RegisterPullPartialTransactionInfosHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const partialtransaction::CosignedTransactionInfosRetriever& transactionInfosRetriever);
+
+	/// Registers a pull filtered partial transactions handler in \a handlers that responds with partial transactions
+	/// returned by the retriever (\a transactionInfosRetriever).
+	void RegisterPullFilteredPartialTransactionInfosHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const partialtransaction::FilteredCosignedTransactionInfosRetriever& transactionInfosRetriever);
 }}
@@ -77,10 +77,11 @@ namespace catapult { namespace partialtransaction {
 		const auto& handlers = context.testState().state().packetHandlers();
 
 		// Assert:
-		EXPECT_EQ(3u, handlers.size());
+		EXPECT_EQ(4u, handlers.size());
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Partial_Transactions));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Detached_Cosignatures));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Partial_Transaction_Infos));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos));
 	}
 
 	// endregion
@@ -133,6 +133,59 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct FilteredTransactionInfosTraits : public TransactionInfosTraits {
+			static constexpr uint32_t Request_Data_Size = 2 * sizeof(utils::BloomFilterHeader) + 4 + 2;
+
+			static cache::ShortHashPairFilter KnownShortHashPairsFilter() {
+				return { utils::BloomFilter(987, 3, { 0x12, 0x34, 0x56, 0x78 }), utils::BloomFilter(654, 4, { 0x9A, 0xBC }) };
+			}
+
+			static auto Invoke(const RemotePtApi& api) {
+				return api.filteredTransactionInfos(Timestamp(84), KnownShortHashPairsFilter());
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = TransactionInfosTraits::CreateValidResponsePacket();
+				pResponsePacket->Type = ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos;
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it has an incorrect tag specifying no transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				reinterpret_cast<uint16_t&>(*pResponsePacket->Data()) = 0x0000;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + Request_Data_Size, packet.Size);
+				EXPECT_EQ(Timestamp(84), reinterpret_cast<const Timestamp&>(*packet.Data()));
+
+				// - transaction short hashes filter
+				const auto* pData = packet.Data() + Request_Data_Header_Size;
+				const auto& transactionFilterHeader = reinterpret_cast<const utils::BloomFilterHeader&>(*pData);
+				EXPECT_EQ(4u, transactionFilterHeader.Size);
+				EXPECT_EQ(987u, transactionFilterHeader.Seed);
+				EXPECT_EQ(3u, transactionFilterHeader.NumHashFunctions);
+
+				auto expectedTransactionFilterData = std::vector<uint8_t>{ 0x12, 0x34, 0x56, 0x78 };
+				pData += sizeof(utils::BloomFilterHeader);
+				EXPECT_EQ_MEMORY(pData, expectedTransactionFilterData.data(), 4);
+				pData += 4;
+
+				// - short hash pairs filter
+				const auto& pairFilterHeader = reinterpret_cast<const utils::BloomFilterHeader&>(*pData);
+				EXPECT_EQ(2u, pairFilterHeader.Size);
+				EXPECT_EQ(654u, pairFilterHeader.Seed);
+				EXPECT_EQ(4u, pairFilterHeader.NumHashFunctions);
+
+				auto expectedPairFilterData = std::vector<uint8_t>{ 0x9A, 0xBC };
+				pData += sizeof(utils::BloomFilterHeader);
+				EXPECT_EQ_MEMORY(pData, expectedPairFilterData.data(), 2);
+			}
+		};
+
 		struct RemotePtApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -147,4 +200,5 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemotePtApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, TransactionInfos)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, FilteredTransactionInfos)
 }}
@@ -112,4 +112,106 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_CONDITIONAL_ENTITIES_SYNCHRONIZER_TESTS(PtSynchronizer)
+
+	// region filtered
+
+#define TEST_CLASS PtSynchronizerTests
+
+	namespace {
+		struct FilteredTestContext {
+		public:
+			explicit FilteredTestContext(uint32_t numShortHashPairs)
+					: ShortHashPairs(PtSynchronizerTraits::CreateRequestRange(numShortHashPairs))
+					, NumConsumerCalls(0)
+			{}
+
+		public:
+			cache::ShortHashPairRange ShortHashPairs;
+			size_t NumConsumerCalls;
+		};
+
+		auto CreateFilteredSynchronizer(FilteredTestContext& context, bool shouldExecute = true) {
+			return CreateFilteredPtSynchronizer(
+					[]() { return Timestamp(84); },
+					[&context]() { return cache::ShortHashPairRange::CopyRange(context.ShortHashPairs); },
+					[&context](const auto&) { ++context.NumConsumerCalls; },
+					[shouldExecute]() { return shouldExecute; });
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerSendsFiltersContainingAllKnownShortHashPairs) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(PtSynchronizerTraits::CreateResponseContainer(3));
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		EXPECT_TRUE(remoteApi.transactionInfosRequests().empty());
+
+		ASSERT_EQ(1u, remoteApi.filteredTransactionInfosRequests().size());
+		const auto& request = remoteApi.filteredTransactionInfosRequests()[0];
+		EXPECT_EQ(Timestamp(84), request.Deadline);
+		EXPECT_EQ(5u, request.ShortHashPairsFilter.TransactionShortHashes.data().size());
+		EXPECT_EQ(5u, request.ShortHashPairsFilter.ShortHashPairs.data().size());
+		for (const auto& shortHashPair : context.ShortHashPairs) {
+			EXPECT_TRUE(cache::MightContainTransaction(request.ShortHashPairsFilter, shortHashPair.TransactionShortHash));
+			EXPECT_TRUE(cache::MightContain(request.ShortHashPairsFilter, shortHashPair));
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerUsesDifferentSeedForEachRequest) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(PtSynchronizerTraits::CreateResponseContainer(3));
+
+		// Act:
+		synchronizer(remoteApi).get();
+		synchronizer(remoteApi).get();
+
+		// Assert:
+		const auto& requests = remoteApi.filteredTransactionInfosRequests();
+		ASSERT_EQ(2u, requests.size());
+		auto seed1 = requests[0].ShortHashPairsFilter.TransactionShortHashes.seed();
+		auto seed2 = requests[1].ShortHashPairsFilter.TransactionShortHashes.seed();
+		EXPECT_NE(seed1, seed2);
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerFailsWhenRemoteApiThrows) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(PtSynchronizerTraits::CreateResponseContainer(3));
+		remoteApi.setError(MockRemoteApi::EntryPoint::Filtered_Partial_Transaction_Infos);
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+		EXPECT_EQ(1u, remoteApi.filteredTransactionInfosRequests().size());
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerBypassesRequestWhenConditionIsNotSatisfied) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context, false);
+		MockRemoteApi remoteApi(PtSynchronizerTraits::CreateResponseContainer(3));
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+		EXPECT_TRUE(remoteApi.filteredTransactionInfosRequests().empty());
+	}
+
+	// endregion
 }}
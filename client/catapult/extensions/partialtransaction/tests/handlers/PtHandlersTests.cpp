@@ -22,6 +22,7 @@
 #include "partialtransaction/src/handlers/PtHandlers.h"
 #include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
 #include "catapult/utils/Functional.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PushHandlerTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/plugins/PullHandlerTests.h"
@@ -236,4 +237,137 @@ namespace catapult { namespace handlers {
 			test::PullEntitiesHandlerAssertAdapter<PullTransactionsRequestResponseTraits>::AssertFunc<ShortHashPairTraits>)
 
 	// endregion
+
+	// region PullFilteredPartialTransactionInfosHandler
+
+	namespace {
+		constexpr auto Filtered_Packet_Type = ionet::PacketType::Pull_Filtered_Partial_Transaction_Infos;
+
+		utils::BloomFilter CreateRandomFilter(size_t size) {
+			return utils::BloomFilter(static_cast<uint32_t>(test::Random()), 3, test::GenerateRandomVector(size));
+		}
+
+		std::shared_ptr<ionet::Packet> CreatePullFilteredPacket(
+				Timestamp minDeadline,
+				const std::vector<utils::BloomFilter>& filters,
+				uint32_t numTrailingBytes = 0) {
+			auto payloadSize = SizeOf32<Timestamp>() + numTrailingBytes;
+			for (const auto& filter : filters)
+				payloadSize += static_cast<uint32_t>(sizeof(utils::BloomFilterHeader) + filter.data().size());
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pPacket->Type = Filtered_Packet_Type;
+
+			auto* pData = pPacket->Data();
+			reinterpret_cast<Timestamp&>(*pData) = minDeadline;
+			pData += sizeof(Timestamp);
+			for (const auto& filter : filters) {
+				reinterpret_cast<utils::BloomFilterHeader&>(*pData) = filter.header();
+				pData += sizeof(utils::BloomFilterHeader);
+
+				std::memcpy(pData, filter.data().data(), filter.data().size());
+				pData += filter.data().size();
+			}
+
+			return pPacket;
+		}
+
+		struct FilteredRetrieverParams {
+		public:
+			FilteredRetrieverParams(Timestamp minDeadline, const cache::ShortHashPairFilter& filter)
+					: MinDeadline(minDeadline)
+					, Filter(filter)
+			{}
+
+		public:
+			Timestamp MinDeadline;
+			cache::ShortHashPairFilter Filter;
+		};
+
+		template<typename TAction>
+		void RunPullFilteredTest(const ionet::Packet& packet, const CosignedTransactionInfos& transactionInfos, TAction action) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			std::vector<FilteredRetrieverParams> params;
+			RegisterPullFilteredPartialTransactionInfosHandler(handlers, [&params, &transactionInfos](
+					auto minDeadline,
+					const auto& filter) {
+				params.emplace_back(minDeadline, filter);
+				return transactionInfos;
+			});
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(packet, handlerContext));
+
+			// Assert:
+			action(params, handlerContext);
+		}
+
+		void AssertPullFilteredPacketIsRejected(const ionet::Packet& packet) {
+			RunPullFilteredTest(packet, {}, [](const auto& params, const auto& handlerContext) {
+				EXPECT_TRUE(params.empty());
+				test::AssertNoResponse(handlerContext);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithoutMinDeadlineIsRejected) {
+		// Arrange:
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(SizeOf32<Timestamp>() - 1);
+		pPacket->Type = Filtered_Packet_Type;
+
+		// Act + Assert:
+		AssertPullFilteredPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithoutFiltersIsRejected) {
+		AssertPullFilteredPacketIsRejected(*CreatePullFilteredPacket(Timestamp(), {}));
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithSingleFilterIsRejected) {
+		AssertPullFilteredPacketIsRejected(*CreatePullFilteredPacket(Timestamp(), { CreateRandomFilter(8) }));
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithMalformedFilterIsRejected) {
+		// Arrange: zero hash functions are not allowed
+		auto pPacket = CreatePullFilteredPacket(Timestamp(), { CreateRandomFilter(8), CreateRandomFilter(8) });
+		auto secondFilterOffset = sizeof(Timestamp) + sizeof(utils::BloomFilterHeader) + 8;
+		reinterpret_cast<utils::BloomFilterHeader&>(*(pPacket->Data() + secondFilterOffset)).NumHashFunctions = 0;
+
+		// Act + Assert:
+		AssertPullFilteredPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithTrailingDataIsRejected) {
+		AssertPullFilteredPacketIsRejected(*CreatePullFilteredPacket(Timestamp(), { CreateRandomFilter(8), CreateRandomFilter(8) }, 1));
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_ValidPacketIsAccepted) {
+		// Arrange:
+		auto transactionFilter = CreateRandomFilter(8);
+		auto pairFilter = CreateRandomFilter(11);
+		auto pPacket = CreatePullFilteredPacket(Timestamp(123), { transactionFilter, pairFilter });
+
+		PullTransactionsRequestResponseTraits::PullResponseContext responseContext(5);
+
+		// Act:
+		RunPullFilteredTest(*pPacket, responseContext.response(), [&](const auto& params, const auto& handlerContext) {
+			// Assert: the requested values were passed to the retriever
+			ASSERT_EQ(1u, params.size());
+			EXPECT_EQ(Timestamp(123), params[0].MinDeadline);
+			EXPECT_EQ(transactionFilter.seed(), params[0].Filter.TransactionShortHashes.seed());
+			EXPECT_EQ(transactionFilter.data(), params[0].Filter.TransactionShortHashes.data());
+			EXPECT_EQ(pairFilter.seed(), params[0].Filter.ShortHashPairs.seed());
+			EXPECT_EQ(pairFilter.data(), params[0].Filter.ShortHashPairs.data());
+
+			// - the response contains all retrieved transaction infos
+			ASSERT_TRUE(handlerContext.hasResponse());
+			auto payload = handlerContext.response();
+			test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + responseContext.responseSize(), Filtered_Packet_Type);
+			responseContext.assertPayload(payload);
+		});
+	}
+
+	// endregion
 }}
@@ -31,7 +31,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Partial_Transaction_Infos
+			Partial_Transaction_Infos,
+			Filtered_Partial_Transaction_Infos
 		};
 
 		struct TransactionInfosRequest {
@@ -39,6 +40,11 @@ namespace catapult { namespace mocks {
 			cache::ShortHashPairRange ShortHashPairs;
 		};
 
+		struct FilteredTransactionInfosRequest {
+			Timestamp Deadline;
+			cache::ShortHashPairFilter ShortHashPairsFilter;
+		};
+
 	public:
 		/// Creates a partial transaction api around cosigned transaction infos (\a transactionInfos).
 		explicit MockPtApi(const partialtransaction::CosignedTransactionInfos& transactionInfos)
@@ -58,6 +64,11 @@ namespace catapult { namespace mocks {
 			return m_transactionInfosRequests;
 		}
 
+		/// Gets a vector of parameters that were passed to the filtered partial transaction infos requests.
+		const auto& filteredTransactionInfosRequests() const {
+			return m_filteredTransactionInfosRequests;
+		}
+
 	public:
 		/// Gets the configured partial transaction infos and throws if the error entry point is set to Partial_Transaction_Infos.
 		/// \note The \a minDeadline and \a knownShortHashPairs parameters are captured.
@@ -73,6 +84,22 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(decltype(m_transactionInfos)(m_transactionInfos));
 		}
 
+		/// Gets the configured partial transaction infos and throws if the error entry point is set to
+		/// Filtered_Partial_Transaction_Infos.
+		/// \note The \a minDeadline and \a knownShortHashPairsFilter parameters are captured.
+		thread::future<partialtransaction::CosignedTransactionInfos> filteredTransactionInfos(
+				Timestamp minDeadline,
+				cache::ShortHashPairFilter&& knownShortHashPairsFilter) const override {
+			auto request = FilteredTransactionInfosRequest{ minDeadline, std::move(knownShortHashPairsFilter) };
+			m_filteredTransactionInfosRequests.push_back(std::move(request));
+			if (shouldRaiseException(EntryPoint::Filtered_Partial_Transaction_Infos)) {
+				using ResultType = partialtransaction::CosignedTransactionInfos;
+				return CreateFutureException<ResultType>("filtered partial transaction infos error has been set");
+			}
+
+			return thread::make_ready_future(decltype(m_transactionInfos)(m_transactionInfos));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -87,5 +114,6 @@ namespace catapult { namespace mocks {
 		partialtransaction::CosignedTransactionInfos m_transactionInfos;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<TransactionInfosRequest> m_transactionInfosRequests;
+		mutable std::vector<FilteredTransactionInfosRequest> m_filteredTransactionInfosRequests;
 	};
 }}
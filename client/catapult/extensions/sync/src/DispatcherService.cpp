@@ -28,6 +28,7 @@
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "catapult/cache_core/ImportanceView.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/chain/BatchEntityProcessor.h"
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
@@ -58,6 +59,7 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/validators/StatelessValidationStatistics.h"
 #include <filesystem>
 
 using namespace catapult::consumers;
@@ -66,6 +68,8 @@ using namespace catapult::disruptor;
 namespace catapult { namespace sync {
 
 	namespace {
+		constexpr auto Speculative_Validation_Statistics_Service_Name = "dispatcher.speculativeValidation";
+
 		// region utils
 
 		crypto::RandomFiller CreateRandomFiller() {
@@ -76,10 +80,17 @@ namespace catapult { namespace sync {
 
 		std::shared_ptr<const validators::ParallelValidationPolicy> CreateParallelValidationPolicy(
 				thread::IoThreadPool& validatorPool,
-				const plugins::PluginManager& pluginManager) {
+				const plugins::PluginManager& pluginManager,
+				const std::shared_ptr<validators::StatelessValidationStatistics>& pStatistics) {
+			auto validatorFactory = [&pluginManager](const auto& decorator) {
+				return pluginManager.createStatelessValidator([](auto) { return false; }, decorator);
+			};
 			return validators::CreateParallelValidationPolicy(
 					validatorPool,
-					extensions::CreateStatelessEntityValidator(pluginManager, model::SignatureNotification::Notification_Type));
+					validatorFactory,
+					pluginManager.createNotificationPublisher(),
+					[](auto notificationType) { return model::SignatureNotification::Notification_Type == notificationType; },
+					pStatistics);
 		}
 
 		ConsumerDispatcherOptions CreateBlockConsumerDispatcherOptions(const config::NodeConfiguration& config) {
@@ -87,6 +98,7 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.BlockDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -95,6 +107,7 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -148,9 +161,20 @@ namespace catapult { namespace sync {
 			return blockchainConfig.EnableVerifiableReceipts ? ReceiptValidationMode::Enabled : ReceiptValidationMode::Disabled;
 		}
 
+		chain::BatchEntityProcessor CreateSyncBatchEntityProcessor(
+				const config::CatapultConfiguration& config,
+				const chain::ExecutionConfiguration& executionConfig,
+				thread::IoThreadPool& pool,
+				const std::shared_ptr<chain::SpeculativeValidationStatistics>& pSpeculativeStatistics) {
+			return config.Node.EnableSpeculativeStatefulValidation
+					? chain::CreateSpeculativeBatchEntityProcessor(executionConfig, pool, pSpeculativeStatistics)
+					: chain::CreateBatchEntityProcessor(executionConfig, pool);
+		}
+
 		BlockchainProcessor CreateSyncProcessor(
 				const model::BlockchainConfiguration& blockchainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::BatchEntityProcessor& batchEntityProcessor,
+				thread::IoThreadPool& stateHashPool) {
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockchainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockchainConfig, [view](const auto& publicKey, auto height) {
@@ -159,11 +183,16 @@ namespace catapult { namespace sync {
 			};
 			return CreateBlockchainProcessor(
 					blockHitPredicateFactory,
-					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockchainConfig));
+					batchEntityProcessor,
+					GetReceiptValidationMode(blockchainConfig),
+					stateHashPool);
 		}
 
-		BlockchainSyncHandlers CreateBlockchainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockchainSyncHandlers CreateBlockchainSyncHandlers(
+				extensions::ServiceState& state,
+				thread::IoThreadPool& stateHashPool,
+				const std::shared_ptr<chain::SpeculativeValidationStatistics>& pSpeculativeStatistics,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockchainConfig = state.config().Blockchain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -187,7 +216,11 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockchainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			auto executionConfig = extensions::CreateExecutionConfiguration(pluginManager);
+			syncHandlers.Processor = CreateSyncProcessor(
+					blockchainConfig,
+					CreateSyncBatchEntityProcessor(state.config(), executionConfig, stateHashPool, pSpeculativeStatistics),
+					stateHashPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -228,28 +261,33 @@ namespace catapult { namespace sync {
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, RollbackInfo& rollbackInfo) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::IoThreadPool& validatorPool,
+					const std::shared_ptr<validators::StatelessValidationStatistics>& pStatistics,
+					const std::shared_ptr<chain::SpeculativeValidationStatistics>& pSpeculativeStatistics,
+					RollbackInfo& rollbackInfo) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(utCache));
 				m_consumers.push_back(CreateBlockchainCheckConsumer(
 						m_state.config().Blockchain.MaxBlockFutureTime,
 						m_state.timeSupplier()));
 				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
+						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager(), pStatistics),
 						requiresValidationPredicate));
 				m_consumers.push_back(CreateBlockBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						CreateRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
 						validatorPool,
-						requiresValidationPredicate));
+						requiresValidationPredicate,
+						m_nodeConfig.BlockStreamingSignatureBatchSize));
 
 				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
 				disruptorConsumers.push_back(CreateBlockchainSyncConsumer(
 						m_state.config().Blockchain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
-						CreateBlockchainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockchainSyncHandlers(m_state, validatorPool, pSpeculativeStatistics, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockchainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -318,10 +356,13 @@ namespace catapult { namespace sync {
 						m_state.hooks().knownHashPredicate(utCache)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, chain::UtUpdater& utUpdater) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::IoThreadPool& validatorPool,
+					const std::shared_ptr<validators::StatelessValidationStatistics>& pStatistics,
+					chain::UtUpdater& utUpdater) {
 				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
+						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager(), pStatistics),
 						failedTransactionSink));
 				m_consumers.push_back(CreateTransactionBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
@@ -421,6 +462,21 @@ namespace catapult { namespace sync {
 			return pRollbackInfo;
 		}
 
+		auto CreateAndRegisterStatelessValidationStatistics(
+				extensions::ServiceLocator& locator,
+				const plugins::PluginManager& pluginManager) {
+			auto validatorNames = pluginManager.createStatelessValidator()->names();
+			auto pStatistics = std::make_shared<validators::StatelessValidationStatistics>(validatorNames);
+			locator.registerRootedService(validators::Stateless_Validation_Statistics_Service_Name, pStatistics);
+			return pStatistics;
+		}
+
+		auto CreateAndRegisterSpeculativeValidationStatistics(extensions::ServiceLocator& locator) {
+			auto pStatistics = std::make_shared<chain::SpeculativeValidationStatistics>();
+			locator.registerRootedService(Speculative_Validation_Statistics_Service_Name, pStatistics);
+			return pStatistics;
+		}
+
 		void AddRollbackCounter(
 				extensions::ServiceLocator& locator,
 				const std::string& counterName,
@@ -446,6 +502,28 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				using validators::StatelessValidationStatistics;
+				constexpr auto Statistics_Service_Name = validators::Stateless_Validation_Statistics_Service_Name;
+				locator.registerServiceCounter<StatelessValidationStatistics>(Statistics_Service_Name, "SV ENT TOT", [](
+						const auto& statistics) {
+					return statistics.numEntities();
+				});
+				locator.registerServiceCounter<StatelessValidationStatistics>(Statistics_Service_Name, "SV ENT RATE", [](
+						const auto& statistics) {
+					return statistics.entitiesPerSecond();
+				});
+
+				using chain::SpeculativeValidationStatistics;
+				constexpr auto Speculative_Service_Name = Speculative_Validation_Statistics_Service_Name;
+				locator.registerServiceCounter<SpeculativeValidationStatistics>(Speculative_Service_Name, "SPEC TOT", [](
+						const auto& statistics) {
+					return statistics.numSpeculativeResults();
+				});
+				locator.registerServiceCounter<SpeculativeValidationStatistics>(Speculative_Service_Name, "SPEC REUSE", [](
+						const auto& statistics) {
+					return statistics.numReusedResults();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -464,10 +542,12 @@ namespace catapult { namespace sync {
 				transactionDispatcherBuilder.addHashConsumers();
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().Blockchain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo);
+				auto pStatistics = CreateAndRegisterStatelessValidationStatistics(locator, state.pluginManager());
+				auto pSpeculativeStatistics = CreateAndRegisterSpeculativeValidationStatistics(locator);
+				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, pStatistics, pSpeculativeStatistics, *pRollbackInfo);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
 
-				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
+				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, pStatistics, utUpdater);
 				RegisterTransactionDispatcherService(pTransactionDispatcher, *pServiceGroup, locator, state);
 			}
 		};
@@ -30,6 +30,7 @@
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -64,6 +65,7 @@ namespace catapult { namespace sync {
 							extensions::CreateLocalFinalizedHeightSupplier(state)),
 					CreateChainSynchronizerConfiguration(config),
 					extensions::CreateLocalFinalizedHeightSupplier(state),
+					[&storage = state.storage()](const auto& hash) { return storage.view().findHeight(hash); },
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
@@ -78,7 +80,10 @@ namespace catapult { namespace sync {
 		}
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
-			auto utSynchronizer = chain::CreateUtSynchronizer(
+			auto createUtSynchronizer = state.config().Node.EnableFilteredTransactionsPull
+					? chain::CreateFilteredUtSynchronizer
+					: chain::CreateUtSynchronizer;
+			auto utSynchronizer = createUtSynchronizer(
 					state.config().Node.MinFeeMultiplier,
 					state.timeSupplier(),
 					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
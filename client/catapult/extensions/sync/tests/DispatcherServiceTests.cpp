@@ -28,6 +28,7 @@
 #include "catapult/model/BlockUtils.h"
 #include "catapult/plugins/PluginLoader.h"
 #include "catapult/preprocessor.h"
+#include "catapult/validators/StatelessValidationStatistics.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -47,14 +48,18 @@ namespace catapult { namespace sync {
 #define TEST_CLASS DispatcherServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 10u;
+		constexpr auto Num_Expected_Services = 7u;
+		constexpr auto Num_Expected_Counters = 22u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
 		constexpr auto Transaction_Elements_Counter_Name = "TX ELEM TOT";
 		constexpr auto Block_Elements_Active_Counter_Name = "BLK ELEM ACT";
 		constexpr auto Transaction_Elements_Active_Counter_Name = "TX ELEM ACT";
+		constexpr auto Stateless_Validation_Entities_Counter_Name = "SV ENT TOT";
+		constexpr auto Stateless_Validation_Entity_Rate_Counter_Name = "SV ENT RATE";
+		constexpr auto Speculative_Validation_Results_Counter_Name = "SPEC TOT";
+		constexpr auto Speculative_Validation_Reused_Results_Counter_Name = "SPEC REUSE";
 		constexpr auto Rollback_Elements_Committed_All = "RB COMMIT ALL";
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
@@ -353,6 +358,8 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
+		EXPECT_TRUE(!!context.locator().service<void>(validators::Stateless_Validation_Statistics_Service_Name));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.speculativeValidation"));
 
 		// - all counters should be zero
 		EXPECT_EQ(0u, context.counter(Block_Elements_Counter_Name));
@@ -363,6 +370,10 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Stateless_Validation_Entities_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Stateless_Validation_Entity_Rate_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Speculative_Validation_Results_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Speculative_Validation_Reused_Results_Counter_Name));
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -435,6 +446,8 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
+		EXPECT_TRUE(!!context.locator().service<void>(validators::Stateless_Validation_Statistics_Service_Name));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.speculativeValidation"));
 
 		// - all counters should indicate shutdown
 		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Block_Elements_Counter_Name));
@@ -445,6 +458,10 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Stateless_Validation_Entities_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Stateless_Validation_Entity_Rate_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Speculative_Validation_Results_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Speculative_Validation_Reused_Results_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, TasksAreRegistered) {
@@ -1192,6 +1209,9 @@ namespace catapult { namespace sync {
 			EXPECT_EQ(0u, context.numNewBlockSinkCalls());
 			EXPECT_EQ(1u, context.numNewTransactionsSinkCalls());
 			EXPECT_EQ(0u, context.numTransactionStatuses());
+
+			// - the transaction was statelessly validated
+			EXPECT_EQ(1u, context.counter(Stateless_Validation_Entities_Counter_Name));
 		});
 	}
 
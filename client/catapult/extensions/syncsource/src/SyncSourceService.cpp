@@ -38,6 +38,7 @@ namespace catapult { namespace syncsource {
 			handlers::BlockRangeHandler PushBlockCallback;
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::UtRetriever UtRetriever;
+			handlers::FilteredUtRetriever FilteredUtRetriever;
 		};
 
 		void SetConfig(handlers::PullBlocksHandlerConfiguration& blocksHandlerConfig, const config::NodeConfiguration& nodeConfig) {
@@ -59,6 +60,9 @@ namespace catapult { namespace syncsource {
 			config.UtRetriever = [&cache = state.utCache()](auto minDeadline, auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minDeadline, minFeeMultiplier, shortHashes);
 			};
+			config.FilteredUtRetriever = [&cache = state.utCache()](auto minDeadline, auto minFeeMultiplier, const auto& filter) {
+				return cache.view().filteredUnknownTransactions(minDeadline, minFeeMultiplier, filter);
+			};
 
 			return config;
 		}
@@ -81,6 +85,7 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullFilteredTransactionsHandler(handlers, config.FilteredUtRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -29,12 +29,14 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/AccountStateCacheStorage.h"
 #include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "catapult/cache_core/AccountStatePrefetcher.h"
 #include "catapult/cache_core/BlockStatisticCacheStorage.h"
 #include "catapult/cache_core/BlockStatisticCacheSubCachePlugin.h"
 #include "catapult/keylink/KeyLinkObserver.h"
 #include "catapult/keylink/KeyLinkValidator.h"
 #include "catapult/keylink/MultiKeyLinkObserver.h"
 #include "catapult/keylink/MultiKeyLinkValidator.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/plugins/CacheHandlers.h"
 #include "catapult/plugins/PluginManager.h"
@@ -74,6 +76,17 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("ACNTST C HVA"), [&cache]() {
 					return cache.sub<AccountStateCache>().createView()->highValueAccounts().addresses().size();
 				});
+				counters.emplace_back(utils::DiagnosticCounterId("ACNTST PT HIT"), [&cache]() {
+					return cache.sub<AccountStateCache>().createView()->patriciaTreeNodeCacheStatistics().NumHits;
+				});
+				counters.emplace_back(utils::DiagnosticCounterId("ACNTST PT MIS"), [&cache]() {
+					return cache.sub<AccountStateCache>().createView()->patriciaTreeNodeCacheStatistics().NumMisses;
+				});
+			});
+
+			auto networkIdentifier = config.Network.Identifier;
+			manager.addSubCachePrefetcherFactory([networkIdentifier]() {
+				return std::make_unique<AccountStatePrefetcher>(networkIdentifier);
 			});
 		}
 
@@ -133,6 +146,19 @@ namespace catapult { namespace plugins {
 			}
 		};
 
+		template<typename TNotification>
+		void AddKeyLinkNotificationAccessHook(PluginManager& manager) {
+			manager.addNotificationAccessHook([](auto& extractor) {
+				auto networkIdentifier = extractor.networkIdentifier();
+				extractor.template add<TNotification>([networkIdentifier](const auto& notification, const auto&, auto& access) {
+					// links are stored in the main account state
+					auto mainAccountAddress = model::PublicKeyToAddress(notification.MainAccountPublicKey, networkIdentifier);
+					access.Reads.Addresses.push_back(mainAccountAddress);
+					access.Writes.Addresses.push_back(mainAccountAddress);
+				});
+			});
+		}
+
 		void RegisterVrfKeyLinkTransaction(PluginManager& manager) {
 			manager.addTransactionSupport(CreateVrfKeyLinkTransactionPlugin());
 
@@ -143,6 +169,8 @@ namespace catapult { namespace plugins {
 			manager.addObserverHook([](auto& builder) {
 				builder.add(keylink::CreateKeyLinkObserver<model::VrfKeyLinkNotification, VrfKeyAccessor>("Vrf"));
 			});
+
+			AddKeyLinkNotificationAccessHook<model::VrfKeyLinkNotification>(manager);
 		}
 
 		void RegisterVotingKeyLinkTransaction(PluginManager& manager) {
@@ -163,6 +191,8 @@ namespace catapult { namespace plugins {
 			manager.addObserverHook([](auto& builder) {
 				builder.add(keylink::CreateMultiKeyLinkObserver<model::VotingKeyLinkNotification, VotingKeyAccessor>("Voting"));
 			});
+
+			AddKeyLinkNotificationAccessHook<model::VotingKeyLinkNotification>(manager);
 		}
 
 		// endregion
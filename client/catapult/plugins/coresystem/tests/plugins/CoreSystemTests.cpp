@@ -49,7 +49,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Account_State_Path };
+				return { ionet::PacketType::Account_State_Path, ionet::PacketType::Account_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
@@ -57,7 +57,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "ACNTST C", "ACNTST C HVA", "BLKDIF C" };
+				return { "ACNTST C", "ACNTST C HVA", "ACNTST PT HIT", "ACNTST PT MIS", "BLKDIF C" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -26,6 +26,7 @@
 #include "src/observers/Observers.h"
 #include "src/plugins/HashLockTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
 #include "catapult/plugins/CacheHandlers.h"
 #include "catapult/plugins/PluginManager.h"
 
@@ -69,6 +70,14 @@ namespace catapult { namespace plugins {
 				.add(observers::CreateExpiredHashLockInfoObserver())
 				.add(observers::CreateCompletedAggregateObserver());
 		});
+
+		manager.addNotificationAccessHook([](auto& extractor) {
+			extractor.template add<model::TransactionNotification>([](const auto& notification, const auto&, auto& access) {
+				// completing an aggregate credits the (unknown) lock owner
+				if (model::Entity_Type_Aggregate_Bonded == notification.TransactionType)
+					access.IsUnknown = true;
+			});
+		});
 	}
 }}
 
@@ -54,6 +54,7 @@ namespace catapult { namespace cache {
 			, MosaicCacheDeltaMixins::BasicInsertRemove(*mosaicSets.pPrimary)
 			, MosaicCacheDeltaMixins::Touch(*mosaicSets.pPrimary, *mosaicSets.pHeightGrouping)
 			, MosaicCacheDeltaMixins::DeltaElements(*mosaicSets.pPrimary)
+			, MosaicCacheDeltaMixins::Prefetch(*mosaicSets.pPrimary)
 			, m_pEntryById(mosaicSets.pPrimary)
 			, m_pMosaicIdsByExpiryHeight(mosaicSets.pHeightGrouping)
 	{}
@@ -48,7 +48,8 @@ namespace catapult { namespace cache {
 			, public MosaicCacheDeltaMixins::ActivePredicate
 			, public MosaicCacheDeltaMixins::BasicInsertRemove
 			, public MosaicCacheDeltaMixins::Touch
-			, public MosaicCacheDeltaMixins::DeltaElements {
+			, public MosaicCacheDeltaMixins::DeltaElements
+			, public MosaicCacheDeltaMixins::Prefetch {
 	public:
 		using ReadOnlyView = MosaicCacheTypes::CacheReadOnlyType;
 
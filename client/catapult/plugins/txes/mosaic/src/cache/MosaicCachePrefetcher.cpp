@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MosaicCachePrefetcher.h"
+#include "src/model/MosaicNotifications.h"
+#include "catapult/model/ResolverContext.h"
+
+namespace catapult { namespace cache {
+
+	void MosaicCachePrefetcher::notify(const model::Notification& notification) {
+		switch (notification.Type) {
+		case model::Core_Balance_Transfer_Notification:
+			addMosaicId(static_cast<const model::BalanceTransferNotification&>(notification).MosaicId);
+			break;
+
+		case model::Core_Balance_Debit_Notification:
+			addMosaicId(static_cast<const model::BalanceDebitNotification&>(notification).MosaicId);
+			break;
+
+		case model::Core_Mosaic_Required_Notification:
+			addMosaicId(static_cast<const model::MosaicRequiredNotification&>(notification).MosaicId);
+			break;
+
+		case model::Mosaic_Definition_Notification:
+			add(static_cast<const model::MosaicDefinitionNotification&>(notification).MosaicId);
+			break;
+
+		case model::Mosaic_Supply_Change_Notification:
+			addMosaicId(static_cast<const model::MosaicSupplyChangeNotification&>(notification).MosaicId);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void MosaicCachePrefetcher::addMosaicId(const model::ResolvableMosaicId& mosaicId) {
+		if (mosaicId.isResolved()) {
+			add(mosaicId.resolved());
+			return;
+		}
+
+		// aliases can only be resolved during execution, so they are not prefetched
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+		auto unresolvedMosaicId = mosaicId.unresolved();
+		if (0 == (Namespace_Flag & unresolvedMosaicId.unwrap()))
+			add(model::ResolverContext().resolve(unresolvedMosaicId));
+	}
+}}
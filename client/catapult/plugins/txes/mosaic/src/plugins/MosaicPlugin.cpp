@@ -24,6 +24,7 @@
 #include "MosaicSupplyChangeTransactionPlugin.h"
 #include "MosaicSupplyRevocationTransactionPlugin.h"
 #include "src/cache/MosaicCache.h"
+#include "src/cache/MosaicCachePrefetcher.h"
 #include "src/cache/MosaicCacheStorage.h"
 #include "src/config/MosaicConfiguration.h"
 #include "src/model/MosaicReceiptType.h"
@@ -73,6 +74,10 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("MOSAIC C"), [&cache]() { return GetMosaicView(cache)->size(); });
 		});
 
+		manager.addSubCachePrefetcherFactory([]() {
+			return std::make_unique<cache::MosaicCachePrefetcher>();
+		});
+
 		manager.addStatelessValidatorHook([](auto& builder) {
 			builder
 				.add(validators::CreateMosaicIdValidator())
@@ -0,0 +1,180 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/MosaicCachePrefetcher.h"
+#include "src/model/MosaicNotifications.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS MosaicCachePrefetcherTests
+
+	namespace {
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+
+		auto CreateBalanceTransferNotification(UnresolvedMosaicId mosaicId) {
+			return model::BalanceTransferNotification(
+					test::GenerateRandomAddress(),
+					test::GenerateRandomUnresolvedAddress(),
+					mosaicId,
+					Amount(100));
+		}
+
+		auto CreateBalanceDebitNotification(UnresolvedMosaicId mosaicId) {
+			return model::BalanceDebitNotification(test::GenerateRandomAddress(), mosaicId, Amount(100));
+		}
+
+		auto CreateMosaicSupplyChangeNotification(UnresolvedMosaicId mosaicId) {
+			return model::MosaicSupplyChangeNotification(
+					test::GenerateRandomAddress(),
+					mosaicId,
+					model::MosaicSupplyChangeAction::Increase,
+					Amount(100));
+		}
+
+		auto CreateMosaicRequiredNotification(UnresolvedMosaicId mosaicId) {
+			return model::MosaicRequiredNotification(test::GenerateRandomAddress(), mosaicId);
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherInitiallyHasNoKeys) {
+		// Act:
+		MosaicCachePrefetcher prefetcher;
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	// region unresolved mosaic id notifications
+
+#define UNRESOLVED_NOTIFICATION_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_BalanceTransfer) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BalanceTransferTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BalanceDebit) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BalanceDebitTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MosaicSupplyChange) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<MosaicSupplyChangeTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MosaicRequired) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<MosaicRequiredTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	namespace {
+		struct BalanceTransferTraits {
+			static auto Create(UnresolvedMosaicId mosaicId) {
+				return CreateBalanceTransferNotification(mosaicId);
+			}
+		};
+
+		struct BalanceDebitTraits {
+			static auto Create(UnresolvedMosaicId mosaicId) {
+				return CreateBalanceDebitNotification(mosaicId);
+			}
+		};
+
+		struct MosaicSupplyChangeTraits {
+			static auto Create(UnresolvedMosaicId mosaicId) {
+				return CreateMosaicSupplyChangeNotification(mosaicId);
+			}
+		};
+
+		struct MosaicRequiredTraits {
+			static auto Create(UnresolvedMosaicId mosaicId) {
+				return CreateMosaicRequiredNotification(mosaicId);
+			}
+		};
+	}
+
+	UNRESOLVED_NOTIFICATION_TEST(PrefetcherCollectsMosaicIdsThatAreNotAliases) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+
+		// Act:
+		prefetcher.notify(TTraits::Create(UnresolvedMosaicId(0x1234'5678'9ABC'DEF0)));
+
+		// Assert:
+		EXPECT_EQ(MosaicCachePrefetcher::KeySet({ MosaicId(0x1234'5678'9ABC'DEF0) }), prefetcher.keys());
+	}
+
+	UNRESOLVED_NOTIFICATION_TEST(PrefetcherIgnoresMosaicIdsThatAreAliases) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+
+		// Act:
+		prefetcher.notify(TTraits::Create(UnresolvedMosaicId(0x1234'5678'9ABC'DEF0 | Namespace_Flag)));
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	// endregion
+
+	// region other notifications
+
+	TEST(TEST_CLASS, PrefetcherCollectsResolvedMosaicIdsFromMosaicRequiredNotifications) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+		auto mosaicId = MosaicId(0x1234'5678'9ABC'DEF0 | Namespace_Flag);
+
+		// Act:
+		prefetcher.notify(model::MosaicRequiredNotification(test::GenerateRandomAddress(), mosaicId));
+
+		// Assert: resolved mosaic ids are always collected
+		EXPECT_EQ(MosaicCachePrefetcher::KeySet({ mosaicId }), prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsMosaicIdsFromMosaicDefinitionNotifications) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+
+		// Act:
+		prefetcher.notify(model::MosaicDefinitionNotification(test::GenerateRandomAddress(), MosaicId(123), model::MosaicProperties()));
+
+		// Assert:
+		EXPECT_EQ(MosaicCachePrefetcher::KeySet({ MosaicId(123) }), prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, PrefetcherIgnoresOtherNotifications) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+
+		// Act:
+		prefetcher.notify(model::AccountAddressNotification(test::GenerateRandomAddress()));
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsUniqueMosaicIdsFromMultipleNotifications) {
+		// Arrange:
+		MosaicCachePrefetcher prefetcher;
+
+		// Act:
+		prefetcher.notify(CreateBalanceTransferNotification(UnresolvedMosaicId(111)));
+		prefetcher.notify(CreateBalanceDebitNotification(UnresolvedMosaicId(222)));
+		prefetcher.notify(CreateBalanceTransferNotification(UnresolvedMosaicId(111)));
+		prefetcher.notify(CreateMosaicSupplyChangeNotification(UnresolvedMosaicId(333 | Namespace_Flag)));
+		prefetcher.notify(model::MosaicDefinitionNotification(test::GenerateRandomAddress(), MosaicId(222), model::MosaicProperties()));
+		prefetcher.notify(CreateMosaicRequiredNotification(UnresolvedMosaicId(444)));
+
+		// Assert:
+		EXPECT_EQ(MosaicCachePrefetcher::KeySet({ MosaicId(111), MosaicId(222), MosaicId(444) }), prefetcher.keys());
+	}
+
+	// endregion
+}}
@@ -62,6 +62,11 @@ namespace catapult { namespace cache {
 		return m_gracePeriodDuration;
 	}
 
+	void BasicNamespaceCacheDelta::prefetch(const std::vector<NamespaceId>& ids) const {
+		m_pHistoryById->prefetch(ids);
+		m_pNamespaceById->prefetch(ids);
+	}
+
 	void BasicNamespaceCacheDelta::insert(const state::RootNamespace& ns) {
 		// register the namespace for expiration at the end of its lifetime (if its lifetime changes later, it will not be pruned)
 		AddIdentifierWithGroup(*m_pRootNamespaceIdsByExpiryHeight, ns.lifetime().End, ns.id());
@@ -75,6 +75,10 @@ namespace catapult { namespace cache {
 		/// Gets the grace period duration.
 		BlockDuration gracePeriodDuration() const;
 
+		/// Prefetches all root namespace histories and namespaces identified by \a ids.
+		/// \note This only has an effect when the cache is backed by a database.
+		void prefetch(const std::vector<NamespaceId>& ids) const;
+
 	public:
 		/// Inserts the root namespace \a ns into the cache.
 		void insert(const state::RootNamespace& ns);
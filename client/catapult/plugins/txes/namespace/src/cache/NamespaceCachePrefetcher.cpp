@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NamespaceCachePrefetcher.h"
+#include "src/model/AliasNotifications.h"
+#include "src/model/NamespaceNotifications.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	void NamespaceCachePrefetcher::notify(const model::Notification& notification) {
+		switch (notification.Type) {
+		case model::Core_Register_Account_Address_Notification:
+			addAlias(static_cast<const model::AccountAddressNotification&>(notification).Address);
+			break;
+
+		case model::Core_Balance_Transfer_Notification:
+			addBalanceAliases(static_cast<const model::BalanceTransferNotification&>(notification));
+			break;
+
+		case model::Core_Balance_Debit_Notification:
+			addBalanceAliases(static_cast<const model::BalanceDebitNotification&>(notification));
+			break;
+
+		case model::Core_Mosaic_Required_Notification:
+			addAlias(static_cast<const model::MosaicRequiredNotification&>(notification).MosaicId);
+			break;
+
+		case model::Namespace_Root_Registration_Notification:
+			add(static_cast<const model::RootNamespaceNotification&>(notification).NamespaceId);
+			break;
+
+		case model::Namespace_Child_Registration_Notification: {
+			const auto& childNotification = static_cast<const model::ChildNamespaceNotification&>(notification);
+			add(childNotification.NamespaceId);
+			add(childNotification.ParentId);
+			break;
+		}
+
+		case model::Namespace_Required_Notification:
+			add(static_cast<const model::NamespaceRequiredNotification&>(notification).NamespaceId);
+			break;
+
+		case model::Namespace_Alias_Link_Notification:
+		case model::Namespace_Aliased_Address_Notification:
+		case model::Namespace_Aliased_MosaicId_Notification:
+			add(static_cast<const model::BaseAliasNotification&>(notification).NamespaceId);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	template<typename TNotification>
+	void NamespaceCachePrefetcher::addBalanceAliases(const TNotification& notification) {
+		addAlias(notification.Sender);
+		addAlias(notification.MosaicId);
+
+		if constexpr (std::is_same_v<model::BalanceTransferNotification, TNotification>)
+			addAlias(notification.Recipient);
+	}
+
+	void NamespaceCachePrefetcher::addAlias(const model::ResolvableAddress& address) {
+		if (address.isResolved())
+			return;
+
+		auto unresolvedAddress = address.unresolved();
+		if (0 == (1 & unresolvedAddress[0]))
+			return;
+
+		NamespaceId namespaceId;
+		std::memcpy(static_cast<void*>(&namespaceId), unresolvedAddress.data() + 1, sizeof(NamespaceId));
+		add(namespaceId);
+	}
+
+	void NamespaceCachePrefetcher::addAlias(const model::ResolvableMosaicId& mosaicId) {
+		if (mosaicId.isResolved())
+			return;
+
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+		auto unresolvedMosaicId = mosaicId.unresolved();
+		if (0 != (Namespace_Flag & unresolvedMosaicId.unwrap()))
+			add(NamespaceId(unresolvedMosaicId.unwrap()));
+	}
+}}
@@ -24,6 +24,7 @@
 #include "MosaicAliasTransactionPlugin.h"
 #include "NamespaceRegistrationTransactionPlugin.h"
 #include "src/cache/NamespaceCache.h"
+#include "src/cache/NamespaceCachePrefetcher.h"
 #include "src/cache/NamespaceCacheStorage.h"
 #include "src/cache/NamespaceCacheSubCachePlugin.h"
 #include "src/config/NamespaceConfiguration.h"
@@ -167,6 +168,10 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C DS"), [&cache]() { return GetNamespaceView(cache)->deepSize(); });
 			});
 
+			manager.addSubCachePrefetcherFactory([]() {
+				return std::make_unique<cache::NamespaceCachePrefetcher>();
+			});
+
 			manager.addStatelessValidatorHook([config, minDuration, maxDuration](auto& builder) {
 				builder
 					.add(validators::CreateNamespaceRegistrationTypeValidator())
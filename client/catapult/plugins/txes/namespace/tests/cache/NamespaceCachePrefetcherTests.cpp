@@ -0,0 +1,180 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/NamespaceCachePrefetcher.h"
+#include "src/model/AliasNotifications.h"
+#include "src/model/NamespaceNotifications.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS NamespaceCachePrefetcherTests
+
+	namespace {
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+
+		UnresolvedAddress CreateAliasAddress(NamespaceId namespaceId) {
+			UnresolvedAddress unresolvedAddress{};
+			unresolvedAddress[0] = 1;
+			std::memcpy(unresolvedAddress.data() + 1, &namespaceId, sizeof(NamespaceId));
+			return unresolvedAddress;
+		}
+
+		UnresolvedAddress CreateNonAliasAddress() {
+			auto unresolvedAddress = test::GenerateRandomUnresolvedAddress();
+			unresolvedAddress[0] = static_cast<uint8_t>(unresolvedAddress[0] & 0xFE);
+			return unresolvedAddress;
+		}
+
+		UnresolvedMosaicId CreateAliasMosaicId(NamespaceId namespaceId) {
+			return UnresolvedMosaicId(namespaceId.unwrap());
+		}
+
+		void AssertCollectedNamespaceIds(
+				const std::vector<NamespaceId>& expectedNamespaceIds,
+				const consumer<NamespaceCachePrefetcher&>& notify) {
+			// Arrange:
+			NamespaceCachePrefetcher prefetcher;
+
+			// Act:
+			notify(prefetcher);
+
+			// Assert:
+			NamespaceCachePrefetcher::KeySet expectedKeys(expectedNamespaceIds.cbegin(), expectedNamespaceIds.cend());
+			EXPECT_EQ(expectedKeys, prefetcher.keys());
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherInitiallyHasNoKeys) {
+		// Act:
+		NamespaceCachePrefetcher prefetcher;
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	// region namespace notifications
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromRootNamespaceNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123) }, [](auto& prefetcher) {
+			prefetcher.notify(model::RootNamespaceNotification(test::GenerateRandomAddress(), NamespaceId(123), BlockDuration(10)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceAndParentIdsFromChildNamespaceNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123), NamespaceId(234) }, [](auto& prefetcher) {
+			prefetcher.notify(model::ChildNamespaceNotification(test::GenerateRandomAddress(), NamespaceId(123), NamespaceId(234)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromNamespaceRequiredNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123) }, [](auto& prefetcher) {
+			prefetcher.notify(model::NamespaceRequiredNotification(test::GenerateRandomAddress(), NamespaceId(123)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromAliasNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123), NamespaceId(234), NamespaceId(345) }, [](auto& prefetcher) {
+			prefetcher.notify(model::AliasLinkNotification(NamespaceId(123), model::AliasAction::Link));
+			prefetcher.notify(model::AliasedAddressNotification(NamespaceId(234), model::AliasAction::Link, test::GenerateRandomAddress()));
+			prefetcher.notify(model::AliasedMosaicIdNotification(NamespaceId(345), model::AliasAction::Unlink, MosaicId(111)));
+		});
+	}
+
+	// endregion
+
+	// region aliased address and mosaic notifications
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromAliasedAccountAddresses) {
+		AssertCollectedNamespaceIds({ NamespaceId(123) }, [](auto& prefetcher) {
+			prefetcher.notify(model::AccountAddressNotification(CreateAliasAddress(NamespaceId(123))));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherIgnoresAccountAddressesThatAreNotAliases) {
+		AssertCollectedNamespaceIds({}, [](auto& prefetcher) {
+			prefetcher.notify(model::AccountAddressNotification(CreateNonAliasAddress()));
+			prefetcher.notify(model::AccountAddressNotification(test::GenerateRandomAddress()));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromAliasesInBalanceTransferNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123 | Namespace_Flag), NamespaceId(234) }, [](auto& prefetcher) {
+			prefetcher.notify(model::BalanceTransferNotification(
+					test::GenerateRandomAddress(),
+					CreateAliasAddress(NamespaceId(234)),
+					CreateAliasMosaicId(NamespaceId(123 | Namespace_Flag)),
+					Amount(100)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromAliasesInBalanceDebitNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123 | Namespace_Flag), NamespaceId(234) }, [](auto& prefetcher) {
+			prefetcher.notify(model::BalanceDebitNotification(
+					CreateAliasAddress(NamespaceId(234)),
+					CreateAliasMosaicId(NamespaceId(123 | Namespace_Flag)),
+					Amount(100)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherIgnoresBalanceNotificationsWithoutAliases) {
+		AssertCollectedNamespaceIds({}, [](auto& prefetcher) {
+			prefetcher.notify(model::BalanceTransferNotification(
+					test::GenerateRandomAddress(),
+					CreateNonAliasAddress(),
+					UnresolvedMosaicId(123),
+					Amount(100)));
+			prefetcher.notify(model::BalanceDebitNotification(test::GenerateRandomAddress(), UnresolvedMosaicId(234), Amount(100)));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsNamespaceIdsFromAliasesInMosaicRequiredNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123 | Namespace_Flag) }, [](auto& prefetcher) {
+			prefetcher.notify(model::MosaicRequiredNotification(
+					test::GenerateRandomAddress(),
+					CreateAliasMosaicId(NamespaceId(123 | Namespace_Flag))));
+			prefetcher.notify(model::MosaicRequiredNotification(test::GenerateRandomAddress(), MosaicId(234 | Namespace_Flag)));
+		});
+	}
+
+	// endregion
+
+	// region other
+
+	TEST(TEST_CLASS, PrefetcherIgnoresOtherNotifications) {
+		AssertCollectedNamespaceIds({}, [](auto& prefetcher) {
+			prefetcher.notify(model::AccountPublicKeyNotification(test::GenerateRandomByteArray<Key>()));
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsUniqueNamespaceIdsFromMultipleNotifications) {
+		AssertCollectedNamespaceIds({ NamespaceId(123), NamespaceId(234), NamespaceId(345) }, [](auto& prefetcher) {
+			prefetcher.notify(model::RootNamespaceNotification(test::GenerateRandomAddress(), NamespaceId(123), BlockDuration(10)));
+			prefetcher.notify(model::ChildNamespaceNotification(test::GenerateRandomAddress(), NamespaceId(234), NamespaceId(123)));
+			prefetcher.notify(model::AccountAddressNotification(CreateAliasAddress(NamespaceId(345))));
+			prefetcher.notify(model::AccountAddressNotification(CreateAliasAddress(NamespaceId(123))));
+		});
+	}
+
+	// endregion
+}}
@@ -61,7 +61,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Mosaic_Restrictions_State_Path };
+				return { ionet::PacketType::Mosaic_Restrictions_State_Path, ionet::PacketType::Mosaic_Restrictions_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
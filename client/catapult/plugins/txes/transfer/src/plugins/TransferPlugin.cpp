@@ -22,6 +22,7 @@
 #include "TransferPlugin.h"
 #include "TransferTransactionPlugin.h"
 #include "src/config/TransferConfiguration.h"
+#include "src/model/TransferNotifications.h"
 #include "src/observers/Observers.h"
 #include "src/validators/Validators.h"
 #include "catapult/config/CatapultDataDirectory.h"
@@ -41,6 +42,13 @@ namespace catapult { namespace plugins {
 			builder.add(validators::CreateTransferMosaicsValidator());
 		});
 
+		manager.addNotificationAccessHook([](auto& extractor) {
+			// neither message nor mosaics notifications are validated or observed against cache state
+			auto noAccess = [](const auto&, const auto&, const auto&) {};
+			extractor.add(model::TransferMessageNotification::Notification_Type, noAccess);
+			extractor.add(model::TransferMosaicsNotification::Notification_Type, noAccess);
+		});
+
 		if (!manager.userConfig().EnableDelegatedHarvestersAutoDetection)
 			return;
 
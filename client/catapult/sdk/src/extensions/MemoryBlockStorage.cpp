@@ -105,6 +105,7 @@ namespace catapult { namespace extensions {
 		m_blockElements[height] = Copy(*m_blocks[height], blockElement);
 		m_blockStatements[height] = m_blockElements[height]->OptionalStatement;
 		m_blockElements[height]->OptionalStatement.reset();
+		m_hashHeights[blockElement.EntityHash] = height;
 
 		m_height = std::max(m_height, height);
 	}
@@ -126,6 +127,15 @@ namespace catapult { namespace extensions {
 		}
 	}
 
+	Height MemoryBlockStorage::findHeight(const Hash256& hash) const {
+		// dropped blocks are not removed, so check that the block at the indexed height still has a matching hash
+		auto iter = m_hashHeights.find(hash);
+		if (m_hashHeights.cend() == iter || iter->second > m_height || hash != m_blockElements.find(iter->second)->second->EntityHash)
+			return Height(0);
+
+		return iter->second;
+	}
+
 	std::shared_ptr<const model::Block> MemoryBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
 		auto iter = m_blocks.find(height);
@@ -183,6 +193,7 @@ namespace catapult { namespace extensions {
 		m_blocks.clear();
 		m_blockElements.clear();
 		m_blockStatements.clear();
+		m_hashHeights.clear();
 		m_height = Height(0);
 	}
 
@@ -22,7 +22,9 @@
 #pragma once
 #include "catapult/io/BlockStorage.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include <map>
+#include <unordered_map>
 
 namespace catapult { namespace extensions {
 
@@ -32,6 +34,7 @@ namespace catapult { namespace extensions {
 		using Blocks = std::map<Height, std::shared_ptr<model::Block>>;
 		using BlockElements = std::map<Height, std::shared_ptr<model::BlockElement>>;
 		using BlockStatements = std::map<Height, std::shared_ptr<const model::BlockStatement>>;
+		using HashHeights = std::unordered_map<Hash256, Height, utils::ArrayHasher<Hash256>>;
 
 	public:
 		/// Creates a memory-based block storage around \a nemesisBlockElement.
@@ -45,6 +48,7 @@ namespace catapult { namespace extensions {
 		void dropBlocksAfter(Height height) override;
 
 		// BlockStorage
+		Height findHeight(const Hash256& hash) const override;
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
@@ -59,6 +63,7 @@ namespace catapult { namespace extensions {
 		Blocks m_blocks;
 		BlockElements m_blockElements;
 		BlockStatements m_blockStatements;
+		HashHeights m_hashHeights;
 		Height m_height;
 	};
 }}
@@ -65,6 +65,44 @@ namespace catapult { namespace extensions {
 			}
 		};
 
+		struct ExecutionProfileTraits {
+		public:
+			using ResultType = model::EntityRange<model::ExecutionProfileEntry>;
+			static constexpr auto Packet_Type = ionet::PacketType::Execution_Profile;
+			static constexpr auto Friendly_Name = "execution profile";
+
+			static auto CreateRequestPacketPayload() {
+				return ionet::PacketPayload(Packet_Type);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractEntitiesFromPacket<model::ExecutionProfileEntry>(
+						packet,
+						model::IsSizeValidT<model::ExecutionProfileEntry>);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
+		struct DispatcherLatenciesTraits {
+		public:
+			using ResultType = model::EntityRange<model::DispatcherLatencyEntry>;
+			static constexpr auto Packet_Type = ionet::PacketType::Dispatcher_Latencies;
+			static constexpr auto Friendly_Name = "dispatcher latencies";
+
+			static auto CreateRequestPacketPayload() {
+				return ionet::PacketPayload(Packet_Type);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractEntitiesFromPacket<model::DispatcherLatencyEntry>(
+						packet,
+						model::IsSizeValidT<model::DispatcherLatencyEntry>);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		struct ActiveNodeInfosTraits {
 		public:
 			using ResultType = model::EntityRange<ionet::PackedNodeInfo>;
@@ -159,6 +197,14 @@ namespace catapult { namespace extensions {
 				return m_impl.dispatch(DiagnosticCountersTraits());
 			}
 
+			FutureType<ExecutionProfileTraits> executionProfile() const override {
+				return m_impl.dispatch(ExecutionProfileTraits());
+			}
+
+			FutureType<DispatcherLatenciesTraits> dispatcherLatencies() const override {
+				return m_impl.dispatch(DispatcherLatenciesTraits());
+			}
+
 			FutureType<ActiveNodeInfosTraits> activeNodeInfos() const override {
 				return m_impl.dispatch(ActiveNodeInfosTraits());
 			}
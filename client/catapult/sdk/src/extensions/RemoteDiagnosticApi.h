@@ -25,6 +25,8 @@
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/CacheEntryInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DispatcherLatencyEntry.h"
+#include "catapult/model/ExecutionProfileEntry.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/state/TimestampedHash.h"
 #include "catapult/thread/Future.h"
@@ -49,6 +51,12 @@ namespace catapult { namespace extensions {
 		/// Gets the current diagnostic counter values.
 		virtual future<model::EntityRange<model::DiagnosticCounterValue>> diagnosticCounters() const = 0;
 
+		/// Gets the validator and observer execution profile entries.
+		virtual future<model::EntityRange<model::ExecutionProfileEntry>> executionProfile() const = 0;
+
+		/// Gets the consumer dispatcher latency entries.
+		virtual future<model::EntityRange<model::DispatcherLatencyEntry>> dispatcherLatencies() const = 0;
+
 		/// Gets the node infos for all active nodes
 		virtual future<model::EntityRange<ionet::PackedNodeInfo>> activeNodeInfos() const = 0;
 
@@ -196,6 +196,128 @@ namespace catapult { namespace extensions {
 
 		// endregion
 
+		// region ExecutionProfileTraits
+
+		struct ExecutionProfileTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Execution_Profile;
+			static constexpr auto Name_Size = 5u;
+			static constexpr auto Response_Entity_Size = sizeof(model::ExecutionProfileEntry) + Name_Size;
+			static constexpr auto Num_Entries = 3u;
+
+			static auto Invoke(const RemoteDiagnosticApi& api) {
+				return api.executionProfile();
+			}
+
+			static auto CreateValidResponsePacket() {
+				uint32_t payloadSize = Num_Entries * Response_Entity_Size;
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = Packet_Type;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+
+				// set sizes appropriately
+				auto* pData = pResponsePacket->Data();
+				for (auto i = 0u; i < Num_Entries; ++i) {
+					auto& entry = reinterpret_cast<model::ExecutionProfileEntry&>(*pData);
+					entry.Size = Response_Entity_Size;
+					entry.NameSize = Name_Size;
+					pData += Response_Entity_Size;
+				}
+
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// just change the size because no responses are intrinsically invalid
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_TRUE(ionet::IsPacketValid(packet, Packet_Type));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::EntityRange<model::ExecutionProfileEntry>& entries) {
+				ASSERT_EQ(static_cast<uint32_t>(Num_Entries), entries.size());
+
+				auto iter = entries.cbegin();
+				const auto* pResponseData = response.Data();
+				for (auto i = 0u; i < Num_Entries; ++i) {
+					auto message = "execution profile entry at " + std::to_string(i);
+
+					// Assert: check the entry size then the memory
+					ASSERT_EQ(Response_Entity_Size, iter->Size) << message;
+					EXPECT_EQ_MEMORY(pResponseData, &*iter, iter->Size) << message;
+
+					pResponseData += Response_Entity_Size;
+					++iter;
+				}
+			}
+		};
+
+		// endregion
+
+		// region DispatcherLatenciesTraits
+
+		struct DispatcherLatenciesTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Dispatcher_Latencies;
+			static constexpr auto Name_Size = 7u;
+			static constexpr auto Response_Entity_Size = sizeof(model::DispatcherLatencyEntry) + Name_Size;
+			static constexpr auto Num_Entries = 3u;
+
+			static auto Invoke(const RemoteDiagnosticApi& api) {
+				return api.dispatcherLatencies();
+			}
+
+			static auto CreateValidResponsePacket() {
+				uint32_t payloadSize = Num_Entries * Response_Entity_Size;
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = Packet_Type;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+
+				// set sizes appropriately
+				auto* pData = pResponsePacket->Data();
+				for (auto i = 0u; i < Num_Entries; ++i) {
+					auto& entry = reinterpret_cast<model::DispatcherLatencyEntry&>(*pData);
+					entry.Size = Response_Entity_Size;
+					entry.NameSize = Name_Size;
+					pData += Response_Entity_Size;
+				}
+
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// just change the size because no responses are intrinsically invalid
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_TRUE(ionet::IsPacketValid(packet, Packet_Type));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::EntityRange<model::DispatcherLatencyEntry>& entries) {
+				ASSERT_EQ(static_cast<uint32_t>(Num_Entries), entries.size());
+
+				auto iter = entries.cbegin();
+				const auto* pResponseData = response.Data();
+				for (auto i = 0u; i < Num_Entries; ++i) {
+					auto message = "dispatcher latency entry at " + std::to_string(i);
+
+					// Assert: check the entry size then the memory
+					ASSERT_EQ(Response_Entity_Size, iter->Size) << message;
+					EXPECT_EQ_MEMORY(pResponseData, &*iter, iter->Size) << message;
+
+					pResponseData += Response_Entity_Size;
+					++iter;
+				}
+			}
+		};
+
+		// endregion
+
 		// region UnlockedAccountsTraits
 
 		struct UnlockedAccountsTraits {
@@ -434,6 +556,8 @@ namespace catapult { namespace extensions {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteDiagnosticApi, DiagnosticConfirmTimestampedHashes)
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticCounters)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteDiagnosticApi, ExecutionProfile)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteDiagnosticApi, DispatcherLatencies)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, ActiveNodeInfos)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, UnlockedAccounts)
 
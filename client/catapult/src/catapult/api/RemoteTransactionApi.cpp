@@ -56,6 +56,27 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct FilteredUtTraits : public UtTraits {
+		public:
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Filtered_Transactions;
+			static constexpr auto Friendly_Name = "pull filtered unconfirmed transactions";
+
+			static auto CreateRequestPacketPayload(
+					Timestamp minDeadline,
+					BlockFeeMultiplier minFeeMultiplier,
+					utils::BloomFilter&& knownShortHashesFilter) {
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendValue(minDeadline);
+				builder.appendValue(minFeeMultiplier);
+				builder.appendValue(knownShortHashesFilter.header());
+				builder.appendValues(knownShortHashesFilter.data());
+				return builder.build();
+			}
+
+		public:
+			using UtTraits::UtTraits;
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -81,6 +102,14 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minDeadline, minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<FilteredUtTraits> filteredUnconfirmedTransactions(
+					Timestamp minDeadline,
+					BlockFeeMultiplier minFeeMultiplier,
+					utils::BloomFilter&& knownShortHashesFilter) const override {
+				auto traits = FilteredUtTraits(m_registry);
+				return m_impl.dispatch(traits, minDeadline, minFeeMultiplier, std::move(knownShortHashesFilter));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
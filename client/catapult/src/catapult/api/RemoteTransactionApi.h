@@ -23,6 +23,7 @@
 #include "RemoteApi.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
+#include "catapult/utils/BloomFilter.h"
 
 namespace catapult { namespace ionet { class PacketIo; } }
 
@@ -42,6 +43,13 @@ namespace catapult { namespace api {
 				Timestamp minDeadline,
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote that have a deadline at least \a minDeadline,
+		/// a fee multiplier at least \a minFeeMultiplier and do not have a short hash in \a knownShortHashesFilter.
+		virtual thread::future<model::TransactionRange> filteredUnconfirmedTransactions(
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				utils::BloomFilter&& knownShortHashesFilter) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
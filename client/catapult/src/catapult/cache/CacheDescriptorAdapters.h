@@ -41,6 +41,7 @@ namespace catapult { namespace cache {
 				using ValueType = typename TDescriptor::ValueType;
 				using StorageType = std::pair<const KeyType, ValueType>;
 				using Serializer = typename TDescriptor::Serializer;
+				using KeyHasher = TValueHasher;
 
 				static constexpr auto GetKeyFromValue(const ValueType& value) {
 					return TDescriptor::GetKeyFromValue(value);
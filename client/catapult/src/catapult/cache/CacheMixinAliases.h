@@ -32,6 +32,7 @@ namespace catapult { namespace cache {
 		using Size = SizeMixin<TSet>;
 		using Contains = ContainsMixin<TSet, TCacheDescriptor>;
 		using Iteration = IterationMixin<TSet>;
+		using Prefetch = PrefetchMixin<TSet, TCacheDescriptor>;
 
 		using ConstAccessor = ConstAccessorMixin<TSet, TCacheDescriptor>;
 		using MutableAccessor = MutableAccessorMixin<TSet, TCacheDescriptor>;
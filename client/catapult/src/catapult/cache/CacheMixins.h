@@ -71,6 +71,28 @@ namespace catapult { namespace cache {
 		const TSet& m_set;
 	};
 
+	/// Mixin for adding prefetch support to a cache.
+	template<typename TSet, typename TCacheDescriptor>
+	class PrefetchMixin {
+	private:
+		using KeyType = typename TCacheDescriptor::KeyType;
+
+	public:
+		/// Creates a mixin around \a set.
+		explicit PrefetchMixin(const TSet& set) : m_set(set)
+		{}
+
+	public:
+		/// Prefetches all elements identified by \a keys so that subsequent lookups do not hit the underlying storage.
+		/// \note This only has an effect when the cache is backed by a database.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			m_set.prefetch(keys);
+		}
+
+	private:
+		const TSet& m_set;
+	};
+
 	/// Mixin for adding iteration support to a cache.
 	template<typename TSet>
 	class IterationMixin {
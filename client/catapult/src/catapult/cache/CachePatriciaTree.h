@@ -64,7 +64,7 @@ namespace catapult { namespace cache {
 		public:
 			Impl(CacheDatabase& database, size_t columnId)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_dataSource(m_container, database.databaseConfig().PatriciaTreeNodeCacheSize)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -28,6 +28,8 @@
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -79,6 +81,20 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
+		template<typename TSubCacheViews>
+		void ParallelUpdateSubCacheMerkleRoots(const TSubCacheViews& subViews, Height height, thread::IoThreadPool& pool) {
+			std::vector<SubCacheView*> merkleSubViews;
+			for (const auto& pSubView : subViews) {
+				if (pSubView && pSubView->supportsMerkleRoot())
+					merkleSubViews.push_back(pSubView.get());
+			}
+
+			// each sub cache is updated by a single thread, which can update independent tree branches in parallel
+			thread::ParallelForEachRethrow(pool, merkleSubViews, [height, &pool](auto* pSubView) {
+				pSubView->updateMerkleRoot(height, pool);
+			});
+		}
+
 		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
 		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::warning);
@@ -158,6 +174,14 @@ namespace catapult { namespace cache {
 		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
 	}
 
+	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height, thread::IoThreadPool& pool) const {
+		utils::SlowOperationLogger logger("ParallelUpdateSubCacheMerkleRoots", utils::LogLevel::warning);
+		ParallelUpdateSubCacheMerkleRoots(m_subViews, height, pool);
+
+		// all merkle roots have already been updated
+		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+	}
+
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
 		auto merkleRootIndex = 0u;
 		for (const auto& pSubView : m_subViews) {
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "PatriciaTreeUtils.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
 
@@ -54,6 +55,21 @@ namespace catapult { namespace cache {
 					: std::make_pair(Hash256(), false);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a proof.
+		std::vector<std::pair<Hash256, bool>> tryLookup(
+				const std::vector<typename TTree::KeyType>& keys,
+				tree::PatriciaTreeMultiProof& proof) const {
+			return m_pTree
+					? m_pTree->lookup(keys, proof)
+					: std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), false));
+		}
+
+		/// Gets the statistics of the node cache in front of the tree data source.
+		/// \note All statistics are zero when the tree or its node cache is disabled.
+		PatriciaTreeNodeCacheStatistics patriciaTreeNodeCacheStatistics() const {
+			return m_pTree ? m_pTree->dataSource().nodeCacheStatistics() : PatriciaTreeNodeCacheStatistics();
+		}
+
 	private:
 		const TTree* m_pTree;
 	};
@@ -91,6 +107,18 @@ namespace catapult { namespace cache {
 			setApplyCheckpoint();
 		}
 
+		/// Recalculates the merkle root given the specified chain \a height if supported
+		/// using \a pool to update independent tree branches in parallel.
+		void updateMerkleRoot(Height height, thread::IoThreadPool& pool) {
+			if (!m_pTree)
+				return;
+
+			ApplyDeltasToTree(*m_pTree, m_set, m_nextGenerationId, height, [&pool](const auto& branchIndexes, const auto& updateBranch) {
+				ParallelForEachTreeBranch(pool, branchIndexes, updateBranch);
+			});
+			setApplyCheckpoint();
+		}
+
 		/// Sets the merkle root (\a merkleRoot) if supported.
 		/// \note There must not be any pending changes.
 		void setMerkleRoot(const Hash256& merkleRoot) {
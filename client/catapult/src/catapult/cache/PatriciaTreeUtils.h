@@ -23,6 +23,10 @@
 #include "catapult/deltaset/DeltaElements.h"
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/exceptions.h"
+#include "catapult/functions.h"
+#include <vector>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
 
 namespace catapult { namespace cache {
 
@@ -67,38 +71,72 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
-	/// given the current chain \a height.
-	template<typename TTree, typename TSet>
-	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
-		auto needsApplication = [&set, minGenerationId, maxGenerationId = set.generationId()](const auto& key) {
-			auto generationId = set.generationId(key);
-			return minGenerationId <= generationId && generationId <= maxGenerationId;
-		};
+	namespace detail {
+		/// Calls \a modify for all changes in \a set for all generations starting at \a minGenerationId through the current generation
+		/// given the current chain \a height.
+		/// \note \a modify is passed a key and a pointer to the new value or \c nullptr if the value should be removed.
+		template<typename TSet, typename TModify>
+		void ForEachDelta(const TSet& set, uint32_t minGenerationId, Height height, TModify modify) {
+			auto needsApplication = [&set, minGenerationId, maxGenerationId = set.generationId()](const auto& key) {
+				auto generationId = set.generationId(key);
+				return minGenerationId <= generationId && generationId <= maxGenerationId;
+			};
 
-		auto handleModification = [&tree, height](const auto& pair) {
-			if (detail::IsActiveAdapter::IsActive(pair.second, height))
-				tree.set(pair.first, pair.second);
-			else
-				tree.unset(pair.first);
-		};
+			auto handleModification = [&modify, height](const auto& pair) {
+				modify(pair.first, IsActiveAdapter::IsActive(pair.second, height) ? &pair.second : nullptr);
+			};
 
-		auto deltas = set.deltas();
-		for (const auto& pair : deltas.Added) {
-			if (needsApplication(pair.first)) {
-				// a value can be added and deactivated during the processing of a single chain part
-				handleModification(pair);
+			auto deltas = set.deltas();
+			for (const auto& pair : deltas.Added) {
+				if (needsApplication(pair.first)) {
+					// a value can be added and deactivated during the processing of a single chain part
+					handleModification(pair);
+				}
 			}
-		}
 
-		for (const auto& pair : deltas.Copied) {
-			if (needsApplication(pair.first))
-				handleModification(pair);
+			for (const auto& pair : deltas.Copied) {
+				if (needsApplication(pair.first))
+					handleModification(pair);
+			}
+
+			for (const auto& pair : deltas.Removed) {
+				if (needsApplication(pair.first))
+					modify(pair.first, static_cast<decltype(&pair.second)>(nullptr));
+			}
 		}
 
-		for (const auto& pair : deltas.Removed) {
-			if (needsApplication(pair.first))
-				tree.unset(pair.first);
+		/// Collects all changes in \a set for all generations starting at \a minGenerationId through the current generation
+		/// given the current chain \a height as \a TTree modifications.
+		template<typename TTree, typename TSet>
+		std::vector<typename TTree::Modification> CollectModifications(const TSet& set, uint32_t minGenerationId, Height height) {
+			std::vector<typename TTree::Modification> modifications;
+			ForEachDelta(set, minGenerationId, height, [&modifications](const auto& key, const auto* pValue) {
+				modifications.push_back({ &key, pValue });
+			});
+
+			return modifications;
 		}
 	}
+
+	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
+	/// given the current chain \a height.
+	/// \note All changes are applied to \a tree as a single batch.
+	template<typename TTree, typename TSet>
+	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
+		tree.apply(detail::CollectModifications<TTree>(set, minGenerationId, height));
+	}
+
+	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
+	/// given the current chain \a height using \a forEachBranch to update independent tree branches.
+	template<typename TTree, typename TSet, typename TForEachBranch>
+	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height, TForEachBranch forEachBranch) {
+		tree.apply(detail::CollectModifications<TTree>(set, minGenerationId, height), forEachBranch);
+	}
+
+	/// Updates all tree branches identified by \a branchIndexes by calling \a updateBranch for each one using \a pool.
+	/// \note This function blocks until all branches have been updated.
+	void ParallelForEachTreeBranch(
+			thread::IoThreadPool& pool,
+			const std::vector<size_t>& branchIndexes,
+			const consumer<size_t>& updateBranch);
 }}
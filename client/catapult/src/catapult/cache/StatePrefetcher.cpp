@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StatePrefetcher.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		using SubCachePrefetchers = std::vector<std::unique_ptr<SubCachePrefetcher>>;
+
+		class AggregateSubCachePrefetcher : public model::NotificationSubscriber {
+		public:
+			explicit AggregateSubCachePrefetcher(const SubCachePrefetchers& prefetchers) : m_prefetchers(prefetchers)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				for (const auto& pPrefetcher : m_prefetchers)
+					pPrefetcher->notify(notification);
+			}
+
+		private:
+			const SubCachePrefetchers& m_prefetchers;
+		};
+
+		SubCachePrefetchers CollectKeys(
+				const std::vector<SubCachePrefetcherFactory>& prefetcherFactories,
+				const model::WeakEntityInfos& entityInfos,
+				const model::NotificationPublisher& notificationPublisher) {
+			SubCachePrefetchers prefetchers;
+			for (const auto& factory : prefetcherFactories)
+				prefetchers.push_back(factory());
+
+			AggregateSubCachePrefetcher sub(prefetchers);
+			for (const auto& entityInfo : entityInfos)
+				notificationPublisher.publish(entityInfo, sub);
+
+			return prefetchers;
+		}
+	}
+
+	StatePrefetcher::StatePrefetcher(const std::vector<SubCachePrefetcherFactory>& prefetcherFactories)
+			: m_prefetcherFactories(prefetcherFactories)
+	{}
+
+	size_t StatePrefetcher::size() const {
+		return m_prefetcherFactories.size();
+	}
+
+	void StatePrefetcher::prefetch(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& notificationPublisher,
+			const CatapultCacheDelta& cache) const {
+		if (m_prefetcherFactories.empty() || entityInfos.empty())
+			return;
+
+		for (const auto& pPrefetcher : CollectKeys(m_prefetcherFactories, entityInfos, notificationPublisher))
+			pPrefetcher->prefetch(cache);
+	}
+
+	void StatePrefetcher::prefetch(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& notificationPublisher,
+			const CatapultCacheDelta& cache,
+			thread::IoThreadPool& pool) const {
+		if (m_prefetcherFactories.empty() || entityInfos.empty())
+			return;
+
+		auto prefetchers = CollectKeys(m_prefetcherFactories, entityInfos, notificationPublisher);
+
+		thread::ParallelForEachRethrow(pool, prefetchers, [&cache](const auto& pPrefetcher) {
+			pPrefetcher->prefetch(cache);
+		});
+	}
+}}
@@ -0,0 +1,108 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CatapultCacheDelta.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/WeakEntityInfo.h"
+#include "catapult/functions.h"
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace catapult {
+	namespace model { class NotificationPublisher; }
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace cache {
+
+	/// Notification subscriber that collects the keys of a single sub cache that will be accessed and prefetches them.
+	class SubCachePrefetcher : public model::NotificationSubscriber {
+	public:
+		/// Prefetches all collected keys from \a cache.
+		virtual void prefetch(const CatapultCacheDelta& cache) const = 0;
+	};
+
+	/// Sub cache prefetcher that collects unique keys and prefetches them from \a TCache.
+	template<typename TCache, typename TKey, typename TKeyHasher>
+	class BasicSubCachePrefetcher : public SubCachePrefetcher {
+	public:
+		/// Unique keys.
+		using KeySet = std::unordered_set<TKey, TKeyHasher>;
+
+	public:
+		/// Gets all collected keys.
+		const KeySet& keys() const {
+			return m_keys;
+		}
+
+		/// Prefetches all collected keys from \a cache.
+		void prefetch(const CatapultCacheDelta& cache) const override {
+			if (m_keys.empty())
+				return;
+
+			cache.sub<TCache>().prefetch(std::vector<TKey>(m_keys.cbegin(), m_keys.cend()));
+		}
+
+	protected:
+		/// Collects \a key.
+		void add(const TKey& key) {
+			m_keys.insert(key);
+		}
+
+	private:
+		KeySet m_keys;
+	};
+
+	/// Factory for creating sub cache prefetchers.
+	using SubCachePrefetcherFactory = supplier<std::unique_ptr<SubCachePrefetcher>>;
+
+	/// Prefetches the state of all sub caches that will be accessed when executing entities.
+	class StatePrefetcher {
+	public:
+		/// Creates a prefetcher around \a prefetcherFactories.
+		explicit StatePrefetcher(const std::vector<SubCachePrefetcherFactory>& prefetcherFactories);
+
+	public:
+		/// Gets the number of sub cache prefetchers.
+		size_t size() const;
+
+		/// Uses \a notificationPublisher to collect all keys accessed by \a entityInfos and prefetches them from \a cache.
+		/// \note All sub caches are prefetched on the calling thread.
+		void prefetch(
+				const model::WeakEntityInfos& entityInfos,
+				const model::NotificationPublisher& notificationPublisher,
+				const CatapultCacheDelta& cache) const;
+
+		/// Uses \a notificationPublisher to collect all keys accessed by \a entityInfos and prefetches them from \a cache
+		/// using \a pool to prefetch sub caches in parallel.
+		/// \note This function blocks until all sub caches have been prefetched.
+		void prefetch(
+				const model::WeakEntityInfos& entityInfos,
+				const model::NotificationPublisher& notificationPublisher,
+				const CatapultCacheDelta& cache,
+				thread::IoThreadPool& pool) const;
+
+	private:
+		std::vector<SubCachePrefetcherFactory> m_prefetcherFactories;
+	};
+}}
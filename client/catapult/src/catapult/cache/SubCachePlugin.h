@@ -31,6 +31,8 @@ namespace catapult {
 		class CacheStorage;
 		class CatapultCache;
 	}
+
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -93,6 +95,9 @@ namespace catapult { namespace cache {
 		/// Recalculates the merkle root given the specified chain \a height if supported.
 		virtual void updateMerkleRoot(Height height) = 0;
 
+		/// Recalculates the merkle root given the specified chain \a height if supported using \a pool for parallelization.
+		virtual void updateMerkleRoot(Height height, thread::IoThreadPool& pool) = 0;
+
 		/// Prunes the cache at \a height.
 		virtual void prune(Height height) = 0;
 
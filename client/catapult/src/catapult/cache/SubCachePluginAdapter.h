@@ -131,6 +131,12 @@ namespace catapult { namespace cache {
 				return MerkleRootMutator<UnderlyingViewType>();
 			}
 
+			auto parallelMerkleRootMutator() {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = std::remove_reference_t<decltype(*m_view)>;
+				return ParallelMerkleRootMutator<UnderlyingViewType>();
+			}
+
 			template<typename TPruneValue>
 			auto pruneMutator() {
 				// need to dereference to get underlying view type from LockedCacheView
@@ -167,6 +173,10 @@ namespace catapult { namespace cache {
 				UpdateMerkleRoot(m_view, height, merkleRootMutator());
 			}
 
+			void updateMerkleRoot(Height height, thread::IoThreadPool& pool) override {
+				UpdateMerkleRoot(m_view, height, pool, parallelMerkleRootMutator());
+			}
+
 			void prune(Height height) override {
 				Prune(m_view, height, pruneMutator<Height>());
 			}
@@ -204,6 +214,18 @@ namespace catapult { namespace cache {
 					: public SupportedFeatureFlag
 			{};
 
+			template<typename T, typename = void>
+			struct ParallelMerkleRootMutator : public UnsupportedFeatureFlag {};
+
+			template<typename T>
+			struct ParallelMerkleRootMutator<
+					T,
+					utils::traits::is_type_expression_t<decltype(reinterpret_cast<T*>(1)->updateMerkleRoot(
+							Height(),
+							*reinterpret_cast<thread::IoThreadPool*>(1)))>>
+					: public SupportedFeatureFlag
+			{};
+
 			template<typename TPruneValue, typename T, typename = void>
 			struct PruneMutator : public UnsupportedFeatureFlag {};
 
@@ -252,6 +274,15 @@ namespace catapult { namespace cache {
 				view->updateMerkleRoot(height);
 			}
 
+			static void UpdateMerkleRoot(TView& view, Height height, thread::IoThreadPool&, UnsupportedFeatureFlag) {
+				// fall back to sequential update when parallel update is not supported
+				UpdateMerkleRoot(view, height, MerkleRootMutator<std::remove_reference_t<decltype(*view)>>());
+			}
+
+			static void UpdateMerkleRoot(TView& view, Height height, thread::IoThreadPool& pool, SupportedFeatureFlag) {
+				view->updateMerkleRoot(height, pool);
+			}
+
 			template<typename TPruneValue>
 			static void Prune(TView&, TPruneValue, UnsupportedFeatureFlag)
 			{}
@@ -52,6 +52,7 @@ namespace catapult { namespace cache {
 			, AccountStateCacheDeltaMixins::ConstAccessorKey(*pKeyLookupAdapter)
 			, AccountStateCacheDeltaMixins::PatriciaTreeDelta(*accountStateSets.pPrimary, accountStateSets.pPatriciaTree)
 			, AccountStateCacheDeltaMixins::DeltaElements(*accountStateSets.pPrimary)
+			, AccountStateCacheDeltaMixins::PrefetchAddress(*accountStateSets.pPrimary)
 			, m_pStateByAddress(accountStateSets.pPrimary)
 			, m_pKeyToAddress(accountStateSets.pKeyLookupMap)
 			, m_options(options)
@@ -51,6 +51,7 @@ namespace catapult { namespace cache {
 		using MutableAccessorKey = KeyMixins::MutableAccessor;
 		using PatriciaTreeDelta = AddressMixins::PatriciaTreeDelta;
 		using DeltaElements = AddressMixins::DeltaElements;
+		using PrefetchAddress = AddressMixins::Prefetch;
 
 		// no mutable key accessor because address-to-key pairs are immutable
 	};
@@ -64,7 +65,8 @@ namespace catapult { namespace cache {
 			, public AccountStateCacheDeltaMixins::ConstAccessorAddress
 			, public AccountStateCacheDeltaMixins::ConstAccessorKey
 			, public AccountStateCacheDeltaMixins::PatriciaTreeDelta
-			, public AccountStateCacheDeltaMixins::DeltaElements {
+			, public AccountStateCacheDeltaMixins::DeltaElements
+			, public AccountStateCacheDeltaMixins::PrefetchAddress {
 	public:
 		using ReadOnlyView = ReadOnlyAccountStateCache;
 
@@ -0,0 +1,54 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AccountStatePrefetcher.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/model/ResolverContext.h"
+
+namespace catapult { namespace cache {
+
+	AccountStatePrefetcher::AccountStatePrefetcher(model::NetworkIdentifier networkIdentifier) : m_networkIdentifier(networkIdentifier)
+	{}
+
+	void AccountStatePrefetcher::notify(const model::Notification& notification) {
+		if (model::Core_Register_Account_Address_Notification == notification.Type)
+			addAddress(static_cast<const model::AccountAddressNotification&>(notification).Address);
+		else if (model::Core_Register_Account_Public_Key_Notification == notification.Type)
+			addPublicKey(static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey);
+	}
+
+	void AccountStatePrefetcher::addAddress(const model::ResolvableAddress& address) {
+		if (address.isResolved()) {
+			add(address.resolved());
+			return;
+		}
+
+		// aliases can only be resolved during execution, so they are not prefetched
+		auto unresolvedAddress = address.unresolved();
+		if (0 == (1 & unresolvedAddress[0]))
+			add(model::ResolverContext().resolve(unresolvedAddress));
+	}
+
+	void AccountStatePrefetcher::addPublicKey(const Key& publicKey) {
+		add(model::PublicKeyToAddress(publicKey, m_networkIdentifier));
+	}
+}}
@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AccountStateCache.h"
+#include "catapult/cache/StatePrefetcher.h"
+#include "catapult/model/NetworkIdentifier.h"
+#include "catapult/model/Resolvable.h"
+
+namespace catapult { namespace cache {
+
+	/// Prefetcher that collects all accounts registered by notifications.
+	class AccountStatePrefetcher : public BasicSubCachePrefetcher<AccountStateCache, Address, utils::ArrayHasher<Address>> {
+	public:
+		/// Creates a prefetcher for accounts on the network with \a networkIdentifier.
+		explicit AccountStatePrefetcher(model::NetworkIdentifier networkIdentifier);
+
+	public:
+		void notify(const model::Notification& notification) override;
+
+	private:
+		void addAddress(const model::ResolvableAddress& address);
+		void addPublicKey(const Key& publicKey);
+
+	private:
+		model::NetworkIdentifier m_networkIdentifier;
+	};
+}}
@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	// region Shard
+
+	class PatriciaTreeNodeCache::Shard {
+	private:
+		struct Entry {
+			tree::TreeNode Node;
+			bool IsReferenced;
+		};
+
+	public:
+		explicit Shard(size_t maxSize)
+				: m_maxSize(maxSize)
+				, m_clockHand(0)
+				, m_numHits(0)
+				, m_numMisses(0) {
+			m_entries.reserve(m_maxSize);
+		}
+
+	public:
+		void addStatistics(PatriciaTreeNodeCacheStatistics& statistics) const {
+			utils::SpinLockGuard guard(m_lock);
+			statistics.NumHits += m_numHits;
+			statistics.NumMisses += m_numMisses;
+			statistics.Size += m_entries.size();
+		}
+
+		tree::TreeNode find(const Hash256& hash) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_hashToIndexMap.find(hash);
+			if (m_hashToIndexMap.cend() == iter) {
+				++m_numMisses;
+				return tree::TreeNode();
+			}
+
+			++m_numHits;
+			auto& entry = m_entries[iter->second];
+			entry.IsReferenced = true;
+			return entry.Node.copy();
+		}
+
+		void add(const tree::TreeNode& node) {
+			utils::SpinLockGuard guard(m_lock);
+			if (m_hashToIndexMap.cend() != m_hashToIndexMap.find(node.hash()))
+				return;
+
+			if (m_entries.size() < m_maxSize) {
+				m_hashToIndexMap.emplace(node.hash(), m_entries.size());
+				m_entries.push_back(Entry{ node.copy(), false });
+				return;
+			}
+
+			// advance the clock hand past all recently referenced entries (giving each a second chance)
+			while (m_entries[m_clockHand].IsReferenced) {
+				m_entries[m_clockHand].IsReferenced = false;
+				advanceClockHand();
+			}
+
+			auto& entry = m_entries[m_clockHand];
+			m_hashToIndexMap.erase(entry.Node.hash());
+			m_hashToIndexMap.emplace(node.hash(), m_clockHand);
+			entry.Node = node.copy();
+			advanceClockHand();
+		}
+
+	private:
+		void advanceClockHand() {
+			m_clockHand = (m_clockHand + 1) % m_maxSize;
+		}
+
+	private:
+		size_t m_maxSize;
+		size_t m_clockHand;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		std::vector<Entry> m_entries;
+		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> m_hashToIndexMap;
+		mutable utils::SpinLock m_lock;
+	};
+
+	// endregion
+
+	// region PatriciaTreeNodeCache
+
+	namespace {
+		size_t CalculateNumShards(size_t maxSize, size_t numShards) {
+			return std::max<size_t>(1, std::min(maxSize, numShards));
+		}
+	}
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(size_t maxSize, size_t numShards) : m_maxSize(maxSize) {
+		if (0 == maxSize)
+			CATAPULT_THROW_INVALID_ARGUMENT("node cache must be able to hold at least one node");
+
+		// distribute capacity evenly across shards with any remainder going to the first shards
+		auto actualNumShards = CalculateNumShards(maxSize, numShards);
+		for (auto i = 0u; i < actualNumShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>(maxSize / actualNumShards + (i < maxSize % actualNumShards ? 1 : 0)));
+	}
+
+	PatriciaTreeNodeCache::~PatriciaTreeNodeCache() = default;
+
+	size_t PatriciaTreeNodeCache::maxSize() const {
+		return m_maxSize;
+	}
+
+	PatriciaTreeNodeCacheStatistics PatriciaTreeNodeCache::statistics() const {
+		PatriciaTreeNodeCacheStatistics statistics{};
+		for (const auto& pShard : m_shards)
+			pShard->addStatistics(statistics);
+
+		return statistics;
+	}
+
+	tree::TreeNode PatriciaTreeNodeCache::find(const Hash256& hash) const {
+		return shard(hash).find(hash);
+	}
+
+	void PatriciaTreeNodeCache::add(const tree::TreeNode& node) {
+		shard(node.hash()).add(node);
+	}
+
+	PatriciaTreeNodeCache::Shard& PatriciaTreeNodeCache::shard(const Hash256& hash) const {
+		// node hashes are uniformly distributed, so use a byte that is not consumed by ArrayHasher to pick a shard
+		return *m_shards[hash[Hash256_tag::Size - 1] % m_shards.size()];
+	}
+
+	// endregion
+}}
@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/TreeNode.h"
+#include "catapult/utils/NonCopyable.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Patricia tree node cache statistics.
+	struct PatriciaTreeNodeCacheStatistics {
+		/// Number of lookups that found a cached node.
+		uint64_t NumHits;
+
+		/// Number of lookups that did not find a cached node.
+		uint64_t NumMisses;
+
+		/// Number of cached nodes.
+		uint64_t Size;
+	};
+
+	/// Bounded cache of deserialized patricia tree nodes keyed by node hash.
+	/// \note Nodes are identified by the hashes of their (immutable) contents, so cached nodes never need to be invalidated.
+	///       Nodes are distributed across independently locked shards, each of which evicts nodes using the CLOCK algorithm.
+	class PatriciaTreeNodeCache : public utils::NonCopyable {
+	public:
+		/// Default number of shards.
+		static constexpr size_t Default_Num_Shards = 16;
+
+	public:
+		/// Creates a cache that holds at most \a maxSize nodes distributed across \a numShards shards.
+		explicit PatriciaTreeNodeCache(size_t maxSize, size_t numShards = Default_Num_Shards);
+
+		/// Destroys the cache.
+		~PatriciaTreeNodeCache();
+
+	public:
+		/// Gets the maximum number of cached nodes.
+		size_t maxSize() const;
+
+		/// Gets the cache statistics.
+		PatriciaTreeNodeCacheStatistics statistics() const;
+
+	public:
+		/// Gets a copy of the node with \a hash or an empty node if it is not cached.
+		tree::TreeNode find(const Hash256& hash) const;
+
+		/// Adds \a node to the cache, evicting a node if the cache is full.
+		void add(const tree::TreeNode& node);
+
+	private:
+		class Shard;
+
+		Shard& shard(const Hash256& hash) const;
+
+	private:
+		size_t m_maxSize;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+	};
+}}
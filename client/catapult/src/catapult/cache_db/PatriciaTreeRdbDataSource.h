@@ -21,15 +21,20 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeNodeCache.h"
 #include "catapult/types.h"
+#include <memory>
 
 namespace catapult { namespace cache {
 
 	/// Patricia tree rocksdb-based data source.
+	/// \note Deserialized nodes are optionally cached in memory in front of the container.
 	class PatriciaTreeRdbDataSource {
 	public:
-		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
+		/// Creates data source around \a container that caches up to \a maxNodeCacheSize nodes in memory.
+		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, size_t maxNodeCacheSize = 0)
+				: m_container(container)
+				, m_pNodeCache(0 == maxNodeCacheSize ? nullptr : std::make_unique<PatriciaTreeNodeCache>(maxNodeCacheSize))
 		{}
 
 	public:
@@ -38,13 +43,28 @@ namespace catapult { namespace cache {
 			return m_container.size();
 		}
 
+		/// Gets the node cache statistics.
+		/// \note All statistics are zero when node caching is disabled.
+		PatriciaTreeNodeCacheStatistics nodeCacheStatistics() const {
+			return m_pNodeCache ? m_pNodeCache->statistics() : PatriciaTreeNodeCacheStatistics();
+		}
+
 		/// Gets the tree node associated with \a hash.
 		tree::TreeNode get(const Hash256& hash) const {
+			if (m_pNodeCache) {
+				auto node = m_pNodeCache->find(hash);
+				if (!node.empty())
+					return node;
+			}
+
 			auto iter = m_container.find(hash);
 			if (m_container.cend() == iter)
 				return tree::TreeNode();
 
 			const auto& pair = *iter;
+			if (m_pNodeCache)
+				m_pNodeCache->add(pair.second);
+
 			return pair.second.copy();
 		}
 
@@ -62,9 +82,14 @@ namespace catapult { namespace cache {
 	private:
 		void set(const tree::TreeNode& node) {
 			m_container.insert(std::make_pair(node.hash(), node.copy()));
+
+			// saved nodes are likely to be loaded soon because upper tree levels change with (almost) every commit
+			if (m_pNodeCache)
+				m_pNodeCache->add(node);
 		}
 
 	private:
 		PatriciaTreeContainer& m_container;
+		std::unique_ptr<PatriciaTreeNodeCache> m_pNodeCache;
 	};
 }}
@@ -25,9 +25,39 @@
 #include "RocksDatabase.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include "catapult/utils/traits/Traits.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace cache {
 
+	namespace detail {
+		/// Hasher that hashes the serialized representation of a key without copying it.
+		struct SerializedKeyHasher {
+			template<typename TKey>
+			size_t operator()(const TKey& key) const {
+				auto serializedKey = SerializeKey(key);
+				auto serializedKeyView = std::string_view(reinterpret_cast<const char*>(serializedKey.pData), serializedKey.Size);
+				return std::hash<std::string_view>()(serializedKeyView);
+			}
+		};
+
+		/// Selects the key hasher of \a TDescriptor or SerializedKeyHasher when \a TDescriptor does not define one.
+		template<typename TDescriptor, typename = void>
+		struct DescriptorKeyHasher {
+			using type = SerializedKeyHasher;
+		};
+
+		template<typename TDescriptor>
+		struct DescriptorKeyHasher<TDescriptor, utils::traits::is_type_expression_t<typename TDescriptor::KeyHasher>> {
+			using type = typename TDescriptor::KeyHasher;
+		};
+	}
+
 	/// Typed container adapter that wraps column.
 	template<typename TDescriptor, typename TContainer = RdbColumnContainer>
 	class RdbTypedColumnContainer : public TContainer {
@@ -44,6 +74,16 @@ namespace catapult { namespace cache {
 			using ValueType = typename TDescriptor::ValueType;
 			using StorageType = typename TDescriptor::StorageType;
 
+		public:
+			/// Creates an iterator that represents non-existing element.
+			const_iterator() = default;
+
+		private:
+			// creates an iterator around an already deserialized element (\a pStorage)
+			explicit const_iterator(const std::shared_ptr<StorageType>& pStorage) : m_pStorage(pStorage) {
+				m_iterator.setFound(true);
+			}
+
 		public:
 			/// Returns \c true if this iterator and \a rhs are equal.
 			bool operator==(const const_iterator& rhs) const {
@@ -88,12 +128,18 @@ namespace catapult { namespace cache {
 		private:
 			RdbDataIterator m_iterator;
 			mutable std::shared_ptr<StorageType> m_pStorage;
+
+		private:
+			friend class RdbTypedColumnContainer;
 		};
 
 	public:
 		/// Creates a container around \a database and \a columnId.
 		template<typename TDatabase = RocksDatabase>
-		RdbTypedColumnContainer(TDatabase& database, size_t columnId) : TContainer(database, columnId)
+		RdbTypedColumnContainer(TDatabase& database, size_t columnId)
+				: TContainer(database, columnId)
+				, m_hasPrefetchedElements(false)
+				, m_generation(0)
 		{}
 
 	public:
@@ -111,6 +157,7 @@ namespace catapult { namespace cache {
 
 		/// Inserts \a element into container.
 		void insert(const StorageType& element) {
+			invalidatePrefetched(TDescriptor::ToKey(element));
 			TContainer::insert(
 					SerializeKey(TDescriptor::ToKey(element)),
 					TDescriptor::Serializer::SerializeValue(TDescriptor::ToValue(element)));
@@ -123,17 +170,79 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key. Returns cend() if \a key has not been found.
 		const_iterator find(const KeyType& key) const {
 			const_iterator iter;
-			TContainer::find(SerializeKey(key), iter.dbIterator());
+			if (!findPrefetched(key, iter))
+				TContainer::find(SerializeKey(key), iter.dbIterator());
+
 			return iter;
 		}
 
+		/// Finds all elements with \a keys in a single batched lookup.
+		/// \note Returned iterators are in the same order as \a keys and are equal to cend() for keys that have not been found.
+		std::vector<const_iterator> findAll(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::findAll(serializedKeys, dbIterators);
+
+			std::vector<const_iterator> iterators(keys.size());
+			for (auto i = 0u; i < dbIterators.size(); ++i)
+				iterators[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iterators;
+		}
+
+		/// Prefetches all elements with \a keys in a single batched lookup, replacing all previously prefetched elements.
+		/// \note Subsequent finds of prefetched keys (including keys that have not been found) are served from memory
+		///        until the corresponding elements are modified or until the next commit (see clearPrefetched).
+		void prefetch(const std::vector<KeyType>& keys) const {
+			// capture the generation before reading so that results racing with a modification are discarded below
+			auto generation = m_generation.load();
+			auto iterators = findAll(keys);
+
+			PrefetchedElements prefetchedElements;
+			for (auto i = 0u; i < keys.size(); ++i) {
+				std::shared_ptr<StorageType> pStorage;
+				if (cend() != iterators[i]) {
+					auto value = TDescriptor::Serializer::DeserializeValue(iterators[i].dbIterator().buffer());
+					pStorage = std::make_shared<StorageType>(TDescriptor::ToStorage(value));
+				}
+
+				prefetchedElements.emplace(keys[i], std::move(pStorage));
+			}
+
+			std::lock_guard<std::mutex> guard(m_prefetchedElementsMutex);
+			m_prefetchedElements = std::move(prefetchedElements);
+
+			// set the flag before checking the generation, so that every concurrent modification either
+			// observes the flag (and invalidates its key) or is detected here (and discards all elements)
+			m_hasPrefetchedElements = true;
+			if (generation != m_generation.load())
+				clearPrefetchedUnlocked();
+		}
+
+		/// Clears all prefetched elements.
+		/// \note This is called when changes are committed, which scopes prefetched elements to the block being executed.
+		void clearPrefetched() {
+			++m_generation;
+			if (!m_hasPrefetchedElements)
+				return;
+
+			std::lock_guard<std::mutex> guard(m_prefetchedElementsMutex);
+			clearPrefetchedUnlocked();
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
+			clearPrefetched();
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
 		}
 
 		/// Removes element with \a key.
 		void remove(const KeyType& key) {
+			invalidatePrefetched(key);
 			TContainer::remove(SerializeKey(key));
 		}
 
@@ -141,5 +250,46 @@ namespace catapult { namespace cache {
 		const_iterator cend() const {
 			return const_iterator();
 		}
+
+	private:
+		bool findPrefetched(const KeyType& key, const_iterator& iter) const {
+			// skip the lock when nothing is prefetched, which is the case outside of block execution
+			if (!m_hasPrefetchedElements)
+				return false;
+
+			std::lock_guard<std::mutex> guard(m_prefetchedElementsMutex);
+			auto prefetchedIter = m_prefetchedElements.find(key);
+			if (m_prefetchedElements.cend() == prefetchedIter)
+				return false;
+
+			if (prefetchedIter->second)
+				iter = const_iterator(prefetchedIter->second);
+
+			return true;
+		}
+
+		void invalidatePrefetched(const KeyType& key) {
+			++m_generation;
+			if (!m_hasPrefetchedElements)
+				return;
+
+			std::lock_guard<std::mutex> guard(m_prefetchedElementsMutex);
+			m_prefetchedElements.erase(key);
+		}
+
+		void clearPrefetchedUnlocked() const {
+			m_prefetchedElements.clear();
+			m_hasPrefetchedElements = false;
+		}
+
+	private:
+		// prefetched elements, where nullptr indicates a key that has not been found
+		using KeyHasher = typename detail::DescriptorKeyHasher<TDescriptor>::type;
+		using PrefetchedElements = std::unordered_map<KeyType, std::shared_ptr<StorageType>, KeyHasher>;
+
+		mutable PrefetchedElements m_prefetchedElements;
+		mutable std::mutex m_prefetchedElementsMutex;
+		mutable std::atomic_bool m_hasPrefetchedElements;
+		std::atomic<uint64_t> m_generation; // incremented by every modification
 	};
 }}
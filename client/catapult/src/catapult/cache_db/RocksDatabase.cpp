@@ -178,6 +178,10 @@ namespace catapult { namespace cache {
 		return m_settings.ColumnFamilyNames;
 	}
 
+	const config::NodeConfiguration::CacheDatabaseSubConfiguration& RocksDatabase::databaseConfig() const {
+		return m_settings.DatabaseConfig;
+	}
+
 	bool RocksDatabase::canPrune() const {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
@@ -207,6 +211,33 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.clear();
+		if (keys.empty())
+			return;
+
+		// batched MultiGet requires contiguous values, so retrieve into temporary slices and move them into the results
+		std::vector<rocksdb::PinnableSlice> values(keys.size());
+		std::vector<rocksdb::Status> statuses(keys.size());
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], keys.size(), keys.data(), values.data(), statuses.data());
+
+		results.reserve(keys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& key = keys[i];
+			const auto& status = statuses[i];
+			if (!status.ok() && !status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+
+			RdbDataIterator result;
+			result.storage() = std::move(values[i]);
+			result.setFound(status.ok());
+			results.push_back(std::move(result));
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
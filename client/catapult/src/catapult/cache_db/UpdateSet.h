@@ -26,8 +26,11 @@
 namespace catapult { namespace cache {
 
 	/// Applies all changes in \a deltas to \a elements.
+	/// \note All prefetched elements are cleared because they were prefetched for the block being committed.
 	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
 	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
+		elements.clearPrefetched();
+
 		auto size = elements.size();
 		if (!deltas.HasChanges())
 			return;
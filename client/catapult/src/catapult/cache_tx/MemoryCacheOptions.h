@@ -28,12 +28,19 @@ namespace catapult { namespace cache {
 	class MemoryCacheOptions {
 	public:
 		/// Creates default options.
-		constexpr MemoryCacheOptions() = default;
+		constexpr MemoryCacheOptions() : MemoryCacheOptions(utils::FileSize(), utils::FileSize())
+		{}
 
 		/// Creates options with custom \a maxResponseSize and \a maxCacheSize.
 		constexpr MemoryCacheOptions(utils::FileSize maxResponseSize, utils::FileSize maxCacheSize)
+				: MemoryCacheOptions(maxResponseSize, maxCacheSize, 1)
+		{}
+
+		/// Creates options with custom \a maxResponseSize, \a maxCacheSize and \a numShards.
+		constexpr MemoryCacheOptions(utils::FileSize maxResponseSize, utils::FileSize maxCacheSize, uint32_t numShards)
 				: MaxResponseSize(maxResponseSize)
 				, MaxCacheSize(maxCacheSize)
+				, NumShards(numShards)
 		{}
 
 	public:
@@ -42,5 +49,9 @@ namespace catapult { namespace cache {
 
 		/// Maximum size of the cache.
 		utils::FileSize MaxCacheSize;
+
+		/// Number of independently locked shards.
+		/// \note This is only used by the unconfirmed transactions cache.
+		uint32_t NumShards;
 	};
 }}
@@ -21,6 +21,7 @@
 
 #include "MemoryPtCache.h"
 #include "CacheSizeLogger.h"
+#include "ShortHashFilters.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/Cosignature.h"
 #include "catapult/state/TimestampedHash.h"
@@ -136,42 +137,78 @@ namespace catapult { namespace cache {
 		return shortHashPairs;
 	}
 
-	MemoryPtCacheView::UnknownTransactionInfos MemoryPtCacheView::unknownTransactions(
-			Timestamp minDeadline,
-			const ShortHashPairMap& knownShortHashPairs) const {
-		uint64_t totalSize = 0;
-		UnknownTransactionInfos unknownTransactionInfos;
-		for (const auto& pair : m_transactionDataContainer) {
-			const auto& ptData = pair.second;
-			auto shortHash = utils::ToShortHash(ptData.entityHash());
-			auto iter = knownShortHashPairs.find(shortHash);
-
-			// if both hashes match, the data is completely known, so skip it
-			if (knownShortHashPairs.cend() != iter && iter->second == utils::ToShortHash(ptData.cosignaturesHash()))
-				continue;
-
-			if (ptData.transaction()->Deadline < minDeadline)
-				continue;
+	namespace {
+		template<typename TIsTransactionKnown, typename TIsShortHashPairKnown>
+		std::vector<model::CosignedTransactionInfo> FindUnknownTransactions(
+				const PtDataContainer& transactionDataContainer,
+				utils::FileSize maxResponseSize,
+				Timestamp minDeadline,
+				TIsTransactionKnown isTransactionKnown,
+				TIsShortHashPairKnown isShortHashPairKnown) {
+			uint64_t totalSize = 0;
+			std::vector<model::CosignedTransactionInfo> unknownTransactionInfos;
+			for (const auto& pair : transactionDataContainer) {
+				const auto& ptData = pair.second;
+				ShortHashPair shortHashPair{ utils::ToShortHash(ptData.entityHash()), utils::ToShortHash(ptData.cosignaturesHash()) };
+				auto isKnown = isTransactionKnown(shortHashPair.TransactionShortHash);
+
+				// if both hashes match, the data is completely known, so skip it
+				if (isKnown && isShortHashPairKnown(shortHashPair))
+					continue;
+
+				if (ptData.transaction()->Deadline < minDeadline)
+					continue;
+
+				auto entrySize = sizeof(Hash256) + sizeof(model::Cosignature) * ptData.cosignatures().size();
+				model::CosignedTransactionInfo transactionInfo;
+				transactionInfo.EntityHash = ptData.entityHash();
+				transactionInfo.Cosignatures = ptData.cosignatures();
+
+				// only add the transaction if it is unknown
+				if (!isKnown) {
+					transactionInfo.pTransaction = ptData.transaction();
+					entrySize += transactionInfo.pTransaction->Size;
+				}
 
-			auto entrySize = sizeof(Hash256) + sizeof(model::Cosignature) * ptData.cosignatures().size();
-			model::CosignedTransactionInfo transactionInfo;
-			transactionInfo.EntityHash = ptData.entityHash();
-			transactionInfo.Cosignatures = ptData.cosignatures();
+				totalSize += entrySize;
+				if (totalSize > maxResponseSize.bytes())
+					break;
 
-			// only add the transaction if it is unknown
-			if (knownShortHashPairs.cend() == iter) {
-				transactionInfo.pTransaction = ptData.transaction();
-				entrySize += transactionInfo.pTransaction->Size;
+				unknownTransactionInfos.push_back(transactionInfo);
 			}
 
-			totalSize += entrySize;
-			if (totalSize > m_maxResponseSize.bytes())
-				break;
-
-			unknownTransactionInfos.push_back(transactionInfo);
+			return unknownTransactionInfos;
 		}
+	}
+
+	MemoryPtCacheView::UnknownTransactionInfos MemoryPtCacheView::unknownTransactions(
+			Timestamp minDeadline,
+			const ShortHashPairMap& knownShortHashPairs) const {
+		return FindUnknownTransactions(
+				m_transactionDataContainer,
+				m_maxResponseSize,
+				minDeadline,
+				[&knownShortHashPairs](auto transactionShortHash) {
+					return knownShortHashPairs.cend() != knownShortHashPairs.find(transactionShortHash);
+				},
+				[&knownShortHashPairs](const auto& shortHashPair) {
+					return knownShortHashPairs.find(shortHashPair.TransactionShortHash)->second == shortHashPair.CosignaturesShortHash;
+				});
+	}
 
-		return unknownTransactionInfos;
+	MemoryPtCacheView::UnknownTransactionInfos MemoryPtCacheView::filteredUnknownTransactions(
+			Timestamp minDeadline,
+			const ShortHashPairFilter& knownShortHashPairsFilter) const {
+		return FindUnknownTransactions(
+				m_transactionDataContainer,
+				m_maxResponseSize,
+				minDeadline,
+				[&knownShortHashPairsFilter](auto transactionShortHash) {
+					return MightContainTransaction(knownShortHashPairsFilter, transactionShortHash);
+				},
+				[&knownShortHashPairsFilter](const auto& shortHashPair) {
+					return MightContain(knownShortHashPairsFilter, shortHashPair);
+				});
 	}
 
 	// endregion
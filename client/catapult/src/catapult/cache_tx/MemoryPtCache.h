@@ -30,7 +30,12 @@
 #include "catapult/utils/SpinReaderWriterLock.h"
 #include <unordered_map>
 
-namespace catapult { namespace cache { class PtData; } }
+namespace catapult {
+	namespace cache {
+		class PtData;
+		struct ShortHashPairFilter;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -69,6 +74,13 @@ namespace catapult { namespace cache {
 		/// and do not have a short hash pair in \a knownShortHashPairs.
 		UnknownTransactionInfos unknownTransactions(Timestamp minDeadline, const ShortHashPairMap& knownShortHashPairs) const;
 
+		/// Gets a vector of all unknown transaction infos in the cache that have a deadline at least \a minDeadline
+		/// and do not have a short hash pair in \a knownShortHashPairsFilter.
+		/// \note False positives of \a knownShortHashPairsFilter are excluded.
+		UnknownTransactionInfos filteredUnknownTransactions(
+				Timestamp minDeadline,
+				const ShortHashPairFilter& knownShortHashPairsFilter) const;
+
 	private:
 		utils::FileSize m_maxResponseSize;
 		utils::FileSize m_cacheSize;
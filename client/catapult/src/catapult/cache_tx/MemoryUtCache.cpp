@@ -22,8 +22,12 @@
 #include "MemoryUtCache.h"
 #include "AccountWeights.h"
 #include "CacheSizeLogger.h"
+#include "ShortHashFilters.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/FeeUtils.h"
+#include <cstring>
+#include <mutex>
+#include <optional>
 
 namespace catapult { namespace cache {
 
@@ -48,75 +52,280 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	struct TransactionFeeMultiplierKey {
+	public:
+		TransactionFeeMultiplierKey(BlockFeeMultiplier maxFeeMultiplier, size_t id)
+				: MaxFeeMultiplier(maxFeeMultiplier)
+				, Id(id)
+				, pData(nullptr)
+		{}
+
+		explicit TransactionFeeMultiplierKey(const TransactionData& data)
+				: MaxFeeMultiplier(model::CalculateTransactionMaxFeeMultiplier(*data.pEntity))
+				, Id(data.Id)
+				, pData(&data)
+		{}
+
+	public:
+		bool operator<(const TransactionFeeMultiplierKey& rhs) const {
+			return MaxFeeMultiplier == rhs.MaxFeeMultiplier ? Id < rhs.Id : MaxFeeMultiplier > rhs.MaxFeeMultiplier;
+		}
+
+	public:
+		BlockFeeMultiplier MaxFeeMultiplier;
+		size_t Id;
+		const TransactionData* pData;
+	};
+
+	struct UtCacheShard {
+	public:
+		cache::TransactionDataContainer TransactionDataContainer;
+		TransactionFeeMultiplierIndex FeeMultiplierIndex;
+		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		utils::FileSize CacheSize;
+		mutable utils::SpinReaderWriterLock Lock;
+	};
+
+	namespace {
+		// region shard utils
+
+		size_t GetShardIndex(const Hash256& hash, size_t numShards) {
+			// skip bytes used by ArrayHasher so that shard assignment is independent of IdLookup bucket assignment
+			size_t value;
+			std::memcpy(static_cast<void*>(&value), &hash[Hash256::Size - sizeof(size_t)], sizeof(size_t));
+			return value % numShards;
+		}
+
+		template<typename TShards, typename TAccessor>
+		auto Sum(const TShards& shards, TAccessor accessor) {
+			decltype(accessor(*shards[0])) sum = 0;
+			for (const auto& pShard : shards)
+				sum += accessor(*pShard);
+
+			return sum;
+		}
+
+		// endregion
+
+		// region cursors
+
+		template<typename TContainer>
+		class ContainerCursor {
+		public:
+			explicit ContainerCursor(const TContainer& container)
+					: m_iter(container.cbegin())
+					, m_endIter(container.cend())
+			{}
+
+		public:
+			bool isEnd() const {
+				return m_endIter == m_iter;
+			}
+
+			const auto& current() const {
+				return *m_iter;
+			}
+
+			void next() {
+				++m_iter;
+			}
+
+		private:
+			typename TContainer::const_iterator m_iter;
+			typename TContainer::const_iterator m_endIter;
+		};
+
+		// index is ordered by decreasing max fee multiplier, so visit groups of equal max fee multipliers in reverse
+		// but visit the transactions within each group in index (arrival) order
+		class AscendingFeeMultiplierCursor {
+		public:
+			explicit AscendingFeeMultiplierCursor(const TransactionFeeMultiplierIndex& index)
+					: m_index(index)
+					, m_groupBeginIter(index.cend())
+					, m_groupEndIter(index.cend())
+					, m_iter(index.cend()) {
+				moveToPreviousGroup();
+			}
+
+		public:
+			bool isEnd() const {
+				return m_groupEndIter == m_iter;
+			}
+
+			const auto& current() const {
+				return *m_iter;
+			}
+
+			void next() {
+				if (m_groupEndIter == ++m_iter)
+					moveToPreviousGroup();
+			}
+
+		private:
+			void moveToPreviousGroup() {
+				if (m_index.cbegin() == m_groupBeginIter) {
+					m_groupEndIter = m_groupBeginIter;
+					m_iter = m_groupBeginIter;
+					return;
+				}
+
+				m_groupEndIter = m_groupBeginIter;
+				auto maxFeeMultiplier = std::prev(m_groupEndIter)->MaxFeeMultiplier;
+				m_groupBeginIter = m_index.lower_bound(TransactionFeeMultiplierKey(maxFeeMultiplier, 0));
+				m_iter = m_groupBeginIter;
+			}
+
+		private:
+			const TransactionFeeMultiplierIndex& m_index;
+			TransactionFeeMultiplierIndex::const_iterator m_groupBeginIter;
+			TransactionFeeMultiplierIndex::const_iterator m_groupEndIter;
+			TransactionFeeMultiplierIndex::const_iterator m_iter;
+		};
+
+		// calls consumer with the current elements of all cursors in the order defined by isBefore
+		// until all are consumed or false is returned by consumer
+		// (number of shards is small, so a linear scan is used to find the next cursor)
+		template<typename TCursor, typename TIsBefore, typename TConsumer>
+		void ForEachMerged(std::vector<TCursor>& cursors, TIsBefore isBefore, TConsumer consumer) {
+			for (;;) {
+				TCursor* pNextCursor = nullptr;
+				for (auto& cursor : cursors) {
+					if (cursor.isEnd())
+						continue;
+
+					if (!pNextCursor || isBefore(cursor.current(), pNextCursor->current()))
+						pNextCursor = &cursor;
+				}
+
+				if (!pNextCursor || !consumer(pNextCursor->current()))
+					return;
+
+				pNextCursor->next();
+			}
+		}
+
+		template<typename TShards, typename TConsumer>
+		void ForEachData(const TShards& shards, TConsumer consumer) {
+			using Cursor = ContainerCursor<TransactionDataContainer>;
+			std::vector<Cursor> cursors;
+			for (const auto& pShard : shards)
+				cursors.emplace_back(pShard->TransactionDataContainer);
+
+			ForEachMerged(cursors, [](const auto& lhs, const auto& rhs) { return lhs.Id < rhs.Id; }, consumer);
+		}
+
+		// endregion
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			utils::FileSize maxResponseSize,
-			utils::FileSize cacheSize,
-			const TransactionDataContainer& transactionDataContainer,
-			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			std::vector<const UtCacheShard*>&& shards,
+			ReaderLockGuards&& readLocks)
 			: m_maxResponseSize(maxResponseSize)
-			, m_cacheSize(cacheSize)
-			, m_transactionDataContainer(transactionDataContainer)
-			, m_idLookup(idLookup)
-			, m_readLock(std::move(readLock))
+			, m_shards(std::move(shards))
+			, m_readLocks(std::move(readLocks))
 	{}
 
 	size_t MemoryUtCacheView::size() const {
-		return m_transactionDataContainer.size();
+		return Sum(m_shards, [](const auto& shard) { return shard.TransactionDataContainer.size(); });
 	}
 
 	utils::FileSize MemoryUtCacheView::memorySize() const {
-		return m_cacheSize;
+		return utils::FileSize::FromBytes(Sum(m_shards, [](const auto& shard) { return shard.CacheSize.bytes(); }));
 	}
 
 	bool MemoryUtCacheView::contains(const Hash256& hash) const {
-		return m_idLookup.cend() != m_idLookup.find(hash);
+		const auto& idLookup = m_shards[GetShardIndex(hash, m_shards.size())]->IdLookup;
+		return idLookup.cend() != idLookup.find(hash);
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
-		}
+		ForEachData(m_shards, consumer);
+	}
+
+	void MemoryUtCacheView::forEachByAscendingFeeMultiplier(const TransactionInfoConsumer& consumer) const {
+		std::vector<AscendingFeeMultiplierCursor> cursors;
+		for (const auto* pShard : m_shards)
+			cursors.emplace_back(pShard->FeeMultiplierIndex);
+
+		ForEachMerged(
+				cursors,
+				[](const auto& lhs, const auto& rhs) {
+					return lhs.MaxFeeMultiplier == rhs.MaxFeeMultiplier ? lhs.Id < rhs.Id : lhs.MaxFeeMultiplier < rhs.MaxFeeMultiplier;
+				},
+				[&consumer](const auto& key) { return consumer(*key.pData); });
+	}
+
+	void MemoryUtCacheView::forEachByDescendingFeeMultiplier(const TransactionInfoConsumer& consumer) const {
+		std::vector<ContainerCursor<TransactionFeeMultiplierIndex>> cursors;
+		for (const auto* pShard : m_shards)
+			cursors.emplace_back(pShard->FeeMultiplierIndex);
+
+		ForEachMerged(cursors, std::less<TransactionFeeMultiplierKey>(), [&consumer](const auto& key) {
+			return consumer(*key.pData);
+		});
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
-		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
+		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(size());
 		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
+		ForEachData(m_shards, [&shortHashesIter](const auto& data) {
 			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
+			return true;
+		});
 
 		return shortHashes;
 	}
 
+	namespace {
+		template<typename TIsKnown>
+		std::vector<std::shared_ptr<const model::Transaction>> FindUnknownTransactions(
+				const std::vector<const UtCacheShard*>& shards,
+				utils::FileSize maxResponseSize,
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				TIsKnown isKnown) {
+			uint64_t totalSize = 0;
+			std::vector<std::shared_ptr<const model::Transaction>> transactions;
+			ForEachData(shards, [maxResponseSize, minDeadline, minFeeMultiplier, isKnown, &totalSize, &transactions](const auto& data) {
+				if (data.pEntity->Deadline < minDeadline)
+					return true;
+
+				if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
+					return true;
+
+				if (!isKnown(utils::ToShortHash(data.EntityHash))) {
+					auto pTransaction = data.pEntity;
+					totalSize += pTransaction->Size;
+					if (totalSize > maxResponseSize.bytes())
+						return false;
+
+					transactions.push_back(pTransaction);
+				}
+
+				return true;
+			});
+
+			return transactions;
+		}
+	}
+
 	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::unknownTransactions(
 			Timestamp minDeadline,
 			BlockFeeMultiplier minFeeMultiplier,
 			const utils::ShortHashesSet& knownShortHashes) const {
-		uint64_t totalSize = 0;
-		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			if (data.pEntity->Deadline < minDeadline)
-				continue;
-
-			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
-
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize.bytes())
-					break;
-
-				transactions.push_back(pTransaction);
-			}
-		}
+		auto isKnown = [&knownShortHashes](auto shortHash) { return knownShortHashes.cend() != knownShortHashes.find(shortHash); };
+		return FindUnknownTransactions(m_shards, m_maxResponseSize, minDeadline, minFeeMultiplier, isKnown);
+	}
 
-		return transactions;
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::filteredUnknownTransactions(
+			Timestamp minDeadline,
+			BlockFeeMultiplier minFeeMultiplier,
+			const utils::BloomFilter& knownShortHashesFilter) const {
+		auto isKnown = [&knownShortHashesFilter](auto shortHash) { return MightContain(knownShortHashesFilter, shortHash); };
+		return FindUnknownTransactions(m_shards, m_maxResponseSize, minDeadline, minFeeMultiplier, isKnown);
 	}
 
 	// endregion
@@ -126,68 +335,74 @@ namespace catapult { namespace cache {
 	namespace {
 		class MemoryUtCacheModifier : public UtCacheModifier {
 		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+			using WriterLockGuard = utils::SpinReaderWriterLock::WriterLockGuard;
 
 		public:
 			MemoryUtCacheModifier(
 					utils::FileSize maxCacheSize,
-					utils::FileSize& cacheSize,
 					size_t& idSequence,
-					TransactionDataContainer& transactionDataContainer,
-					IdLookup& idLookup,
+					std::vector<std::unique_ptr<UtCacheShard>>& shards,
 					AccountWeights& weights,
-					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+					std::unique_lock<std::mutex>&& modifierLock)
 					: m_maxCacheSize(maxCacheSize)
-					, m_cacheSize(cacheSize)
 					, m_idSequence(idSequence)
-					, m_transactionDataContainer(transactionDataContainer)
-					, m_idLookup(idLookup)
+					, m_shards(shards)
 					, m_weights(weights)
-					, m_writeLock(std::move(writeLock))
+					, m_modifierLock(std::move(modifierLock))
 			{}
 
 		public:
 			size_t size() const override {
-				return m_transactionDataContainer.size();
+				return Sum(m_shards, [](const auto& shard) { return shard.TransactionDataContainer.size(); });
 			}
 
 			utils::FileSize memorySize() const override {
-				return m_cacheSize;
+				return utils::FileSize::FromBytes(Sum(m_shards, [](const auto& shard) { return shard.CacheSize.bytes(); }));
 			}
 
 			bool add(const model::TransactionInfo& transactionInfo) override {
 				auto transactionSize = transactionInfo.pEntity->Size;
-				if (m_maxCacheSize.bytes() - m_cacheSize.bytes() < transactionSize)
+				auto cacheSize = memorySize();
+				if (m_maxCacheSize.bytes() - cacheSize.bytes() < transactionSize)
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				// shards are only modified by the (single) active modifier, so they can be read without acquiring shard locks
+				auto& shard = *m_shards[GetShardIndex(transactionInfo.EntityHash, m_shards.size())];
+				if (shard.IdLookup.cend() != shard.IdLookup.find(transactionInfo.EntityHash))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				{
+					auto writeLock = lockShard(shard);
+					shard.IdLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
+					auto dataIter = shard.TransactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+					shard.FeeMultiplierIndex.emplace(*dataIter);
+					shard.CacheSize = utils::FileSize::FromBytes(shard.CacheSize.bytes() + transactionSize);
+				}
 
 				m_weights.increment(transactionInfo.pEntity->SignerPublicKey, transactionSize);
 
-				auto oldCacheSize = m_cacheSize;
-				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() + transactionSize);
-				LogSizes("unconfirmed transactions", oldCacheSize, m_cacheSize, m_maxCacheSize);
+				auto newCacheSize = utils::FileSize::FromBytes(cacheSize.bytes() + transactionSize);
+				LogSizes("unconfirmed transactions", cacheSize, newCacheSize, m_maxCacheSize);
 				return true;
 			}
 
 			model::TransactionInfo remove(const Hash256& hash) override {
-				auto iter = m_idLookup.find(hash);
-				if (m_idLookup.cend() == iter)
+				auto& shard = *m_shards[GetShardIndex(hash, m_shards.size())];
+				auto iter = shard.IdLookup.find(hash);
+				if (shard.IdLookup.cend() == iter)
 					return model::TransactionInfo();
 
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
+				auto writeLock = lockShard(shard);
+				auto dataIter = shard.TransactionDataContainer.find(TransactionData(iter->second));
 				auto erasedInfo = dataIter->copy();
 
 				auto transactionSize = dataIter->pEntity->Size;
 				m_weights.decrement(dataIter->pEntity->SignerPublicKey, transactionSize);
-				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() - transactionSize);
+				shard.CacheSize = utils::FileSize::FromBytes(shard.CacheSize.bytes() - transactionSize);
 
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
+				shard.FeeMultiplierIndex.erase(TransactionFeeMultiplierKey(*dataIter));
+				shard.TransactionDataContainer.erase(dataIter);
+				shard.IdLookup.erase(iter);
 				return erasedInfo;
 			}
 
@@ -196,31 +411,54 @@ namespace catapult { namespace cache {
 			}
 
 			std::vector<model::TransactionInfo> removeAll() override {
-				if (!m_transactionDataContainer.empty())
-					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
-
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
+				// lock all shards (in order) until this modifier is destroyed so that views never observe transactions
+				// that are removed here and subsequently readded
+				if (m_shardLocks.empty()) {
+					m_shardLocks.reserve(m_shards.size());
+					for (auto& pShard : m_shards)
+						m_shardLocks.push_back(pShard->Lock.acquireWriter());
+				}
+
+				auto numTransactions = size();
+				if (0 != numTransactions)
+					CATAPULT_LOG(debug) << "removing " << numTransactions << " elements from ut cache";
+
+				// unfortunately cannot just move transaction data containers because they contain a different (derived) type
 				std::vector<model::TransactionInfo> transactionInfosCopy;
-				transactionInfosCopy.reserve(m_transactionDataContainer.size());
+				transactionInfosCopy.reserve(numTransactions);
 
-				for (const auto& data : m_transactionDataContainer)
+				ForEachData(m_shards, [&transactionInfosCopy](const auto& data) {
 					transactionInfosCopy.emplace_back(data.copy());
+					return true;
+				});
+
+				for (auto& pShard : m_shards) {
+					pShard->CacheSize = utils::FileSize();
+					pShard->TransactionDataContainer.clear();
+					pShard->FeeMultiplierIndex.clear();
+					pShard->IdLookup.clear();
+				}
 
-				m_cacheSize = utils::FileSize();
-				m_transactionDataContainer.clear();
-				m_idLookup.clear();
 				m_weights.reset();
 				return transactionInfosCopy;
 			}
 
+		private:
+			std::optional<WriterLockGuard> lockShard(UtCacheShard& shard) {
+				// all shards are already locked after removeAll
+				if (!m_shardLocks.empty())
+					return std::nullopt;
+
+				return shard.Lock.acquireWriter();
+			}
+
 		private:
 			utils::FileSize m_maxCacheSize;
-			utils::FileSize& m_cacheSize;
 			size_t& m_idSequence;
-			TransactionDataContainer& m_transactionDataContainer;
-			IdLookup& m_idLookup;
+			std::vector<std::unique_ptr<UtCacheShard>>& m_shards;
 			AccountWeights& m_weights;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			std::unique_lock<std::mutex> m_modifierLock;
+			std::vector<WriterLockGuard> m_shardLocks;
 		};
 	}
 
@@ -229,41 +467,48 @@ namespace catapult { namespace cache {
 	// region MemoryUtCache
 
 	struct MemoryUtCache::Impl {
-		cache::TransactionDataContainer TransactionDataContainer;
-		utils::FileSize CacheSize;
+	public:
+		explicit Impl(size_t numShards) : IdSequence(0) {
+			for (auto i = 0u; i < numShards; ++i)
+				Shards.push_back(std::make_unique<UtCacheShard>());
+		}
 
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+	public:
+		size_t IdSequence;
+		std::vector<std::unique_ptr<UtCacheShard>> Shards;
 		AccountWeights Weights;
+		std::mutex ModifierMutex;
 	};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
 			: m_options(options)
-			, m_idSequence(0)
-			, m_pImpl(std::make_unique<Impl>())
+			, m_pImpl(std::make_unique<Impl>(std::max<size_t>(1, options.NumShards)))
 	{}
 
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(
-				m_options.MaxResponseSize,
-				m_pImpl->CacheSize,
-				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
-				std::move(readLock));
+		// acquire shard locks in the same order as removeAll to avoid deadlocks
+		std::vector<const UtCacheShard*> shards;
+		std::vector<utils::SpinReaderWriterLock::ReaderLockGuard> readLocks;
+		shards.reserve(m_pImpl->Shards.size());
+		readLocks.reserve(m_pImpl->Shards.size());
+		for (const auto& pShard : m_pImpl->Shards) {
+			readLocks.push_back(pShard->Lock.acquireReader());
+			shards.push_back(pShard.get());
+		}
+
+		return MemoryUtCacheView(m_options.MaxResponseSize, std::move(shards), std::move(readLocks));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
-		auto writeLock = m_lock.acquireWriter();
+		std::unique_lock<std::mutex> modifierLock(m_pImpl->ModifierMutex);
 		return UtCacheModifierProxy(std::make_unique<MemoryUtCacheModifier>(
 				m_options.MaxCacheSize,
-				m_pImpl->CacheSize,
-				m_idSequence,
-				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
+				m_pImpl->IdSequence,
+				m_pImpl->Shards,
 				m_pImpl->Weights,
-				std::move(writeLock)));
+				std::move(modifierLock)));
 	}
 
 	// endregion
@@ -29,7 +29,14 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct TransactionData;
+		struct TransactionFeeMultiplierKey;
+		struct UtCacheShard;
+	}
+	namespace utils { class BloomFilter; }
+}
 
 namespace catapult { namespace cache {
 
@@ -37,22 +44,22 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Secondary index of transaction data ordered by decreasing max fee multiplier and then by increasing arrival.
+	/// \note std::set is used to allow incomplete type.
+	using TransactionFeeMultiplierIndex = std::set<TransactionFeeMultiplierKey>;
+
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
-		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
+		using ReaderLockGuards = std::vector<utils::SpinReaderWriterLock::ReaderLockGuard>;
 
 	public:
-		/// Creates a view around a maximum response size (\a maxResponseSize), current cache size (\a cacheSize),
-		/// a transaction data container (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
-		MemoryUtCacheView(
-				utils::FileSize maxResponseSize,
-				utils::FileSize cacheSize,
-				const TransactionDataContainer& transactionDataContainer,
-				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around a maximum response size (\a maxResponseSize) and all cache shards (\a shards)
+		/// with lock contexts \a readLocks.
+		/// \note \a readLocks must contain a reader lock for each shard.
+		MemoryUtCacheView(utils::FileSize maxResponseSize, std::vector<const UtCacheShard*>&& shards, ReaderLockGuards&& readLocks);
 
 	public:
 		/// Gets the number of unconfirmed transactions in the cache.
@@ -67,6 +74,16 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos in order of increasing max fee multiplier
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are consumed from oldest to newest.
+		void forEachByAscendingFeeMultiplier(const TransactionInfoConsumer& consumer) const;
+
+		/// Calls \a consumer with all transaction infos in order of decreasing max fee multiplier
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are consumed from oldest to newest.
+		void forEachByDescendingFeeMultiplier(const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// \note Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -78,12 +95,18 @@ namespace catapult { namespace cache {
 				BlockFeeMultiplier minFeeMultiplier,
 				const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a vector of all transactions in the cache that have a deadline at least \a minDeadline,
+		/// a fee multiplier at least \a minFeeMultiplier and do not have a short hash in \a knownShortHashesFilter.
+		/// \note False positives of \a knownShortHashesFilter are excluded.
+		UnknownTransactions filteredUnknownTransactions(
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::BloomFilter& knownShortHashesFilter) const;
+
 	private:
 		utils::FileSize m_maxResponseSize;
-		utils::FileSize m_cacheSize;
-		const TransactionDataContainer& m_transactionDataContainer;
-		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		std::vector<const UtCacheShard*> m_shards;
+		ReaderLockGuards m_readLocks;
 	};
 
 	/// Interface (read write) for caching unconfirmed transactions.
@@ -94,6 +117,9 @@ namespace catapult { namespace cache {
 	};
 
 	/// Cache for all unconfirmed transactions.
+	/// \note Transactions are partitioned by hash into independently locked shards.
+	///       Modifiers are serialized, but each add or remove only blocks views while it is updating a single shard.
+	///       A modifier that has removed all transactions blocks views until it is destroyed.
 	class MemoryUtCache : public ReadWriteUtCache {
 	public:
 		using CacheWriteOnlyInterface = UtCache;
@@ -116,9 +142,7 @@ namespace catapult { namespace cache {
 
 	private:
 		MemoryCacheOptions m_options;
-		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
 	};
 
 	/// Delegating proxy around a MemoryUtCache.
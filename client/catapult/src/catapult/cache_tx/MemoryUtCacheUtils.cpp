@@ -30,66 +30,61 @@ namespace catapult { namespace cache {
 		return GetFirstTransactionInfoPointers(utCacheView, transactionLimit, countRetriever, [](const auto&) { return true; });
 	}
 
-	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
-			const MemoryUtCacheView& utCacheView,
-			uint32_t transactionLimit,
-			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo&>& filter) {
-		std::vector<const model::TransactionInfo*> transactionInfoPointers;
-		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
+	namespace {
+		template<typename TForEach>
+		std::vector<const model::TransactionInfo*> SelectFirstTransactionInfoPointers(
+				size_t utCacheSize,
+				uint32_t transactionLimit,
+				const EmbeddedCountRetriever& countRetriever,
+				const predicate<const model::TransactionInfo&>& filter,
+				TForEach forEach) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			transactionInfoPointers.reserve(std::min<size_t>(utCacheSize, transactionLimit));
 
-		if (0 != transactionLimit) {
-			uint32_t totalTransactionsCount = 0;
-			utCacheView.forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
-					const auto& transactionInfo) {
-				auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
-				if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-					return false;
+			if (0 != transactionLimit) {
+				uint32_t totalTransactionsCount = 0;
+				forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
+						const auto& transactionInfo) {
+					auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
+					if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
+						return false;
 
-				if (filter(transactionInfo)) {
-					totalTransactionsCount += currentTransactionsCount;
-					transactionInfoPointers.push_back(&transactionInfo);
-				}
+					if (filter(transactionInfo)) {
+						totalTransactionsCount += currentTransactionsCount;
+						transactionInfoPointers.push_back(&transactionInfo);
+					}
 
-				return true;
-			});
-		}
+					return true;
+				});
+			}
 
-		return transactionInfoPointers;
+			return transactionInfoPointers;
+		}
 	}
 
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
 			const predicate<const model::TransactionInfo&>& filter) {
-		// 1. load all UTs
-		std::vector<const model::TransactionInfo*> allTransactionInfoPointers;
-		allTransactionInfoPointers.reserve(utCacheView.size());
-		utCacheView.forEach([&allTransactionInfoPointers](const auto& transactionInfo) {
-			allTransactionInfoPointers.push_back(&transactionInfo);
-			return true;
+		return SelectFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, [&utCacheView](
+				const auto& consumer) {
+			utCacheView.forEach(consumer);
 		});
+	}
 
-		// 2. sort by predicate (use stable_sort to prefer older when otherwise equal)
-		std::sort(allTransactionInfoPointers.begin(), allTransactionInfoPointers.end(), sortComparer);
-
-		// 3. select candidates
-		uint32_t totalTransactionsCount = 0;
-		std::vector<const model::TransactionInfo*> candidateTransactionInfoPointers;
-		candidateTransactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
-		for (const auto* pTransactionInfo : allTransactionInfoPointers) {
-			auto currentTransactionsCount = countRetriever(*pTransactionInfo->pEntity);
-			if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-				break;
-
-			if (filter(*pTransactionInfo)) {
-				totalTransactionsCount += currentTransactionsCount;
-				candidateTransactionInfoPointers.push_back(pTransactionInfo);
-			}
-		}
-
-		return candidateTransactionInfoPointers;
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			FeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		return SelectFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, [&utCacheView, order](
+				const auto& consumer) {
+			if (FeeMultiplierOrder::Ascending == order)
+				utCacheView.forEachByAscendingFeeMultiplier(consumer);
+			else
+				utCacheView.forEachByDescendingFeeMultiplier(consumer);
+		});
 	}
 }}
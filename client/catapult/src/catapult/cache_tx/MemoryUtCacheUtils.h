@@ -27,6 +27,15 @@ namespace catapult { namespace cache {
 	/// Retrieves the number of transactions contained within a top-level transaction.
 	using EmbeddedCountRetriever = std::function<uint32_t (const model::Transaction&)>;
 
+	/// Order in which transaction infos are selected by max fee multiplier.
+	enum class FeeMultiplierOrder {
+		/// Transaction infos with smallest max fee multipliers are selected first.
+		Ascending,
+
+		/// Transaction infos with largest max fee multipliers are selected first.
+		Descending
+	};
+
 	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView
 	/// where \a countRetriever returns the total number of transactions contained within a top-level transaction.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
@@ -44,13 +53,15 @@ namespace catapult { namespace cache {
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter);
 
-	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter after sorting
-	/// by \a sortComparer where \a countRetriever returns the total number of transactions contained within a top-level transaction.
+	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter when ordered
+	/// by max fee multiplier (\a order) where \a countRetriever returns the total number of transactions contained within
+	/// a top-level transaction.
+	/// \note This uses the fee multiplier index of \a utCacheView and only visits transaction infos until \a transactionLimit is reached.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+			FeeMultiplierOrder order,
 			const predicate<const model::TransactionInfo&>& filter);
 }}
@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashFilters.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		uint64_t ToKey(utils::ShortHash shortHash) {
+			return shortHash.unwrap();
+		}
+
+		uint64_t ToKey(const ShortHashPair& shortHashPair) {
+			return static_cast<uint64_t>(shortHashPair.TransactionShortHash.unwrap()) << 32 | shortHashPair.CosignaturesShortHash.unwrap();
+		}
+	}
+
+	// region short hashes
+
+	utils::BloomFilter CreateShortHashesFilter(const model::ShortHashRange& shortHashes, uint32_t seed) {
+		utils::BloomFilter filter(shortHashes.size(), seed);
+		for (auto shortHash : shortHashes)
+			Insert(filter, shortHash);
+
+		return filter;
+	}
+
+	void Insert(utils::BloomFilter& filter, utils::ShortHash shortHash) {
+		filter.insert(ToKey(shortHash));
+	}
+
+	bool MightContain(const utils::BloomFilter& filter, utils::ShortHash shortHash) {
+		return filter.contains(ToKey(shortHash));
+	}
+
+	// endregion
+
+	// region short hash pairs
+
+	ShortHashPairFilter CreateShortHashPairFilter(const ShortHashPairRange& shortHashPairs, uint32_t seed) {
+		ShortHashPairFilter filter{
+			utils::BloomFilter(shortHashPairs.size(), seed),
+			utils::BloomFilter(shortHashPairs.size(), seed)
+		};
+		for (const auto& shortHashPair : shortHashPairs)
+			Insert(filter, shortHashPair);
+
+		return filter;
+	}
+
+	void Insert(ShortHashPairFilter& filter, const ShortHashPair& shortHashPair) {
+		filter.TransactionShortHashes.insert(ToKey(shortHashPair.TransactionShortHash));
+		filter.ShortHashPairs.insert(ToKey(shortHashPair));
+	}
+
+	bool MightContainTransaction(const ShortHashPairFilter& filter, utils::ShortHash transactionShortHash) {
+		return filter.TransactionShortHashes.contains(ToKey(transactionShortHash));
+	}
+
+	bool MightContain(const ShortHashPairFilter& filter, const ShortHashPair& shortHashPair) {
+		return filter.ShortHashPairs.contains(ToKey(shortHashPair));
+	}
+
+	// endregion
+}}
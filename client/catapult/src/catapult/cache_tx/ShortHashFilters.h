@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHashPair.h"
+#include "catapult/model/RangeTypes.h"
+#include "catapult/utils/BloomFilter.h"
+
+namespace catapult { namespace cache {
+
+	// region short hashes
+
+	/// Creates a filter composed of all \a shortHashes with bit positions randomized by \a seed.
+	utils::BloomFilter CreateShortHashesFilter(const model::ShortHashRange& shortHashes, uint32_t seed);
+
+	/// Inserts \a shortHash into \a filter.
+	void Insert(utils::BloomFilter& filter, utils::ShortHash shortHash);
+
+	/// Returns \c true if \a shortHash might be contained in \a filter.
+	bool MightContain(const utils::BloomFilter& filter, utils::ShortHash shortHash);
+
+	// endregion
+
+	// region short hash pairs
+
+	/// Probabilistic set of short hash pairs.
+	struct ShortHashPairFilter {
+	public:
+		/// Transaction short hashes.
+		utils::BloomFilter TransactionShortHashes;
+
+		/// Short hash pairs.
+		utils::BloomFilter ShortHashPairs;
+	};
+
+	/// Creates a filter composed of all \a shortHashPairs with bit positions randomized by \a seed.
+	ShortHashPairFilter CreateShortHashPairFilter(const ShortHashPairRange& shortHashPairs, uint32_t seed);
+
+	/// Inserts \a shortHashPair into \a filter.
+	void Insert(ShortHashPairFilter& filter, const ShortHashPair& shortHashPair);
+
+	/// Returns \c true if a short hash pair with transaction short hash \a transactionShortHash might be contained in \a filter.
+	bool MightContainTransaction(const ShortHashPairFilter& filter, utils::ShortHash transactionShortHash);
+
+	/// Returns \c true if \a shortHashPair might be contained in \a filter.
+	bool MightContain(const ShortHashPairFilter& filter, const ShortHashPair& shortHashPair);
+
+	// endregion
+}}
@@ -23,6 +23,11 @@
 #include "ProcessContextsBuilder.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_set>
 
 using namespace catapult::validators;
 
@@ -31,7 +36,9 @@ namespace catapult { namespace chain {
 	namespace {
 		class DefaultBatchEntityProcessor {
 		public:
-			explicit DefaultBatchEntityProcessor(const ExecutionConfiguration& config) : m_config(config)
+			DefaultBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool* pPool)
+					: m_config(config)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -43,6 +50,9 @@ namespace catapult { namespace chain {
 				if (entityInfos.empty())
 					return ValidationResult::Neutral;
 
+				if (m_config.pStatePrefetcher)
+					prefetch(entityInfos, state.Cache);
+
 				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
 				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
 				auto validatorContext = contextBuilder.buildValidatorContext();
@@ -58,12 +68,373 @@ namespace catapult { namespace chain {
 				return ValidationResult::Success;
 			}
 
+		private:
+			void prefetch(const model::WeakEntityInfos& entityInfos, const cache::CatapultCacheDelta& cache) const {
+				if (m_pPool)
+					m_config.pStatePrefetcher->prefetch(entityInfos, *m_config.pNotificationPublisher, cache, *m_pPool);
+				else
+					m_config.pStatePrefetcher->prefetch(entityInfos, *m_config.pNotificationPublisher, cache);
+			}
+
+		private:
+			ExecutionConfiguration m_config;
+			thread::IoThreadPool* m_pPool;
+		};
+
+		// region speculation
+
+		struct SpeculativeNotificationRecord {
+			model::NotificationType Type;
+			model::NotificationAccess Access;
+			bool HasResult = false;
+			ValidationResult Result = ValidationResult::Success;
+		};
+
+		struct SpeculativeEntityRecords {
+			std::vector<SpeculativeNotificationRecord> Notifications;
+			bool IsComplete = false;
+		};
+
+		// validates notifications against the state at the start of the batch and records the state they access
+		class SpeculativeValidationSubscriber : public model::NotificationSubscriber {
+		public:
+			SpeculativeValidationSubscriber(
+					const model::NotificationAccessExtractor& accessExtractor,
+					const stateful::NotificationValidator& validator,
+					const ValidatorContext& validatorContext,
+					SpeculativeEntityRecords& records)
+					: m_accessExtractor(accessExtractor)
+					, m_validator(validator)
+					, m_validatorContext(validatorContext)
+					, m_records(records)
+					, m_isStopped(false)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				SpeculativeNotificationRecord record;
+				record.Type = notification.Type;
+				record.Access = m_accessExtractor.extract(notification, m_validatorContext.Resolvers);
+
+				// speculation is pointless after the first failure because the entity will be rejected
+				if (!m_isStopped && !record.Access.IsUnknown && IsSet(notification.Type, model::NotificationChannel::Validator))
+					validate(notification, record);
+
+				m_records.Notifications.push_back(std::move(record));
+			}
+
+		private:
+			void validate(const model::Notification& notification, SpeculativeNotificationRecord& record) {
+				try {
+					record.Result = m_validator.validate(notification, m_validatorContext);
+					record.HasResult = true;
+					m_isStopped = !IsValidationResultSuccess(record.Result);
+				} catch (const std::exception&) {
+					// leave exceptions to be raised by serial validation
+					m_isStopped = true;
+				}
+			}
+
+		private:
+			const model::NotificationAccessExtractor& m_accessExtractor;
+			const stateful::NotificationValidator& m_validator;
+			const ValidatorContext& m_validatorContext;
+			SpeculativeEntityRecords& m_records;
+			bool m_isStopped;
+		};
+
+		// tracks the state written by all notifications observed so far
+		class WrittenStateTracker {
+		public:
+			WrittenStateTracker() : m_isAllWritten(false)
+			{}
+
+		public:
+			bool isAnyRead(const model::NotificationAccess& access) const {
+				if (m_isAllWritten || access.IsUnknown)
+					return true;
+
+				return IsAnyContained(m_addresses, access.Reads.Addresses)
+						|| IsAnyContained(m_mosaicIds, access.Reads.MosaicIds)
+						|| IsAnyContained(m_hashes, access.Reads.Hashes);
+			}
+
+		public:
+			void markAllWritten() {
+				m_isAllWritten = true;
+			}
+
+			void add(const model::NotificationAccess& access) {
+				if (access.IsUnknown) {
+					markAllWritten();
+					return;
+				}
+
+				m_addresses.insert(access.Writes.Addresses.cbegin(), access.Writes.Addresses.cend());
+				m_mosaicIds.insert(access.Writes.MosaicIds.cbegin(), access.Writes.MosaicIds.cend());
+				m_hashes.insert(access.Writes.Hashes.cbegin(), access.Writes.Hashes.cend());
+			}
+
+		private:
+			template<typename TSet, typename TKeys>
+			static bool IsAnyContained(const TSet& set, const TKeys& keys) {
+				return std::any_of(keys.cbegin(), keys.cend(), [&set](const auto& key) { return set.cend() != set.find(key); });
+			}
+
+		private:
+			bool m_isAllWritten;
+			model::AddressSet m_addresses;
+			std::unordered_set<MosaicId, utils::BaseValueHasher<MosaicId>> m_mosaicIds;
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_hashes;
+		};
+
+		// state shared by the replay validator and observer during the serial phase
+		struct SpeculativeReplayState {
+			const SpeculativeNotificationRecord* pCurrentRecord = nullptr;
+			WrittenStateTracker Tracker;
+			size_t NumReusedResults = 0;
+		};
+
+		// reuses speculative results of notifications that do not read any state written since the start of the batch
+		class SpeculativeReplayValidator : public stateful::NotificationValidator {
+		public:
+			SpeculativeReplayValidator(const stateful::NotificationValidator& validator, SpeculativeReplayState& replayState)
+					: m_validator(validator)
+					, m_replayState(replayState)
+					, m_name("SpeculativeReplayValidator")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				const auto* pRecord = m_replayState.pCurrentRecord;
+				if (!pRecord || !pRecord->HasResult || m_replayState.Tracker.isAnyRead(pRecord->Access))
+					return m_validator.validate(notification, context);
+
+				++m_replayState.NumReusedResults;
+				return pRecord->Result;
+			}
+
+		private:
+			const stateful::NotificationValidator& m_validator;
+			SpeculativeReplayState& m_replayState;
+			std::string m_name;
+		};
+
+		// tracks the state written by observed notifications
+		class SpeculativeReplayObserver : public observers::NotificationObserver {
+		public:
+			SpeculativeReplayObserver(const observers::NotificationObserver& observer, SpeculativeReplayState& replayState)
+					: m_observer(observer)
+					, m_replayState(replayState)
+					, m_name("SpeculativeReplayObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			void notify(const model::Notification& notification, observers::ObserverContext& context) const override {
+				m_observer.notify(notification, context);
+
+				const auto* pRecord = m_replayState.pCurrentRecord;
+				if (pRecord)
+					m_replayState.Tracker.add(pRecord->Access);
+				else
+					m_replayState.Tracker.markAllWritten();
+			}
+
+		private:
+			const observers::NotificationObserver& m_observer;
+			SpeculativeReplayState& m_replayState;
+			std::string m_name;
+		};
+
+		// matches published notifications with speculative records before forwarding them for processing
+		class SpeculativeReplaySubscriber : public model::NotificationSubscriber {
+		public:
+			SpeculativeReplaySubscriber(
+					const SpeculativeEntityRecords& records,
+					SpeculativeReplayState& replayState,
+					model::NotificationSubscriber& subscriber)
+					: m_records(records)
+					, m_replayState(replayState)
+					, m_subscriber(subscriber)
+					, m_index(0)
+					, m_isMatching(records.IsComplete)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				// once records diverge from published notifications, all remaining notifications are processed serially
+				const auto& notifications = m_records.Notifications;
+				if (m_isMatching)
+					m_isMatching = m_index < notifications.size() && notifications[m_index].Type == notification.Type;
+
+				m_replayState.pCurrentRecord = m_isMatching ? &notifications[m_index++] : nullptr;
+				m_subscriber.notify(notification);
+				m_replayState.pCurrentRecord = nullptr;
+			}
+
+		private:
+			const SpeculativeEntityRecords& m_records;
+			SpeculativeReplayState& m_replayState;
+			model::NotificationSubscriber& m_subscriber;
+			size_t m_index;
+			bool m_isMatching;
+		};
+
+		class SpeculativeBatchEntityProcessor {
+		public:
+			SpeculativeBatchEntityProcessor(
+					const ExecutionConfiguration& config,
+					thread::IoThreadPool& pool,
+					const std::shared_ptr<SpeculativeValidationStatistics>& pStatistics)
+					: m_config(config)
+					, m_pool(pool)
+					, m_pStatistics(pStatistics) {
+				if (!m_config.pNotificationAccessExtractor)
+					CATAPULT_THROW_INVALID_ARGUMENT("speculative batch entity processor requires notification access extractor");
+			}
+
+		public:
+			ValidationResult operator()(
+					Height height,
+					Timestamp timestamp,
+					const model::WeakEntityInfos& entityInfos,
+					observers::ObserverState& state) const {
+				if (entityInfos.empty())
+					return ValidationResult::Neutral;
+
+				if (m_config.pStatePrefetcher)
+					m_config.pStatePrefetcher->prefetch(entityInfos, *m_config.pNotificationPublisher, state.Cache, m_pool);
+
+				// speculation only has read-only access to the cache and completes before any observer is executed
+				auto entityRecords = speculate(height, timestamp, entityInfos, state.Cache);
+
+				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
+				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
+				auto validatorContext = contextBuilder.buildValidatorContext();
+				auto observerContext = contextBuilder.buildObserverContext();
+
+				SpeculativeReplayState replayState;
+				SpeculativeReplayValidator validator(*m_config.pValidator, replayState);
+				SpeculativeReplayObserver observer(*m_config.pObserver, replayState);
+				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
+				auto result = ValidationResult::Success;
+				for (auto i = 0u; i < entityInfos.size(); ++i) {
+					SpeculativeReplaySubscriber replaySub(entityRecords[i], replayState, sub);
+					m_config.pNotificationPublisher->publish(entityInfos[i], replaySub);
+					if (!IsValidationResultSuccess(sub.result())) {
+						result = sub.result();
+						break;
+					}
+				}
+
+				m_pStatistics->addBatch(CountSpeculativeResults(entityRecords), replayState.NumReusedResults);
+				return result;
+			}
+
+		private:
+			static size_t CountSpeculativeResults(const std::vector<SpeculativeEntityRecords>& entityRecords) {
+				size_t numResults = 0;
+				for (const auto& records : entityRecords) {
+					for (const auto& record : records.Notifications) {
+						if (record.HasResult)
+							++numResults;
+					}
+				}
+
+				return numResults;
+			}
+
+			std::vector<SpeculativeEntityRecords> speculate(
+					Height height,
+					Timestamp timestamp,
+					const model::WeakEntityInfos& entityInfos,
+					const cache::CatapultCacheDelta& cache) const {
+				auto readOnlyCache = cache.toReadOnly();
+				auto resolverContext = m_config.ResolverContextFactory(readOnlyCache);
+				auto validatorContext = ValidatorContext(
+						model::NotificationContext(height, resolverContext),
+						timestamp,
+						m_config.Network,
+						readOnlyCache);
+
+				// all workers only read state, which is not modified until speculation completes
+				std::vector<SpeculativeEntityRecords> entityRecords(entityInfos.size());
+				thread::WorkStealingOptions options;
+				options.UseCallingThread = true;
+				thread::WorkStealingParallelForPartition(
+						m_pool.ioContext(),
+						entityInfos,
+						m_pool.numWorkerThreads(),
+						options,
+						[this, &validatorContext, &entityRecords](auto itBegin, auto itEnd, auto startIndex, auto) {
+							auto i = startIndex;
+							for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
+								auto& records = entityRecords[i];
+								SpeculativeValidationSubscriber sub(
+										*m_config.pNotificationAccessExtractor,
+										*m_config.pValidator,
+										validatorContext,
+										records);
+
+								try {
+									m_config.pNotificationPublisher->publish(*iter, sub);
+									records.IsComplete = true;
+								} catch (const std::exception&) {
+									// incomplete records are ignored and the entity is processed serially
+								}
+							}
+						}).get();
+
+				return entityRecords;
+			}
+
 		private:
 			ExecutionConfiguration m_config;
+			thread::IoThreadPool& m_pool;
+			std::shared_ptr<SpeculativeValidationStatistics> m_pStatistics;
 		};
+
+		// endregion
+	}
+
+	SpeculativeValidationStatistics::SpeculativeValidationStatistics()
+			: m_numSpeculativeResults(0)
+			, m_numReusedResults(0)
+	{}
+
+	uint64_t SpeculativeValidationStatistics::numSpeculativeResults() const {
+		return m_numSpeculativeResults;
+	}
+
+	uint64_t SpeculativeValidationStatistics::numReusedResults() const {
+		return m_numReusedResults;
+	}
+
+	void SpeculativeValidationStatistics::addBatch(size_t numSpeculativeResults, size_t numReusedResults) {
+		m_numSpeculativeResults += numSpeculativeResults;
+		m_numReusedResults += numReusedResults;
 	}
 
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config) {
-		return DefaultBatchEntityProcessor(config);
+		return DefaultBatchEntityProcessor(config, nullptr);
+	}
+
+	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool& pool) {
+		return DefaultBatchEntityProcessor(config, &pool);
+	}
+
+	BatchEntityProcessor CreateSpeculativeBatchEntityProcessor(
+			const ExecutionConfiguration& config,
+			thread::IoThreadPool& pool,
+			const std::shared_ptr<SpeculativeValidationStatistics>& pStatistics) {
+		return SpeculativeBatchEntityProcessor(config, pool, pStatistics);
 	}
 }}
@@ -21,6 +21,9 @@
 
 #pragma once
 #include "ExecutionConfiguration.h"
+#include <atomic>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
 
 namespace catapult { namespace chain {
 
@@ -34,4 +37,41 @@ namespace catapult { namespace chain {
 
 	/// Creates a batch entity processor around \a config.
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config);
+
+	/// Creates a batch entity processor around \a config that prefetches state in parallel using \a pool.
+	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool& pool);
+
+	/// Statistics collected by speculative batch entity processors.
+	class SpeculativeValidationStatistics {
+	public:
+		/// Creates empty statistics.
+		SpeculativeValidationStatistics();
+
+	public:
+		/// Gets the total number of notifications that were validated speculatively.
+		uint64_t numSpeculativeResults() const;
+
+		/// Gets the total number of speculative validation results that were reused.
+		uint64_t numReusedResults() const;
+
+	public:
+		/// Adds a batch with \a numSpeculativeResults speculative validation results of which \a numReusedResults were reused.
+		void addBatch(size_t numSpeculativeResults, size_t numReusedResults);
+
+	private:
+		std::atomic<uint64_t> m_numSpeculativeResults;
+		std::atomic<uint64_t> m_numReusedResults;
+	};
+
+	/// Creates a batch entity processor around \a config that speculatively validates entities in parallel using \a pool
+	/// and adds the number of speculative and reused validation results to \a pStatistics.
+	/// \note Speculative validation results are only used when none of the state read by a notification has been modified
+	///        by a preceding notification, so results are always identical to those of a sequential batch entity processor.
+	/// \note The stateful validator in \a config is called concurrently from \a pool threads with a validator context
+	///        that only provides read-only access to the cache delta being processed. It must be thread safe and must not
+	///        modify any state. The cache delta is not modified until all speculative validation has completed.
+	BatchEntityProcessor CreateSpeculativeBatchEntityProcessor(
+			const ExecutionConfiguration& config,
+			thread::IoThreadPool& pool,
+			const std::shared_ptr<SpeculativeValidationStatistics>& pStatistics);
 }}
@@ -249,9 +249,10 @@ namespace catapult { namespace chain {
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
 					const supplier<Height>& localFinalizedHeightSupplier,
+					const std::function<Height (const Hash256&)>& localHashHeightSupplier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
-					, m_compareChainOptions{ config.MaxHashesPerSyncAttempt, localFinalizedHeightSupplier }
+					, m_compareChainOptions{ config.MaxHashesPerSyncAttempt, localFinalizedHeightSupplier, localHashHeightSupplier }
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
@@ -331,11 +332,13 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
+			const std::function<Height (const Hash256&)>& localHashHeightSupplier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
 		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
 				pLocalChainApi,
 				config,
 				localFinalizedHeightSupplier,
+				localHashHeightSupplier,
 				blockRangeConsumer);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
@@ -59,10 +59,12 @@ namespace catapult { namespace chain {
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), blockchain \a config,
-	/// local finalized height supplier (\a localFinalizedHeightSupplier) and block range consumer (\a blockRangeConsumer).
+	/// local finalized height supplier (\a localFinalizedHeightSupplier), optional local hash height supplier
+	/// (\a localHashHeightSupplier) and block range consumer (\a blockRangeConsumer).
 	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
+			const std::function<Height (const Hash256&)>& localHashHeightSupplier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
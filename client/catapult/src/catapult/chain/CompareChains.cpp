@@ -147,6 +147,9 @@ namespace catapult { namespace chain {
 						<< ", starting height " << startingHeight
 						<< ", max hashes " << maxHashes;
 
+				if (m_options.LocalHashHeightSupplier)
+					return compareHashesWithLocalHashHeights(startingHeight, maxHashes);
+
 				return thread::when_all(m_local.hashesFrom(startingHeight, maxHashes), m_remote.hashesFrom(startingHeight, maxHashes))
 					.then([pThis = shared_from_this()](auto&& aggregateFuture) {
 						auto hashesFuture = aggregateFuture.get();
@@ -156,18 +159,60 @@ namespace catapult { namespace chain {
 					});
 			}
 
+			thread::future<ChainComparisonCode> compareHashesWithLocalHashHeights(Height startingHeight, uint32_t maxHashes) {
+				// only remote hashes need to be pulled because they can be looked up in the local hash height index
+				return thread::compose(m_remote.hashesFrom(startingHeight, maxHashes), [pThis = shared_from_this()](auto&& hashesFuture) {
+					auto pRemoteHashes = std::make_shared<model::HashRange>(hashesFuture.get());
+					return pThis->m_local.chainStatistics().then([pThis, pRemoteHashes](auto&& chainStatisticsFuture) {
+						auto localHeight = chainStatisticsFuture.get().Height;
+						return pThis->compareHashes(localHeight, *pRemoteHashes);
+					});
+				});
+			}
+
+			ChainComparisonCode compareHashes(Height localHeight, const model::HashRange& remoteHashes) {
+				// mirror local hashesFrom, which fails when no local hashes are available
+				if (localHeight < m_startingHashesHeight)
+					CATAPULT_THROW_RUNTIME_ERROR_1("unable to get local hashes from height", m_startingHashesHeight);
+
+				if (!isValidRemoteHashes(remoteHashes))
+					return ChainComparisonCode::Remote_Returned_Too_Many_Hashes;
+
+				auto numLocalHashes = std::min<size_t>(m_options.HashesPerBatch, (localHeight - m_startingHashesHeight).unwrap() + 1);
+
+				size_t firstDifferenceIndex = 0;
+				auto height = m_startingHashesHeight;
+				for (const auto& hash : remoteHashes) {
+					if (numLocalHashes == firstDifferenceIndex || height != m_options.LocalHashHeightSupplier(hash))
+						break;
+
+					++firstDifferenceIndex;
+					height = height + Height(1);
+				}
+
+				return compareHashes(numLocalHashes, remoteHashes.size(), firstDifferenceIndex);
+			}
+
 			ChainComparisonCode compareHashes(const model::HashRange& localHashes, const model::HashRange& remoteHashes) {
-				if (remoteHashes.size() > m_options.HashesPerBatch || 0 == remoteHashes.size())
+				if (!isValidRemoteHashes(remoteHashes))
 					return ChainComparisonCode::Remote_Returned_Too_Many_Hashes;
 
-				// at least the first compared block should be the same; if not, the remote is a liar or on a fork
 				auto firstDifferenceIndex = FindFirstDifferenceIndex(localHashes, remoteHashes);
+				return compareHashes(localHashes.size(), remoteHashes.size(), firstDifferenceIndex);
+			}
+
+			bool isValidRemoteHashes(const model::HashRange& remoteHashes) const {
+				return remoteHashes.size() <= m_options.HashesPerBatch && 0 != remoteHashes.size();
+			}
+
+			ChainComparisonCode compareHashes(size_t numLocalHashes, size_t numRemoteHashes, size_t firstDifferenceIndex) {
+				// at least the first compared block should be the same; if not, the remote is a liar or on a fork
 				if (isProcessingFirstBatchOfHashes() && 0 == firstDifferenceIndex)
 					return ChainComparisonCode::Remote_Is_Forked;
 
 				// need to use min because remote is allowed to return [1, m_options.HashesPerBatch] hashes
 				auto commonBlockHeight = m_startingHashesHeight + Height(firstDifferenceIndex - 1);
-				auto localHeightDerivedFromHashes = m_startingHashesHeight + Height(std::min(localHashes.size(), remoteHashes.size()) - 1);
+				auto localHeightDerivedFromHashes = m_startingHashesHeight + Height(std::min(numLocalHashes, numRemoteHashes) - 1);
 
 				if (0 == firstDifferenceIndex) {
 					// search previous hashes for first common block
@@ -175,7 +220,7 @@ namespace catapult { namespace chain {
 					return tryContinue(Height((m_lowerBoundHeight + m_startingHashesHeight).unwrap() / 2));
 				}
 
-				if (remoteHashes.size() == firstDifferenceIndex) {
+				if (numRemoteHashes == firstDifferenceIndex) {
 					if (localHeightDerivedFromHashes >= m_localHeight) {
 						if (localHeightDerivedFromHashes < m_remoteHeight) {
 							CATAPULT_LOG(debug)
@@ -33,6 +33,10 @@ namespace catapult { namespace chain {
 
 		/// Finalized height supplier.
 		supplier<Height> FinalizedHeightSupplier;
+
+		/// Optional local hash height supplier.
+		/// \note When set, remote hashes are resolved against the local chain instead of pulling local hashes.
+		std::function<Height (const Hash256&)> LocalHashHeightSupplier;
 	};
 
 	/// Result of a chain comparison operation.
@@ -20,7 +20,9 @@
 **/
 
 #pragma once
+#include "catapult/cache/StatePrefetcher.h"
 #include "catapult/model/NetworkIdentifier.h"
+#include "catapult/model/NotificationAccess.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/validators/ValidatorTypes.h"
@@ -46,6 +48,8 @@ namespace catapult { namespace chain {
 		using ObserverPointer = std::shared_ptr<const observers::AggregateNotificationObserver>;
 		using ValidatorPointer = std::shared_ptr<const validators::stateful::AggregateNotificationValidator>;
 		using PublisherPointer = std::shared_ptr<const model::NotificationPublisher>;
+		using StatePrefetcherPointer = std::shared_ptr<const cache::StatePrefetcher>;
+		using NotificationAccessExtractorPointer = std::shared_ptr<const model::NotificationAccessExtractor>;
 
 	public:
 
@@ -57,5 +61,11 @@ namespace catapult { namespace chain {
 
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
+
+		/// Optional state prefetcher that warms sub caches before entities are executed.
+		StatePrefetcherPointer pStatePrefetcher;
+
+		/// Optional notification access extractor (required for speculative validation).
+		NotificationAccessExtractorPointer pNotificationAccessExtractor;
 	};
 }}
@@ -22,7 +22,9 @@
 #include "UtSynchronizer.h"
 #include "EntitiesSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/cache_tx/ShortHashFilters.h"
 #include "catapult/model/NodeIdentity.h"
+#include "catapult/utils/RandomGenerator.h"
 
 namespace catapult { namespace chain {
 
@@ -53,12 +55,31 @@ namespace catapult { namespace chain {
 				m_transactionRangeConsumer(model::AnnotatedTransactionRange(std::move(range), sourceIdentity));
 			}
 
-		private:
+		protected:
 			BlockFeeMultiplier m_minFeeMultiplier;
 			TimeSupplier m_timeSupplier;
 			ShortHashesSupplier m_shortHashesSupplier;
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 		};
+
+		struct FilteredUtTraits : public UtTraits {
+		public:
+			using UtTraits::UtTraits;
+
+		public:
+			thread::future<model::TransactionRange> apiCall(const RemoteApiType& api) const {
+				// use a new seed for every request so that false positives are not repeated across rounds
+				auto seed = static_cast<uint32_t>(utils::LowEntropyRandomGenerator()());
+				auto filter = cache::CreateShortHashesFilter(m_shortHashesSupplier(), seed);
+				return api.filteredUnconfirmedTransactions(m_timeSupplier(), m_minFeeMultiplier, std::move(filter));
+			}
+		};
+
+		template<typename TTraits>
+		RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(TTraits&& traits, const predicate<>& shouldExecute) {
+			auto pSynchronizer = std::make_shared<EntitiesSynchronizer<TTraits>>(std::move(traits));
+			return CreateConditionalRemoteNodeSynchronizer(pSynchronizer, shouldExecute);
+		}
 	}
 
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
@@ -67,8 +88,16 @@ namespace catapult { namespace chain {
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer,
 			const predicate<>& shouldExecute) {
-		auto traits = UtTraits(minFeeMultiplier, timeSupplier, shortHashesSupplier, transactionRangeConsumer);
-		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
-		return CreateConditionalRemoteNodeSynchronizer(pSynchronizer, shouldExecute);
+		return CreateUtSynchronizer(UtTraits(minFeeMultiplier, timeSupplier, shortHashesSupplier, transactionRangeConsumer), shouldExecute);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateFilteredUtSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const TimeSupplier& timeSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer,
+			const predicate<>& shouldExecute) {
+		auto traits = FilteredUtTraits(minFeeMultiplier, timeSupplier, shortHashesSupplier, transactionRangeConsumer);
+		return CreateUtSynchronizer(std::move(traits), shouldExecute);
 	}
 }}
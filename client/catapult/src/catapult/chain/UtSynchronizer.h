@@ -42,4 +42,16 @@ namespace catapult { namespace chain {
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer,
 			const predicate<>& shouldExecute);
+
+	/// Creates an unconfirmed transactions synchronizer around the specified time supplier (\a timeSupplier),
+	/// short hashes supplier (\a shortHashesSupplier) and transaction range consumer (\a transactionRangeConsumer)
+	/// for transactions with fee multipliers at least \a minFeeMultiplier.
+	/// \note Known short hashes are sent to the remote as a (compact) bloom filter instead of as a list.
+	/// \note Remote operation is only initiated when \a shouldExecute returns \c true.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateFilteredUtSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const TimeSupplier& timeSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer,
+			const predicate<>& shouldExecute);
 }}
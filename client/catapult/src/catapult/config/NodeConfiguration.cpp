@@ -45,6 +45,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(EnableMemoryMappedBlockStorage);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -60,9 +61,11 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(MinFeeMultiplier);
 		LOAD_NODE_PROPERTY(MaxTimeBehindPullTransactionsStart);
+		LOAD_NODE_PROPERTY(EnableFilteredTransactionsPull);
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheNumShards);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -74,6 +77,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(BlockDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(BlockDisruptorMaxMemorySize);
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
+		LOAD_NODE_PROPERTY(BlockStreamingSignatureBatchSize);
 
 		LOAD_NODE_PROPERTY(TransactionDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(TransactionDisruptorMaxMemorySize);
@@ -81,6 +85,10 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
+		LOAD_NODE_PROPERTY(DispatcherWaitStrategy);
+
+		LOAD_NODE_PROPERTY(EnableExecutionProfiling);
+		LOAD_NODE_PROPERTY(EnableSpeculativeStatefulValidation);
 
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
@@ -103,6 +111,7 @@ namespace catapult { namespace config {
 		LOAD_CACHE_DATABASE_PROPERTY(MemtableMemoryBudget);
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeNodeCacheSize);
 
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
@@ -150,7 +159,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 7 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 47 + 8 + 4 + 4 + 5 + 9);
 		return config;
 	}
 
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "catapult/disruptor/ConsumerWaitStrategy.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/ionet/NodeVersion.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
@@ -57,6 +58,9 @@ namespace catapult { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// \c true if blocks should be read from memory mapped block files.
+		bool EnableMemoryMappedBlockStorage;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -91,6 +95,10 @@ namespace catapult { namespace config {
 		/// of the network time.
 		utils::TimeSpan MaxTimeBehindPullTransactionsStart;
 
+		/// \c true if transaction pulls should send bloom filters of known short hashes instead of short hash lists.
+		/// \note Remote nodes must support the filtered pull packets.
+		bool EnableFilteredTransactionsPull;
+
 		/// Transaction selection strategy used for syncing and harvesting unconfirmed transactions.
 		model::TransactionSelectionStrategy TransactionSelectionStrategy;
 
@@ -100,6 +108,9 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		utils::FileSize UnconfirmedTransactionsCacheMaxSize;
 
+		/// Number of independently locked shards of the unconfirmed transactions cache.
+		uint32_t UnconfirmedTransactionsCacheNumShards;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -125,6 +136,10 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a block element should be traced through queue and completion.
 		uint32_t BlockElementTraceInterval;
 
+		/// Number of block signatures that are extracted before being verified together.
+		/// \note \c 0 will disable streaming and verify signatures only after all have been extracted.
+		uint32_t BlockStreamingSignatureBatchSize;
+
 		/// Number of slots in the transaction disruptor circular buffer.
 		uint32_t TransactionDisruptorSlotCount;
 
@@ -140,6 +155,15 @@ namespace catapult { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// Strategy used by dispatcher consumers waiting for new elements.
+		disruptor::ConsumerWaitStrategy DispatcherWaitStrategy;
+
+		/// \c true if call counts and elapsed times of all validators and observers should be profiled.
+		bool EnableExecutionProfiling;
+
+		/// \c true if stateful validation of independent entities should be speculatively parallelized during block processing.
+		bool EnableSpeculativeStatefulValidation;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -183,6 +207,10 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// Maximum number of deserialized nodes cached in memory per patricia tree.
+			/// \note Disables node caching when zero.
+			uint32_t PatriciaTreeNodeCacheSize;
 		};
 
 	public:
@@ -48,10 +48,20 @@ namespace catapult { namespace consumers {
 			}
 
 		public:
+			void reserve(size_t numInputs) {
+				m_notificationToEntityIndexMap.reserve(numInputs);
+				m_inputs.reserve(numInputs);
+			}
+
 			void next() {
 				++m_entityIndex;
 			}
 
+			void clear() {
+				m_notificationToEntityIndexMap.clear();
+				m_inputs.clear();
+			}
+
 		public:
 			void notify(const model::Notification& notification) override {
 				if (model::SignatureNotification::Notification_Type != notification.Type)
@@ -63,7 +73,7 @@ namespace catapult { namespace consumers {
 
 		private:
 			void add(const model::SignatureNotification& notification) {
-				std::vector<RawBuffer> buffers;
+				crypto::SignatureInputBuffers buffers;
 				if (model::SignatureNotification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode)
 					buffers.push_back(m_generationHashSeed);
 
@@ -83,7 +93,9 @@ namespace catapult { namespace consumers {
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
 				const model::WeakEntityInfos& entityInfos) {
+			// every entity has at least one signature
 			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
+			pSub->reserve(entityInfos.size());
 			for (const auto& entityInfo : entityInfos) {
 				publisher.publish(entityInfo, *pSub);
 				pSub->next();
@@ -92,6 +104,81 @@ namespace catapult { namespace consumers {
 			return pSub;
 		}
 
+		// approximate cost of a single signature verification expressed in hashed bytes
+		constexpr uint64_t Signature_Verification_Base_Cost = 16 * 1024;
+
+		uint64_t CalculateVerificationCost(const crypto::SignatureInput& input) {
+			auto cost = Signature_Verification_Base_Cost;
+			for (const auto& buffer : input.Buffers)
+				cost += buffer.Size;
+
+			return cost;
+		}
+
+		template<typename TWorkCallback>
+		void VerifyAll(thread::IoThreadPool& pool, const std::vector<crypto::SignatureInput>& inputs, TWorkCallback callback) {
+			// balance signature batches by cost and let the (otherwise blocked) consumer thread participate in verification
+			thread::WorkStealingOptions options;
+			options.UseCallingThread = true;
+			thread::WorkStealingParallelForPartition(
+					pool.ioContext(),
+					inputs,
+					pool.numWorkerThreads(),
+					CalculateVerificationCost,
+					options,
+					callback).get();
+		}
+
+		validators::ValidationResult StreamAndVerifyAllShortCircuit(
+				const GenerationHashSeed& generationHashSeed,
+				const crypto::RandomFiller& randomFiller,
+				const model::NotificationPublisher& publisher,
+				thread::IoThreadPool& pool,
+				size_t batchSize,
+				const model::WeakEntityInfos& entityInfos) {
+			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
+			auto isAborted = [&aggregateResult]() {
+				return IsValidationResultFailure(aggregateResult.load());
+			};
+			auto verifyBatch = [&randomFiller, &aggregateResult](const auto& inputs) {
+				if (!VerifyMultiShortCircuit(randomFiller, inputs.data(), inputs.size()))
+					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
+			};
+
+			// each chunk of entities is extracted by a single worker, which verifies a batch of signatures as soon as it fills,
+			// so that extraction of some chunks overlaps with verification of others
+			auto partitionCallback = [&generationHashSeed, &publisher, batchSize, isAborted, verifyBatch](
+					auto itBegin,
+					auto itEnd,
+					auto,
+					auto) {
+				SignatureCapturingNotificationSubscriber sub(generationHashSeed);
+				sub.reserve(batchSize);
+				for (auto iter = itBegin; itEnd != iter && !isAborted(); ++iter) {
+					publisher.publish(*iter, sub);
+					if (sub.inputs().size() < batchSize)
+						continue;
+
+					verifyBatch(sub.inputs());
+					sub.clear();
+				}
+
+				if (!sub.inputs().empty() && !isAborted())
+					verifyBatch(sub.inputs());
+			};
+
+			thread::WorkStealingOptions options;
+			options.UseCallingThread = true;
+			thread::WorkStealingParallelForPartition(
+					pool.ioContext(),
+					entityInfos,
+					pool.numWorkerThreads(),
+					[](const auto& entityInfo) { return entityInfo.entity().Size; },
+					options,
+					partitionCallback).get();
+			return aggregateResult.load();
+		}
+
 		std::vector<validators::ValidationResult> MapNotificationResultsToEntityResults(
 				size_t numEntities,
 				const std::vector<size_t>& notificationToEntityIndexMap,
@@ -111,11 +198,19 @@ namespace catapult { namespace consumers {
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
-			const RequiresValidationPredicate& requiresValidationPredicate) {
+			const RequiresValidationPredicate& requiresValidationPredicate,
+			uint32_t streamingBatchSize) {
+		if (0 != streamingBatchSize) {
+			auto streamingValidator = [&pool, generationHashSeed, randomFiller, pPublisher, streamingBatchSize](const auto& entityInfos) {
+				return StreamAndVerifyAllShortCircuit(generationHashSeed, randomFiller, *pPublisher, pool, streamingBatchSize, entityInfos);
+			};
+			return MakeBlockValidationConsumer(requiresValidationPredicate, streamingValidator);
+		}
+
 		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto inputs = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos)->inputs();
+			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
 			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
@@ -125,7 +220,7 @@ namespace catapult { namespace consumers {
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			VerifyAll(pool, pSub->inputs(), partitionCallback);
 			return aggregateResult.load();
 		});
 	}
@@ -142,7 +237,7 @@ namespace catapult { namespace consumers {
 			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
-			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
+			// note: store notification (not entity) results because it's possible for an entity to be split across chunks,
 			//       which would lead to a write data race (of same data) from multiple threads
 			std::vector<validators::ValidationResult> notificationResults(pSub->inputs().size(), validators::ValidationResult::Success);
 			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
@@ -160,7 +255,7 @@ namespace catapult { namespace consumers {
 				}
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
+			VerifyAll(pool, pSub->inputs(), partitionCallback);
 
 			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
 		});
@@ -67,12 +67,15 @@ namespace catapult { namespace consumers {
 	/// generation hash seed (\a generationHashSeed).
 	/// Validation will only be performed for entities for which \a requiresValidationPredicate returns \c true.
 	/// \a randomFiller is used to generate random bytes.
+	/// When \a streamingBatchSize is nonzero, signatures are extracted in parallel and verified in batches of (at least)
+	/// that size as soon as they are extracted.
 	disruptor::ConstBlockConsumer CreateBlockBatchSignatureConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
 			thread::IoThreadPool& pool,
-			const RequiresValidationPredicate& requiresValidationPredicate);
+			const RequiresValidationPredicate& requiresValidationPredicate,
+			uint32_t streamingBatchSize = 0);
 
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
 	/// state (in \a cache) and blocks (in \a storage) with \a importanceGrouping.
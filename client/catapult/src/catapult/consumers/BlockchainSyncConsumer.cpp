@@ -336,11 +336,7 @@ namespace catapult { namespace consumers {
 
 		private:
 			static bool Contains(const io::BlockStorageView& storageView, const model::HeightHashPair& heightHashPair) {
-				if (storageView.chainHeight() < heightHashPair.Height)
-					return false;
-
-				auto storageHashRange = storageView.loadHashesFrom(heightHashPair.Height, 1);
-				return heightHashPair.Hash == *storageHashRange.cbegin();
+				return heightHashPair.Height == storageView.findHeight(heightHashPair.Hash);
 			}
 
 			static bool Contains(const BlockElements& elements, const model::HeightHashPair& heightHashPair) {
@@ -22,6 +22,9 @@
 #include "RecentHashCache.h"
 #include "catapult/utils/ContainerHelpers.h"
 #include "catapult/utils/Logging.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "catapult/utils/ThrottleLogger.h"
+#include <cstring>
 
 namespace catapult { namespace consumers {
 
@@ -86,13 +89,158 @@ namespace catapult { namespace consumers {
 
 	// region SynchronizedRecentHashCache
 
+	namespace {
+		// slot layout: | fingerprint (40 bits) | epoch (24 bits) |, where zero indicates an empty slot
+		constexpr uint64_t Epoch_Bits = 24;
+		constexpr uint64_t Epoch_Mask = (static_cast<uint64_t>(1) << Epoch_Bits) - 1;
+
+		uint64_t Mix(uint64_t value) {
+			value ^= value >> 30;
+			value *= 0xBF58'476D'1CE4'E5B9;
+			value ^= value >> 27;
+			value *= 0x94D0'49BB'1331'11EB;
+			value ^= value >> 31;
+			return value;
+		}
+
+		size_t CalculateNumBuckets(uint64_t maxCacheSize, size_t bucketSize) {
+			// reserve some headroom so that buckets do not overflow before the cache holds maxCacheSize hashes
+			auto minNumBuckets = (maxCacheSize + (maxCacheSize + 3) / 4 + bucketSize - 1) / bucketSize;
+
+			size_t numBuckets = 1;
+			while (numBuckets < minNumBuckets)
+				numBuckets <<= 1;
+
+			return numBuckets;
+		}
+
+		uint64_t CalculateNumLiveEpochs(const HashCheckOptions& options, uint64_t epochDuration) {
+			auto numLiveEpochs = (options.CacheDuration + epochDuration - 1) / epochDuration;
+			return std::min<uint64_t>(numLiveEpochs, Epoch_Mask / 2);
+		}
+
+		constexpr uint64_t ToSlotValue(uint64_t fingerprint, uint64_t epoch) {
+			return fingerprint << Epoch_Bits | (epoch & Epoch_Mask);
+		}
+
+		constexpr uint64_t ToFingerprint(uint64_t slotValue) {
+			return slotValue >> Epoch_Bits;
+		}
+	}
+
 	SynchronizedRecentHashCache::SynchronizedRecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options)
-			: m_recentHashCache(timeSupplier, options)
-	{}
+			: m_timeSupplier(timeSupplier)
+			, m_epochDuration(std::max<uint64_t>(1, options.PruneInterval))
+			, m_numLiveEpochs(CalculateNumLiveEpochs(options, m_epochDuration))
+			, m_seed(utils::HighEntropyRandomGenerator()()) {
+		auto numBuckets = CalculateNumBuckets(options.MaxCacheSize, Bucket_Size);
+		m_bucketMask = numBuckets - 1;
+		m_buckets = std::unique_ptr<Bucket[]>(new Bucket[numBuckets]()); // value initialization zeroes all slots
+	}
+
+	size_t SynchronizedRecentHashCache::capacity() const {
+		return (m_bucketMask + 1) * Bucket_Size;
+	}
+
+	size_t SynchronizedRecentHashCache::size() const {
+		auto epoch = currentEpoch();
+		size_t count = 0;
+		for (auto i = 0u; i <= m_bucketMask; ++i) {
+			for (const auto& slot : m_buckets[i].Slots) {
+				auto slotValue = slot.load(std::memory_order_relaxed);
+				if (0 != slotValue && !isExpired(slotValue, epoch))
+					++count;
+			}
+		}
+
+		return count;
+	}
+
+	// slots do not guard any other data, so all slot accesses can be relaxed
 
 	bool SynchronizedRecentHashCache::add(const Hash256& hash) {
-		utils::SpinLockGuard guard(m_lock);
-		return m_recentHashCache.add(hash);
+		auto epoch = currentEpoch();
+		auto key = createKey(hash);
+		auto newSlotValue = ToSlotValue(key.Fingerprint, epoch);
+
+		for (;;) {
+			// slots within a bucket are claimed in order and never emptied, so the first empty slot ends the bucket
+			std::atomic<uint64_t>* pReusableSlot = nullptr;
+			uint64_t reusableSlotValue = 0;
+			for (auto bucketIndex : key.BucketIndexes) {
+				for (auto& slot : m_buckets[bucketIndex].Slots) {
+					auto slotValue = slot.load(std::memory_order_relaxed);
+					auto isEmpty = 0 == slotValue;
+					auto isExpiredSlot = !isEmpty && isExpired(slotValue, epoch);
+					if (!isEmpty && !isExpiredSlot && key.Fingerprint == ToFingerprint(slotValue)) {
+						// hash is known, so extend its lifetime (failure indicates a concurrent refresh or reuse and can be ignored)
+						if (newSlotValue != slotValue)
+							slot.compare_exchange_strong(slotValue, newSlotValue, std::memory_order_relaxed);
+
+						return false;
+					}
+
+					if ((isEmpty || isExpiredSlot) && !pReusableSlot) {
+						pReusableSlot = &slot;
+						reusableSlotValue = slotValue;
+					}
+
+					if (isEmpty)
+						break;
+				}
+			}
+
+			// only add the hash if one of its buckets is not full
+			if (!pReusableSlot) {
+				CATAPULT_LOG_THROTTLE(warning, 60'000) << "short lived hash check cache bucket is full";
+				return true;
+			}
+
+			// on failure, another thread claimed the slot, so rescan because it might have added the same hash
+			if (pReusableSlot->compare_exchange_strong(reusableSlotValue, newSlotValue, std::memory_order_relaxed))
+				return true;
+		}
+	}
+
+	bool SynchronizedRecentHashCache::contains(const Hash256& hash) const {
+		auto epoch = currentEpoch();
+		auto key = createKey(hash);
+		for (auto bucketIndex : key.BucketIndexes) {
+			for (const auto& slot : m_buckets[bucketIndex].Slots) {
+				auto slotValue = slot.load(std::memory_order_relaxed);
+				if (0 == slotValue)
+					break;
+
+				if (!isExpired(slotValue, epoch) && key.Fingerprint == ToFingerprint(slotValue))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	uint64_t SynchronizedRecentHashCache::currentEpoch() const {
+		return m_timeSupplier().unwrap() / m_epochDuration;
+	}
+
+	bool SynchronizedRecentHashCache::isExpired(uint64_t slotValue, uint64_t epoch) const {
+		return ((epoch - slotValue) & Epoch_Mask) > m_numLiveEpochs;
+	}
+
+	SynchronizedRecentHashCache::SlotKey SynchronizedRecentHashCache::createKey(const Hash256& hash) const {
+		// key the fingerprint with a random seed so that hashes colliding in the cache cannot be ground offline
+		auto value = m_seed;
+		for (auto i = 0u; i < Hash256_tag::Size; i += sizeof(uint64_t)) {
+			uint64_t word;
+			std::memcpy(&word, hash.data() + i, sizeof(uint64_t));
+			value = Mix(value ^ word);
+		}
+
+		SlotKey key;
+		key.Fingerprint = std::max<uint64_t>(1, ToFingerprint(value));
+		key.BucketIndexes[0] = static_cast<size_t>(value) & m_bucketMask;
+		key.BucketIndexes[1] = static_cast<size_t>(value ^ Mix(key.Fingerprint)) & m_bucketMask;
+		return key;
 	}
 
 	// endregion
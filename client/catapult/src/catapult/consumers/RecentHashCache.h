@@ -25,6 +25,9 @@
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinLock.h"
 #include "catapult/types.h"
+#include <array>
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 
 namespace catapult { namespace consumers {
@@ -61,19 +64,57 @@ namespace catapult { namespace consumers {
 		std::unordered_map<Hash256, Timestamp, utils::ArrayHasher<Hash256>> m_cache;
 	};
 
-	/// Synchronized wrapper around a RecentHashCache.
+	/// Lock-free hash cache that holds recently seen hashes and can be shared by multiple threads.
+	/// \note Hashes are stored as keyed fingerprints in a fixed-capacity open-addressing table composed of cache line sized buckets.
+	///       Each entry is tagged with the prune interval (epoch) in which it was last seen, so expired entries are lazily reused
+	///       instead of being removed by a full scan. As a result, entries expire between cache duration and
+	///       cache duration + prune interval after they were last seen.
 	class SynchronizedRecentHashCache {
+	private:
+		static constexpr size_t Bucket_Size = 8;
+
+		struct alignas(64) Bucket {
+			std::array<std::atomic<uint64_t>, Bucket_Size> Slots;
+		};
+
+		struct SlotKey {
+			uint64_t Fingerprint;
+			std::array<size_t, 2> BucketIndexes;
+		};
+
 	public:
 		/// Creates a recent hash cache around \a timeSupplier and \a options.
 		SynchronizedRecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
 
+	public:
+		/// Gets the number of hashes that can be stored in the cache.
+		size_t capacity() const;
+
+		/// Gets the number of unexpired hashes in the cache.
+		/// \note This requires a full scan of the cache and is intended for diagnostics.
+		size_t size() const;
+
 	public:
 		/// Checks if \a hash is already in the cache and adds it to the cache if it is unknown.
-		/// \note This also prunes the hash cache.
+		/// \note This also refreshes the epoch of \a hash when it is known.
 		bool add(const Hash256& hash);
 
+		/// Returns \c true if the cache contains \a hash, \c false otherwise.
+		bool contains(const Hash256& hash) const;
+
+	private:
+		uint64_t currentEpoch() const;
+
+		bool isExpired(uint64_t slotValue, uint64_t epoch) const;
+
+		SlotKey createKey(const Hash256& hash) const;
+
 	private:
-		RecentHashCache m_recentHashCache;
-		utils::SpinLock m_lock;
+		chain::TimeSupplier m_timeSupplier;
+		uint64_t m_epochDuration;
+		uint64_t m_numLiveEpochs;
+		uint64_t m_seed;
+		size_t m_bucketMask;
+		std::unique_ptr<Bucket[]> m_buckets;
 	};
 }}
@@ -75,6 +75,22 @@ namespace catapult { namespace crypto {
 		}
 	}
 
+	// region SignatureInputBuffers
+
+	SignatureInputBuffers::SignatureInputBuffers(std::initializer_list<RawBuffer> buffers) : m_size(0) {
+		for (const auto& buffer : buffers)
+			push_back(buffer);
+	}
+
+	void SignatureInputBuffers::push_back(const RawBuffer& buffer) {
+		if (Capacity == m_size)
+			CATAPULT_THROW_OUT_OF_RANGE("signature input buffers are full");
+
+		m_buffers[m_size++] = buffer;
+	}
+
+	// endregion
+
 	// region Sign
 
 	void Sign(const KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& computedSignature) {
@@ -139,50 +155,56 @@ namespace catapult { namespace crypto {
 
 	// region Verify
 
+	namespace {
+		bool VerifyBuffers(const Key& publicKey, const RawBuffer* pBuffers, size_t numBuffers, const Signature& signature) {
+			const uint8_t *RESTRICT encodedR = signature.data();
+			const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(encodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			if (Key() == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Hash512 hash_h;
+			Sha512_Builder hasher_h;
+			hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
+			for (auto i = 0u; i < numBuffers; ++i)
+				hasher_h.update(pBuffers[i]);
+
+			hasher_h.final(hash_h);
+
+			bignum256modm h;
+			expand256_modm(h, hash_h.data(), 64);
+
+			// A = -pub
+			ge25519 ALIGN(16) A;
+			if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
+				return false;
+
+			bignum256modm S;
+			expand256_modm(S, encodedS, 32);
+
+			// R = encodedS * B - h * A
+			ge25519 ALIGN(16) R;
+			ge25519_double_scalarmult_vartime(&R, &A, h, S);
+
+			// compare calculated R to given R
+			uint8_t checkr[Encoded_Size];
+			ge25519_pack(checkr, &R);
+			return 1 == ed25519_verify(encodedR, checkr, 32);
+		}
+	}
+
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
-		return Verify(publicKey, std::vector<RawBuffer>{ dataBuffer }, signature);
+		return VerifyBuffers(publicKey, &dataBuffer, 1, signature);
 	}
 
 	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffers, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
-
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
-
-		// reject zero public key, which is known weak key
-		if (Key() == publicKey)
-			return false;
-
-		// h = H(encodedR || public || data)
-		Hash512 hash_h;
-		Sha512_Builder hasher_h;
-		hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
-		for (const auto& buffer : buffers)
-			hasher_h.update(buffer);
-
-		hasher_h.final(hash_h);
-
-		bignum256modm h;
-		expand256_modm(h, hash_h.data(), 64);
-
-		// A = -pub
-		ge25519 ALIGN(16) A;
-		if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
-			return false;
-
-		bignum256modm S;
-		expand256_modm(S, encodedS, 32);
-
-		// R = encodedS * B - h * A
-		ge25519 ALIGN(16) R;
-		ge25519_double_scalarmult_vartime(&R, &A, h, S);
-
-		// compare calculated R to given R
-		uint8_t checkr[Encoded_Size];
-		ge25519_pack(checkr, &R);
-		return 1 == ed25519_verify(encodedR, checkr, 32);
+		return VerifyBuffers(publicKey, buffers.data(), buffers.size(), signature);
 	}
 
 	// endregion
@@ -207,7 +229,9 @@ namespace catapult { namespace crypto {
 		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
 			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				const auto& signatureInput = pSignatureInputs[offset + i];
+				const auto& buffers = signatureInput.Buffers;
+				valid[offset + i] = VerifyBuffers(signatureInput.PublicKey, buffers.data(), buffers.size(), signatureInput.Signature);
 				aggregateResult &= valid[offset + i];
 			}
 
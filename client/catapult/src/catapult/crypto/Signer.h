@@ -21,17 +21,72 @@
 
 #pragma once
 #include "KeyPair.h"
+#include <array>
 #include <vector>
 
 namespace catapult { namespace crypto {
 
+	/// Fixed capacity container of signature input buffers that is stored inline.
+	class SignatureInputBuffers {
+	public:
+		/// Maximum number of buffers.
+		static constexpr size_t Capacity = 2;
+
+	public:
+		/// Creates an empty container.
+		SignatureInputBuffers() : m_size(0)
+		{}
+
+		/// Creates a container around \a buffers.
+		SignatureInputBuffers(std::initializer_list<RawBuffer> buffers);
+
+	public:
+		/// Gets the number of buffers.
+		size_t size() const {
+			return m_size;
+		}
+
+		/// Returns \c true if the container is empty.
+		bool empty() const {
+			return 0 == m_size;
+		}
+
+		/// Gets a const pointer to the first buffer.
+		const RawBuffer* data() const {
+			return m_buffers.data();
+		}
+
+		/// Gets a const iterator to the first buffer.
+		const RawBuffer* begin() const {
+			return data();
+		}
+
+		/// Gets a const iterator to one past the last buffer.
+		const RawBuffer* end() const {
+			return data() + m_size;
+		}
+
+		/// Gets the buffer at \a index.
+		const RawBuffer& operator[](size_t index) const {
+			return m_buffers[index];
+		}
+
+	public:
+		/// Appends \a buffer to this container.
+		void push_back(const RawBuffer& buffer);
+
+	private:
+		std::array<RawBuffer, Capacity> m_buffers;
+		size_t m_size;
+	};
+
 	/// Signature input.
 	struct SignatureInput {
 		/// Public key.
 		const Key& PublicKey;
 
 		/// Buffers.
-		std::vector<RawBuffer> Buffers;
+		SignatureInputBuffers Buffers;
 
 		/// Signature.
 		const catapult::Signature& Signature;
@@ -58,6 +113,7 @@ namespace catapult { namespace crypto {
 
 	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
 	/// \a randomFiller is used to generate random bytes.
+	/// \note Signature inputs are accessed in place and are never copied.
 	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
 	/// and a vector of bools that indicates the verification result for each individual signature.
 	std::pair<std::vector<bool>, bool> VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
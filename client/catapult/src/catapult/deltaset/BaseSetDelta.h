@@ -28,6 +28,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -64,6 +65,13 @@ namespace catapult { namespace deltaset {
 		Removed
 	};
 
+	/// Prefetches the elements identified by \a keys from \a elements.
+	/// \note This is a no-op for sets that are fully loaded into memory.
+	template<typename TSet, typename TKey>
+	void PrefetchBaseSet(const TSet&, const std::vector<TKey>&) {
+		// memory sets don't need to be prefetched
+	}
+
 	template<typename TSetTraits>
 	class BaseSetDeltaIterationView;
 
@@ -182,6 +190,21 @@ namespace catapult { namespace deltaset {
 			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
 		}
 
+		/// Prefetches all original elements identified by \a keys that are not already tracked by this delta.
+		/// \note This is a hint that allows storage backed sets to load elements in bulk before they are accessed.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			std::vector<KeyType> originalKeys;
+			for (const auto& key : keys) {
+				if (Contains(m_removedElements, key) || Contains(m_addedElements, key) || Contains(m_copiedElements, key))
+					continue;
+
+				originalKeys.push_back(key);
+			}
+
+			if (!originalKeys.empty())
+				PrefetchBaseSet(m_originalElements, originalKeys);
+		}
+
 	private:
 		template<typename TSet> // SetType or MemorySetType
 		static constexpr bool Contains(const TSet& set, const KeyType& key) {
@@ -23,6 +23,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -155,6 +156,13 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Prefetches all elements with \a keys so that subsequent searches for them are served from memory.
+		/// \note This is a no-op for memory-based containers.
+		void prefetch(const std::vector<typename TKeyTraits::KeyType>& keys) const {
+			if (m_pContainer1)
+				m_pContainer1->prefetch(keys);
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -216,4 +224,11 @@ namespace catapult { namespace deltaset {
 	void PruneBaseSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const TPruningBoundary& pruningBoundary) {
 		container.prune(pruningBoundary);
 	}
+
+	/// Prefetches the elements identified by \a keys from \a container.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKey>
+	void PrefetchBaseSet(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const std::vector<TKey>& keys) {
+		container.prefetch(keys);
+	}
 }}
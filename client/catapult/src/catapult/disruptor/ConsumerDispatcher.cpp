@@ -45,6 +45,31 @@ namespace catapult { namespace disruptor {
 					<< "completing processing of " << element
 					<< ", last consumer is " << (maxPosition - minPosition) << " elements behind";
 		}
+
+		// abandons a claimed position on destruction unless dismissed, so that a producer failing after claiming a position
+		// cannot block producers with higher claimed positions forever
+		template<typename TAbandon>
+		class ClaimedPositionGuard {
+		public:
+			explicit ClaimedPositionGuard(TAbandon abandon)
+					: m_abandon(abandon)
+					, m_isDismissed(false)
+			{}
+
+			~ClaimedPositionGuard() {
+				if (!m_isDismissed)
+					m_abandon();
+			}
+
+		public:
+			void dismiss() {
+				m_isDismissed = true;
+			}
+
+		private:
+			TAbandon m_abandon;
+			bool m_isDismissed;
+		};
 	}
 
 	ConsumerDispatcher::ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers)
@@ -61,8 +86,10 @@ namespace catapult { namespace disruptor {
 			, m_barriers(consumers.size() + 1)
 			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval)
 			, m_inspector(inspector)
+			, m_statistics(consumers.size())
 			, m_numActiveElements(0)
-			, m_memorySize(0) {
+			, m_memorySize(0)
+			, m_claimPosition(0) {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
@@ -71,11 +98,13 @@ namespace catapult { namespace disruptor {
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+						pThis->waitForNext(consumerEntry);
 						continue;
 					}
 
+					pDisruptorElement->markConsumerStart(consumerEntry.level());
 					auto result = consumer(pDisruptorElement->input());
+					pDisruptorElement->markConsumerEnd(consumerEntry.level());
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
 
@@ -93,6 +122,7 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		notifyConsumers();
 		m_threads.join();
 	}
 
@@ -116,6 +146,10 @@ namespace catapult { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
+	const ConsumerDispatcherStatistics& ConsumerDispatcher::statistics() const {
+		return m_statistics;
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -136,18 +170,59 @@ namespace catapult { namespace disruptor {
 		m_barriers[consumerEntry.level() + 1].advance();
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
+		if (consumerEntry.level() + 1 != m_barriers.size() - 1) {
+			notifyConsumers();
 			return;
+		}
 
+		// abandoned elements are never queued with input, so there is nothing to inspect or complete
 		auto& element = m_disruptor.elementAt(consumerPosition);
+		if (element.input().empty())
+			return;
+
 		LogCompletion(element, m_barriers, m_options.ElementTraceInterval);
 		m_inspector(element.input(), element.completionResult());
+
+		// fold timings after the inspector so that total times include the inspector (e.g. memory reclamation)
+		m_statistics.add(element, DisruptorClock::now());
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	void ConsumerDispatcher::waitForNext(const ConsumerEntry& consumerEntry) {
+		if (ConsumerWaitStrategy::Busy_Spin == m_options.WaitStrategy)
+			return;
+
+		if (ConsumerWaitStrategy::Yield == m_options.WaitStrategy) {
+			std::this_thread::yield();
+			return;
+		}
+
+		if (ConsumerWaitStrategy::Blocking == m_options.WaitStrategy) {
+			std::unique_lock<std::mutex> lock(m_waitMutex);
+			m_waitCondition.wait(lock, [this, &consumerEntry]() {
+				return !m_keepRunning || m_barriers[consumerEntry.level()].position() != consumerEntry.position();
+			});
+			return;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	void ConsumerDispatcher::notifyConsumers() {
+		if (ConsumerWaitStrategy::Blocking != m_options.WaitStrategy)
+			return;
+
+		// acquire the mutex so that a consumer cannot miss the notification between checking its barrier and waiting
+		{
+			std::lock_guard<std::mutex> lock(m_waitMutex);
+		}
+
+		m_waitCondition.notify_all();
+	}
+
+	bool ConsumerDispatcher::canProcessNextElement(PositionType claimPosition) const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
+		auto maxPosition = claimPosition;
 		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
 		auto totalCapacity = m_disruptor.capacity();
 
@@ -158,6 +233,41 @@ namespace catapult { namespace disruptor {
 		return requiredCapacity == totalCapacity;
 	}
 
+	bool ConsumerDispatcher::tryReserveMemory(utils::FileSize inputMemorySize) {
+		auto memorySize = m_memorySize.load();
+		do {
+			if (m_options.DisruptorMaxMemorySize.bytes() - memorySize < inputMemorySize.bytes()) {
+				CATAPULT_LOG(warning)
+						<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
+						<< ", current = " << utils::FileSize::FromBytes(memorySize) << ")";
+				return false;
+			}
+		} while (!m_memorySize.compare_exchange_weak(memorySize, memorySize + inputMemorySize.bytes()));
+
+		return true;
+	}
+
+	bool ConsumerDispatcher::tryClaimPosition(PositionType& position) {
+		auto claimPosition = m_claimPosition.load();
+		do {
+			if (!canProcessNextElement(claimPosition))
+				return false;
+		} while (!m_claimPosition.compare_exchange_weak(claimPosition, claimPosition + 1));
+
+		position = claimPosition;
+		return true;
+	}
+
+	void ConsumerDispatcher::publish(PositionType position) {
+		// consumers see elements in claim order, so wait for all producers with lower claimed positions to publish first
+		auto& producerBarrier = m_barriers[0];
+		while (producerBarrier.position() != position)
+			std::this_thread::yield();
+
+		producerBarrier.advance();
+		notifyConsumers();
+	}
+
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize) {
 		return [this, processingComplete, inputMemorySize](auto elementId, const auto& result) {
 			processingComplete(elementId, result);
@@ -174,14 +284,13 @@ namespace catapult { namespace disruptor {
 		}
 
 		auto inputMemorySize = input.memorySize();
+		auto wrappedProcessingComplete = wrap(processingComplete, inputMemorySize);
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		auto isFull = !canProcessNextElement();
-		if (m_options.DisruptorMaxMemorySize.bytes() - m_memorySize < inputMemorySize.bytes()) {
-			CATAPULT_LOG(warning)
-					<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
-					<< ", current = " << utils::FileSize::FromBytes(m_memorySize) << ")";
+		// reserve memory before claiming a position because a claimed position can only be released by publishing it
+		PositionType position = 0;
+		auto isFull = !tryReserveMemory(inputMemorySize);
+		if (!isFull && !tryClaimPosition(position)) {
+			m_memorySize -= inputMemorySize.bytes();
 			isFull = true;
 		}
 
@@ -192,11 +301,22 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		m_memorySize += inputMemorySize.bytes();
 		++m_numActiveElements;
 
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete, inputMemorySize));
-		m_barriers[0].advance();
+		// if the element cannot be added, publish a skipped element in its place and release its reservations
+		ClaimedPositionGuard positionGuard([this, position, inputMemorySize]() {
+			CATAPULT_LOG(warning) << m_options.DispatcherName << " abandoning claimed position " << position;
+			m_disruptor.abandon(position);
+			m_memorySize -= inputMemorySize.bytes();
+			--m_numActiveElements;
+			publish(position);
+		});
+
+		auto id = m_disruptor.add(position, std::move(input), wrappedProcessingComplete);
+		m_disruptor.elementAt(position).markQueued(m_statistics.numConsumers());
+
+		positionGuard.dismiss();
+		publish(position);
 		return id;
 	}
 
@@ -21,12 +21,15 @@
 
 #pragma once
 #include "ConsumerDispatcherOptions.h"
+#include "ConsumerDispatcherStatistics.h"
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
 #include "catapult/thread/ThreadGroup.h"
 #include "catapult/utils/NamedObject.h"
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
@@ -74,12 +77,25 @@ namespace catapult { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the latency statistics of all consumers.
+		const ConsumerDispatcherStatistics& statistics() const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		void waitForNext(const ConsumerEntry& consumerEntry);
+
+		void notifyConsumers();
+
+		bool canProcessNextElement(PositionType claimPosition) const;
+
+		bool tryReserveMemory(utils::FileSize inputMemorySize);
+
+		bool tryClaimPosition(PositionType& position);
+
+		void publish(PositionType position);
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize);
 
@@ -89,10 +105,13 @@ namespace catapult { namespace disruptor {
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
+		ConsumerDispatcherStatistics m_statistics;
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
+		std::atomic<PositionType> m_claimPosition; // next position that can be claimed by a producer
 
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
+		std::mutex m_waitMutex; // only used by ConsumerWaitStrategy::Blocking
+		std::condition_variable m_waitCondition;
 	};
 }}
@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ConsumerDispatcherStatistics.h"
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		uint64_t ToMicroseconds(DisruptorClock::duration duration) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+		}
+	}
+
+	ConsumerDispatcherStatistics::ConsumerDispatcherStatistics(size_t numConsumers) {
+		for (auto i = 0u; i < numConsumers; ++i) {
+			m_waitTimes.push_back(std::make_unique<utils::LatencyHistogram>());
+			m_processingTimes.push_back(std::make_unique<utils::LatencyHistogram>());
+		}
+	}
+
+	size_t ConsumerDispatcherStatistics::numConsumers() const {
+		return m_waitTimes.size();
+	}
+
+	const utils::LatencyHistogram& ConsumerDispatcherStatistics::waitTimes(size_t level) const {
+		return *m_waitTimes[level];
+	}
+
+	const utils::LatencyHistogram& ConsumerDispatcherStatistics::processingTimes(size_t level) const {
+		return *m_processingTimes[level];
+	}
+
+	const utils::LatencyHistogram& ConsumerDispatcherStatistics::totalTimes() const {
+		return m_totalTimes;
+	}
+
+	void ConsumerDispatcherStatistics::add(const DisruptorElement& element, DisruptorClock::time_point completionTime) {
+		auto previousEndTime = element.queueTime();
+		const auto& consumerTimestamps = element.consumerTimestamps();
+		for (auto level = 0u; level < consumerTimestamps.size() && level < m_waitTimes.size(); ++level) {
+			// consumers after an aborting consumer skip the element and don't have timestamps
+			const auto& timestamps = consumerTimestamps[level];
+			if (DisruptorClock::time_point() == timestamps.Start)
+				break;
+
+			m_waitTimes[level]->add(ToMicroseconds(timestamps.Start - previousEndTime));
+			m_processingTimes[level]->add(ToMicroseconds(timestamps.End - timestamps.Start));
+			previousEndTime = timestamps.End;
+		}
+
+		m_totalTimes.add(ToMicroseconds(completionTime - element.queueTime()));
+	}
+}}
@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorElement.h"
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/utils/NonCopyable.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace disruptor {
+
+	/// Latency statistics of all consumers of a consumer dispatcher.
+	/// \note All latencies are in microseconds.
+	class ConsumerDispatcherStatistics : utils::NonCopyable {
+	public:
+		/// Creates statistics for \a numConsumers consumers.
+		explicit ConsumerDispatcherStatistics(size_t numConsumers);
+
+	public:
+		/// Gets the number of consumers.
+		size_t numConsumers() const;
+
+		/// Gets the histogram of times elements waited before being processed by the consumer at \a level.
+		/// \note For the first consumer, this is the time elements spent queued in the disruptor.
+		const utils::LatencyHistogram& waitTimes(size_t level) const;
+
+		/// Gets the histogram of times spent by the consumer at \a level processing elements.
+		const utils::LatencyHistogram& processingTimes(size_t level) const;
+
+		/// Gets the histogram of times between elements being queued and completed.
+		const utils::LatencyHistogram& totalTimes() const;
+
+	public:
+		/// Adds the timestamps of \a element, which was completed at \a completionTime.
+		void add(const DisruptorElement& element, DisruptorClock::time_point completionTime);
+
+	private:
+		std::vector<std::unique_ptr<utils::LatencyHistogram>> m_waitTimes;
+		std::vector<std::unique_ptr<utils::LatencyHistogram>> m_processingTimes;
+		utils::LatencyHistogram m_totalTimes;
+	};
+}}
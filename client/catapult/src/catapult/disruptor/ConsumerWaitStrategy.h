@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <string>
+
+namespace catapult { namespace disruptor {
+
+	/// Strategy used by consumers waiting for new elements.
+	enum class ConsumerWaitStrategy {
+		/// Sleep for a fixed interval between polls.
+		Sleep,
+
+		/// Continuously poll without yielding.
+		/// \note This strategy has the lowest latency but fully occupies one core per consumer.
+		Busy_Spin,
+
+		/// Yield the current thread between polls.
+		Yield,
+
+		/// Block on a condition variable until new elements are available.
+		Blocking
+	};
+
+	/// Tries to parse \a strategyName into a consumer wait \a strategy.
+	bool TryParseValue(const std::string& strategyName, ConsumerWaitStrategy& strategy);
+}}
@@ -28,7 +28,8 @@ namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
+	//  2. positions are claimed inside ConsumerDispatcher, which checks if the Disruptor is full,
+	//     so concurrent adds always write to distinct elements
 	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
@@ -38,12 +39,24 @@ namespace catapult { namespace disruptor {
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		return add(m_allElementsCount, std::move(input), processingComplete);
+	}
+
+	DisruptorElementId Disruptor::add(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
+		auto element = DisruptorElement(std::move(input), position + 1, processingComplete);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		auto id = element.id();
+		m_container[position] = std::move(element);
+		++m_allElementsCount;
+		return id;
+	}
+
+	void Disruptor::abandon(PositionType position) {
+		auto element = DisruptorElement();
+		element.markSkipped(position, ConsumerResult::Abort());
+		m_container[position] = std::move(element);
 	}
 
 	void Disruptor::markSkipped(PositionType position, const ConsumerResult& result) {
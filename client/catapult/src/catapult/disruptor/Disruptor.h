@@ -27,6 +27,7 @@
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -43,6 +44,15 @@ namespace catapult { namespace disruptor {
 		/// Once the processing of the input is complete, \a processingComplete will be called.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Adds \a input to the underlying container at a previously claimed \a position and returns the assigned disruptor element id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This function can be called concurrently as long as all positions are distinct and within capacity.
+		DisruptorElementId add(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
+		/// Replaces the element at a previously claimed \a position with an empty element that is skipped by all consumers.
+		/// \note This is used to release a claimed position when its element could not be added.
+		void abandon(PositionType position);
+
 		/// Sets the skip flag on the element at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result);
 
@@ -56,7 +66,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		inline size_t size() const {
-			return m_container.size();
+			return std::min<size_t>(m_allElementsCount, m_container.capacity());
 		}
 
 		/// Gets the capacity of the disruptor.
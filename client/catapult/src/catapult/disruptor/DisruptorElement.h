@@ -22,9 +22,23 @@
 #pragma once
 #include "ConsumerInput.h"
 #include "catapult/utils/SpinLock.h"
+#include <chrono>
+#include <vector>
 
 namespace catapult { namespace disruptor {
 
+	/// Clock used for timing disruptor elements.
+	using DisruptorClock = std::chrono::steady_clock;
+
+	/// Times at which a single consumer started and finished processing a disruptor element.
+	struct ConsumerTimestamps {
+		/// Time at which the consumer started processing the element.
+		DisruptorClock::time_point Start;
+
+		/// Time at which the consumer finished processing the element.
+		DisruptorClock::time_point End;
+	};
+
 	/// Augments consumer input with disruptor metadata.
 	class DisruptorElement {
 	public:
@@ -71,6 +85,17 @@ namespace catapult { namespace disruptor {
 			return m_result;
 		}
 
+		/// Gets the time at which the element was queued.
+		DisruptorClock::time_point queueTime() const {
+			return m_queueTime;
+		}
+
+		/// Gets the timestamps of all consumers.
+		/// \note Timestamps of consumers that did not process the element are default initialized.
+		const std::vector<ConsumerTimestamps>& consumerTimestamps() const {
+			return m_consumerTimestamps;
+		}
+
 	public:
 		/// Marks the element as skipped at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result) {
@@ -81,6 +106,22 @@ namespace catapult { namespace disruptor {
 			m_result.FinalConsumerPosition = position;
 		}
 
+		/// Marks the element as queued for processing by \a numConsumers consumers.
+		void markQueued(size_t numConsumers) {
+			m_queueTime = DisruptorClock::now();
+			m_consumerTimestamps.assign(numConsumers, ConsumerTimestamps());
+		}
+
+		/// Marks the start of processing by the consumer at \a level.
+		void markConsumerStart(size_t level) {
+			m_consumerTimestamps[level].Start = DisruptorClock::now();
+		}
+
+		/// Marks the end of processing by the consumer at \a level.
+		void markConsumerEnd(size_t level) {
+			m_consumerTimestamps[level].End = DisruptorClock::now();
+		}
+
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
 			m_processingComplete(m_id, m_result);
@@ -91,6 +132,8 @@ namespace catapult { namespace disruptor {
 		DisruptorElementId m_id;
 		ProcessingCompleteFunc m_processingComplete;
 		ConsumerCompletionResult m_result;
+		DisruptorClock::time_point m_queueTime;
+		std::vector<ConsumerTimestamps> m_consumerTimestamps; // each consumer only writes its own timestamps
 		std::unique_ptr<utils::SpinLock> m_pSpinLock; // unique_ptr to allow moving of element
 	};
 
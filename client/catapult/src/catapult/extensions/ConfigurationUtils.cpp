@@ -25,6 +25,9 @@
 namespace catapult { namespace extensions {
 
 	cache::MemoryCacheOptions GetUtCacheOptions(const config::NodeConfiguration& config) {
-		return cache::MemoryCacheOptions(config.UnconfirmedTransactionsCacheMaxResponseSize, config.UnconfirmedTransactionsCacheMaxSize);
+		return cache::MemoryCacheOptions(
+				config.UnconfirmedTransactionsCacheMaxResponseSize,
+				config.UnconfirmedTransactionsCacheMaxSize,
+				config.UnconfirmedTransactionsCacheNumShards);
 	}
 }}
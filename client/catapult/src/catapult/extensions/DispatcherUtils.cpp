@@ -41,6 +41,20 @@ namespace catapult { namespace extensions {
 		};
 	}
 
+	namespace {
+		std::pair<size_t, uint64_t> FindSlowestConsumer(const disruptor::ConsumerDispatcherStatistics& statistics) {
+			// slowest consumer has the largest 99th percentile processing time
+			std::pair<size_t, uint64_t> slowestConsumer(0, 0);
+			for (auto i = 0u; i < statistics.numConsumers(); ++i) {
+				auto processingTime = statistics.processingTimes(i).percentile(99);
+				if (processingTime > slowestConsumer.second)
+					slowestConsumer = std::make_pair(i, processingTime);
+			}
+
+			return slowestConsumer;
+		}
+	}
+
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix) {
 		using disruptor::ConsumerDispatcher;
 
@@ -53,6 +67,20 @@ namespace catapult { namespace extensions {
 		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM MEM", [](const auto& dispatcher) {
 			return dispatcher.memorySize().megabytes();
 		});
+
+		// latencies are in microseconds
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " LAT MED", [](const auto& dispatcher) {
+			return dispatcher.statistics().totalTimes().percentile(50);
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " LAT TAIL", [](const auto& dispatcher) {
+			return dispatcher.statistics().totalTimes().percentile(99);
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " SLOW STG", [](const auto& dispatcher) {
+			return FindSlowestConsumer(dispatcher.statistics()).first;
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " SLOW TAIL", [](const auto& dispatcher) {
+			return FindSlowestConsumer(dispatcher.statistics()).second;
+		});
 	}
 
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
@@ -40,6 +40,7 @@ namespace catapult { namespace extensions {
 	chain::FailedTransactionSink SubscriberToSink(subscribers::TransactionStatusSubscriber& subscriber);
 
 	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
+	/// \note Latency counters report end-to-end latencies and the slowest consumer (by 99th percentile processing time).
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
 	/// Transaction batch range dispatcher.
@@ -31,9 +31,15 @@ namespace catapult { namespace extensions {
 		executionConfig.pObserver = pluginManager.createObserver();
 		executionConfig.pValidator = pluginManager.createStatefulValidator();
 		executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+		executionConfig.pNotificationAccessExtractor = pluginManager.createNotificationAccessExtractor();
 		executionConfig.ResolverContextFactory = [&pluginManager](const auto& cache) {
 			return pluginManager.createResolverContext(cache);
 		};
+
+		// prefetching only reduces random reads from the cache database, so skip it when all state is in memory
+		if (pluginManager.storageConfig().PreferCacheDatabase)
+			executionConfig.pStatePrefetcher = pluginManager.createStatePrefetcher();
+
 		return executionConfig;
 	}
 }}
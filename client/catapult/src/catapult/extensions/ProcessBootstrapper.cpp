@@ -51,6 +51,9 @@ namespace catapult { namespace extensions {
 							: thread::MultiServicePool::IsolatedPoolMode::Enabled))
 			, m_subscriptionManager(config)
 			, m_pluginManager(m_config.Blockchain, CreateStorageConfiguration(config), m_config.User, m_config.Inflation) {
+			if (m_config.Node.EnableExecutionProfiling)
+				m_pluginManager.enableExecutionProfiling();
+
 #ifdef STRICT_SYMBOL_VISIBILITY
 			// need to forcibly inject typeinfos into containing exe so that they are properly resolved across modules
 			ForceSymbolInjection<model::EmbeddedTransactionPlugin>();
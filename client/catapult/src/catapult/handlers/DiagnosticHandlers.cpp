@@ -28,7 +28,10 @@
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DispatcherLatencyEntry.h"
+#include "catapult/model/ExecutionProfileEntry.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/Functional.h"
 
 namespace catapult { namespace handlers {
 
@@ -148,4 +151,89 @@ namespace catapult { namespace handlers {
 	}
 
 	// endregion
+
+	// region DiagnosticExecutionProfileHandler
+
+	namespace {
+		auto CreateDiagnosticExecutionProfileHandler(const ExecutionProfileSupplier& profileSupplier) {
+			return [profileSupplier](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Execution_Profile))
+					return;
+
+				auto allEntryValues = profileSupplier();
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(utils::Sum(allEntryValues, [](const auto& entryValues) {
+					return sizeof(model::ExecutionProfileEntry) + entryValues.Name.size();
+				}));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Execution_Profile;
+
+				auto* pData = pResponsePacket->Data();
+				for (const auto& entryValues : allEntryValues) {
+					auto nameSize = utils::checked_cast<size_t, uint16_t>(entryValues.Name.size());
+					auto& entry = reinterpret_cast<model::ExecutionProfileEntry&>(*pData);
+					entry.Size = SizeOf32<model::ExecutionProfileEntry>() + nameSize;
+					entry.NameSize = nameSize;
+					entry.ExecutionProfileEntry_Reserved1 = 0;
+					entry.NumCalls = entryValues.NumCalls;
+					entry.TotalElapsedNanoseconds = entryValues.TotalElapsedNanoseconds;
+					entry.MaxElapsedNanoseconds = entryValues.MaxElapsedNanoseconds;
+					std::memcpy(pData + sizeof(model::ExecutionProfileEntry), entryValues.Name.data(), nameSize);
+					pData += entry.Size;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticExecutionProfileHandler(ionet::ServerPacketHandlers& handlers, const utils::ExecutionProfile& profile) {
+		RegisterDiagnosticExecutionProfileHandler(handlers, [&profile]() { return profile.values(); });
+	}
+
+	void RegisterDiagnosticExecutionProfileHandler(ionet::ServerPacketHandlers& handlers, const ExecutionProfileSupplier& profileSupplier) {
+		handlers.registerHandler(ionet::PacketType::Execution_Profile, CreateDiagnosticExecutionProfileHandler(profileSupplier));
+	}
+
+	// endregion
+
+	// region DiagnosticDispatcherLatenciesHandler
+
+	namespace {
+		auto CreateDiagnosticDispatcherLatenciesHandler(const DispatcherLatenciesSupplier& latenciesSupplier) {
+			return [latenciesSupplier](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Dispatcher_Latencies))
+					return;
+
+				auto allLatencies = latenciesSupplier();
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(utils::Sum(allLatencies, [](const auto& latencies) {
+					return sizeof(model::DispatcherLatencyEntry) + latencies.DispatcherName.size();
+				}));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Dispatcher_Latencies;
+
+				auto* pData = pResponsePacket->Data();
+				for (const auto& latencies : allLatencies) {
+					auto nameSize = utils::checked_cast<size_t, uint16_t>(latencies.DispatcherName.size());
+					auto& entry = reinterpret_cast<model::DispatcherLatencyEntry&>(*pData);
+					entry.Size = SizeOf32<model::DispatcherLatencyEntry>() + nameSize;
+					entry.NameSize = nameSize;
+					entry.ConsumerLevel = latencies.ConsumerLevel;
+					entry.WaitTimes = latencies.WaitTimes;
+					entry.ProcessingTimes = latencies.ProcessingTimes;
+					std::memcpy(pData + sizeof(model::DispatcherLatencyEntry), latencies.DispatcherName.data(), nameSize);
+					pData += entry.Size;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticDispatcherLatenciesHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const DispatcherLatenciesSupplier& latenciesSupplier) {
+		handlers.registerHandler(ionet::PacketType::Dispatcher_Latencies, CreateDiagnosticDispatcherLatenciesHandler(latenciesSupplier));
+	}
+
+	// endregion
 }}
@@ -21,6 +21,10 @@
 
 #pragma once
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/utils/ExecutionProfile.h"
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/functions.h"
+#include <string>
 #include <vector>
 
 namespace catapult {
@@ -31,6 +35,27 @@ namespace catapult {
 
 namespace catapult { namespace handlers {
 
+	/// Latencies of a single consumer of a named consumer dispatcher.
+	struct DispatcherConsumerLatencies {
+		/// Dispatcher name.
+		std::string DispatcherName;
+
+		/// Consumer level or model::DispatcherLatencyEntry::Total_Consumer_Level.
+		uint16_t ConsumerLevel;
+
+		/// Summary of wait times.
+		utils::LatencySummary WaitTimes;
+
+		/// Summary of processing times.
+		utils::LatencySummary ProcessingTimes;
+	};
+
+	/// Supplies the latencies of all consumers of all dispatchers.
+	using DispatcherLatenciesSupplier = supplier<std::vector<DispatcherConsumerLatencies>>;
+
+	/// Supplies the values of all execution profile entries.
+	using ExecutionProfileSupplier = supplier<std::vector<utils::ExecutionProfile::EntryValues>>;
+
 	/// Registers a diagnostic counters handler in \a handlers that responds with the current values of \a counters.
 	void RegisterDiagnosticCountersHandler(ionet::ServerPacketHandlers& handlers, const std::vector<utils::DiagnosticCounter>& counters);
 
@@ -39,4 +64,17 @@ namespace catapult { namespace handlers {
 
 	/// Registers a diagnostic block statement handler in \a handlers that responds with data from \a storage.
 	void RegisterDiagnosticBlockStatementHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage);
+
+	/// Registers a diagnostic execution profile handler in \a handlers that responds with all entries in \a profile
+	/// sorted by decreasing total elapsed time.
+	void RegisterDiagnosticExecutionProfileHandler(ionet::ServerPacketHandlers& handlers, const utils::ExecutionProfile& profile);
+
+	/// Registers a diagnostic execution profile handler in \a handlers that responds with all entries returned by \a profileSupplier.
+	void RegisterDiagnosticExecutionProfileHandler(ionet::ServerPacketHandlers& handlers, const ExecutionProfileSupplier& profileSupplier);
+
+	/// Registers a diagnostic dispatcher latencies handler in \a handlers that responds with all consumer latencies
+	/// returned by \a latenciesSupplier.
+	void RegisterDiagnosticDispatcherLatenciesHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const DispatcherLatenciesSupplier& latenciesSupplier);
 }}
@@ -24,6 +24,7 @@
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/TransactionPlugin.h"
+#include "catapult/utils/BloomFilter.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/utils/ShortHash.h"
 #include <functional>
@@ -113,4 +114,34 @@ namespace catapult { namespace handlers {
 			};
 		}
 	};
+
+	/// Provides a pull entities handler implementation that allows filtering by TFilterValue and a filter of known short hashes.
+	template<typename TFilterValue>
+	struct PullFilteredEntitiesHandler {
+	public:
+		/// Creates a handler around \a entitiesRetriever that responds with packets of type \a packetType.
+		template<typename TEntitiesRetriever>
+		static auto Create(ionet::PacketType packetType, TEntitiesRetriever entitiesRetriever) {
+			return [packetType, entitiesRetriever](const auto& packet, auto& context) {
+				auto dataSize = ionet::CalculatePacketDataSize(packet);
+				if (dataSize < sizeof(TFilterValue))
+					return;
+
+				// data is prepended with filter value followed by exactly one serialized bloom filter
+				const auto& filterValue = reinterpret_cast<const TFilterValue&>(*packet.Data());
+				RawBuffer filterBuffer{ packet.Data() + sizeof(TFilterValue), dataSize - sizeof(TFilterValue) };
+
+				utils::BloomFilter knownShortHashesFilter;
+				size_t numBytesConsumed;
+				if (!utils::TryParseBloomFilter(filterBuffer, knownShortHashesFilter, numBytesConsumed))
+					return;
+
+				if (filterBuffer.Size != numBytesConsumed)
+					return;
+
+				auto entities = entitiesRetriever(filterValue, knownShortHashesFilter);
+				context.response(ionet::PacketPayloadFactory::FromEntities(packetType, entities));
+			};
+		}
+	};
 }}
@@ -21,12 +21,28 @@
 
 #pragma once
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/tree/PatriciaTreeMultiProof.h"
 #include "catapult/tree/PatriciaTreeSerializer.h"
 #include "catapult/utils/Casting.h"
 
 namespace catapult { namespace handlers {
 
+	namespace detail {
+		template<typename TValue>
+		void AppendValue(std::vector<uint8_t>& buffer, TValue value) {
+			const auto* pData = reinterpret_cast<const uint8_t*>(&value);
+			buffer.insert(buffer.end(), pData, pData + sizeof(TValue));
+		}
+
+		inline void AppendSerializedNode(std::vector<uint8_t>& buffer, const tree::TreeNode& node) {
+			auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
+			const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
+			buffer.insert(buffer.end(), pData, pData + serializedNode.size());
+		}
+	}
+
 	/// Registers a handler in \a handlers that responds with serialized state path produced by querying \a cache.
 	template<typename TPacket, typename TCache>
 	void RegisterStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache) {
@@ -41,11 +57,8 @@ namespace catapult { namespace handlers {
 
 			// serialize path even if lookup failed (to provide proof that key does not exist in state)
 			std::vector<uint8_t> serializedPath;
-			for (const auto& node : path) {
-				auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
-				const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
-				serializedPath.insert(serializedPath.end(), pData, pData + serializedNode.size());
-			}
+			for (const auto& node : path)
+				detail::AppendSerializedNode(serializedPath, node);
 
 			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedPath.size());
 			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
@@ -54,4 +67,59 @@ namespace catapult { namespace handlers {
 			context.response(ionet::PacketPayload(pResponsePacket));
 		});
 	}
+
+	/// Maximum number of keys in a single state paths request.
+	constexpr uint32_t Max_State_Paths_Request_Keys = 256;
+
+	/// Registers a handler in \a handlers that responds with a serialized multiproof of all keys in a request
+	/// produced by querying \a cache.
+	/// \note Response contains the number of nodes (uint32_t), the number of paths (uint32_t), all distinct serialized nodes
+	///       and, for each requested key, its path composed of a size (uint8_t) and node indexes (uint32_t).
+	/// \note Requests with more than Max_State_Paths_Request_Keys keys and requests with a multiproof that does not fit
+	///       into the max packet data size of \a handlers are rejected.
+	template<typename TRequestTraits, typename TCache>
+	void RegisterStatePathsHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache) {
+		auto maxPacketDataSize = handlers.maxPacketDataSize();
+		handlers.registerHandler(TRequestTraits::Packet_Type, [&cache, maxPacketDataSize](const auto& packet, auto& context) {
+			using KeyType = typename TRequestTraits::RequestStructureType;
+			if (TRequestTraits::Packet_Type != packet.Type)
+				return;
+
+			auto keyRange = ionet::ExtractFixedSizeStructuresFromPacket<KeyType>(packet);
+			if (keyRange.empty() || keyRange.size() > Max_State_Paths_Request_Keys)
+				return;
+
+			// look up all keys with a single tree traversal (proof contains copies of nodes, so view can be released early)
+			tree::PatriciaTreeMultiProof proof;
+			{
+				auto view = cache.createView();
+				view->tryLookup(std::vector<KeyType>(keyRange.cbegin(), keyRange.cend()), proof);
+			}
+
+			// serialize proof even if lookups failed (to provide proof that keys do not exist in state)
+			std::vector<uint8_t> serializedProof;
+			detail::AppendValue(serializedProof, utils::checked_cast<size_t, uint32_t>(proof.Nodes.size()));
+			detail::AppendValue(serializedProof, utils::checked_cast<size_t, uint32_t>(proof.Paths.size()));
+			for (const auto& node : proof.Nodes)
+				detail::AppendSerializedNode(serializedProof, node);
+
+			for (const auto& path : proof.Paths) {
+				detail::AppendValue(serializedProof, utils::checked_cast<size_t, uint8_t>(path.size()));
+				for (auto nodeIndex : path)
+					detail::AppendValue(serializedProof, nodeIndex);
+			}
+
+			// a truncated multiproof is useless, so don't respond when the complete multiproof cannot be sent
+			if (serializedProof.size() > maxPacketDataSize) {
+				CATAPULT_LOG(warning) << "multiproof for " << keyRange.size() << " keys exceeds max packet data size";
+				return;
+			}
+
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedProof.size());
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pResponsePacket->Type = TRequestTraits::Packet_Type;
+			utils::memcpy_cond(pResponsePacket->Data(), serializedProof.data(), serializedProof.size());
+			context.response(ionet::PacketPayload(pResponsePacket));
+		});
+	}
 }}
@@ -52,4 +52,13 @@ namespace catapult { namespace handlers {
 			return utRetriever(filter.Deadline, filter.FeeMultiplier, shortHashes);
 		}));
 	}
+
+	void RegisterPullFilteredTransactionsHandler(ionet::ServerPacketHandlers& handlers, const FilteredUtRetriever& utRetriever) {
+		constexpr auto Packet_Type = ionet::PacketType::Pull_Filtered_Transactions;
+		handlers.registerHandler(Packet_Type, PullFilteredEntitiesHandler<TransactionsFilter>::Create(Packet_Type, [utRetriever](
+				const auto& filter,
+				const auto& knownShortHashesFilter) {
+			return utRetriever(filter.Deadline, filter.FeeMultiplier, knownShortHashesFilter);
+		}));
+	}
 }}
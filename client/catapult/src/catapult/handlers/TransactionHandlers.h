@@ -24,6 +24,7 @@
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
+#include "catapult/utils/BloomFilter.h"
 #include "catapult/utils/ShortHash.h"
 #include <unordered_set>
 
@@ -35,6 +36,9 @@ namespace catapult { namespace handlers {
 	/// Prototype for a function that retrieves unconfirmed transactions given a filter and a set of short hashes.
 	using UtRetriever = std::function<UnconfirmedTransactions (Timestamp, BlockFeeMultiplier, const utils::ShortHashesSet&)>;
 
+	/// Prototype for a function that retrieves unconfirmed transactions given a filter and a filter of known short hashes.
+	using FilteredUtRetriever = std::function<UnconfirmedTransactions (Timestamp, BlockFeeMultiplier, const utils::BloomFilter&)>;
+
 	/// Registers a push transactions handler in \a handlers that forwards transactions to \a transactionRangeHandler
 	/// given a transaction \a registry composed of known transactions.
 	void RegisterPushTransactionsHandler(
@@ -45,4 +49,8 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Registers a pull filtered transactions handler in \a handlers that responds with unconfirmed transactions
+	/// returned by the retriever (\a utRetriever).
+	void RegisterPullFilteredTransactionsHandler(ionet::ServerPacketHandlers& handlers, const FilteredUtRetriever& utRetriever);
 }}
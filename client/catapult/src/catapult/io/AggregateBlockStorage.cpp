@@ -49,6 +49,12 @@ namespace catapult { namespace io {
 				m_pBlockChangeSubscriber->notifyBlock(blockElement);
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				m_pStorage->saveBlocks(blockElements);
+				for (const auto& blockElement : blockElements)
+					m_pBlockChangeSubscriber->notifyBlock(blockElement);
+			}
+
 			void dropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 				m_pBlockChangeSubscriber->notifyDropBlocksAfter(height);
@@ -58,6 +64,10 @@ namespace catapult { namespace io {
 
 			// region BlockStorage
 
+			Height findHeight(const Hash256& hash) const override {
+				return m_pStorage->findHeight(hash);
+			}
+
 			std::shared_ptr<const model::Block> loadBlock(Height height) const override {
 				return m_pStorage->loadBlock(height);
 			}
@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AsyncBlockStorageWriter.h"
+#include "BlockStorage.h"
+#include "catapult/thread/ThreadInfo.h"
+
+namespace catapult { namespace io {
+
+	AsyncBlockStorageWriter::AsyncBlockStorageWriter(LightBlockStorage& storage)
+			: m_storage(storage)
+			, m_numInProgress(0)
+			, m_numGroupCommits(0)
+			, m_isStopped(false)
+			, m_thread([this]() { run(); })
+	{}
+
+	AsyncBlockStorageWriter::~AsyncBlockStorageWriter() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopped = true;
+		}
+
+		m_pendingCondition.notify_one();
+		m_thread.join();
+	}
+
+	size_t AsyncBlockStorageWriter::numGroupCommits() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_numGroupCommits;
+	}
+
+	void AsyncBlockStorageWriter::saveBlocks(std::vector<std::shared_ptr<const model::BlockElement>>&& blockElements) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (auto& pBlockElement : blockElements)
+				m_pendingBlockElements.push_back(std::move(pBlockElement));
+		}
+
+		m_pendingCondition.notify_one();
+	}
+
+	void AsyncBlockStorageWriter::flush() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_completedCondition.wait(lock, [this]() {
+			return m_pException || (m_pendingBlockElements.empty() && 0 == m_numInProgress);
+		});
+
+		if (m_pException)
+			std::rethrow_exception(m_pException);
+	}
+
+	void AsyncBlockStorageWriter::run() {
+		thread::SetThreadName("block storage writer");
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true) {
+			m_pendingCondition.wait(lock, [this]() { return m_isStopped || !m_pendingBlockElements.empty(); });
+			if (m_pendingBlockElements.empty())
+				break;
+
+			auto pendingBlockElements = std::move(m_pendingBlockElements);
+			m_pendingBlockElements.clear();
+			m_numInProgress = pendingBlockElements.size();
+
+			if (!m_pException) {
+				lock.unlock();
+
+				std::exception_ptr pException;
+				try {
+					std::vector<model::BlockElement> blockElements;
+					blockElements.reserve(pendingBlockElements.size());
+					for (const auto& pBlockElement : pendingBlockElements)
+						blockElements.push_back(*pBlockElement);
+
+					m_storage.saveBlocks(blockElements);
+				} catch (...) {
+					pException = std::current_exception();
+				}
+
+				lock.lock();
+				if (pException)
+					m_pException = pException;
+				else
+					++m_numGroupCommits;
+			}
+
+			m_numInProgress = 0;
+			m_completedCondition.notify_all();
+		}
+	}
+}}
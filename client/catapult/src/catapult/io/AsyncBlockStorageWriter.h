@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/Elements.h"
+#include "catapult/utils/NonCopyable.h"
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace catapult { namespace io { class LightBlockStorage; } }
+
+namespace catapult { namespace io {
+
+	/// Writer that saves block elements to storage on a dedicated i/o thread.
+	/// \note All block elements queued while the i/o thread is busy are saved together as a single group commit.
+	class AsyncBlockStorageWriter : public utils::NonCopyable {
+	public:
+		/// Creates a writer around \a storage.
+		explicit AsyncBlockStorageWriter(LightBlockStorage& storage);
+
+		/// Destroys the writer after saving all queued block elements.
+		~AsyncBlockStorageWriter();
+
+	public:
+		/// Gets the number of group commits performed.
+		size_t numGroupCommits() const;
+
+	public:
+		/// Queues \a blockElements for saving.
+		void saveBlocks(std::vector<std::shared_ptr<const model::BlockElement>>&& blockElements);
+
+		/// Waits until all queued block elements have been saved.
+		/// \note Rethrows the first error raised by the storage, after which no further block elements are saved.
+		void flush();
+
+	private:
+		void run();
+
+	private:
+		LightBlockStorage& m_storage;
+		std::vector<std::shared_ptr<const model::BlockElement>> m_pendingBlockElements;
+		size_t m_numInProgress;
+		size_t m_numGroupCommits;
+		bool m_isStopped;
+		std::exception_ptr m_pException;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_pendingCondition;
+		std::condition_variable m_completedCondition;
+		std::thread m_thread;
+	};
+}}
@@ -115,5 +115,32 @@ namespace catapult { namespace io {
 		return pBlockElement;
 	}
 
+	namespace {
+		struct BlockElementWithBlockOwner {
+		public:
+			explicit BlockElementWithBlockOwner(const std::shared_ptr<const model::Block>& pBlock)
+					: pBlockOwner(pBlock)
+					, Element(*pBlock)
+			{}
+
+		public:
+			std::shared_ptr<const model::Block> pBlockOwner;
+			model::BlockElement Element;
+		};
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElementMetadata(
+			const std::shared_ptr<const model::Block>& pBlock,
+			InputStream& inputStream) {
+		auto pOwner = std::make_shared<BlockElementWithBlockOwner>(pBlock);
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pOwner, &pOwner->Element);
+
+		inputStream.read(pBlockElement->EntityHash);
+		inputStream.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(inputStream, *pBlockElement);
+		ReadSubCacheMerkleRoots(inputStream, pBlockElement->SubCacheMerkleRoots);
+		return pBlockElement;
+	}
+
 	// endregion
 }}
@@ -38,4 +38,10 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element metadata (everything following the block) from \a inputStream into an allocated block element around \a pBlock.
+	/// \note Returned block element keeps \a pBlock alive, which allows \a pBlock to be a view into externally owned memory.
+	std::shared_ptr<model::BlockElement> ReadBlockElementMetadata(
+			const std::shared_ptr<const model::Block>& pBlock,
+			InputStream& inputStream);
 }}
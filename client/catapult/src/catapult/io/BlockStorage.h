@@ -25,6 +25,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/NonCopyable.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -43,6 +44,13 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves \a blockElements, which must have consecutive heights.
+		/// \note Storages that support group commits should override this to write all block elements together.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
@@ -50,6 +58,9 @@ namespace catapult { namespace io {
 	/// Interface for saving and loading blocks.
 	class BlockStorage : public LightBlockStorage {
 	public:
+		/// Gets the height of the block with \a hash or \c Height(0) if no such block is stored.
+		virtual Height findHeight(const Hash256& hash) const = 0;
+
 		/// Gets the block at \a height.
 		virtual std::shared_ptr<const model::Block> loadBlock(Height height) const = 0;
 
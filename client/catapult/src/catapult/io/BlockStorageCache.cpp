@@ -87,6 +87,10 @@ namespace catapult { namespace io {
 		return m_storage.loadHashesFrom(height, maxHashes);
 	}
 
+	Height BlockStorageView::findHeight(const Hash256& hash) const {
+		return m_storage.findHeight(hash);
+	}
+
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
 		requireHeight(height, "block");
 		if (m_cachedData.contains(height))
@@ -139,8 +143,7 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
-		for (const auto& blockElement : blockElements)
-			m_stagingStorage.saveBlock(blockElement);
+		m_stagingStorage.saveBlocks(blockElements);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
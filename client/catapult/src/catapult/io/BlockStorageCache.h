@@ -43,6 +43,9 @@ namespace catapult { namespace io {
 		/// Gets a range of at most \a maxHashes hashes starting at \a height.
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const;
 
+		/// Gets the height of the block with \a hash or \c Height(0) if no such block is stored.
+		Height findHeight(const Hash256& hash) const;
+
 		/// Gets the block at \a height.
 		std::shared_ptr<const model::Block> loadBlock(Height height) const;
 
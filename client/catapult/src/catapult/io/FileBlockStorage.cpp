@@ -22,23 +22,33 @@
 #include "FileBlockStorage.h"
 #include "BlockElementSerializer.h"
 #include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
+#include "StringOutputStream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/utils/Logging.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "catapult/preprocessor.h"
+#include <cstring>
 
 namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			FileDatabaseReadMode readMode)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
-			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
+			, m_readMode(readMode)
+			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" }, readMode)
+			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" }, readMode)
 			, m_hashFile(dataDirectory, "hashes")
+			, m_hashHeightIndex((std::filesystem::path(dataDirectory) / "hashes.index").generic_string())
 			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
 	{}
 
@@ -66,12 +76,7 @@ namespace catapult { namespace io {
 	void FileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
 		auto currentHeight = chainHeight();
 		auto height = blockElement.Block.Height;
-
-		if (height != currentHeight + Height(1)) {
-			std::ostringstream out;
-			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
-			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
-		}
+		requireNextHeight(height);
 
 		{
 			// write element
@@ -85,14 +90,133 @@ namespace catapult { namespace io {
 			}
 		}
 
-		if (FileBlockStorageMode::Hash_Index == m_mode)
+		if (FileBlockStorageMode::Hash_Index == m_mode) {
 			m_hashFile.save(height, blockElement.EntityHash);
 
+			std::lock_guard<std::mutex> guard(m_hashHeightIndexMutex);
+			requireHashHeightIndex();
+			m_hashHeightIndex.append(height, { blockElement.EntityHash });
+		}
+
 		if (height > currentHeight)
 			m_indexFile.set(height.unwrap());
 	}
 
+	namespace {
+		// serializes all payloads into a single contiguous buffer so that each file can be written at once
+		class PayloadsBuilder {
+		public:
+			explicit PayloadsBuilder(size_t capacity) : m_stream(capacity)
+			{}
+
+		public:
+			OutputStream& stream() {
+				return m_stream;
+			}
+
+			void completePayload() {
+				m_payloadEndOffsets.push_back(m_stream.str().size());
+			}
+
+			std::vector<RawBuffer> payloads() const {
+				const auto* pData = reinterpret_cast<const uint8_t*>(m_stream.str().data());
+
+				std::vector<RawBuffer> payloads;
+				size_t startOffset = 0;
+				for (auto endOffset : m_payloadEndOffsets) {
+					payloads.emplace_back(pData + startOffset, endOffset - startOffset);
+					startOffset = endOffset;
+				}
+
+				return payloads;
+			}
+
+		private:
+			StringOutputStream m_stream;
+			std::vector<size_t> m_payloadEndOffsets;
+		};
+	}
+
+	void FileBlockStorage::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		if (blockElements.empty())
+			return;
+
+		auto startHeight = blockElements.front().Block.Height;
+		requireNextHeight(startHeight);
+
+		size_t totalBlocksSize = 0;
+		for (auto i = 0u; i < blockElements.size(); ++i) {
+			const auto& block = blockElements[i].Block;
+			if (startHeight + Height(i) != block.Height)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save blocks with nonconsecutive heights at height", block.Height);
+
+			totalBlocksSize += block.Size;
+		}
+
+		// 1. write all block elements
+		PayloadsBuilder blocksBuilder(totalBlocksSize);
+		for (const auto& blockElement : blockElements) {
+			WriteBlockElement(blockElement, blocksBuilder.stream());
+			blocksBuilder.completePayload();
+		}
+
+		m_blockDatabase.writeAll(startHeight.unwrap(), blocksBuilder.payloads());
+
+		// 2. write all statements, which are grouped into runs of consecutive heights
+		auto statementRunStartIndex = 0u;
+		while (statementRunStartIndex < blockElements.size()) {
+			if (!blockElements[statementRunStartIndex].OptionalStatement) {
+				++statementRunStartIndex;
+				continue;
+			}
+
+			PayloadsBuilder statementsBuilder(0);
+			auto statementRunEndIndex = statementRunStartIndex;
+			for (; statementRunEndIndex < blockElements.size(); ++statementRunEndIndex) {
+				const auto& pBlockStatement = blockElements[statementRunEndIndex].OptionalStatement;
+				if (!pBlockStatement)
+					break;
+
+				WriteBlockStatement(*pBlockStatement, statementsBuilder.stream());
+				statementsBuilder.completePayload();
+			}
+
+			m_statementDatabase.writeAll((startHeight + Height(statementRunStartIndex)).unwrap(), statementsBuilder.payloads());
+			statementRunStartIndex = statementRunEndIndex;
+		}
+
+		// 3. write all hashes
+		if (FileBlockStorageMode::Hash_Index == m_mode) {
+			std::vector<Hash256> hashes;
+			hashes.reserve(blockElements.size());
+			for (const auto& blockElement : blockElements)
+				hashes.push_back(blockElement.EntityHash);
+
+			m_hashFile.saveAll(startHeight, hashes);
+
+			std::lock_guard<std::mutex> guard(m_hashHeightIndexMutex);
+			requireHashHeightIndex();
+			m_hashHeightIndex.append(startHeight, hashes);
+		}
+
+		// 4. advance the index only after all data has been synced
+		m_indexFile.set(blockElements.back().Block.Height.unwrap());
+	}
+
 	void FileBlockStorage::dropBlocksAfter(Height height) {
+		if (FileBlockStorageMode::Hash_Index == m_mode) {
+			std::lock_guard<std::mutex> guard(m_hashHeightIndexMutex);
+			requireHashHeightIndex();
+			auto currentHeight = chainHeight();
+			std::vector<Hash256> droppedHashes;
+			if (height < currentHeight) {
+				auto hashes = m_hashFile.loadRangeFrom(height + Height(1), (currentHeight - height).unwrap());
+				droppedHashes.assign(hashes.cbegin(), hashes.cend());
+			}
+
+			m_hashHeightIndex.dropAfter(height, droppedHashes);
+		}
+
 		m_indexFile.set(height.unwrap());
 	}
 
@@ -108,16 +232,68 @@ namespace catapult { namespace io {
 			blockStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::Block> ViewBlock(const FileDatabasePayloadView& payloadView) {
+			const auto& payload = payloadView.Payload;
+			if (payload.Size < sizeof(uint32_t))
+				CATAPULT_THROW_FILE_IO_ERROR("memory mapped block payload is too small");
+
+			uint32_t size;
+			std::memcpy(&size, payload.pData, sizeof(uint32_t));
+			if (size < sizeof(model::Block) || size > payload.Size)
+				CATAPULT_THROW_FILE_IO_ERROR("memory mapped block has invalid size");
+
+			// block shares ownership of the mapped file
+			return std::shared_ptr<const model::Block>(payloadView.pFile, reinterpret_cast<const model::Block*>(payload.pData));
+		}
+	}
+
+	Height FileBlockStorage::findHeight(const Hash256& hash) const {
+		if (FileBlockStorageMode::Hash_Index != m_mode) {
+			// without an index, fall back to scanning stored blocks from the chain tip
+			for (auto height = chainHeight(); Height() != height; height = height - Height(1)) {
+				if (hash == loadBlockElement(height)->EntityHash)
+					return height;
+			}
+
+			return Height();
+		}
+
+		std::lock_guard<std::mutex> guard(m_hashHeightIndexMutex);
+		requireHashHeightIndex();
+
+		auto currentHeight = chainHeight();
+		return m_hashHeightIndex.find(hash, [this, &hash, currentHeight](auto height) {
+			// index only contains hash prefixes, so the full hash needs to be compared
+			return height <= currentHeight && hash == *m_hashFile.loadRangeFrom(height, 1).cbegin();
+		});
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (FileDatabaseReadMode::Memory_Mapped == m_readMode)
+			return ViewBlock(m_blockDatabase.payloadView(height.unwrap()));
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (FileDatabaseReadMode::Memory_Mapped == m_readMode) {
+			auto payloadView = m_blockDatabase.payloadView(height.unwrap());
+			auto pBlock = ViewBlock(payloadView);
+
+			auto metadataBuffer = RawBuffer(payloadView.Payload.pData + pBlock->Size, payloadView.Payload.Size - pBlock->Size);
+			BufferInputStreamAdapter<RawBuffer> metadataStream(metadataBuffer);
+			auto pBlockElement = ReadBlockElementMetadata(pBlock, metadataStream);
+
+			if (!metadataStream.eof())
+				CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+			return PORTABLE_MOVE(pBlockElement);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
@@ -133,6 +309,12 @@ namespace catapult { namespace io {
 		if (!m_statementDatabase.contains(height.unwrap()))
 			return std::make_pair(std::vector<uint8_t>(), false);
 
+		if (FileDatabaseReadMode::Memory_Mapped == m_readMode) {
+			// interface requires owned data, so copy directly out of the mapping
+			auto payload = m_statementDatabase.payloadView(height.unwrap()).Payload;
+			return std::make_pair(std::vector<uint8_t>(payload.pData, payload.pData + payload.Size), true);
+		}
+
 		size_t streamSize = 0;
 		auto pBlockStatementStream = m_statementDatabase.inputStream(height.unwrap(), &streamSize);
 
@@ -150,12 +332,57 @@ namespace catapult { namespace io {
 	void FileBlockStorage::purge() {
 		// remove everything under the directory
 		m_hashFile.reset();
+		{
+			std::lock_guard<std::mutex> guard(m_hashHeightIndexMutex);
+			m_hashHeightIndex.reset();
+		}
+
 		PurgeDirectory(m_dataDirectory);
 	}
 
 	// endregion
 
-	// region requireHeight
+	// region requireHashHeightIndex / requireNextHeight / requireHeight
+
+	namespace {
+		constexpr size_t Rebuild_Hashes_Batch_Size = 10'000;
+	}
+
+	void FileBlockStorage::requireHashHeightIndex() const {
+		if (FileBlockStorageMode::Hash_Index != m_mode)
+			return;
+
+		// index is updated lazily because it is missing in older data directories and lags the index file
+		// when its pending hashes were not written before shutdown
+		auto currentHeight = chainHeight();
+		auto indexHeight = m_hashHeightIndex.height();
+		if (indexHeight == currentHeight)
+			return;
+
+		if (indexHeight > currentHeight) {
+			CATAPULT_LOG(info) << "rebuilding hash height index in " << m_dataDirectory;
+			m_hashHeightIndex.reset();
+			indexHeight = Height(0);
+		} else {
+			CATAPULT_LOG(info) << "updating hash height index in " << m_dataDirectory << " from height " << indexHeight;
+		}
+
+		auto startHeight = indexHeight + Height(1);
+		for (auto height = startHeight; height <= currentHeight; height = height + Height(Rebuild_Hashes_Batch_Size)) {
+			auto hashes = loadHashesFrom(height, Rebuild_Hashes_Batch_Size);
+			m_hashHeightIndex.append(height, std::vector<Hash256>(hashes.cbegin(), hashes.cend()));
+		}
+	}
+
+	void FileBlockStorage::requireNextHeight(Height height) const {
+		auto currentHeight = chainHeight();
+		if (height == currentHeight + Height(1))
+			return;
+
+		std::ostringstream out;
+		out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
 
 	void FileBlockStorage::requireHeight(Height height, const char* description) const {
 		auto chainHeight = this->chainHeight();
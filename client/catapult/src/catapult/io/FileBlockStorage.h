@@ -23,8 +23,10 @@
 #include "BlockStorage.h"
 #include "FileDatabase.h"
 #include "FixedSizeValueStorage.h"
+#include "HashHeightIndex.h"
 #include "IndexFile.h"
 #include "RawFile.h"
+#include <mutex>
 #include <string>
 
 namespace catapult { namespace io {
@@ -43,19 +45,23 @@ namespace catapult { namespace io {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
 		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// When \a readMode is Memory_Mapped, loaded blocks and block elements are views into memory mapped block files.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				FileDatabaseReadMode readMode = FileDatabaseReadMode::Stream);
 
 	public:
 		// LightBlockStorage
 		Height chainHeight() const override;
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
 		void saveBlock(const model::BlockElement& blockElement) override;
+		void saveBlocks(const std::vector<model::BlockElement>& blockElements) override;
 		void dropBlocksAfter(Height height) override;
 
 		// BlockStorage
+		Height findHeight(const Hash256& hash) const override;
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
@@ -64,15 +70,21 @@ namespace catapult { namespace io {
 		void purge() override;
 
 	private:
+		// must be called while holding m_hashHeightIndexMutex
+		void requireHashHeightIndex() const;
+		void requireNextHeight(Height height) const;
 		void requireHeight(Height height, const char* description) const;
 
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		FileDatabaseReadMode m_readMode;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
 		HashFile m_hashFile;
+		mutable HashHeightIndex m_hashHeightIndex;
+		mutable std::mutex m_hashHeightIndexMutex;
 		IndexFile m_indexFile;
 	};
 }}
@@ -24,6 +24,8 @@
 #include "PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
+#include <algorithm>
+#include <cstring>
 
 namespace catapult { namespace io {
 
@@ -61,13 +63,58 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		// region memory mapped utils
+
+		constexpr size_t Max_Mapped_Files = 16;
+
+		uint64_t ReadHeaderValue(const RawBuffer& fileBuffer, uint64_t offset) {
+			if (offset + sizeof(uint64_t) > fileBuffer.Size)
+				CATAPULT_THROW_FILE_IO_ERROR("memory mapped file is too small to contain header");
+
+			uint64_t value;
+			std::memcpy(&value, fileBuffer.pData + offset, sizeof(uint64_t));
+			return value;
+		}
+
+		void ReplaceWithTruncatedCopy(const std::string& filePath, uint64_t headerOffset, uint64_t headerSize) {
+			std::vector<uint8_t> buffer;
+			{
+				auto rawFile = RawFile(filePath, OpenMode::Read_Only);
+				rawFile.seek(headerOffset);
+				auto bodyStartOffset = Read64(rawFile);
+				if (0 == bodyStartOffset)
+					return;
+
+				buffer.resize(bodyStartOffset);
+				rawFile.seek(0);
+				rawFile.read(buffer);
+			}
+
+			// clear offsets >= id
+			std::memset(buffer.data() + headerOffset, 0, headerSize - headerOffset);
+
+			// write the live payloads into a new file and replace the original one with it,
+			// which leaves the original file intact for any outstanding mapping
+			auto tempFilePath = filePath + ".tmp";
+			{
+				auto tempFile = RawFile(tempFilePath, OpenMode::Read_Write);
+				tempFile.write(buffer);
+				tempFile.sync();
+			}
+
+			std::filesystem::rename(tempFilePath, filePath);
+		}
+
+		// endregion
 	}
 
 	// region FileDatabase
 
-	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
+	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options, FileDatabaseReadMode readMode)
 			: m_directory(directory)
-			, m_options(options) {
+			, m_options(options)
+			, m_readMode(readMode) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
 	}
@@ -125,17 +172,122 @@ namespace catapult { namespace io {
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
+	FileDatabasePayloadView FileDatabase::payloadView(uint64_t id) const {
+		if (FileDatabaseReadMode::Memory_Mapped != m_readMode)
+			CATAPULT_THROW_INVALID_ARGUMENT("payload views are only supported in Memory_Mapped read mode");
+
+		auto pFile = mappedFile(id);
+		auto fileBuffer = pFile->buffer();
+		if (bypassHeader())
+			return { pFile, fileBuffer };
+
+		auto headerOffset = getHeaderOffset(id);
+		auto bodyStartOffset = ReadHeaderValue(fileBuffer, headerOffset);
+		if (0 == bodyStartOffset) {
+			std::ostringstream out;
+			out << "cannot read payload at " << id << " that has not been written";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
+			bodyEndOffset = ReadHeaderValue(fileBuffer, headerOffset + sizeof(uint64_t));
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = fileBuffer.Size;
+
+		if (bodyStartOffset > bodyEndOffset || bodyEndOffset > fileBuffer.Size) {
+			std::ostringstream out;
+			out << "payload at " << id << " has invalid bounds (" << bodyStartOffset << ", " << bodyEndOffset << ")";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		return { pFile, { fileBuffer.pData + bodyStartOffset, bodyEndOffset - bodyStartOffset } };
+	}
+
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
+		auto rawFile = openForWrite(id);
+		if (bypassHeader())
+			return std::make_unique<FileStream>(std::move(rawFile));
+
+		// update the header
+		rawFile.seek(getHeaderOffset(id));
+		Write64(rawFile, rawFile.size());
+
+		// seek to the body and return
+		rawFile.seek(rawFile.size());
+		return std::make_unique<FileStream>(std::move(rawFile));
+	}
+
+	void FileDatabase::writeAll(uint64_t startId, const std::vector<RawBuffer>& payloads) {
+		auto id = startId;
+		auto payloadIter = payloads.cbegin();
+		while (payloads.cend() != payloadIter) {
+			// all payloads stored in the same file are written together
+			auto numPayloads = std::min<size_t>(m_options.BatchSize - id % m_options.BatchSize, payloads.cend() - payloadIter);
+			auto rawFile = openForWrite(id);
+
+			if (!bypassHeader()) {
+				std::vector<uint64_t> bodyStartOffsets;
+				bodyStartOffsets.reserve(numPayloads);
+
+				auto bodyStartOffset = rawFile.size();
+				for (auto i = 0u; i < numPayloads; ++i) {
+					bodyStartOffsets.push_back(bodyStartOffset);
+					bodyStartOffset += payloadIter[i].Size;
+				}
+
+				rawFile.seek(getHeaderOffset(id));
+				rawFile.write({ reinterpret_cast<const uint8_t*>(bodyStartOffsets.data()), numPayloads * sizeof(uint64_t) });
+				rawFile.seek(rawFile.size());
+			}
+
+			// coalesce payloads that are adjacent in memory into a single write
+			auto pendingBuffer = RawBuffer();
+			for (auto i = 0u; i < numPayloads; ++i) {
+				const auto& payload = payloadIter[i];
+				if (pendingBuffer.pData && pendingBuffer.pData + pendingBuffer.Size == payload.pData) {
+					pendingBuffer = { pendingBuffer.pData, pendingBuffer.Size + payload.Size };
+					continue;
+				}
+
+				if (pendingBuffer.pData)
+					rawFile.write(pendingBuffer);
+
+				pendingBuffer = payload;
+			}
+
+			if (pendingBuffer.pData)
+				rawFile.write(pendingBuffer);
+
+			rawFile.sync();
+
+			id += numPayloads;
+			payloadIter += static_cast<std::ptrdiff_t>(numPayloads);
+		}
+	}
+
+	RawFile FileDatabase::openForWrite(uint64_t id) {
 		auto filePath = getFilePath(id, true);
 
+		auto headerOffset = getHeaderOffset(id);
+		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
+		if (FileDatabaseReadMode::Memory_Mapped == m_readMode) {
+			unmapFile(id);
+
+			// never truncate files that might be referenced by outstanding views, instead replace them
+			if (bypassHeader())
+				std::filesystem::remove(filePath);
+			else if (std::filesystem::exists(filePath))
+				ReplaceWithTruncatedCopy(filePath, headerOffset, headerSize);
+		}
+
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
 
 		if (bypassHeader())
-			return std::make_unique<FileStream>(std::move(rawFile));
+			return rawFile;
 
-		auto headerOffset = getHeaderOffset(id);
-		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
 		if (isNewFile) {
 			// preallocate index header
 			rawFile.write(std::vector<uint8_t>(headerSize));
@@ -155,13 +307,7 @@ namespace catapult { namespace io {
 			}
 		}
 
-		// update the header
-		rawFile.seek(headerOffset);
-		Write64(rawFile, rawFile.size());
-
-		// seek to the body and return
-		rawFile.seek(rawFile.size());
-		return std::make_unique<FileStream>(std::move(rawFile));
+		return rawFile;
 	}
 
 	bool FileDatabase::bypassHeader() const {
@@ -173,11 +319,15 @@ namespace catapult { namespace io {
 		return id % m_options.BatchSize * sizeof(uint64_t);
 	}
 
+	uint64_t FileDatabase::getGroupId(uint64_t id) const {
+		return (id / m_options.BatchSize) * m_options.BatchSize;
+	}
+
 	std::string FileDatabase::getFilePath(uint64_t id, bool createDirectories) const {
 		struct GroupIdentifier_tag {};
 		using GroupIdentifier = utils::BaseValue<uint64_t, GroupIdentifier_tag>;
 
-		GroupIdentifier groupId((id / m_options.BatchSize) * m_options.BatchSize);
+		GroupIdentifier groupId(getGroupId(id));
 		auto storageDirectory = config::CatapultDataDirectory(m_directory.path()).storageDir(groupId);
 
 		if (createDirectories)
@@ -186,5 +336,40 @@ namespace catapult { namespace io {
 		return storageDirectory.storageFile(m_options.FileExtension);
 	}
 
+	std::shared_ptr<const MemoryMappedFile> FileDatabase::mappedFile(uint64_t id) const {
+		auto groupId = getGroupId(id);
+
+		std::lock_guard<std::mutex> lock(m_mappedFilesMutex);
+		auto iter = std::find_if(m_mappedFiles.begin(), m_mappedFiles.end(), [groupId](const auto& pair) {
+			return groupId == pair.first;
+		});
+
+		if (m_mappedFiles.end() != iter) {
+			std::rotate(m_mappedFiles.begin(), iter, iter + 1);
+			return m_mappedFiles.front().second;
+		}
+
+		auto pFile = std::make_shared<const MemoryMappedFile>(getFilePath(id, false));
+		m_mappedFiles.emplace(m_mappedFiles.begin(), groupId, pFile);
+
+		// evicted mappings remain alive as long as they are referenced by views
+		if (m_mappedFiles.size() > Max_Mapped_Files)
+			m_mappedFiles.pop_back();
+
+		return pFile;
+	}
+
+	void FileDatabase::unmapFile(uint64_t id) {
+		auto groupId = getGroupId(id);
+
+		std::lock_guard<std::mutex> lock(m_mappedFilesMutex);
+		auto iter = std::find_if(m_mappedFiles.begin(), m_mappedFiles.end(), [groupId](const auto& pair) {
+			return groupId == pair.first;
+		});
+
+		if (m_mappedFiles.end() != iter)
+			m_mappedFiles.erase(iter);
+	}
+
 	// endregion
 }}
@@ -20,11 +20,36 @@
 **/
 
 #pragma once
+#include "MemoryMappedFile.h"
+#include "RawFile.h"
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace catapult { namespace io {
 
+	/// File database read modes.
+	enum class FileDatabaseReadMode {
+		/// Payloads can only be read via input streams.
+		Stream,
+
+		/// Payloads can additionally be read via views into memory mapped files.
+		/// \note Files are replaced instead of truncated when payloads are rewritten so that outstanding views are never invalidated.
+		Memory_Mapped
+	};
+
+	/// View of a payload stored in a memory mapped file.
+	struct FileDatabasePayloadView {
+		/// Memory mapped file containing the payload.
+		std::shared_ptr<const MemoryMappedFile> pFile;
+
+		/// Payload data.
+		/// \note This buffer is only valid as long as \a pFile is alive.
+		RawBuffer Payload;
+	};
+
 	/// Database that stores arbitrary payloads indexed by ids across multiple files.
 	class FileDatabase {
 	public:
@@ -38,8 +63,11 @@ namespace catapult { namespace io {
 		};
 
 	public:
-		/// Creates a database in \a directory with \a options.
-		FileDatabase(const config::CatapultDirectory& directory, const Options& options);
+		/// Creates a database in \a directory with \a options and \a readMode.
+		FileDatabase(
+				const config::CatapultDirectory& directory,
+				const Options& options,
+				FileDatabaseReadMode readMode = FileDatabaseReadMode::Stream);
 
 	public:
 		/// Returns \c true if a payload for \a id is contained.
@@ -48,16 +76,35 @@ namespace catapult { namespace io {
 		/// Gets an input stream for \a id and optionally returns the stream size (\a pSize).
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
+		/// Gets a zero-copy view of the payload for \a id.
+		/// \note This is only supported in Memory_Mapped read mode.
+		FileDatabasePayloadView payloadView(uint64_t id) const;
+
 		/// Gets an output stream for \a id.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
+		/// Writes \a payloads with consecutive ids starting at \a startId and flushes them to disk.
+		/// \note Each affected file is written with a single header update and is synced once.
+		void writeAll(uint64_t startId, const std::vector<RawBuffer>& payloads);
+
 	private:
+		RawFile openForWrite(uint64_t id);
+
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
+		uint64_t getGroupId(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
 
+		std::shared_ptr<const MemoryMappedFile> mappedFile(uint64_t id) const;
+		void unmapFile(uint64_t id);
+
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+		FileDatabaseReadMode m_readMode;
+
+		// most recently used mappings are at the front
+		mutable std::vector<std::pair<uint64_t, std::shared_ptr<const MemoryMappedFile>>> m_mappedFiles;
+		mutable std::mutex m_mappedFilesMutex;
 	};
 }}
@@ -44,10 +44,15 @@ namespace catapult { namespace io {
 		/// \note Expects ascending keys.
 		void save(TKey key, const TValue& value);
 
+		/// Saves \a values at consecutive keys starting at \a key and flushes them to disk.
+		/// \note Expects ascending keys.
+		void saveAll(TKey key, const std::vector<TValue>& values);
+
 		/// Closes cached file.
 		void reset();
 
 	private:
+		RawFile& cachedStorageFile(TKey key);
 		std::unique_ptr<RawFile> openStorageFile(TKey key, OpenMode openMode) const;
 		void seekStorageFile(RawFile& rawFile, TKey key) const;
 
@@ -0,0 +1,431 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashHeightIndex.h"
+#include "MemoryMappedFile.h"
+#include "RawFile.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include <filesystem>
+#include <map>
+#include <cstring>
+
+namespace catapult { namespace io {
+
+#pragma pack(push, 1)
+
+	namespace {
+		/// Index file header.
+		struct IndexHeader {
+			/// Number of slots.
+			uint64_t Capacity;
+
+			/// Number of occupied slots.
+			uint64_t Size;
+
+			/// Height of the last indexed hash.
+			catapult::Height Height;
+
+			/// Nonzero when the index is being modified.
+			uint64_t IsDirty;
+		};
+
+		/// Index slot mapping a hash prefix to a height, where an empty slot has a zero height.
+		struct IndexSlot {
+			/// Hash prefix.
+			uint64_t Fingerprint;
+
+			/// Height of the block with a matching hash prefix.
+			catapult::Height Height;
+		};
+	}
+
+#pragma pack(pop)
+
+	namespace {
+		constexpr size_t Min_Capacity = 1024;
+		constexpr size_t Max_Pending_Hashes = 1'000;
+
+		uint64_t CalculateFingerprint(const Hash256& hash) {
+			uint64_t fingerprint;
+			std::memcpy(&fingerprint, hash.data(), sizeof(uint64_t));
+			return fingerprint;
+		}
+
+		size_t CalculateCapacity(size_t size) {
+			// keep load factor at most 50% so that probe sequences stay short
+			auto capacity = Min_Capacity;
+			while (capacity < 2 * size)
+				capacity *= 2;
+
+			return capacity;
+		}
+
+		size_t CalculateFileSize(size_t capacity) {
+			return sizeof(IndexHeader) + capacity * sizeof(IndexSlot);
+		}
+
+		const IndexSlot* GetSlots(const MemoryMappedFile& mappedFile) {
+			return reinterpret_cast<const IndexSlot*>(mappedFile.data() + sizeof(IndexHeader));
+		}
+
+		std::vector<IndexSlot> CreateSlots(Height startHeight, const std::vector<Hash256>& hashes) {
+			std::vector<IndexSlot> slots;
+			slots.reserve(hashes.size());
+			for (auto i = 0u; i < hashes.size(); ++i)
+				slots.push_back(IndexSlot{ CalculateFingerprint(hashes[i]), startHeight + Height(i) });
+
+			return slots;
+		}
+
+		bool IsValidHeader(const IndexHeader& header, size_t fileSize) {
+			auto isPowerOfTwo = 0 == (header.Capacity & (header.Capacity - 1));
+			return !header.IsDirty
+					&& isPowerOfTwo
+					&& 2 * header.Size <= header.Capacity
+					&& CalculateFileSize(header.Capacity) == fileSize;
+		}
+
+		// region slot tables
+
+		class MemorySlots {
+		public:
+			explicit MemorySlots(size_t capacity) : m_slots(capacity)
+			{}
+
+		public:
+			size_t capacity() const {
+				return m_slots.size();
+			}
+
+			const IndexSlot& get(size_t index) const {
+				return m_slots[index];
+			}
+
+			const std::vector<IndexSlot>& slots() const {
+				return m_slots;
+			}
+
+		public:
+			void set(size_t index, const IndexSlot& slot) {
+				m_slots[index] = slot;
+			}
+
+		private:
+			std::vector<IndexSlot> m_slots;
+		};
+
+		// reads through pending changes to mapped slots, which are only written to disk when the changes are committed
+		class MappedSlots {
+		public:
+			MappedSlots(const IndexSlot* pSlots, size_t capacity)
+					: m_pSlots(pSlots)
+					, m_capacity(capacity)
+			{}
+
+		public:
+			size_t capacity() const {
+				return m_capacity;
+			}
+
+			const IndexSlot& get(size_t index) const {
+				auto iter = m_changedSlots.find(index);
+				return m_changedSlots.cend() == iter ? m_pSlots[index] : iter->second;
+			}
+
+			const std::map<size_t, IndexSlot>& changedSlots() const {
+				return m_changedSlots;
+			}
+
+		public:
+			void set(size_t index, const IndexSlot& slot) {
+				m_changedSlots[index] = slot;
+			}
+
+		private:
+			const IndexSlot* m_pSlots;
+			size_t m_capacity;
+			std::map<size_t, IndexSlot> m_changedSlots;
+		};
+
+		template<typename TSlots>
+		void InsertSlot(TSlots& slots, const IndexSlot& slot) {
+			auto mask = slots.capacity() - 1;
+			auto index = slot.Fingerprint & mask;
+			while (Height(0) != slots.get(index).Height)
+				index = (index + 1) & mask;
+
+			slots.set(index, slot);
+		}
+
+		template<typename TSlots>
+		bool RemoveSlot(TSlots& slots, const IndexSlot& slot) {
+			auto mask = slots.capacity() - 1;
+			auto holeIndex = slot.Fingerprint & mask;
+			for (;; holeIndex = (holeIndex + 1) & mask) {
+				const auto& candidate = slots.get(holeIndex);
+				if (Height(0) == candidate.Height)
+					return false;
+
+				if (slot.Fingerprint == candidate.Fingerprint && slot.Height == candidate.Height)
+					break;
+			}
+
+			// shift back all following slots that would become unreachable after the removal
+			for (auto index = (holeIndex + 1) & mask;; index = (index + 1) & mask) {
+				auto candidate = slots.get(index);
+				if (Height(0) == candidate.Height)
+					break;
+
+				// candidate can fill the hole if the hole is between the candidate's preferred index and its actual index
+				auto preferredIndex = candidate.Fingerprint & mask;
+				if (((index - preferredIndex) & mask) >= ((index - holeIndex) & mask)) {
+					slots.set(holeIndex, candidate);
+					holeIndex = index;
+				}
+			}
+
+			slots.set(holeIndex, IndexSlot());
+			return true;
+		}
+
+		// endregion
+
+		// region IndexWriter
+
+		// marks the index as dirty while it is being modified so that a partially written index is detected when reopened
+		class IndexWriter {
+		public:
+			IndexWriter(const std::string& filePath, OpenMode openMode, const IndexHeader& header) : m_file(filePath, openMode) {
+				auto dirtyHeader = header;
+				dirtyHeader.IsDirty = 1;
+				writeHeader(dirtyHeader);
+				m_file.sync();
+			}
+
+		public:
+			void write(size_t index, const IndexSlot* pSlots, size_t numSlots) {
+				m_file.seek(CalculateFileSize(index));
+				m_file.write({ reinterpret_cast<const uint8_t*>(pSlots), numSlots * sizeof(IndexSlot) });
+			}
+
+			void commit(const IndexHeader& header) {
+				writeHeader(header);
+				m_file.sync();
+			}
+
+		private:
+			void writeHeader(const IndexHeader& header) {
+				m_file.seek(0);
+				m_file.write({ reinterpret_cast<const uint8_t*>(&header), sizeof(IndexHeader) });
+			}
+
+		private:
+			RawFile m_file;
+		};
+
+		// endregion
+	}
+
+	HashHeightIndex::HashHeightIndex(const std::string& filePath)
+			: m_filePath(filePath)
+			, m_capacity(0)
+			, m_size(0) {
+		if (std::filesystem::is_regular_file(m_filePath))
+			open();
+	}
+
+	HashHeightIndex::~HashHeightIndex() = default;
+
+	size_t HashHeightIndex::size() const {
+		return m_size;
+	}
+
+	size_t HashHeightIndex::capacity() const {
+		return m_capacity;
+	}
+
+	Height HashHeightIndex::height() const {
+		return m_height;
+	}
+
+	Height HashHeightIndex::find(const Hash256& hash, const predicate<Height>& isMatch) const {
+		if (0 == m_size)
+			return Height(0);
+
+		const auto* pSlots = GetSlots(*m_pMappedFile);
+		auto fingerprint = CalculateFingerprint(hash);
+		auto mask = m_capacity - 1;
+		for (auto index = fingerprint & mask; Height(0) != pSlots[index].Height; index = (index + 1) & mask) {
+			if (fingerprint == pSlots[index].Fingerprint && isMatch(pSlots[index].Height))
+				return pSlots[index].Height;
+		}
+
+		auto height = m_height - Height(m_pendingFingerprints.size());
+		for (auto pendingFingerprint : m_pendingFingerprints) {
+			height = height + Height(1);
+			if (fingerprint == pendingFingerprint && isMatch(height))
+				return height;
+		}
+
+		return Height(0);
+	}
+
+	void HashHeightIndex::append(Height startHeight, const std::vector<Hash256>& hashes) {
+		if (m_height + Height(1) != startHeight) {
+			std::ostringstream out;
+			out << "cannot index hashes starting at height " << startHeight << " when index height is " << m_height;
+			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+		}
+
+		if (hashes.empty())
+			return;
+
+		auto newSize = m_size + hashes.size();
+		if (2 * newSize > m_capacity) {
+			grow(CalculateCapacity(newSize), startHeight, hashes);
+			return;
+		}
+
+		for (const auto& hash : hashes)
+			m_pendingFingerprints.push_back(CalculateFingerprint(hash));
+
+		m_size = newSize;
+		m_height = startHeight + Height(hashes.size() - 1);
+		if (m_pendingFingerprints.size() >= Max_Pending_Hashes)
+			flush();
+	}
+
+	void HashHeightIndex::dropAfter(Height height, const std::vector<Hash256>& droppedHashes) {
+		if (0 == m_capacity) {
+			// index does not contain any hashes, so only the height needs to be updated
+			m_height = height;
+			grow(0, height + Height(1), {});
+			return;
+		}
+
+		// rollbacks are rare, so pending hashes are written before any are removed
+		flush();
+
+		MappedSlots mappedSlots(GetSlots(*m_pMappedFile), m_capacity);
+		auto numRemovedSlots = 0u;
+		for (const auto& slot : CreateSlots(height + Height(1), droppedHashes)) {
+			if (RemoveSlot(mappedSlots, slot))
+				++numRemovedSlots;
+		}
+
+		IndexWriter writer(m_filePath, OpenMode::Read_Append, { m_capacity, m_size, m_height, 0 });
+		for (const auto& pair : mappedSlots.changedSlots())
+			writer.write(pair.first, &pair.second, 1);
+
+		m_size -= numRemovedSlots;
+		m_height = height;
+		writer.commit({ m_capacity, m_size, m_height, 0 });
+		open();
+	}
+
+	void HashHeightIndex::flush() {
+		if (m_pendingFingerprints.empty())
+			return;
+
+		auto numPendingHashes = m_pendingFingerprints.size();
+		auto persistedHeight = m_height - Height(numPendingHashes);
+		auto pendingHeight = persistedHeight;
+		MappedSlots mappedSlots(GetSlots(*m_pMappedFile), m_capacity);
+		for (auto fingerprint : m_pendingFingerprints) {
+			pendingHeight = pendingHeight + Height(1);
+			InsertSlot(mappedSlots, IndexSlot{ fingerprint, pendingHeight });
+		}
+
+		IndexWriter writer(m_filePath, OpenMode::Read_Append, { m_capacity, m_size - numPendingHashes, persistedHeight, 0 });
+		for (const auto& pair : mappedSlots.changedSlots())
+			writer.write(pair.first, &pair.second, 1);
+
+		writer.commit({ m_capacity, m_size, m_height, 0 });
+		m_pendingFingerprints.clear();
+		open();
+	}
+
+	void HashHeightIndex::reset() {
+		m_pendingFingerprints.clear();
+		m_pMappedFile.reset();
+		std::filesystem::remove(m_filePath);
+
+		m_capacity = 0;
+		m_size = 0;
+		m_height = Height(0);
+	}
+
+	void HashHeightIndex::open() {
+		m_pMappedFile = std::make_unique<MemoryMappedFile>(m_filePath);
+
+		IndexHeader header;
+		if (m_pMappedFile->size() < sizeof(IndexHeader)) {
+			header = IndexHeader();
+			header.IsDirty = 1;
+		} else {
+			header = reinterpret_cast<const IndexHeader&>(*m_pMappedFile->data());
+		}
+
+		if (!IsValidHeader(header, m_pMappedFile->size())) {
+			CATAPULT_LOG(warning) << "discarding invalid hash height index " << m_filePath;
+			reset();
+			return;
+		}
+
+		m_capacity = header.Capacity;
+		m_size = header.Size;
+		m_height = header.Height;
+	}
+
+	void HashHeightIndex::grow(size_t capacity, Height startHeight, const std::vector<Hash256>& hashes) {
+		MemorySlots memorySlots(capacity);
+		if (0 != m_capacity) {
+			const auto* pSlots = GetSlots(*m_pMappedFile);
+			for (auto i = 0u; i < m_capacity; ++i) {
+				if (Height(0) != pSlots[i].Height)
+					InsertSlot(memorySlots, pSlots[i]);
+			}
+		}
+
+		auto pendingHeight = m_height - Height(m_pendingFingerprints.size());
+		for (auto fingerprint : m_pendingFingerprints) {
+			pendingHeight = pendingHeight + Height(1);
+			InsertSlot(memorySlots, IndexSlot{ fingerprint, pendingHeight });
+		}
+
+		m_pendingFingerprints.clear();
+		for (const auto& slot : CreateSlots(startHeight, hashes))
+			InsertSlot(memorySlots, slot);
+
+		// release the mapping before the file is rewritten
+		m_pMappedFile.reset();
+		m_capacity = capacity;
+		m_size += hashes.size();
+		if (!hashes.empty())
+			m_height = startHeight + Height(hashes.size() - 1);
+
+		IndexWriter writer(m_filePath, OpenMode::Read_Write, { m_capacity, m_size, m_height, 0 });
+		writer.write(0, memorySlots.slots().data(), m_capacity);
+		writer.commit({ m_capacity, m_size, m_height, 0 });
+		open();
+	}
+}}
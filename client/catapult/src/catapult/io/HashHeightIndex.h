@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
+
+namespace catapult { namespace io {
+
+	/// Memory mapped open addressing index from block hashes to heights.
+	/// \note Only hash prefixes are indexed, so candidate heights need to be checked against the full (columnar) hashes.
+	/// \note This class is not thread safe.
+	class HashHeightIndex : public utils::NonCopyable {
+	public:
+		/// Creates an index backed by the file with path \a filePath.
+		explicit HashHeightIndex(const std::string& filePath);
+
+		/// Destroys the index.
+		~HashHeightIndex();
+
+	public:
+		/// Gets the number of indexed hashes.
+		size_t size() const;
+
+		/// Gets the number of slots in the index.
+		size_t capacity() const;
+
+		/// Gets the height of the last indexed hash.
+		Height height() const;
+
+		/// Finds the height of \a hash by checking all candidate heights with \a isMatch.
+		/// \note Height(0) is returned if no candidate height matches.
+		Height find(const Hash256& hash, const predicate<Height>& isMatch) const;
+
+	public:
+		/// Indexes \a hashes at consecutive heights starting at \a startHeight.
+		/// \note \a startHeight must immediately follow the height of the last indexed hash.
+		/// \note Hashes are written to disk in batches, so the most recently appended hashes are only pending in memory
+		///       until enough hashes are pending, the index grows or the index is flushed.
+		void append(Height startHeight, const std::vector<Hash256>& hashes);
+
+		/// Removes \a droppedHashes, which are at consecutive heights after \a height, from the index and flushes the index to disk.
+		void dropAfter(Height height, const std::vector<Hash256>& droppedHashes);
+
+		/// Writes all pending hashes to disk.
+		void flush();
+
+		/// Removes all hashes from the index.
+		void reset();
+
+	private:
+		void open();
+		void grow(size_t capacity, Height startHeight, const std::vector<Hash256>& hashes);
+
+	private:
+		std::string m_filePath;
+		std::unique_ptr<MemoryMappedFile> m_pMappedFile;
+		size_t m_capacity;
+		size_t m_size;
+		Height m_height;
+		std::vector<uint64_t> m_pendingFingerprints; // fingerprints of the hashes preceding and including m_height
+	};
+}}
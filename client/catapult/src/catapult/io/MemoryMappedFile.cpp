@@ -0,0 +1,155 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr const char* Error_Map = "couldn't map the file";
+
+		[[noreturn]]
+		void ThrowMapError(const std::string& filePath, const char* operation, int64_t errorCode) {
+			CATAPULT_LOG(error) << Error_Map << " " << filePath << ": " << operation << " failed (" << errorCode << ")";
+			CATAPULT_THROW_FILE_IO_ERROR(Error_Map);
+		}
+
+#ifdef _MSC_VER
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (INVALID_HANDLE_VALUE != m_handle && nullptr != m_handle)
+					::CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+
+		const uint8_t* MapFile(const std::string& filePath, size_t& size) {
+			// allow the file to be deleted or appended while it is mapped
+			auto shareMode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+			auto* pPath = filePath.c_str();
+			HandleGuard file(::CreateFile(pPath, GENERIC_READ, shareMode, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+			if (INVALID_HANDLE_VALUE == file.get())
+				ThrowMapError(filePath, "CreateFile", ::GetLastError());
+
+			LARGE_INTEGER fileSize;
+			if (!::GetFileSizeEx(file.get(), &fileSize))
+				ThrowMapError(filePath, "GetFileSizeEx", ::GetLastError());
+
+			size = static_cast<size_t>(fileSize.QuadPart);
+			if (0 == size)
+				return nullptr;
+
+			HandleGuard mapping(::CreateFileMapping(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+			if (nullptr == mapping.get())
+				ThrowMapError(filePath, "CreateFileMapping", ::GetLastError());
+
+			// view keeps the mapping object alive after its handle is closed
+			const auto* pData = ::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
+			if (nullptr == pData)
+				ThrowMapError(filePath, "MapViewOfFile", ::GetLastError());
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void UnmapFile(const uint8_t* pData, size_t) {
+			::UnmapViewOfFile(pData);
+		}
+#else
+		const uint8_t* MapFile(const std::string& filePath, size_t& size) {
+			auto fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+			if (-1 == fd)
+				ThrowMapError(filePath, "open", errno);
+
+			struct stat fileStat;
+			if (-1 == ::fstat(fd, &fileStat)) {
+				auto errorCode = errno;
+				::close(fd);
+				ThrowMapError(filePath, "fstat", errorCode);
+			}
+
+			size = static_cast<size_t>(fileStat.st_size);
+			if (0 == size) {
+				::close(fd);
+				return nullptr;
+			}
+
+			// mapping keeps a reference to the file, so the descriptor can be closed immediately
+			auto* pData = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+			auto errorCode = errno;
+			::close(fd);
+
+			if (MAP_FAILED == pData)
+				ThrowMapError(filePath, "mmap", errorCode);
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void UnmapFile(const uint8_t* pData, size_t size) {
+			::munmap(const_cast<uint8_t*>(pData), size);
+		}
+#endif
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& filePath)
+			: m_pData(nullptr)
+			, m_size(0) {
+		m_pData = MapFile(filePath, m_size);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			UnmapFile(m_pData, m_size);
+	}
+
+	size_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pData;
+	}
+
+	RawBuffer MemoryMappedFile::buffer() const {
+		return { m_pData, m_size };
+	}
+}}
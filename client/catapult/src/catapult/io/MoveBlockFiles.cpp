@@ -20,12 +20,42 @@
 **/
 
 #include "MoveBlockFiles.h"
+#include "AsyncBlockStorageWriter.h"
 #include "BlockStatementSerializer.h"
 #include "BlockStorage.h"
 #include "BufferInputStreamAdapter.h"
 
 namespace catapult { namespace io {
 
+	namespace {
+		constexpr size_t Max_Blocks_Per_Group_Commit = 16;
+
+		std::shared_ptr<const model::BlockElement> LoadBlockElementWithStatement(const BlockStorage& storage, Height height) {
+			auto pBlockElement = storage.loadBlockElement(height);
+			auto blockStatementPair = storage.loadBlockStatementData(height);
+
+			if (blockStatementPair.second) {
+				auto pBlockStatement = std::make_shared<model::BlockStatement>();
+				BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
+				ReadBlockStatement(blockStatementStream, *pBlockStatement);
+				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
+			}
+
+			return pBlockElement;
+		}
+
+		std::vector<std::shared_ptr<const model::BlockElement>> LoadBlockElementsWithStatements(
+				const BlockStorage& storage,
+				Height startHeight,
+				Height endHeight) {
+			std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1))
+				blockElements.push_back(LoadBlockElementWithStatement(storage, height));
+
+			return blockElements;
+		}
+	}
+
 	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
@@ -34,18 +64,30 @@ namespace catapult { namespace io {
 			destinationStorage.dropBlocksAfter(startHeight - Height(1));
 
 		auto sourceHeight = sourceStorage.chainHeight();
-		for (auto height = startHeight; height <= sourceHeight; height = height + Height(1)) {
-			auto pBlockElement = sourceStorage.loadBlockElement(height);
-			auto blockStatementPair = sourceStorage.loadBlockStatementData(height);
+		auto groupCommitHeight = Height(Max_Blocks_Per_Group_Commit - 1);
+		if (startHeight + groupCommitHeight >= sourceHeight) {
+			// all blocks fit into a single group commit, so write them directly
+			// (loaded elements own the blocks referenced by the copied elements, so they must outlive the save)
+			auto loadedBlockElements = LoadBlockElementsWithStatements(sourceStorage, startHeight, sourceHeight);
 
-			if (blockStatementPair.second) {
-				auto pBlockStatement = std::make_shared<model::BlockStatement>();
-				BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
-				ReadBlockStatement(blockStatementStream, *pBlockStatement);
-				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
+			std::vector<model::BlockElement> blockElements;
+			for (const auto& pBlockElement : loadedBlockElements)
+				blockElements.push_back(*pBlockElement);
+
+			destinationStorage.saveBlocks(blockElements);
+		} else {
+			// load the next group of blocks while the previous group is being written on the i/o thread
+			AsyncBlockStorageWriter writer(destinationStorage);
+			for (auto height = startHeight; height <= sourceHeight; height = height + groupCommitHeight + Height(1)) {
+				auto endHeight = std::min(sourceHeight, height + groupCommitHeight);
+				auto blockElements = LoadBlockElementsWithStatements(sourceStorage, height, endHeight);
+
+				// wait for the previous group in order to bound the number of blocks in memory
+				writer.flush();
+				writer.saveBlocks(std::move(blockElements));
 			}
 
-			destinationStorage.saveBlock(*pBlockElement);
+			writer.flush();
 		}
 
 		sourceStorage.purge();
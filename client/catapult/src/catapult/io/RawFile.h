@@ -82,6 +82,10 @@ namespace catapult { namespace io {
 		/// Truncates the file at its current position.
 		void truncate();
 
+		/// Flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if data could not be flushed.
+		void sync();
+
 	private:
 		class FileDescriptorHolder final {
 		public:
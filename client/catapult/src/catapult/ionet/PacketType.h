@@ -67,6 +67,9 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Unconfirmed transactions not matching a filter of known transactions have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Filtered_Transactions, 13) \
+	\
 	/* partial transactions packets have types [0x100, 0x110) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -78,6 +81,9 @@ namespace catapult { namespace ionet {
 	/* Partial transaction infos have been requested by an api-node. */ \
 	ENUM_VALUE(Pull_Partial_Transaction_Infos, 0x102) \
 	\
+	/* Partial transaction infos not matching a filter of known partial transactions have been requested by an api-node. */ \
+	ENUM_VALUE(Pull_Filtered_Partial_Transaction_Infos, 0x103) \
+	\
 	/* node discovery packets have types [0x110, 0x120) */ \
 	\
 	/* Node information has been pushed by a peer. */ \
@@ -163,6 +169,12 @@ namespace catapult { namespace ionet {
 	/* Unlocked accounts have been requested by a client. */ \
 	ENUM_VALUE(Unlocked_Accounts, 0x304) \
 	\
+	/* Validator and observer execution profile has been requested by a client. */ \
+	ENUM_VALUE(Execution_Profile, 0x305) \
+	\
+	/* Consumer dispatcher stage latencies have been requested by a client. */ \
+	ENUM_VALUE(Dispatcher_Latencies, 0x306) \
+	\
 	/* diagnostic info packets have types [0x400, 0x500) - ordered by facility code name */ \
 	\
 	/* Account infos have been requested by a client. */ \
@@ -190,7 +202,36 @@ namespace catapult { namespace ionet {
 	ENUM_VALUE(Account_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionAccount)) \
 	\
 	/* Mosaic restrictions infos have been requested by a client. */ \
-	ENUM_VALUE(Mosaic_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionMosaic))
+	ENUM_VALUE(Mosaic_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionMosaic)) \
+	\
+	/* batch state path packets have types [0x500, 0x600) - ordered by facility code name */ \
+	\
+	/* Account state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_State_Paths, FACILITY_BASED_CODE(0x500, Core)) \
+	\
+	/* Hash lock state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Hash_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockHash)) \
+	\
+	/* Secret lock state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Secret_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockSecret)) \
+	\
+	/* Metadata state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Metadata_State_Paths, FACILITY_BASED_CODE(0x500, Metadata)) \
+	\
+	/* Mosaic state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_State_Paths, FACILITY_BASED_CODE(0x500, Mosaic)) \
+	\
+	/* Multisig state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Multisig_State_Paths, FACILITY_BASED_CODE(0x500, Multisig)) \
+	\
+	/* Namespace state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Namespace_State_Paths, FACILITY_BASED_CODE(0x500, Namespace)) \
+	\
+	/* Account restrictions state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionAccount)) \
+	\
+	/* Mosaic restrictions state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionMosaic))
 
 #define ENUM_VALUE(LABEL, VALUE) LABEL = VALUE,
 	/// Enumeration of known packet types.
@@ -120,8 +120,11 @@ namespace catapult { namespace local {
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
-				, m_statusConsumer(statusConsumer)
-		{}
+				, m_statusConsumer(statusConsumer) {
+			// prefetching only reduces random reads from the cache database, so skip it when all state is in memory
+			if (m_pluginManager.storageConfig().PreferCacheDatabase)
+				m_pStatePrefetcher = m_pluginManager.createStatePrefetcher();
+		}
 
 	public:
 		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress) const {
@@ -172,8 +175,15 @@ namespace catapult { namespace local {
 			auto readOnlyCache = cacheDelta.toReadOnly();
 			auto resolverContext = m_pluginManager.createResolverContext(readOnlyCache);
 
+			auto pNotificationPublisher = m_pluginManager.createNotificationPublisher();
+			if (m_pStatePrefetcher) {
+				model::WeakEntityInfos entityInfos;
+				model::ExtractEntityInfos(blockElement, entityInfos);
+				m_pStatePrefetcher->prefetch(entityInfos, *pNotificationPublisher, cacheDelta);
+			}
+
 			const auto& block = blockElement.Block;
-			observers::NotificationObserverAdapter observer(m_observerFactory(block), m_pluginManager.createNotificationPublisher());
+			observers::NotificationObserverAdapter observer(m_observerFactory(block), std::move(pNotificationPublisher));
 			chain::ExecuteBlock(blockElement, { observer, resolverContext, observerState });
 
 			// populate patricia tree delta
@@ -191,6 +201,7 @@ namespace catapult { namespace local {
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
 		consumer<LoadedBlockStatus&&> m_statusConsumer;
+		std::unique_ptr<const cache::StatePrefetcher> m_pStatePrefetcher;
 	};
 
 	model::ChainScore LoadBlockchain(
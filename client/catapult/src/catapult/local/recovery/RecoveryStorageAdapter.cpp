@@ -47,6 +47,10 @@ namespace catapult { namespace local {
 			}
 
 		public:
+			Height findHeight(const Hash256& hash) const override {
+				return m_storage.findHeight(hash);
+			}
+
 			std::shared_ptr<const model::Block> loadBlock(Height height) const override {
 				return m_storage.loadBlock(height);
 			}
@@ -0,0 +1,62 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TrailingVariableDataLayout.h"
+#include "catapult/utils/LatencyHistogram.h"
+
+namespace catapult { namespace model {
+
+#pragma pack(push, 1)
+
+	/// Latency entry of a single consumer of a named consumer dispatcher.
+	/// \note All latencies are in microseconds.
+	struct DispatcherLatencyEntry : public TrailingVariableDataLayout<DispatcherLatencyEntry, char> {
+	public:
+		/// Consumer level of entries containing end-to-end latencies of a dispatcher.
+		static constexpr uint16_t Total_Consumer_Level = 0xFFFF;
+
+	public:
+		/// Size of the dispatcher name.
+		uint16_t NameSize;
+
+		/// Consumer level or Total_Consumer_Level.
+		uint16_t ConsumerLevel;
+
+		/// Summary of times elements waited before being processed by the consumer.
+		utils::LatencySummary WaitTimes;
+
+		/// Summary of times spent by the consumer processing elements.
+		/// \note For end-to-end entries, this is the summary of times between elements being queued and completed.
+		utils::LatencySummary ProcessingTimes;
+
+		// followed by name if NameSize != 0
+		DEFINE_TRAILING_VARIABLE_DATA_LAYOUT_ACCESSORS(Name, Size)
+
+	public:
+		/// Calculates the real size of \a entry.
+		static constexpr uint64_t CalculateRealSize(const DispatcherLatencyEntry& entry) noexcept {
+			return sizeof(DispatcherLatencyEntry) + entry.NameSize;
+		}
+	};
+
+#pragma pack(pop)
+}}
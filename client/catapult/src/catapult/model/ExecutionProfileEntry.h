@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TrailingVariableDataLayout.h"
+
+namespace catapult { namespace model {
+
+#pragma pack(push, 1)
+
+	/// Execution profile entry of a single named validator or observer.
+	struct ExecutionProfileEntry : public TrailingVariableDataLayout<ExecutionProfileEntry, char> {
+	public:
+		/// Size of the name.
+		uint16_t NameSize;
+
+		/// Reserved padding to align NumCalls on 8-byte boundary.
+		uint16_t ExecutionProfileEntry_Reserved1;
+
+		/// Number of calls.
+		uint64_t NumCalls;
+
+		/// Cumulative elapsed nanoseconds across all calls.
+		uint64_t TotalElapsedNanoseconds;
+
+		/// Maximum elapsed nanoseconds of any single call.
+		uint64_t MaxElapsedNanoseconds;
+
+		// followed by name if NameSize != 0
+		DEFINE_TRAILING_VARIABLE_DATA_LAYOUT_ACCESSORS(Name, Size)
+
+	public:
+		/// Calculates the real size of \a entry.
+		static constexpr uint64_t CalculateRealSize(const ExecutionProfileEntry& entry) noexcept {
+			return sizeof(ExecutionProfileEntry) + entry.NameSize;
+		}
+	};
+
+#pragma pack(pop)
+}}
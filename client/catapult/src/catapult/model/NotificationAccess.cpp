@@ -0,0 +1,135 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationAccess.h"
+#include "Address.h"
+
+namespace catapult { namespace model {
+
+	namespace {
+		void AddAddress(std::vector<Address>& addresses, const Address& address) {
+			addresses.push_back(address);
+		}
+
+		void AddReadWriteAddress(NotificationAccess& access, const Address& address) {
+			AddAddress(access.Reads.Addresses, address);
+			AddAddress(access.Writes.Addresses, address);
+		}
+
+		void NoAccess(const Notification&, const ResolverContext&, NotificationAccess&)
+		{}
+
+		void RegisterCoreHandlers(NotificationAccessExtractor& extractor, NetworkIdentifier networkIdentifier) {
+			using Resolvers = ResolverContext;
+
+			extractor.add<AccountAddressNotification>([](const auto& notification, const Resolvers& resolvers, auto& access) {
+				AddReadWriteAddress(access, notification.Address.resolved(resolvers));
+			});
+
+			extractor.add<AccountPublicKeyNotification>([networkIdentifier](const auto& notification, const Resolvers&, auto& access) {
+				AddReadWriteAddress(access, PublicKeyToAddress(notification.PublicKey, networkIdentifier));
+			});
+
+			extractor.add<BalanceTransferNotification>([](const auto& notification, const Resolvers& resolvers, auto& access) {
+				AddReadWriteAddress(access, notification.Sender.resolved(resolvers));
+				AddReadWriteAddress(access, notification.Recipient.resolved(resolvers));
+				access.Reads.MosaicIds.push_back(resolvers.resolve(notification.MosaicId));
+			});
+
+			extractor.add<BalanceDebitNotification>([](const auto& notification, const Resolvers& resolvers, auto& access) {
+				AddReadWriteAddress(access, notification.Sender.resolved(resolvers));
+				access.Reads.MosaicIds.push_back(resolvers.resolve(notification.MosaicId));
+			});
+
+			// transaction hashes are read by uniqueness validators and written by hash cache observers
+			extractor.add<TransactionNotification>([](const auto& notification, const Resolvers&, auto& access) {
+				AddAddress(access.Reads.Addresses, notification.Sender);
+				access.Reads.Hashes.push_back(notification.TransactionHash);
+				access.Writes.Hashes.push_back(notification.TransactionHash);
+			});
+
+			extractor.add<TransactionFeeNotification>([](const auto& notification, const Resolvers&, auto& access) {
+				AddReadWriteAddress(access, notification.Sender);
+			});
+
+			extractor.add<SignatureNotification>([networkIdentifier](const auto& notification, const Resolvers&, auto& access) {
+				AddAddress(access.Reads.Addresses, PublicKeyToAddress(notification.SignerPublicKey, networkIdentifier));
+			});
+
+			extractor.add<AddressInteractionNotification>([](const auto& notification, const Resolvers& resolvers, auto& access) {
+				AddAddress(access.Reads.Addresses, notification.Source);
+				for (const auto& address : notification.ParticipantsByAddress)
+					AddAddress(access.Reads.Addresses, resolvers.resolve(address));
+			});
+
+			extractor.add<MosaicRequiredNotification>([](const auto& notification, const Resolvers& resolvers, auto& access) {
+				AddAddress(access.Reads.Addresses, notification.Owner.resolved(resolvers));
+				access.Reads.MosaicIds.push_back(notification.MosaicId.resolved(resolvers));
+			});
+
+			// notifications that do not access any keyed state
+			for (auto type : {
+				Core_Entity_Notification,
+				Core_Transaction_Deadline_Notification,
+				Core_Source_Change_Notification,
+				Core_Internal_Padding_Notification,
+				Core_Key_Link_Action_Notification
+			}) {
+				extractor.add(type, NoAccess);
+			}
+
+			// block notifications are intentionally not registered because they access global state
+		}
+	}
+
+	NotificationAccessExtractor::NotificationAccessExtractor(NetworkIdentifier networkIdentifier)
+			: m_networkIdentifier(networkIdentifier) {
+		RegisterCoreHandlers(*this, networkIdentifier);
+	}
+
+	NetworkIdentifier NotificationAccessExtractor::networkIdentifier() const {
+		return m_networkIdentifier;
+	}
+
+	void NotificationAccessExtractor::add(NotificationType type, const Handler& handler) {
+		m_handlers.add(type, handler);
+	}
+
+	NotificationAccess NotificationAccessExtractor::extract(const Notification& notification, const ResolverContext& resolvers) const {
+		NotificationAccess access;
+		const auto& handlers = m_handlers.find(notification.Type);
+		if (handlers.empty()) {
+			access.IsUnknown = true;
+			return access;
+		}
+
+		try {
+			for (const auto& handler : handlers)
+				handler(notification, resolvers, access);
+		} catch (const std::exception&) {
+			// treat notifications with unresolvable keys conservatively
+			access = NotificationAccess();
+			access.IsUnknown = true;
+		}
+
+		return access;
+	}
+}}
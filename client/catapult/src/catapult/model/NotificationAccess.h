@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationTypeDispatchTable.h"
+#include "Notifications.h"
+#include "ResolverContext.h"
+#include <functional>
+
+namespace catapult { namespace model {
+
+	/// Keys of state touched by a notification.
+	struct NotificationAccessKeys {
+		/// Account addresses.
+		std::vector<Address> Addresses;
+
+		/// Mosaic ids.
+		std::vector<MosaicId> MosaicIds;
+
+		/// Hashes.
+		std::vector<Hash256> Hashes;
+	};
+
+	/// State accessed by the validators and observers of a notification.
+	struct NotificationAccess {
+		/// \c true if the accessed state is unknown, in which case the notification reads and writes all state.
+		bool IsUnknown = false;
+
+		/// Keys of state read by validators.
+		NotificationAccessKeys Reads;
+
+		/// Keys of state written by observers.
+		NotificationAccessKeys Writes;
+	};
+
+	/// Extracts the state accessed by notifications.
+	class NotificationAccessExtractor {
+	public:
+		/// Handler that adds the state accessed by a notification to an access using resolvers.
+		using Handler = std::function<void (const Notification&, const ResolverContext&, NotificationAccess&)>;
+
+	public:
+		/// Creates an extractor for the specified \a networkIdentifier that is aware of all core notifications.
+		explicit NotificationAccessExtractor(NetworkIdentifier networkIdentifier);
+
+	public:
+		/// Gets the network identifier.
+		NetworkIdentifier networkIdentifier() const;
+
+		/// Adds a \a handler for notifications with \a type.
+		/// \note All handlers registered for a type are called in registration order.
+		void add(NotificationType type, const Handler& handler);
+
+		/// Adds a typed \a handler for notifications of type \a TNotification.
+		template<typename TNotification>
+		void add(const std::function<void (const TNotification&, const ResolverContext&, NotificationAccess&)>& handler) {
+			add(TNotification::Notification_Type, [handler](const auto& notification, const auto& resolvers, auto& access) {
+				handler(static_cast<const TNotification&>(notification), resolvers, access);
+			});
+		}
+
+	public:
+		/// Extracts the state accessed by \a notification using \a resolvers.
+		/// \note Access is unknown when no handler is registered for the notification type or a handler throws.
+		NotificationAccess extract(const Notification& notification, const ResolverContext& resolvers) const;
+
+	private:
+		NetworkIdentifier m_networkIdentifier;
+		NotificationTypeDispatchTable<Handler> m_handlers;
+	};
+}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Table that maps notification types (excluding channel) to values registered for them.
+	/// \note Values registered for all types are interleaved with type-specific values in registration order.
+	template<typename TValue>
+	class NotificationTypeDispatchTable {
+	public:
+		/// Adds \a value that matches all notification types.
+		void add(const TValue& value) {
+			m_universalValues.push_back(value);
+			for (auto& pair : m_typedValues)
+				pair.second.push_back(value);
+		}
+
+		/// Adds \a value that matches only notifications with \a type (excluding channel).
+		void add(NotificationType type, const TValue& value) {
+			auto key = ClearChannel(type);
+			auto iter = m_typedValues.find(key);
+			if (m_typedValues.end() == iter)
+				iter = m_typedValues.emplace(key, m_universalValues).first;
+
+			iter->second.push_back(value);
+		}
+
+	public:
+		/// Gets all values matching \a type (excluding channel) in registration order.
+		const std::vector<TValue>& find(NotificationType type) const {
+			auto iter = m_typedValues.find(ClearChannel(type));
+			return m_typedValues.cend() == iter ? m_universalValues : iter->second;
+		}
+
+	private:
+		static NotificationType ClearChannel(NotificationType type) {
+			SetNotificationChannel(type, NotificationChannel::None);
+			return type;
+		}
+
+	private:
+		std::vector<TValue> m_universalValues;
+		std::unordered_map<NotificationType, std::vector<TValue>> m_typedValues;
+	};
+}}
@@ -20,9 +20,9 @@
 **/
 
 #pragma once
-#include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
-#include <functional>
+#include "catapult/model/NotificationTypeDispatchTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace observers {
@@ -30,31 +30,47 @@ namespace catapult { namespace observers {
 	/// Demultiplexing observer builder.
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		using NotificationObserverPointerVector = std::vector<NotificationObserverPointerT<model::Notification>>;
+		using DispatchTable = model::NotificationTypeDispatchTable<const NotificationObserver*>;
+
+	public:
+		/// Function that wraps an observer with another observer.
+		using ObserverDecorator = std::function<NotificationObserverPointerT<model::Notification> (
+				NotificationObserverPointerT<model::Notification>&&)>;
+
+	public:
+		/// Creates a builder.
+		DemuxObserverBuilder() = default;
+
+		/// Creates a builder that wraps all added observers with \a decorator.
+		explicit DemuxObserverBuilder(const ObserverDecorator& decorator) : m_decorator(decorator)
+		{}
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_observers.push_back(decorate(std::make_unique<TypedObserver<TNotification>>(std::move(pObserver))));
+			m_dispatchTable.add(TNotification::Notification_Type, m_observers.back().get());
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			return std::make_unique<DemuxAggregateNotificationObserver>(std::move(m_observers), std::move(m_dispatchTable));
+		}
+
+	private:
+		NotificationObserverPointerT<model::Notification> decorate(NotificationObserverPointerT<model::Notification>&& pObserver) {
+			return m_decorator ? m_decorator(std::move(pObserver)) : std::move(pObserver);
 		}
 
 	private:
+		// only invoked with notifications of type TNotification because of dispatch table lookup
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -63,25 +79,62 @@ namespace catapult { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationObserver : public AggregateNotificationObserverT<model::Notification> {
+		public:
+			DemuxAggregateNotificationObserver(NotificationObserverPointerVector&& observers, DispatchTable&& dispatchTable)
+					: m_observers(std::move(observers))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_observers);
+			}
+
+			void notify(const model::Notification& notification, ObserverContext& context) const override {
+				const auto& observers = m_dispatchTable.find(notification.Type);
+				if (NotifyMode::Commit == context.Mode)
+					notifyAll(observers.cbegin(), observers.cend(), notification, context);
+				else
+					notifyAll(observers.crbegin(), observers.crend(), notification, context);
+			}
+
+		private:
+			template<typename TIter>
+			void notifyAll(TIter begin, TIter end, const model::Notification& notification, ObserverContext& context) const {
+				for (auto iter = begin; end != iter; ++iter)
+					(*iter)->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerVector m_observers;
+			DispatchTable m_dispatchTable;
+			std::string m_name;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		ObserverDecorator m_decorator;
+		NotificationObserverPointerVector m_observers;
+		DispatchTable m_dispatchTable;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	inline DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_observers.push_back(decorate(std::move(pObserver)));
+		m_dispatchTable.add(m_observers.back().get());
 		return *this;
 	}
 }}
@@ -0,0 +1,65 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ObserverTypes.h"
+#include "catapult/utils/ExecutionProfile.h"
+
+namespace catapult { namespace observers {
+
+	/// Notification observer decorator that records the call count and elapsed time of every notification in a profile entry.
+	class ProfilingNotificationObserver : public NotificationObserver {
+	private:
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		/// Creates a decorator around \a pObserver that records into \a entry.
+		ProfilingNotificationObserver(NotificationObserverPointerT<model::Notification>&& pObserver, utils::ExecutionProfile::Entry& entry)
+				: m_pObserver(std::move(pObserver))
+				, m_entry(entry)
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_pObserver->name();
+		}
+
+		void notify(const model::Notification& notification, ObserverContext& context) const override {
+			auto start = Clock::now();
+			m_pObserver->notify(notification, context);
+			m_entry.record(Clock::now() - start);
+		}
+
+	private:
+		NotificationObserverPointerT<model::Notification> m_pObserver;
+		utils::ExecutionProfile::Entry& m_entry;
+	};
+
+	/// Creates an observer decorator that wraps observers in profiling observers recording into \a profile.
+	/// \note Profile entry names are composed of \a namePrefix and observer names.
+	inline auto CreateProfilingObserverDecorator(utils::ExecutionProfile& profile, const std::string& namePrefix) {
+		return [&profile, namePrefix](NotificationObserverPointerT<model::Notification>&& pObserver)
+				-> NotificationObserverPointerT<model::Notification> {
+			auto& entry = profile.entry(namePrefix + pObserver->name());
+			return std::make_unique<ProfilingNotificationObserver>(std::move(pObserver), entry);
+		};
+	}
+}}
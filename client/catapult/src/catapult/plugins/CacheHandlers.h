@@ -41,6 +41,9 @@ namespace catapult { namespace plugins {
 			pluginManager.addHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
 				using PacketType = StatePathRequestPacket<CachePacketTypes::State_Path, KeyType>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<CacheType>());
+
+				using RequestTraits = BatchHandlerFactoryTraits<CachePacketTypes::State_Paths, KeyType>;
+				handlers::RegisterStatePathsHandler<RequestTraits>(handlers, cache.sub<CacheType>());
 			});
 
 			pluginManager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
@@ -56,6 +59,7 @@ namespace catapult { namespace plugins {
 		struct CachePacketTypesT {
 			static constexpr auto State_Path = static_cast<ionet::PacketType>(0x200 + utils::to_underlying_type(FacilityCode));
 			static constexpr auto Diagnostic_Infos = static_cast<ionet::PacketType>(0x400 + utils::to_underlying_type(FacilityCode));
+			static constexpr auto State_Paths = static_cast<ionet::PacketType>(0x500 + utils::to_underlying_type(FacilityCode));
 		};
 
 		template<ionet::PacketType PacketType, typename TCacheKey>
@@ -20,6 +20,8 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/observers/ProfilingNotificationObserver.h"
+#include "catapult/validators/ProfilingNotificationValidator.h"
 #include <filesystem>
 
 namespace catapult { namespace plugins {
@@ -102,6 +104,13 @@ namespace catapult { namespace plugins {
 			ApplyAll(builder, hooks);
 			return builder.build(std::forward<TArgs>(args)...);
 		}
+
+		template<typename TBuilder, typename THooks, typename TDecorator, typename... TArgs>
+		static auto BuildDecorated(const THooks& hooks, const TDecorator& decorator, TArgs&&... args) {
+			TBuilder builder(decorator);
+			ApplyAll(builder, hooks);
+			return builder.build(std::forward<TArgs>(args)...);
+		}
 	}
 
 	// region handlers
@@ -134,6 +143,15 @@ namespace catapult { namespace plugins {
 		ApplyAll(counters, m_diagnosticCounterHooks, cache);
 	}
 
+	void PluginManager::enableExecutionProfiling() {
+		if (!m_pExecutionProfile)
+			m_pExecutionProfile = std::make_unique<utils::ExecutionProfile>();
+	}
+
+	const utils::ExecutionProfile* PluginManager::executionProfile() const {
+		return m_pExecutionProfile.get();
+	}
+
 	// endregion
 
 	// region validators
@@ -146,9 +164,35 @@ namespace catapult { namespace plugins {
 		m_statefulValidatorHooks.push_back(hook);
 	}
 
+	namespace {
+		constexpr auto Stateless_Validator_Profile_Prefix = "stateless::";
+		constexpr auto Stateful_Validator_Profile_Prefix = "stateful::";
+		constexpr auto Observer_Profile_Prefix = "observers::";
+	}
+
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateless::DemuxValidatorBuilder>(m_statelessValidatorHooks, isSuppressedFailure);
+		using BuilderType = validators::stateless::DemuxValidatorBuilder;
+		if (!m_pExecutionProfile)
+			return Build<BuilderType>(m_statelessValidatorHooks, isSuppressedFailure);
+
+		auto decorator = validators::CreateProfilingValidatorDecorator<>(*m_pExecutionProfile, Stateless_Validator_Profile_Prefix);
+		return BuildDecorated<BuilderType>(m_statelessValidatorHooks, decorator, isSuppressedFailure);
+	}
+
+	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator(
+			const validators::ValidationResultPredicate& isSuppressedFailure,
+			const validators::stateless::NotificationValidatorDecorator& decorator) const {
+		using BuilderType = validators::stateless::DemuxValidatorBuilder;
+		if (!m_pExecutionProfile)
+			return BuildDecorated<BuilderType>(m_statelessValidatorHooks, decorator, isSuppressedFailure);
+
+		// profile sub validators directly so that profiled times exclude any overhead added by decorator
+		auto profilingDecorator = validators::CreateProfilingValidatorDecorator<>(*m_pExecutionProfile, Stateless_Validator_Profile_Prefix);
+		auto combinedDecorator = [decorator, profilingDecorator](auto&& pValidator) {
+			return decorator(profilingDecorator(std::move(pValidator)));
+		};
+		return BuildDecorated<BuilderType>(m_statelessValidatorHooks, combinedDecorator, isSuppressedFailure);
 	}
 
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator() const {
@@ -157,7 +201,15 @@ namespace catapult { namespace plugins {
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateful::DemuxValidatorBuilder>(m_statefulValidatorHooks, isSuppressedFailure);
+		using BuilderType = validators::stateful::DemuxValidatorBuilder;
+		if (!m_pExecutionProfile)
+			return Build<BuilderType>(m_statefulValidatorHooks, isSuppressedFailure);
+
+		using validators::ValidatorContext;
+		auto decorator = validators::CreateProfilingValidatorDecorator<const ValidatorContext&>(
+				*m_pExecutionProfile,
+				Stateful_Validator_Profile_Prefix);
+		return BuildDecorated<BuilderType>(m_statefulValidatorHooks, decorator, isSuppressedFailure);
 	}
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator() const {
@@ -177,14 +229,23 @@ namespace catapult { namespace plugins {
 	}
 
 	PluginManager::ObserverPointer PluginManager::createObserver() const {
-		observers::DemuxObserverBuilder builder;
+		auto builder = createObserverBuilder();
 		ApplyAll(builder, m_observerHooks);
 		ApplyAll(builder, m_transientObserverHooks);
 		return builder.build();
 	}
 
 	PluginManager::ObserverPointer PluginManager::createPermanentObserver() const {
-		return Build<observers::DemuxObserverBuilder>(m_observerHooks);
+		auto builder = createObserverBuilder();
+		ApplyAll(builder, m_observerHooks);
+		return builder.build();
+	}
+
+	observers::DemuxObserverBuilder PluginManager::createObserverBuilder() const {
+		if (!m_pExecutionProfile)
+			return observers::DemuxObserverBuilder();
+
+		return observers::DemuxObserverBuilder(observers::CreateProfilingObserverDecorator(*m_pExecutionProfile, Observer_Profile_Prefix));
 	}
 
 	// endregion
@@ -227,6 +288,32 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetchers
+
+	void PluginManager::addSubCachePrefetcherFactory(const cache::SubCachePrefetcherFactory& factory) {
+		m_subCachePrefetcherFactories.push_back(factory);
+	}
+
+	PluginManager::StatePrefetcherPointer PluginManager::createStatePrefetcher() const {
+		return std::make_unique<cache::StatePrefetcher>(m_subCachePrefetcherFactories);
+	}
+
+	// endregion
+
+	// region notification access
+
+	void PluginManager::addNotificationAccessHook(const NotificationAccessHook& hook) {
+		m_notificationAccessHooks.push_back(hook);
+	}
+
+	PluginManager::NotificationAccessExtractorPointer PluginManager::createNotificationAccessExtractor() const {
+		auto pExtractor = std::make_unique<model::NotificationAccessExtractor>(m_config.Network.Identifier);
+		ApplyAll(*pExtractor, m_notificationAccessHooks);
+		return PORTABLE_MOVE(pExtractor);
+	}
+
+	// endregion
+
 	// region publisher
 
 	PluginManager::PublisherPointer PluginManager::createNotificationPublisher(model::PublicationMode mode) const {
@@ -22,15 +22,18 @@
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache/StatePrefetcher.h"
 #include "catapult/config/InflationConfiguration.h"
 #include "catapult/config/UserConfiguration.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/BlockchainConfiguration.h"
+#include "catapult/model/NotificationAccess.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/TransactionPlugin.h"
 #include "catapult/observers/DemuxObserverBuilder.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/ExecutionProfile.h"
 #include "catapult/validators/DemuxValidatorBuilder.h"
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
@@ -65,6 +68,7 @@ namespace catapult { namespace plugins {
 		using StatelessValidatorHook = consumer<validators::stateless::DemuxValidatorBuilder&>;
 		using StatefulValidatorHook = consumer<validators::stateful::DemuxValidatorBuilder&>;
 		using ObserverHook = consumer<observers::DemuxObserverBuilder&>;
+		using NotificationAccessHook = consumer<model::NotificationAccessExtractor&>;
 
 		using StatelessValidatorPointer = std::unique_ptr<const validators::stateless::AggregateNotificationValidator>;
 		using StatefulValidatorPointer = std::unique_ptr<const validators::stateful::AggregateNotificationValidator>;
@@ -81,6 +85,8 @@ namespace catapult { namespace plugins {
 		using AggregateAddressResolver = AggregateResolver<UnresolvedAddress, Address>;
 
 		using PublisherPointer = std::unique_ptr<const model::NotificationPublisher>;
+		using StatePrefetcherPointer = std::unique_ptr<const cache::StatePrefetcher>;
+		using NotificationAccessExtractorPointer = std::unique_ptr<const model::NotificationAccessExtractor>;
 
 	public:
 		/// Creates a new plugin manager around \a config, \a storageConfig \a userConfig and \a inflationConfig.
@@ -160,6 +166,12 @@ namespace catapult { namespace plugins {
 		/// Adds all diagnostic counters to \a counters given \a cache.
 		void addDiagnosticCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache) const;
 
+		/// Enables profiling of all validators and observers created after this call.
+		void enableExecutionProfiling();
+
+		/// Gets the execution profile or \c nullptr if execution profiling is not enabled.
+		const utils::ExecutionProfile* executionProfile() const;
+
 		// endregion
 
 		// region validators
@@ -173,6 +185,12 @@ namespace catapult { namespace plugins {
 		/// Creates a stateless validator that ignores suppressed failures according to \a isSuppressedFailure.
 		StatelessValidatorPointer createStatelessValidator(const validators::ValidationResultPredicate& isSuppressedFailure) const;
 
+		/// Creates a stateless validator that ignores suppressed failures according to \a isSuppressedFailure
+		/// and wraps all sub validators with \a decorator.
+		StatelessValidatorPointer createStatelessValidator(
+				const validators::ValidationResultPredicate& isSuppressedFailure,
+				const validators::stateless::NotificationValidatorDecorator& decorator) const;
+
 		/// Creates a stateless validator with no suppressed failures.
 		StatelessValidatorPointer createStatelessValidator() const;
 
@@ -213,6 +231,26 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region prefetchers
+
+		/// Adds a sub cache prefetcher \a factory.
+		void addSubCachePrefetcherFactory(const cache::SubCachePrefetcherFactory& factory);
+
+		/// Creates a state prefetcher.
+		StatePrefetcherPointer createStatePrefetcher() const;
+
+		// endregion
+
+		// region notification access
+
+		/// Adds a notification access \a hook.
+		void addNotificationAccessHook(const NotificationAccessHook& hook);
+
+		/// Creates a notification access extractor.
+		NotificationAccessExtractorPointer createNotificationAccessExtractor() const;
+
+		// endregion
+
 		// region publisher
 
 		/// Creates a notification publisher for the specified \a mode.
@@ -220,6 +258,9 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+	private:
+		observers::DemuxObserverBuilder createObserverBuilder() const;
+
 	private:
 		model::BlockchainConfiguration m_config;
 		StorageConfiguration m_storageConfig;
@@ -231,6 +272,7 @@ namespace catapult { namespace plugins {
 		std::vector<HandlerHook> m_nonDiagnosticHandlerHooks;
 		std::vector<HandlerHook> m_diagnosticHandlerHooks;
 		std::vector<CounterHook> m_diagnosticCounterHooks;
+		std::unique_ptr<utils::ExecutionProfile> m_pExecutionProfile;
 		std::vector<StatelessValidatorHook> m_statelessValidatorHooks;
 		std::vector<StatefulValidatorHook> m_statefulValidatorHooks;
 		std::vector<ObserverHook> m_observerHooks;
@@ -238,6 +280,9 @@ namespace catapult { namespace plugins {
 
 		std::vector<MosaicResolver> m_mosaicResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
+
+		std::vector<cache::SubCachePrefetcherFactory> m_subCachePrefetcherFactories;
+		std::vector<NotificationAccessHook> m_notificationAccessHooks;
 	};
 }}
 
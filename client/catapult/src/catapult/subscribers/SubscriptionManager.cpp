@@ -34,9 +34,22 @@
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::FileBlockStorage> CreateFileBlockStorage(const config::CatapultConfiguration& config) {
+			auto readMode = config.Node.EnableMemoryMappedBlockStorage
+					? io::FileDatabaseReadMode::Memory_Mapped
+					: io::FileDatabaseReadMode::Stream;
+			return std::make_unique<io::FileBlockStorage>(
+					config.User.DataDirectory,
+					config.Node.FileDatabaseBatchSize,
+					io::FileBlockStorageMode::Hash_Index,
+					readMode);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::CatapultConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory, m_config.Node.FileDatabaseBatchSize)) {
+			, m_pStorage(CreateFileBlockStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
@@ -21,7 +21,12 @@
 
 #pragma once
 #include "Future.h"
+#include "IoThreadPool.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <vector>
 
 namespace catapult { namespace thread {
 
@@ -114,6 +119,236 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
+	/// Options for customizing the behavior of work stealing parallel for loops.
+	struct WorkStealingOptions {
+		/// Number of chunks to create per partition.
+		/// \note More chunks allow better balancing at the cost of more (smaller) callback invocations.
+		size_t NumChunksPerPartition = 4;
+
+		/// \c true if the calling thread should process chunks (starting with the first one) before returning.
+		bool UseCallingThread = false;
+	};
+
+	namespace detail {
+		/// Splits \a items into at most \a numChunks contiguous chunks with roughly equal total cost
+		/// as determined by \a costSupplier and returns the (exclusive) end index of each chunk.
+		template<typename TItems, typename TCostSupplier>
+		std::vector<size_t> CalculateChunkEndIndexes(const TItems& items, size_t numChunks, TCostSupplier costSupplier) {
+			std::vector<uint64_t> cumulativeCosts;
+			cumulativeCosts.reserve(items.size());
+
+			uint64_t totalCost = 0;
+			for (const auto& item : items) {
+				// treat every item as having some cost so that each chunk is guaranteed to make progress
+				totalCost += std::max<uint64_t>(1, costSupplier(item));
+				cumulativeCosts.push_back(totalCost);
+			}
+
+			std::vector<size_t> chunkEndIndexes;
+			if (0 == numChunks)
+				return chunkEndIndexes;
+
+			for (auto i = 0u; i < cumulativeCosts.size(); ++i) {
+				// close the current chunk when it reaches its fair share of the total cost
+				auto chunkCostThreshold = totalCost * (chunkEndIndexes.size() + 1) / numChunks;
+				if (cumulativeCosts[i] >= chunkCostThreshold)
+					chunkEndIndexes.push_back(i + 1);
+			}
+
+			// sanity check: last chunk must always extend to the end
+			if (!cumulativeCosts.empty() && cumulativeCosts.size() != chunkEndIndexes.back())
+				chunkEndIndexes.push_back(cumulativeCosts.size());
+
+			return chunkEndIndexes;
+		}
+	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions work stealing batches and calls \a callback for each chunk.
+	/// Items are split into chunks of roughly equal cost as determined by \a costSupplier and \a options.
+	/// Each of the (at most \a numPartitions) workers repeatedly claims the next unprocessed chunk until all chunks are claimed.
+	/// Future is returned that is resolved when all items have been processed.
+	/// If \a callback throws, the future is instead faulted with the first exception after all running chunks have finished.
+	/// \note \a callback is passed the unique index of the chunk (instead of the partition) as its last argument.
+	/// \note Chunks claimed after \a callback throws are skipped.
+	template<typename TItems, typename TCostSupplier, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TCostSupplier costSupplier,
+			const WorkStealingOptions& options,
+			TWorkCallback callback) {
+		using ItemsIterator = decltype(items.begin());
+
+		// region WorkStealingContext
+
+		class WorkStealingContext {
+		public:
+			WorkStealingContext(
+					ItemsIterator itBegin,
+					const std::vector<size_t>& chunkEndIndexes,
+					size_t numReservedChunks,
+					TWorkCallback&& callback)
+					: m_callback(std::move(callback))
+					, m_nextChunkIndex(numReservedChunks)
+					, m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
+					, m_hasException(false) {
+				size_t startIndex = 0;
+				for (auto endIndex : chunkEndIndexes) {
+					m_chunkStartIndexes.push_back(startIndex);
+					m_chunkBeginIterators.push_back(itBegin);
+
+					std::advance(itBegin, static_cast<typename ItemsIterator::difference_type>(endIndex - startIndex));
+					startIndex = endIndex;
+				}
+
+				m_chunkBeginIterators.push_back(itBegin);
+			}
+
+		public:
+			auto future() {
+				return m_promise.get_future();
+			}
+
+		public:
+			void processChunk(size_t chunkIndex) {
+				if (m_hasException)
+					return;
+
+				// exceptions must not escape because they would either unwind into the io context (pool thread)
+				// or unwind the caller's stack while pool threads are still running callbacks (calling thread)
+				try {
+					m_callback(
+							m_chunkBeginIterators[chunkIndex],
+							m_chunkBeginIterators[chunkIndex + 1],
+							m_chunkStartIndexes[chunkIndex],
+							chunkIndex);
+				} catch (...) {
+					std::lock_guard<std::mutex> guard(m_exceptionMutex);
+					if (!m_pException)
+						m_pException = std::current_exception();
+
+					m_hasException = true;
+				}
+			}
+
+			void processChunks() {
+				for (;;) {
+					auto chunkIndex = m_nextChunkIndex++;
+					if (chunkIndex >= m_chunkStartIndexes.size())
+						break;
+
+					processChunk(chunkIndex);
+				}
+			}
+
+		public:
+			void incrementOutstandingOperations() {
+				++m_numOutstandingOperations;
+			}
+
+			void decrementOutstandingOperations() {
+				if (0 != --m_numOutstandingOperations)
+					return;
+
+				// all other operations have completed, so m_pException can no longer change
+				if (m_pException)
+					m_promise.set_exception(m_pException);
+				else
+					m_promise.set_value(true);
+			}
+
+		private:
+			TWorkCallback m_callback;
+			std::vector<size_t> m_chunkStartIndexes;
+			std::vector<ItemsIterator> m_chunkBeginIterators;
+			std::atomic<size_t> m_nextChunkIndex;
+			std::atomic<size_t> m_numOutstandingOperations;
+			std::atomic_bool m_hasException;
+			std::mutex m_exceptionMutex;
+			std::exception_ptr m_pException;
+			thread::promise<bool> m_promise;
+		};
+
+		// endregion
+
+		// region DecrementGuard
+
+		class DecrementGuard {
+		public:
+			explicit DecrementGuard(WorkStealingContext& context) : m_context(context)
+			{}
+
+			~DecrementGuard() {
+				m_context.decrementOutstandingOperations();
+			}
+
+		private:
+			WorkStealingContext& m_context;
+		};
+
+		// endregion
+
+		auto numChunks = numPartitions * std::max<size_t>(1, options.NumChunksPerPartition);
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(items, numChunks, costSupplier);
+		auto numWorkers = std::min(numPartitions, chunkEndIndexes.size());
+
+		// when the calling thread participates, it reserves the first chunk and replaces one pool worker
+		auto useCallingThread = options.UseCallingThread && 0 != numWorkers;
+		auto numReservedChunks = useCallingThread ? 1u : 0u;
+		auto numPoolWorkers = numWorkers - numReservedChunks;
+
+		auto pContext = std::make_shared<WorkStealingContext>(items.begin(), chunkEndIndexes, numReservedChunks, std::move(callback));
+		DecrementGuard mainOperationGuard(*pContext);
+
+		for (auto i = 0u; i < numPoolWorkers; ++i) {
+			// each thread captures pContext by value, which keeps that object alive
+			pContext->incrementOutstandingOperations();
+			boost::asio::post(ioContext, [pContext]() {
+				DecrementGuard threadOperationGuard(*pContext);
+				pContext->processChunks();
+			});
+		}
+
+		if (useCallingThread) {
+			pContext->processChunk(0);
+			pContext->processChunks();
+		}
+
+		return pContext->future();
+	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions work stealing batches and calls \a callback for each chunk.
+	/// All items are assumed to have the same cost.
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			const WorkStealingOptions& options,
+			TWorkCallback callback) {
+		return WorkStealingParallelForPartition(ioContext, items, numPartitions, [](const auto&) { return 1u; }, options, callback);
+	}
+
+	/// Uses \a pool and the calling thread to call \a callback for each item in \a items and blocks until all items have been processed.
+	/// Each item is processed as a separate work stealing chunk, so items can be processed even when the pool is busy.
+	/// \note The first exception thrown by \a callback is rethrown on the calling thread.
+	template<typename TItems, typename TCallback>
+	void ParallelForEachRethrow(IoThreadPool& pool, TItems& items, TCallback callback) {
+		WorkStealingOptions options;
+		options.NumChunksPerPartition = items.size();
+		options.UseCallingThread = true;
+		WorkStealingParallelForPartition(pool.ioContext(), items, pool.numWorkerThreads(), options, [callback](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto) {
+			for (auto iter = itBegin; itEnd != iter; ++iter)
+				callback(*iter);
+		}).get();
+	}
+
 	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
 	/// Future is returned that is resolved when all items have been processed.
 	template<typename TItems, typename TWorkCallback>
@@ -48,6 +48,11 @@ namespace catapult { namespace tree {
 		}
 
 	public:
+		/// Gets the underlying data source.
+		const TDataSource& dataSource() const {
+			return m_dataSource;
+		}
+
 		/// Gets the root hash that uniquely identifies this tree.
 		Hash256 root() const {
 			return m_tree.root();
@@ -58,6 +63,11 @@ namespace catapult { namespace tree {
 			return m_tree.lookup(key, nodePath);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a proof.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, PatriciaTreeMultiProof& proof) const {
+			return m_tree.lookup(keys, proof);
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		std::shared_ptr<DeltaType> rebase() {
@@ -35,6 +35,10 @@ namespace catapult { namespace tree {
 	private:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
+		using TreeType = PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>>;
+
+	public:
+		using Modification = typename TreeType::Modification;
 
 	public:
 		/// Creates a tree around \a dataSource with root \a rootHash.
@@ -77,6 +81,17 @@ namespace catapult { namespace tree {
 			return m_tree.unset(key);
 		}
 
+		/// Applies all \a modifications to the tree as a single batch.
+		void apply(const std::vector<Modification>& modifications) {
+			m_tree.apply(modifications);
+		}
+
+		/// Applies all \a modifications to the tree using \a forEachBranch to update independent root branches.
+		template<typename TForEachBranch>
+		void apply(const std::vector<Modification>& modifications, TForEachBranch forEachBranch) {
+			m_tree.apply(modifications, forEachBranch);
+		}
+
 	public:
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
@@ -108,6 +123,6 @@ namespace catapult { namespace tree {
 	private:
 		ReadThroughMemoryDataSource<TDataSource> m_dataSource;
 		Hash256 m_baseRootHash;
-		PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>> m_tree;
+		TreeType m_tree;
 	};
 }}
@@ -25,7 +25,18 @@
 
 namespace catapult { namespace tree {
 
-	MemoryDataSource::MemoryDataSource(DataSourceVerbosity verbosity) : m_isVerbose(DataSourceVerbosity::Verbose == verbosity)
+	namespace {
+		template<typename TMap>
+		void ResetMap(TMap& map) {
+			TMap(0, map.hash_function(), map.key_eq(), map.get_allocator()).swap(map);
+		}
+	}
+
+	MemoryDataSource::MemoryDataSource(DataSourceVerbosity verbosity)
+			: m_isVerbose(DataSourceVerbosity::Verbose == verbosity)
+			, m_pArena(std::make_unique<utils::MemoryArena>())
+			, m_leafNodes(0, utils::ArrayHasher<Hash256>(), std::equal_to<Hash256>(), utils::ArenaAllocator<int>(*m_pArena))
+			, m_branchNodes(0, utils::ArrayHasher<Hash256>(), std::equal_to<Hash256>(), utils::ArenaAllocator<int>(*m_pArena))
 	{}
 
 	size_t MemoryDataSource::size() const {
@@ -59,7 +70,9 @@ namespace catapult { namespace tree {
 					<< ", value = " << node.value();
 		}
 
-		m_leafNodes.emplace(node.hash(), node);
+		// only emplace missing nodes because emplace allocates a map node before checking for an existing key
+		if (m_leafNodes.cend() == m_leafNodes.find(node.hash()))
+			m_leafNodes.emplace(node.hash(), node);
 	}
 
 	void MemoryDataSource::set(const BranchTreeNode& node) {
@@ -69,11 +82,23 @@ namespace catapult { namespace tree {
 					<< ", #links " << node.numLinks();
 		}
 
-		m_branchNodes.emplace(node.hash(), node);
+		// only emplace missing nodes because emplace allocates a map node before checking for an existing key
+		if (m_branchNodes.cend() == m_branchNodes.find(node.hash()))
+			m_branchNodes.emplace(node.hash(), node);
 	}
 
 	void MemoryDataSource::clear() {
-		m_leafNodes.clear();
-		m_branchNodes.clear();
+		// destroy all nodes and bucket arrays before releasing the arena that backs them
+		ResetMap(m_leafNodes);
+		ResetMap(m_branchNodes);
+		m_pArena->release();
+	}
+
+	size_t MemoryDataSource::memorySize() const {
+		return m_pArena->size();
+	}
+
+	size_t MemoryDataSource::memoryCapacity() const {
+		return m_pArena->capacity();
 	}
 }}
@@ -23,17 +23,35 @@
 #include "DataSourceVerbosity.h"
 #include "TreeNode.h"
 #include "catapult/utils/Hashers.h"
+#include "catapult/utils/MemoryArena.h"
 #include "catapult/functions.h"
 #include <unordered_map>
 
 namespace catapult { namespace tree {
 
 	/// Patricia tree memory data source.
+	/// \note Map nodes are stored in an arena that is released when the data source is cleared or destroyed.
+	///       Only the map nodes use the arena; branch links and long paths owned by tree nodes are allocated from the global heap.
 	class MemoryDataSource {
+	private:
+		template<typename TNode>
+		using NodeMap = std::unordered_map<
+			Hash256,
+			TNode,
+			utils::ArrayHasher<Hash256>,
+			std::equal_to<Hash256>,
+			utils::ArenaAllocator<std::pair<const Hash256, TNode>>>;
+
 	public:
 		/// Creates a data source with specified \a verbosity.
 		explicit MemoryDataSource(DataSourceVerbosity verbosity = DataSourceVerbosity::Off);
 
+		/// Move constructor.
+		MemoryDataSource(MemoryDataSource&&) = default;
+
+		/// Move assignment operator (deleted because nodes cannot be moved into a different arena).
+		MemoryDataSource& operator=(MemoryDataSource&&) = delete;
+
 	public:
 		/// Gets the number of saved nodes.
 		size_t size() const;
@@ -55,9 +73,17 @@ namespace catapult { namespace tree {
 		/// Clears all nodes.
 		void clear();
 
+	public:
+		/// Gets the number of bytes used for node storage.
+		size_t memorySize() const;
+
+		/// Gets the number of bytes reserved for node storage.
+		size_t memoryCapacity() const;
+
 	private:
 		bool m_isVerbose;
-		std::unordered_map<Hash256, LeafTreeNode, utils::ArrayHasher<Hash256>> m_leafNodes;
-		std::unordered_map<Hash256, BranchTreeNode, utils::ArrayHasher<Hash256>> m_branchNodes;
+		std::unique_ptr<utils::MemoryArena> m_pArena; // heap allocated so that allocators remain valid when this data source is moved
+		NodeMap<LeafTreeNode> m_leafNodes;
+		NodeMap<BranchTreeNode> m_branchNodes;
 	};
 }}
@@ -20,7 +20,11 @@
 **/
 
 #pragma once
+#include "PatriciaTreeMultiProof.h"
 #include "TreeNode.h"
+#include <algorithm>
+#include <array>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -218,6 +222,257 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region apply
+
+	public:
+		/// Modification of the value associated with a key.
+		struct Modification {
+			/// Modified key.
+			const KeyType* pKey;
+
+			/// New value or \c nullptr if the value associated with the key should be removed.
+			const ValueType* pValue;
+		};
+
+		/// Applies all \a modifications to the tree as a single batch.
+		/// \note Modifications are applied in key path order, so each affected node is rebuilt only once.
+		///        When a key is modified multiple times, only its last modification is applied.
+		void apply(const std::vector<Modification>& modifications) {
+			auto encodedModifications = Encode(modifications);
+			apply(m_rootNode, encodedModifications.begin(), encodedModifications.end());
+		}
+
+		/// Applies all \a modifications to the tree as a single batch.
+		/// When the root node is a branch, the modifications are grouped by the root branch they affect and \a forEachBranch
+		/// is passed the indexes of all affected branches and a function that applies all modifications to a single branch.
+		/// \note Different branches are independent, so \a forEachBranch can apply them in parallel but must not return
+		///        until all branches have been updated.
+		template<typename TForEachBranch>
+		void apply(const std::vector<Modification>& modifications, TForEachBranch forEachBranch) {
+			auto encodedModifications = Encode(modifications);
+			if (!m_rootNode.isBranch() || !m_rootNode.path().empty()) {
+				// modifications cannot be partitioned because they are not guaranteed to be rooted in different branches
+				apply(m_rootNode, encodedModifications.begin(), encodedModifications.end());
+				return;
+			}
+
+			std::vector<size_t> branchIndexes;
+			std::array<EncodedModificationsRange, BranchTreeNode::Max_Links> branchModifications;
+			auto modificationsBegin = encodedModifications.begin();
+			auto modificationsEnd = encodedModifications.end();
+			ForEachLinkGroup(0, modificationsBegin, modificationsEnd, [&branchIndexes, &branchModifications](
+					auto index,
+					auto begin,
+					auto end) {
+				branchIndexes.push_back(index);
+				branchModifications[index] = std::make_pair(begin, end);
+			});
+
+			// each branch is only accessed by a single thread, so the updated nodes can be collected without synchronization
+			const auto& rootBranchNode = m_rootNode.asBranchNode();
+			std::array<TreeNode, BranchTreeNode::Max_Links> updatedBranchNodes;
+			std::array<bool, BranchTreeNode::Max_Links> updatedBranchFlags{};
+			forEachBranch(branchIndexes, [this, &rootBranchNode, &branchModifications, &updatedBranchNodes, &updatedBranchFlags](
+					size_t index) {
+				const auto& modificationsRange = branchModifications[index];
+				updatedBranchNodes[index] = getLinkedNode(rootBranchNode, index);
+				updatedBranchFlags[index] = apply(updatedBranchNodes[index], modificationsRange.first, modificationsRange.second);
+			});
+
+			auto branchNode = BranchTreeNode(rootBranchNode);
+			auto isModified = false;
+			for (auto index : branchIndexes) {
+				if (updatedBranchFlags[index]) {
+					setOrClearLink(branchNode, updatedBranchNodes[index], index);
+					isModified = true;
+				}
+			}
+
+			if (isModified)
+				m_rootNode = collapseBranch(std::move(branchNode));
+		}
+
+	private:
+		struct EncodedModification {
+			TreeNodePath Path;
+			Hash256 Value;
+			bool IsRemoval;
+		};
+
+		using EncodedModifications = std::vector<EncodedModification>;
+		using EncodedModificationIterator = typename EncodedModifications::iterator;
+		using EncodedModificationsRange = std::pair<EncodedModificationIterator, EncodedModificationIterator>;
+
+	private:
+		static EncodedModifications Encode(const std::vector<Modification>& modifications) {
+			EncodedModifications encodedModifications;
+			encodedModifications.reserve(modifications.size());
+			for (const auto& modification : modifications) {
+				auto keyPath = TreeNodePath(TEncoder::EncodeKey(*modification.pKey));
+				if (modification.pValue)
+					encodedModifications.push_back({ keyPath, TEncoder::EncodeValue(*modification.pValue), false });
+				else
+					encodedModifications.push_back({ keyPath, Hash256(), true });
+			}
+
+			// sort modifications by path so that all modifications of any subtree are contiguous
+			std::stable_sort(encodedModifications.begin(), encodedModifications.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Path < rhs.Path;
+			});
+
+			// only keep the last modification of each path
+			auto isSamePath = [](const auto& lhs, const auto& rhs) { return lhs.Path == rhs.Path; };
+			auto uniqueBeginIter = std::unique(encodedModifications.rbegin(), encodedModifications.rend(), isSamePath).base();
+			encodedModifications.erase(encodedModifications.begin(), uniqueBeginIter);
+			return encodedModifications;
+		}
+
+		// calls \a action for each group of (sorted) elements in [begin, end) that follow the same link of a branch with
+		// a path composed of \a pathSize nibbles; the paths of all elements passed to \a action are relative to the link
+		template<typename TIterator, typename TAction>
+		static void ForEachLinkGroup(size_t pathSize, TIterator begin, TIterator end, TAction action) {
+			while (end != begin) {
+				auto linkIndex = begin->Path.nibbleAt(pathSize);
+				auto groupEnd = std::find_if(begin, end, [pathSize, linkIndex](const auto& modification) {
+					return linkIndex != modification.Path.nibbleAt(pathSize);
+				});
+
+				for (auto iter = begin; groupEnd != iter; ++iter)
+					iter->Path = iter->Path.subpath(pathSize + 1);
+
+				action(linkIndex, begin, groupEnd);
+				begin = groupEnd;
+			}
+		}
+
+		// applies all (sorted) modifications in [begin, end) with paths relative to the position of \a node
+		// and returns \c true if \a node was modified
+		bool apply(TreeNode& node, EncodedModificationIterator begin, EncodedModificationIterator end) {
+			if (end == begin)
+				return false;
+
+			if (node.empty()) {
+				node = buildSubtree(begin, end);
+				return !node.empty();
+			}
+
+			if (node.isLeaf())
+				return applyToLeaf(node, begin, end);
+
+			return applyToBranch(node, begin, end);
+		}
+
+		TreeNode buildSubtree(EncodedModificationIterator begin, EncodedModificationIterator end) {
+			// removals have no effect when building a new subtree
+			end = std::remove_if(begin, end, [](const auto& modification) { return modification.IsRemoval; });
+			if (end == begin)
+				return TreeNode();
+
+			if (1 == std::distance(begin, end))
+				return TreeNode(LeafTreeNode(begin->Path, begin->Value));
+
+			// because paths are sorted, the path shared by all paths is the path shared by the first and last ones
+			auto sharedPathSize = FindFirstDifferenceIndex(begin->Path, std::prev(end)->Path);
+			auto branchNode = BranchTreeNode(begin->Path.subpath(0, sharedPathSize));
+			ForEachLinkGroup(sharedPathSize, begin, end, [this, &branchNode](auto index, auto groupBegin, auto groupEnd) {
+				setLink(branchNode, buildSubtree(groupBegin, groupEnd), index);
+			});
+
+			return TreeNode(branchNode);
+		}
+
+		bool applyToLeaf(TreeNode& node, EncodedModificationIterator begin, EncodedModificationIterator end) {
+			const auto& leafNode = node.asLeafNode();
+			auto leafIter = std::lower_bound(begin, end, leafNode.path(), [](const auto& modification, const auto& path) {
+				return modification.Path < path;
+			});
+
+			// if the leaf is modified, it can simply be replaced
+			if (end != leafIter && leafNode.path() == leafIter->Path) {
+				node = buildSubtree(begin, end);
+				return true;
+			}
+
+			// if no values are added, the leaf is unchanged
+			if (std::all_of(begin, end, [](const auto& modification) { return modification.IsRemoval; }))
+				return false;
+
+			// otherwise, the leaf needs to be merged into a new subtree with the added values
+			EncodedModifications modifications(begin, leafIter);
+			modifications.push_back({ leafNode.path(), leafNode.value(), false });
+			modifications.insert(modifications.end(), leafIter, end);
+			node = buildSubtree(modifications.begin(), modifications.end());
+			return true;
+		}
+
+		bool applyToBranch(TreeNode& node, EncodedModificationIterator begin, EncodedModificationIterator end) {
+			// removals of keys that do not fully share the branch path have no effect
+			const auto& branchPath = node.path();
+			end = std::remove_if(begin, end, [&branchPath](const auto& modification) {
+				return modification.IsRemoval && branchPath.size() != FindFirstDifferenceIndex(branchPath, modification.Path);
+			});
+
+			// if an added key does not fully share the branch path, the branch must be split at the first difference
+			auto differenceIndex = branchPath.size();
+			for (auto iter = begin; end != iter; ++iter)
+				differenceIndex = std::min(differenceIndex, FindFirstDifferenceIndex(branchPath, iter->Path));
+
+			auto isModified = false;
+			auto branchNode = BranchTreeNode(node.asBranchNode());
+			if (branchPath.size() != differenceIndex) {
+				auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+				auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
+				branchNode.setPath(branchPath.subpath(differenceIndex + 1));
+				setLink(newBranchNode, branchNode, branchLinkIndex);
+				branchNode = std::move(newBranchNode);
+				isModified = true;
+			}
+
+			ForEachLinkGroup(branchNode.path().size(), begin, end, [this, &branchNode, &isModified](
+					auto index,
+					auto groupBegin,
+					auto groupEnd) {
+				auto linkedNode = getLinkedNode(branchNode, index);
+				if (apply(linkedNode, groupBegin, groupEnd)) {
+					setOrClearLink(branchNode, linkedNode, index);
+					isModified = true;
+				}
+			});
+
+			if (!isModified)
+				return false;
+
+			node = collapseBranch(std::move(branchNode));
+			return true;
+		}
+
+		void setOrClearLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
+			if (node.empty())
+				branchNode.clearLink(index);
+			else
+				setLink(branchNode, node, index);
+		}
+
+		TreeNode collapseBranch(BranchTreeNode&& branchNode) {
+			// a branch node must always have at least two links, so collapse it if necessary
+			switch (branchNode.numLinks()) {
+			case 0:
+				return TreeNode();
+
+			case 1: {
+				auto lastLinkIndex = branchNode.highestLinkIndex();
+				auto referencedNode = getLinkedNode(branchNode, lastLinkIndex);
+				referencedNode.setPath(TreeNodePath::Join(branchNode.path(), lastLinkIndex, referencedNode.path()));
+				return referencedNode;
+			}
+
+			default:
+				return TreeNode(branchNode);
+			}
+		}
+
+		// endregion
+
 		// region lookup
 
 	public:
@@ -254,6 +509,90 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region lookup (batch)
+
+	public:
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a proof.
+		/// \note Results and proof paths are ordered like \a keys.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, PatriciaTreeMultiProof& proof) const {
+			std::vector<EncodedLookupKey> encodedKeys;
+			encodedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				encodedKeys.push_back({ TreeNodePath(TEncoder::EncodeKey(key)), encodedKeys.size() });
+
+			// sort keys by path so that all keys of any subtree are contiguous and every node is visited once
+			std::stable_sort(encodedKeys.begin(), encodedKeys.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Path < rhs.Path;
+			});
+
+			proof.Nodes.clear();
+			proof.Paths.clear();
+			proof.Paths.resize(keys.size());
+
+			std::vector<std::pair<Hash256, bool>> results(keys.size(), LookupNotFoundResult());
+			lookup(m_rootNode, encodedKeys.begin(), encodedKeys.end(), proof, results);
+			return results;
+		}
+
+	private:
+		struct EncodedLookupKey {
+			TreeNodePath Path;
+			size_t Index;
+		};
+
+		using EncodedLookupKeyIterator = typename std::vector<EncodedLookupKey>::iterator;
+
+	private:
+		// looks up all (sorted) keys in [begin, end) with paths relative to the position of \a node
+		void lookup(
+				const TreeNode& node,
+				EncodedLookupKeyIterator begin,
+				EncodedLookupKeyIterator end,
+				PatriciaTreeMultiProof& proof,
+				std::vector<std::pair<Hash256, bool>>& results) const {
+			// if the node is empty, there is nothing to do
+			if (node.empty() || end == begin)
+				return;
+
+			auto nodeIndex = static_cast<uint32_t>(proof.Nodes.size());
+			proof.Nodes.push_back(node.copy());
+			for (auto iter = begin; end != iter; ++iter)
+				proof.Paths[iter->Index].push_back(nodeIndex);
+
+			// if the node is a leaf, it must fully match a key path for the key to be in the tree
+			if (!node.isBranch()) {
+				for (auto iter = begin; end != iter; ++iter) {
+					if (node.path() == iter->Path)
+						results[iter->Index] = std::make_pair(node.asLeafNode().value(), true);
+				}
+
+				return;
+			}
+
+			// keys diverging from the branch path cannot be in the tree, so their paths end at the branch
+			// (because keys are sorted, the keys sharing the branch path are contiguous)
+			const auto& branchNode = node.asBranchNode();
+			const auto& branchPath = branchNode.path();
+			auto isBelowBranch = [&branchPath](const auto& encodedKey) {
+				return branchPath.size() == FindFirstDifferenceIndex(branchPath, encodedKey.Path);
+			};
+
+			begin = std::find_if(begin, end, isBelowBranch);
+			end = std::find_if_not(begin, end, isBelowBranch);
+			ForEachLinkGroup(branchPath.size(), begin, end, [this, &branchNode, &proof, &results](
+					auto index,
+					auto groupBegin,
+					auto groupEnd) {
+				// if the branch does not have a link for a group, no key in the group can be in the tree
+				if (!branchNode.hasLink(index))
+					return;
+
+				lookup(getLinkedNode(branchNode, index), groupBegin, groupEnd, proof, results);
+			});
+		}
+
+		// endregion
+
 		// region tryLoad + setRoot + clear
 
 	public:
@@ -284,8 +623,13 @@ namespace catapult { namespace tree {
 	public:
 		/// Saves all tree nodes to the underlying data source.
 		void saveAll() {
-			if (!m_rootNode.empty())
-				saveAll(m_rootNode);
+			if (m_rootNode.empty())
+				return;
+
+			// calculate all dirty hashes in the tree before saving so that the (copied) saved nodes inherit them
+			// instead of each one being recalculated for both the copy and the original
+			m_rootNode.hash();
+			saveAll(m_rootNode);
 		}
 
 	private:
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeMultiProof.h"
+
+namespace catapult { namespace tree {
+
+	ProofVerificationResult VerifyMultiProofPath(
+			const PatriciaTreeMultiProof& proof,
+			size_t pathIndex,
+			const TreeNodePath& keyPath,
+			const Hash256& rootHash,
+			Hash256& value) {
+		if (proof.Paths.size() <= pathIndex)
+			return ProofVerificationResult::Invalid;
+
+		// an empty tree does not contain any nodes
+		const auto& path = proof.Paths[pathIndex];
+		if (path.empty())
+			return Hash256() == rootHash ? ProofVerificationResult::Absent : ProofVerificationResult::Invalid;
+
+		// node hashes are cached, so nodes shared by multiple paths are only hashed once
+		auto expectedHash = rootHash;
+		auto remainingKeyPath = keyPath;
+		for (auto i = 0u; i < path.size(); ++i) {
+			if (proof.Nodes.size() <= path[i])
+				return ProofVerificationResult::Invalid;
+
+			const auto& node = proof.Nodes[path[i]];
+			if (node.empty() || expectedHash != node.hash())
+				return ProofVerificationResult::Invalid;
+
+			auto isLastNode = path.size() - 1 == i;
+			if (node.isLeaf()) {
+				// a leaf must terminate the path and either match or diverge from the key
+				if (!isLastNode)
+					return ProofVerificationResult::Invalid;
+
+				if (remainingKeyPath != node.path())
+					return ProofVerificationResult::Absent;
+
+				value = node.asLeafNode().value();
+				return ProofVerificationResult::Present;
+			}
+
+			const auto& branchNode = node.asBranchNode();
+			auto differenceIndex = FindFirstDifferenceIndex(branchNode.path(), remainingKeyPath);
+			if (differenceIndex != branchNode.path().size()) {
+				// a branch diverging from the key must terminate the path
+				return isLastNode ? ProofVerificationResult::Absent : ProofVerificationResult::Invalid;
+			}
+
+			if (remainingKeyPath.size() == differenceIndex)
+				return ProofVerificationResult::Invalid;
+
+			// a branch without a link for the key must terminate the path, otherwise the path must continue along the link
+			auto linkIndex = remainingKeyPath.nibbleAt(differenceIndex);
+			if (!branchNode.hasLink(linkIndex))
+				return isLastNode ? ProofVerificationResult::Absent : ProofVerificationResult::Invalid;
+
+			if (isLastNode)
+				return ProofVerificationResult::Invalid;
+
+			expectedHash = branchNode.link(linkIndex);
+			remainingKeyPath = remainingKeyPath.subpath(differenceIndex + 1);
+		}
+
+		return ProofVerificationResult::Invalid;
+	}
+}}
@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Proof of existence or nonexistence of multiple keys in a patricia tree.
+	/// \note Nodes shared by multiple paths are only included once.
+	struct PatriciaTreeMultiProof {
+		/// Distinct nodes referenced by all paths.
+		std::vector<TreeNode> Nodes;
+
+		/// Paths composed of node indexes from the root node to the last node visited for each key.
+		std::vector<std::vector<uint32_t>> Paths;
+	};
+
+	/// Possible results of verifying a patricia tree proof.
+	enum class ProofVerificationResult {
+		/// Proof is malformed or is not consistent with the root hash.
+		Invalid,
+
+		/// Proof proves that the key is in the tree.
+		Present,
+
+		/// Proof proves that the key is not in the tree.
+		Absent
+	};
+
+	/// Verifies that the path at \a pathIndex in \a proof proves the existence or nonexistence of the key with encoded path \a keyPath
+	/// in the tree with \a rootHash. When the key is present, its (encoded) value is stored in \a value.
+	ProofVerificationResult VerifyMultiProofPath(
+			const PatriciaTreeMultiProof& proof,
+			size_t pathIndex,
+			const TreeNodePath& keyPath,
+			const Hash256& rootHash,
+			Hash256& value);
+}}
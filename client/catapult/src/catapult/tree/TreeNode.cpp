@@ -93,9 +93,12 @@ namespace catapult { namespace tree {
 
 	// region BranchTreeNode
 
+	namespace {
+		const Hash256 Empty_Hash = Hash256();
+	}
+
 	BranchTreeNode::BranchTreeNode(const TreeNodePath& path)
 			: m_path(path)
-			, m_links() // zero initialize
 			, m_isDirty(true)
 	{}
 
@@ -114,17 +117,20 @@ namespace catapult { namespace tree {
 	}
 
 	bool BranchTreeNode::hasLinkedNode(size_t index) const {
-		return !!m_linkedNodes[index];
+		return hasLink(index) && !m_linkedNodes.empty() && !!m_linkedNodes[linkPosition(index)];
 	}
 
 	const Hash256& BranchTreeNode::link(size_t index) const {
-		const auto& pLinkedNode = m_linkedNodes[index];
-		return pLinkedNode ? pLinkedNode->hash() : m_links[index];
+		if (!hasLink(index))
+			return Empty_Hash;
+
+		auto position = linkPosition(index);
+		const auto* pLinkedNode = m_linkedNodes.empty() ? nullptr : m_linkedNodes[position].get();
+		return pLinkedNode ? pLinkedNode->hash() : m_links[position];
 	}
 
 	TreeNode BranchTreeNode::linkedNode(size_t index) const {
-		const auto& pLinkedNode = m_linkedNodes[index];
-		return pLinkedNode ? pLinkedNode->copy() : TreeNode();
+		return hasLinkedNode(index) ? m_linkedNodes[linkPosition(index)]->copy() : TreeNode();
 	}
 
 	uint8_t BranchTreeNode::highestLinkIndex() const {
@@ -151,45 +157,69 @@ namespace catapult { namespace tree {
 	}
 
 	void BranchTreeNode::setLink(const Hash256& link, size_t index) {
-		m_links[index] = link;
-		m_linkedNodes[index].reset();
-		setLink(index);
+		auto position = findOrInsertLink(index);
+		m_links[position] = link;
+		if (!m_linkedNodes.empty())
+			m_linkedNodes[position].reset();
 	}
 
 	void BranchTreeNode::setLink(const TreeNode& node, size_t index) {
-		// m_links does not need to be explicitly cleared because m_linkedNodes takes precedence
-		m_linkedNodes[index] = std::make_shared<const TreeNode>(node.copy());
-		setLink(index);
+		// m_links does not need to be explicitly updated because m_linkedNodes takes precedence
+		auto position = findOrInsertLink(index);
+		if (m_linkedNodes.empty())
+			m_linkedNodes.resize(m_links.size());
+
+		m_linkedNodes[position] = std::make_shared<const TreeNode>(node.copy());
 	}
 
 	void BranchTreeNode::clearLink(size_t index) {
-		setLink(Hash256(), index);
+		m_isDirty = true;
+		if (!hasLink(index))
+			return;
+
+		auto position = linkPosition(index);
+		m_links.erase(m_links.begin() + static_cast<std::ptrdiff_t>(position));
+		if (!m_linkedNodes.empty())
+			m_linkedNodes.erase(m_linkedNodes.begin() + static_cast<std::ptrdiff_t>(position));
+
 		m_linkSet.reset(index);
 	}
 
 	void BranchTreeNode::compactLinks() {
-		for (auto i = 0u; i < Max_Links; ++i) {
-			auto& pLinkedNode = m_linkedNodes[i];
-			if (!pLinkedNode)
-				continue;
-
-			m_links[i] = pLinkedNode->hash();
-			pLinkedNode.reset();
+		for (auto i = 0u; i < m_linkedNodes.size(); ++i) {
+			if (m_linkedNodes[i])
+				m_links[i] = m_linkedNodes[i]->hash();
 		}
+
+		m_linkedNodes = std::vector<std::shared_ptr<const TreeNode>>();
 	}
 
-	void BranchTreeNode::setLink(size_t index) {
-		m_linkSet.set(index);
+	size_t BranchTreeNode::findOrInsertLink(size_t index) {
 		m_isDirty = true;
+
+		auto position = linkPosition(index);
+		if (!hasLink(index)) {
+			m_links.insert(m_links.begin() + static_cast<std::ptrdiff_t>(position), Hash256());
+			if (!m_linkedNodes.empty())
+				m_linkedNodes.insert(m_linkedNodes.begin() + static_cast<std::ptrdiff_t>(position), nullptr);
+
+			m_linkSet.set(index);
+		}
+
+		return position;
+	}
+
+	size_t BranchTreeNode::linkPosition(size_t index) const {
+		// position of a link within the dense arrays is the number of links set before it
+		auto lowerLinksMask = (static_cast<unsigned long>(1) << index) - 1;
+		return std::bitset<Max_Links>(m_linkSet.to_ulong() & lowerLinksMask).count();
 	}
 
 	// endregion
 
 	// region TreeNode
 
-	TreeNode::TreeNode()
-			: m_treeNodeType(TreeNodeType::Empty)
-			, m_emptyHash()
+	TreeNode::TreeNode() : m_treeNodeType(TreeNodeType::Empty)
 	{}
 
 	TreeNode::TreeNode(const LeafTreeNode& node)
@@ -215,12 +245,15 @@ namespace catapult { namespace tree {
 	}
 
 	const TreeNodePath& TreeNode::path() const {
+		// empty node path is shared by all empty nodes to avoid storing it in each node
+		static const TreeNodePath Empty_Path;
+
 		if (isLeaf())
 			return m_leafNode.path();
 		else if (isBranch())
 			return m_branchNode.path();
 		else
-			return m_emptyPath;
+			return Empty_Path;
 	}
 
 	const Hash256& TreeNode::hash() const {
@@ -229,7 +262,7 @@ namespace catapult { namespace tree {
 		else if (isBranch())
 			return m_branchNode.hash();
 		else
-			return m_emptyHash;
+			return Empty_Hash;
 	}
 
 	void TreeNode::setPath(const TreeNodePath& path) {
@@ -24,6 +24,7 @@
 #include "catapult/types.h"
 #include <bitset>
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace tree { class TreeNode; } }
 
@@ -64,6 +65,7 @@ namespace catapult { namespace tree {
 	// region BranchTreeNode
 
 	/// Represents a branch tree node.
+	/// \note Only set links are stored. They are kept in dense arrays ordered by link index and located via the link bitmap.
 	class BranchTreeNode {
 	public:
 		/// Maximum number of branch links.
@@ -119,12 +121,14 @@ namespace catapult { namespace tree {
 		void compactLinks();
 
 	private:
-		void setLink(size_t index);
+		size_t findOrInsertLink(size_t index);
+
+		size_t linkPosition(size_t index) const;
 
 	private:
 		TreeNodePath m_path;
-		std::array<Hash256, BranchTreeNode::Max_Links> m_links;
-		std::array<std::shared_ptr<const TreeNode>, BranchTreeNode::Max_Links> m_linkedNodes; // shared_ptr to allow copying
+		std::vector<Hash256> m_links;
+		std::vector<std::shared_ptr<const TreeNode>> m_linkedNodes; // either empty or parallel to m_links; shared_ptr to allow copying
 		std::bitset<BranchTreeNode::Max_Links> m_linkSet;
 		mutable Hash256 m_hash;
 		mutable bool m_isDirty;
@@ -188,10 +192,6 @@ namespace catapult { namespace tree {
 		LeafTreeNode m_leafNode;
 		BranchTreeNode m_branchNode;
 		TreeNodeType m_treeNodeType;
-
-		// used to return references from path() and hash() when type is Empty
-		TreeNodePath m_emptyPath;
-		Hash256 m_emptyHash;
 	};
 
 	// endregion
@@ -40,16 +40,18 @@ namespace catapult { namespace tree {
 	TreeNodePath::TreeNodePath()
 			: m_size(0)
 			, m_adjustment(0)
+			, m_inlinePath() // zero initialize
 	{}
 
-	TreeNodePath::TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size)
+	TreeNodePath::TreeNodePath(const uint8_t* pPath, size_t offset, size_t size)
 			: m_size(size)
 			, m_adjustment(offset % 2) // adjustment is needed to correctly handle paths beginning at odd nibbles
-			, m_path(CalculateByteSize(offset, size)) {
+			, m_inlinePath() {
 		if (0 == m_size)
 			return;
 
-		std::memcpy(m_path.data(), &path[offset / 2], m_path.size());
+		auto byteSize = CalculateByteSize(offset, size);
+		std::memcpy(allocate(byteSize), pPath + offset / 2, byteSize);
 	}
 
 	bool TreeNodePath::empty() const {
@@ -62,7 +64,7 @@ namespace catapult { namespace tree {
 
 	uint8_t TreeNodePath::nibbleAt(size_t index) const {
 		index += m_adjustment;
-		auto byte = m_path[index / 2];
+		auto byte = data()[index / 2];
 
 		// return high nibble before low nibble
 		return 0 == index % 2 ? ((byte & 0xF0) >> 4) : (byte & 0x0F);
@@ -76,30 +78,45 @@ namespace catapult { namespace tree {
 		return !(*this == rhs);
 	}
 
+	bool TreeNodePath::operator<(const TreeNodePath& rhs) const {
+		auto differenceIndex = FindFirstDifferenceIndex(*this, rhs);
+		if (size() == differenceIndex || rhs.size() == differenceIndex)
+			return size() < rhs.size();
+
+		return nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+	}
+
 	TreeNodePath TreeNodePath::subpath(size_t offset) const {
 		return subpath(offset, size() - offset);
 	}
 
 	TreeNodePath TreeNodePath::subpath(size_t offset, size_t size) const {
-		return TreeNodePath(m_path, offset + m_adjustment, size);
+		return TreeNodePath(data(), offset + m_adjustment, size);
+	}
+
+	const uint8_t* TreeNodePath::data() const {
+		return m_heapPath.empty() ? m_inlinePath.data() : m_heapPath.data();
+	}
+
+	uint8_t* TreeNodePath::allocate(size_t byteSize) {
+		if (byteSize <= Inline_Capacity)
+			return m_inlinePath.data();
+
+		m_heapPath.resize(byteSize);
+		return m_heapPath.data();
 	}
 
 	namespace {
 		class JoinBuilder {
 		public:
-			explicit JoinBuilder(size_t size)
+			explicit JoinBuilder(uint8_t* pPath)
 					: m_index(0)
-					, m_path(size, 0)
+					, m_pPath(pPath)
 			{}
 
-		public:
-			const std::vector<uint8_t>& path() {
-				return m_path;
-			}
-
 		public:
 			void addNibble(uint8_t nibble) {
-				m_path[m_index / 2] = static_cast<uint8_t>(m_path[m_index / 2] | (0 != m_index % 2 ? (nibble & 0x0F) : (nibble << 4)));
+				m_pPath[m_index / 2] = static_cast<uint8_t>(m_pPath[m_index / 2] | (0 != m_index % 2 ? (nibble & 0x0F) : (nibble << 4)));
 				++m_index;
 			}
 
@@ -110,25 +127,30 @@ namespace catapult { namespace tree {
 
 		private:
 			size_t m_index;
-			std::vector<uint8_t> m_path;
+			uint8_t* m_pPath;
 		};
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		TreeNodePath joinedPath;
+		joinedPath.m_size = lhs.size() + rhs.size();
+
+		// newly allocated path bytes are always zeroed
+		JoinBuilder builder(joinedPath.allocate((joinedPath.m_size + 1) / 2));
 		builder.addNibbles(lhs);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return joinedPath;
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + 1 + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		TreeNodePath joinedPath;
+		joinedPath.m_size = lhs.size() + 1 + rhs.size();
+
+		JoinBuilder builder(joinedPath.allocate((joinedPath.m_size + 1) / 2));
 		builder.addNibbles(lhs);
 		builder.addNibble(nibble);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return joinedPath;
 	}
 
 	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path) {
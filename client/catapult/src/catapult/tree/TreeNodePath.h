@@ -22,6 +22,7 @@
 #pragma once
 #include "catapult/utils/traits/Traits.h"
 #include <algorithm>
+#include <array>
 #include <iosfwd>
 #include <vector>
 #include <stdint.h>
@@ -29,30 +30,34 @@
 namespace catapult { namespace tree {
 
 	/// Represents a path in a tree.
+	/// \note Packed nibbles are stored inline for paths with up to 64 nibbles, which covers all 256-bit keys.
 	class TreeNodePath {
+	private:
+		static constexpr size_t Inline_Capacity = 32;
+
 	public:
 		/// Creates a default path.
 		TreeNodePath();
 
 		/// Creates a path from \a key.
 		template<typename TKey>
-		explicit TreeNodePath(TKey key) : m_adjustment(0) {
+		explicit TreeNodePath(TKey key) : TreeNodePath() {
 			if constexpr (utils::traits::is_scalar_v<TKey>) {
 				m_size = 2 * sizeof(TKey);
-				m_path.resize(sizeof(TKey));
+				auto* pPath = allocate(sizeof(TKey));
 
 				// copy in big endian byte order
 				const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
-				std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), m_path.begin());
+				std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), pPath);
 			} else {
 				m_size = 2 * key.size();
-				m_path.resize(key.size());
-				std::copy(key.cbegin(), key.cend(), m_path.begin());
+				auto* pPath = allocate(key.size());
+				std::copy(key.cbegin(), key.cend(), pPath);
 			}
 		}
 
 	private:
-		TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size);
+		TreeNodePath(const uint8_t* pPath, size_t offset, size_t size);
 
 	public:
 		/// Returns \c true if this path is empty.
@@ -72,6 +77,9 @@ namespace catapult { namespace tree {
 		/// Returns \c true if this path is not equal to \a rhs.
 		bool operator!=(const TreeNodePath& rhs) const;
 
+		/// Returns \c true if this path is lexicographically less than \a rhs.
+		bool operator<(const TreeNodePath& rhs) const;
+
 	public:
 		/// Creates a subpath starting at nibble \a offset.
 		TreeNodePath subpath(size_t offset) const;
@@ -86,10 +94,16 @@ namespace catapult { namespace tree {
 		/// Joins \a lhs, \a nibble and \a rhs into a new path.
 		static TreeNodePath Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs);
 
+	private:
+		const uint8_t* data() const;
+
+		uint8_t* allocate(size_t byteSize);
+
 	private:
 		size_t m_size;
 		size_t m_adjustment; // used to track odd / even starting nibble
-		std::vector<uint8_t> m_path;
+		std::array<uint8_t, Inline_Capacity> m_inlinePath;
+		std::vector<uint8_t> m_heapPath; // only used when path does not fit into m_inlinePath
 	};
 
 	/// Insertion operator for outputting \a path to \a out.
@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BloomFilter.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		uint64_t Mix(uint64_t value) {
+			// splitmix64 finalizer
+			value ^= value >> 30;
+			value *= 0xBF58'476D'1CE4'E5B9;
+			value ^= value >> 27;
+			value *= 0x94D0'49BB'1331'11EB;
+			value ^= value >> 31;
+			return value;
+		}
+	}
+
+	BloomFilter::BloomFilter() : BloomFilter(0, Default_Num_Hash_Functions, std::vector<uint8_t>())
+	{}
+
+	BloomFilter::BloomFilter(size_t capacity, uint32_t seed)
+			: BloomFilter(seed, Default_Num_Hash_Functions, std::vector<uint8_t>(std::max<size_t>(1, capacity * Default_Bits_Per_Key / 8)))
+	{}
+
+	BloomFilter::BloomFilter(uint32_t seed, uint32_t numHashFunctions, std::vector<uint8_t>&& data)
+			: m_seed(seed)
+			, m_numHashFunctions(numHashFunctions)
+			, m_data(std::move(data))
+	{}
+
+	uint32_t BloomFilter::seed() const {
+		return m_seed;
+	}
+
+	uint32_t BloomFilter::numHashFunctions() const {
+		return m_numHashFunctions;
+	}
+
+	const std::vector<uint8_t>& BloomFilter::data() const {
+		return m_data;
+	}
+
+	BloomFilterHeader BloomFilter::header() const {
+		return { static_cast<uint32_t>(m_data.size()), m_seed, m_numHashFunctions };
+	}
+
+	void BloomFilter::insert(uint64_t key) {
+		if (m_data.empty())
+			CATAPULT_THROW_RUNTIME_ERROR("cannot insert key into bloom filter without data");
+
+		forEachBitPosition(key, [&data = m_data](auto position) {
+			data[position / 8] = static_cast<uint8_t>(data[position / 8] | (1u << (position % 8)));
+			return true;
+		});
+	}
+
+	bool BloomFilter::contains(uint64_t key) const {
+		if (m_data.empty())
+			return false;
+
+		auto isSet = true;
+		forEachBitPosition(key, [&data = m_data, &isSet](auto position) {
+			isSet = 0 != (data[position / 8] & (1u << (position % 8)));
+			return isSet;
+		});
+		return isSet;
+	}
+
+	template<typename TAction>
+	void BloomFilter::forEachBitPosition(uint64_t key, TAction action) const {
+		// derive all positions from two independent hashes (Kirsch-Mitzenmacher), second hash must be odd
+		auto hash = Mix(key ^ (static_cast<uint64_t>(m_seed) << 32 | m_seed));
+		auto hash1 = hash & 0xFFFF'FFFF;
+		auto hash2 = (hash >> 32) | 1;
+
+		auto numBits = m_data.size() * 8;
+		for (auto i = 0u; i < m_numHashFunctions; ++i) {
+			if (!action((hash1 + i * hash2) % numBits))
+				return;
+		}
+	}
+
+	bool TryParseBloomFilter(const RawBuffer& buffer, BloomFilter& filter, size_t& numBytesConsumed) {
+		BloomFilterHeader header;
+		if (buffer.Size < sizeof(BloomFilterHeader))
+			return false;
+
+		std::memcpy(static_cast<void*>(&header), buffer.pData, sizeof(BloomFilterHeader));
+		if (0 == header.Size || buffer.Size - sizeof(BloomFilterHeader) < header.Size)
+			return false;
+
+		if (0 == header.NumHashFunctions || header.NumHashFunctions > BloomFilter::Max_Hash_Functions)
+			return false;
+
+		const auto* pDataStart = buffer.pData + sizeof(BloomFilterHeader);
+		filter = BloomFilter(header.Seed, header.NumHashFunctions, std::vector<uint8_t>(pDataStart, pDataStart + header.Size));
+		numBytesConsumed = sizeof(BloomFilterHeader) + header.Size;
+		return true;
+	}
+}}
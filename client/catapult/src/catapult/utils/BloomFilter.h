@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "RawBuffer.h"
+#include <vector>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+#pragma pack(push, 1)
+
+	/// Header of a serialized bloom filter.
+	struct BloomFilterHeader {
+		/// Size of the filter data following the header.
+		uint32_t Size;
+
+		/// Seed used to randomize bit positions.
+		uint32_t Seed;
+
+		/// Number of bit positions set for each key.
+		uint32_t NumHashFunctions;
+	};
+
+#pragma pack(pop)
+
+	/// Probabilistic set of 64-bit keys that never reports a false negative.
+	/// \note Keys are expected to be uniformly distributed (e.g. derived from hashes).
+	class BloomFilter {
+	public:
+		/// Number of filter bits allocated per key by default.
+		static constexpr uint32_t Default_Bits_Per_Key = 8;
+
+		/// Number of bit positions set for each key by default (minimizes false positives for Default_Bits_Per_Key).
+		static constexpr uint32_t Default_Num_Hash_Functions = 5;
+
+		/// Maximum number of bit positions that can be set for each key.
+		static constexpr uint32_t Max_Hash_Functions = 16;
+
+	public:
+		/// Creates an empty filter that does not contain any keys.
+		BloomFilter();
+
+		/// Creates an empty filter sized for \a capacity keys with bit positions randomized by \a seed.
+		BloomFilter(size_t capacity, uint32_t seed);
+
+		/// Creates a filter around \a seed, \a numHashFunctions and filter \a data.
+		BloomFilter(uint32_t seed, uint32_t numHashFunctions, std::vector<uint8_t>&& data);
+
+	public:
+		/// Gets the seed used to randomize bit positions.
+		uint32_t seed() const;
+
+		/// Gets the number of bit positions set for each key.
+		uint32_t numHashFunctions() const;
+
+		/// Gets the filter data.
+		const std::vector<uint8_t>& data() const;
+
+		/// Gets the header describing this filter.
+		BloomFilterHeader header() const;
+
+	public:
+		/// Adds \a key to the filter.
+		/// \note Throws when the filter does not have any data (e.g. it was default constructed).
+		void insert(uint64_t key);
+
+		/// Returns \c true if \a key might have been added to the filter, \c false if it definitely was not.
+		bool contains(uint64_t key) const;
+
+	private:
+		template<typename TAction>
+		void forEachBitPosition(uint64_t key, TAction action) const;
+
+	private:
+		uint32_t m_seed;
+		uint32_t m_numHashFunctions;
+		std::vector<uint8_t> m_data;
+	};
+
+	/// Tries to parse a serialized bloom filter (header followed by filter data) from the start of \a buffer into \a filter.
+	/// On success, \a numBytesConsumed is set to the number of bytes parsed.
+	bool TryParseBloomFilter(const RawBuffer& buffer, BloomFilter& filter, size_t& numBytesConsumed);
+}}
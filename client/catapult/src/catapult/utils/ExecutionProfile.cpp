@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ExecutionProfile.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	// region Entry
+
+	ExecutionProfile::Entry::Entry(const std::string& name)
+			: m_name(name)
+			, m_numCalls(0)
+			, m_totalElapsedNanoseconds(0)
+			, m_maxElapsedNanoseconds(0)
+	{}
+
+	const std::string& ExecutionProfile::Entry::name() const {
+		return m_name;
+	}
+
+	ExecutionProfile::EntryValues ExecutionProfile::Entry::values() const {
+		return { m_name, m_numCalls, m_totalElapsedNanoseconds, m_maxElapsedNanoseconds };
+	}
+
+	void ExecutionProfile::Entry::record(std::chrono::nanoseconds elapsedTime) {
+		auto elapsedNanoseconds = static_cast<uint64_t>(elapsedTime.count());
+		++m_numCalls;
+		m_totalElapsedNanoseconds += elapsedNanoseconds;
+
+		auto maxElapsedNanoseconds = m_maxElapsedNanoseconds.load();
+		while (maxElapsedNanoseconds < elapsedNanoseconds) {
+			if (m_maxElapsedNanoseconds.compare_exchange_weak(maxElapsedNanoseconds, elapsedNanoseconds))
+				break;
+		}
+	}
+
+	// endregion
+
+	// region ExecutionProfile
+
+	size_t ExecutionProfile::size() const {
+		SpinLockGuard guard(m_lock);
+		return m_entries.size();
+	}
+
+	std::vector<ExecutionProfile::EntryValues> ExecutionProfile::values() const {
+		std::vector<EntryValues> values;
+		{
+			SpinLockGuard guard(m_lock);
+			for (const auto& entry : m_entries)
+				values.push_back(entry.values());
+		}
+
+		std::stable_sort(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.TotalElapsedNanoseconds > rhs.TotalElapsedNanoseconds;
+		});
+		return values;
+	}
+
+	ExecutionProfile::Entry& ExecutionProfile::entry(const std::string& name) {
+		SpinLockGuard guard(m_lock);
+		auto iter = m_nameToEntryMap.find(name);
+		if (m_nameToEntryMap.cend() != iter)
+			return *iter->second;
+
+		// deque never relocates existing elements on emplace_back, so references remain valid
+		auto& entry = m_entries.emplace_back(name);
+		m_nameToEntryMap.emplace(name, &entry);
+		return entry;
+	}
+
+	// endregion
+}}
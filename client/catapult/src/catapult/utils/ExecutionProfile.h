@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "SpinLock.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Collects call counts and elapsed times of named operations.
+	class ExecutionProfile {
+	public:
+		/// Execution statistics of a single named operation.
+		struct EntryValues {
+			/// Operation name.
+			std::string Name;
+
+			/// Number of calls.
+			uint64_t NumCalls;
+
+			/// Cumulative elapsed nanoseconds across all calls.
+			uint64_t TotalElapsedNanoseconds;
+
+			/// Maximum elapsed nanoseconds of any single call.
+			uint64_t MaxElapsedNanoseconds;
+		};
+
+		/// Accumulates execution statistics of a single named operation.
+		class Entry {
+		public:
+			/// Creates an entry with \a name.
+			explicit Entry(const std::string& name);
+
+		public:
+			/// Gets the entry name.
+			const std::string& name() const;
+
+			/// Gets the current entry values.
+			EntryValues values() const;
+
+		public:
+			/// Records a single call that took \a elapsedTime.
+			void record(std::chrono::nanoseconds elapsedTime);
+
+		private:
+			std::string m_name;
+			std::atomic<uint64_t> m_numCalls;
+			std::atomic<uint64_t> m_totalElapsedNanoseconds;
+			std::atomic<uint64_t> m_maxElapsedNanoseconds;
+		};
+
+	public:
+		/// Gets the number of entries.
+		size_t size() const;
+
+		/// Gets the values of all entries sorted by decreasing total elapsed time.
+		std::vector<EntryValues> values() const;
+
+	public:
+		/// Gets the entry with \a name, creating it if it does not exist yet.
+		/// \note Returned reference is valid for the lifetime of the profile.
+		Entry& entry(const std::string& name);
+
+	private:
+		std::deque<Entry> m_entries;
+		std::unordered_map<std::string, Entry*> m_nameToEntryMap;
+		mutable SpinLock m_lock;
+	};
+}}
@@ -0,0 +1,125 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr auto Sub_Bucket_Bits = LatencyHistogram::Sub_Bucket_Bits;
+		constexpr auto Sub_Bucket_Count = LatencyHistogram::Sub_Bucket_Count;
+		constexpr auto Sub_Bucket_Half_Count = LatencyHistogram::Sub_Bucket_Half_Count;
+
+		size_t GetBucketIndex(uint64_t value) {
+			if (value < Sub_Bucket_Count)
+				return value;
+
+			// values in [2^k, 2^(k + 1)) share a power of two bucket that is split into Sub_Bucket_Half_Count linear sub-buckets
+			auto shift = Log2(value) - (Sub_Bucket_Bits - 1);
+			auto subBucketIndex = (value >> shift) - Sub_Bucket_Half_Count;
+			return static_cast<size_t>(Sub_Bucket_Count + (shift - 1) * Sub_Bucket_Half_Count + subBucketIndex);
+		}
+
+		uint64_t GetHighestBucketValue(size_t index) {
+			if (index < Sub_Bucket_Count)
+				return index;
+
+			auto shift = (index - Sub_Bucket_Count) / Sub_Bucket_Half_Count + 1;
+			auto subBucketValue = (index - Sub_Bucket_Count) % Sub_Bucket_Half_Count + Sub_Bucket_Half_Count;
+			auto lowestValue = static_cast<uint64_t>(subBucketValue) << shift;
+			return lowestValue + ((static_cast<uint64_t>(1) << shift) - 1);
+		}
+	}
+
+	LatencyHistogram::LatencyHistogram()
+			: m_count(0)
+			, m_max(0) {
+		for (auto& bucketCount : m_bucketCounts)
+			bucketCount = 0;
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count;
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max;
+	}
+
+	uint64_t LatencyHistogram::percentile(uint32_t percentile) const {
+		uint64_t totalCount;
+		auto bucketCounts = loadBucketCounts(totalCount);
+		return this->percentile(bucketCounts, totalCount, percentile);
+	}
+
+	LatencySummary LatencyHistogram::summarize() const {
+		uint64_t totalCount;
+		auto bucketCounts = loadBucketCounts(totalCount);
+
+		LatencySummary summary;
+		summary.Count = totalCount;
+		summary.Median = percentile(bucketCounts, totalCount, 50);
+		summary.P90 = percentile(bucketCounts, totalCount, 90);
+		summary.P99 = percentile(bucketCounts, totalCount, 99);
+		summary.Max = percentile(bucketCounts, totalCount, 100);
+		return summary;
+	}
+
+	void LatencyHistogram::add(uint64_t value) {
+		++m_bucketCounts[GetBucketIndex(value)];
+		++m_count;
+
+		auto max = m_max.load();
+		while (max < value) {
+			if (m_max.compare_exchange_weak(max, value))
+				break;
+		}
+	}
+
+	LatencyHistogram::BucketCounts LatencyHistogram::loadBucketCounts(uint64_t& totalCount) const {
+		// calculate total count from buckets so that it is consistent with the loaded bucket counts
+		BucketCounts bucketCounts;
+		totalCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			bucketCounts[i] = m_bucketCounts[i].load();
+			totalCount += bucketCounts[i];
+		}
+
+		return bucketCounts;
+	}
+
+	uint64_t LatencyHistogram::percentile(const BucketCounts& bucketCounts, uint64_t totalCount, uint32_t percentile) const {
+		if (0 == totalCount)
+			return 0;
+
+		auto rank = std::max<uint64_t>(1, (totalCount * std::min<uint32_t>(percentile, 100) + 99) / 100);
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			cumulativeCount += bucketCounts[i];
+			if (cumulativeCount >= rank)
+				return std::min<uint64_t>(GetHighestBucketValue(i), m_max);
+		}
+
+		return m_max;
+	}
+}}
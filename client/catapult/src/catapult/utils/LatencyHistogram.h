@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Summary of the values recorded in a latency histogram.
+	struct LatencySummary {
+		/// Number of recorded values.
+		uint64_t Count;
+
+		/// 50th percentile value.
+		uint64_t Median;
+
+		/// 90th percentile value.
+		uint64_t P90;
+
+		/// 99th percentile value.
+		uint64_t P99;
+
+		/// Maximum value.
+		uint64_t Max;
+	};
+
+	/// HDR-style histogram of latency values composed of power of two buckets that are linearly subdivided.
+	/// \note All values are recorded with a relative error less than 1 / Sub_Bucket_Half_Count.
+	class LatencyHistogram {
+	public:
+		/// Number of bits used to index linear sub-buckets.
+		static constexpr uint64_t Sub_Bucket_Bits = 5;
+
+		/// Number of linear sub-buckets used for the smallest values.
+		static constexpr uint64_t Sub_Bucket_Count = 1u << Sub_Bucket_Bits;
+
+		/// Number of linear sub-buckets used for each larger power of two.
+		static constexpr uint64_t Sub_Bucket_Half_Count = Sub_Bucket_Count / 2;
+
+		/// Total number of buckets.
+		static constexpr uint64_t Num_Buckets = Sub_Bucket_Count + (64 - Sub_Bucket_Bits) * Sub_Bucket_Half_Count;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the maximum recorded value.
+		uint64_t max() const;
+
+		/// Gets the smallest (bucketed) value that is greater than or equal to \a percentile percent of all recorded values.
+		uint64_t percentile(uint32_t percentile) const;
+
+		/// Gets a summary of all recorded values.
+		LatencySummary summarize() const;
+
+	public:
+		/// Records \a value.
+		void add(uint64_t value);
+
+	private:
+		using BucketCounts = std::array<uint64_t, Num_Buckets>;
+
+		BucketCounts loadBucketCounts(uint64_t& totalCount) const;
+
+		uint64_t percentile(const BucketCounts& bucketCounts, uint64_t totalCount, uint32_t percentile) const;
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_bucketCounts;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_max;
+	};
+}}
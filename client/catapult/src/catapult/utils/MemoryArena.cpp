@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryArena.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace utils {
+
+	MemoryArena::MemoryArena(size_t blockSize)
+			: m_blockSize(blockSize)
+			, m_size(0)
+			, m_capacity(0)
+			, m_pNext(nullptr)
+			, m_numRemainingBytes(0)
+	{}
+
+	size_t MemoryArena::size() const {
+		return m_size;
+	}
+
+	size_t MemoryArena::capacity() const {
+		return m_capacity;
+	}
+
+	void* MemoryArena::allocate(size_t size, size_t alignment) {
+		if (0 == alignment || 0 != (alignment & (alignment - 1)))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("alignment must be a power of two", alignment);
+
+		// worst case padding is needed when a fresh block is not aligned
+		auto maxSize = size + alignment - 1;
+		if (maxSize > m_blockSize) {
+			void* pBlock = allocateBlock(maxSize);
+			m_size += size;
+			return std::align(alignment, size, pBlock, maxSize);
+		}
+
+		void* pNext = m_pNext;
+		if (!pNext || !std::align(alignment, size, pNext, m_numRemainingBytes)) {
+			m_pNext = allocateBlock(m_blockSize);
+			m_numRemainingBytes = m_blockSize;
+			pNext = m_pNext;
+			std::align(alignment, size, pNext, m_numRemainingBytes);
+		}
+
+		m_pNext = static_cast<uint8_t*>(pNext) + size;
+		m_numRemainingBytes -= size;
+		m_size += size;
+		return pNext;
+	}
+
+	void MemoryArena::release() {
+		m_blocks.clear();
+		m_size = 0;
+		m_capacity = 0;
+		m_pNext = nullptr;
+		m_numRemainingBytes = 0;
+	}
+
+	uint8_t* MemoryArena::allocateBlock(size_t size) {
+		// block memory is intentionally not initialized
+		m_blocks.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[size]));
+		m_capacity += size;
+		return m_blocks.back().get();
+	}
+}}
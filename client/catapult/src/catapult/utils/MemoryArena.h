@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <memory>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	// region MemoryArena
+
+	/// Monotonic memory arena that carves allocations out of large blocks and releases all of them at once.
+	/// \note Individual allocations are never freed, so this is only suitable for containers that grow until they are cleared.
+	class MemoryArena : NonCopyable {
+	public:
+		/// Default size of each block.
+		static constexpr size_t Default_Block_Size = 64 * 1024;
+
+	public:
+		/// Creates an empty arena with blocks of \a blockSize bytes.
+		explicit MemoryArena(size_t blockSize = Default_Block_Size);
+
+	public:
+		/// Gets the number of bytes that have been handed out by this arena.
+		size_t size() const;
+
+		/// Gets the number of bytes reserved by all blocks owned by this arena.
+		size_t capacity() const;
+
+	public:
+		/// Allocates \a size bytes with \a alignment.
+		/// \note Allocations larger than the block size are given dedicated blocks.
+		void* allocate(size_t size, size_t alignment);
+
+		/// Releases all memory owned by this arena, invalidating all previous allocations.
+		void release();
+
+	private:
+		uint8_t* allocateBlock(size_t size);
+
+	private:
+		size_t m_blockSize;
+		size_t m_size;
+		size_t m_capacity;
+		std::vector<std::unique_ptr<uint8_t[]>> m_blocks;
+		uint8_t* m_pNext;
+		size_t m_numRemainingBytes;
+	};
+
+	// endregion
+
+	// region ArenaAllocator
+
+	/// Standard allocator adapter around a memory arena.
+	/// \note Single objects (e.g. container nodes) are allocated from the arena and are reclaimed when the arena is released.
+	///       Arrays (e.g. hash table buckets) are allocated from the global heap so that they are freed when a container grows.
+	template<typename T>
+	class ArenaAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator around \a arena.
+		explicit ArenaAllocator(MemoryArena& arena) : m_pArena(&arena)
+		{}
+
+		/// Creates an allocator around the same arena as \a allocator.
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& allocator) : m_pArena(&allocator.arena())
+		{}
+
+	public:
+		/// Gets the underlying arena.
+		MemoryArena& arena() const {
+			return *m_pArena;
+		}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			if (1 != count)
+				return std::allocator<T>().allocate(count);
+
+			return static_cast<T*>(m_pArena->allocate(sizeof(T), alignof(T)));
+		}
+
+		/// Deallocates storage for \a count objects pointed to by \a pObjects.
+		void deallocate(T* pObjects, size_t count) {
+			// single objects are reclaimed by MemoryArena::release
+			if (1 != count)
+				std::allocator<T>().deallocate(pObjects, count);
+		}
+
+	public:
+		/// Returns \c true if this allocator uses the same arena as \a rhs.
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& rhs) const {
+			return m_pArena == &rhs.arena();
+		}
+
+		/// Returns \c true if this allocator does not use the same arena as \a rhs.
+		template<typename U>
+		bool operator!=(const ArenaAllocator<U>& rhs) const {
+			return !(*this == rhs);
+		}
+
+	private:
+		MemoryArena* m_pArena;
+	};
+
+	// endregion
+}}
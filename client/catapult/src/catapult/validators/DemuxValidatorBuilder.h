@@ -20,9 +20,10 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/model/NotificationTypeDispatchTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace validators {
@@ -33,21 +34,30 @@ namespace catapult { namespace validators {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointerT<model::Notification>>;
+		using DispatchTable = model::NotificationTypeDispatchTable<const NotificationValidator*>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+	public:
+		/// Creates a builder.
+		DemuxValidatorBuilderT() = default;
+
+		/// Creates a builder that wraps all added validators with \a decorator.
+		explicit DemuxValidatorBuilderT(const NotificationValidatorDecoratorT<TArgs...>& decorator) : m_decorator(decorator)
+		{}
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
 			if constexpr (!std::is_same_v<model::Notification, TNotification>) {
-				auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-					return model::AreEqualExcludingChannel(type, notification.Type);
-				};
-				m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+				m_validators.push_back(decorate(std::make_unique<TypedValidator<TNotification>>(std::move(pValidator))));
+				m_dispatchTable.add(TNotification::Notification_Type, m_validators.back().get());
 				return *this;
 			} else {
-				m_builder.add(std::move(pValidator));
+				m_validators.push_back(decorate(std::move(pValidator)));
+				m_dispatchTable.add(m_validators.back().get());
 				return *this;
 			}
 		}
@@ -59,18 +69,23 @@ namespace catapult { namespace validators {
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			return std::make_unique<DemuxAggregateNotificationValidator>(
+					std::move(m_validators),
+					std::move(m_dispatchTable),
+					isSuppressedFailure);
 		}
 
 	private:
+		NotificationValidatorPointerT<model::Notification> decorate(NotificationValidatorPointerT<model::Notification>&& pValidator) {
+			return m_decorator ? m_decorator(std::move(pValidator)) : std::move(pValidator);
+		}
+
+	private:
+		// only invoked with notifications of type TNotification because of dispatch table lookup
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -79,18 +94,63 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		public:
+			DemuxAggregateNotificationValidator(
+					NotificationValidatorPointerVector&& validators,
+					DispatchTable&& dispatchTable,
+					const ValidationResultPredicate& isSuppressedFailure)
+					: m_validators(std::move(validators))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_isSuppressedFailure(isSuppressedFailure)
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_validators);
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				auto aggregateResult = ValidationResult::Success;
+				for (const auto* pValidator : m_dispatchTable.find(notification.Type)) {
+					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+					// ignore suppressed failures
+					if (m_isSuppressedFailure(result))
+						continue;
+
+					// exit on other failures
+					if (IsValidationResultFailure(result))
+						return result;
+
+					AggregateValidationResult(aggregateResult, result);
+				}
+
+				return aggregateResult;
+			}
+
+		private:
+			NotificationValidatorPointerVector m_validators;
+			DispatchTable m_dispatchTable;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		NotificationValidatorDecoratorT<TArgs...> m_decorator;
+		NotificationValidatorPointerVector m_validators;
+		DispatchTable m_dispatchTable;
 	};
 }}
@@ -21,16 +21,23 @@
 
 #include "ParallelValidationPolicy.h"
 #include "AggregateValidationResult.h"
+#include "StatelessValidationStatistics.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/Logging.h"
+#include "catapult/utils/SpinLock.h"
 #include <boost/asio/io_context.hpp>
 #include <algorithm>
+#include <chrono>
 
 namespace catapult { namespace validators {
 
 	namespace {
+		using Clock = std::chrono::steady_clock;
+
 		// region ShortCircuitTraits
 
 		struct ShortCircuitTraits {
@@ -42,11 +49,12 @@ namespace catapult { namespace validators {
 			{}
 
 		public:
-			bool validateEntity(const StatelessEntityValidator& validator, const model::WeakEntityInfo& entityInfo, size_t) {
+			template<typename TValidate>
+			bool validateEntity(TValidate validate, const model::WeakEntityInfo& entityInfo, size_t) {
 				if (IsValidationResultFailure(m_aggregateResult))
 					return false;
 
-				auto result = validator.validate(entityInfo);
+				auto result = validate(entityInfo);
 				AggregateValidationResult(m_aggregateResult, result);
 				return true;
 			}
@@ -72,8 +80,9 @@ namespace catapult { namespace validators {
 			{}
 
 		public:
-			bool validateEntity(const StatelessEntityValidator& validator, const model::WeakEntityInfo& entityInfo, size_t index) {
-				auto result = validator.validate(entityInfo);
+			template<typename TValidate>
+			bool validateEntity(TValidate validate, const model::WeakEntityInfo& entityInfo, size_t index) {
+				auto result = validate(entityInfo);
 				AggregateValidationResult(m_results[index], result);
 				return true;
 			}
@@ -88,12 +97,13 @@ namespace catapult { namespace validators {
 
 		// endregion
 
+		// region BasicValidationWork
+
 		template<typename TTraits>
-		class ValidationWork {
+		class BasicValidationWork {
 		public:
-			ValidationWork(const std::shared_ptr<const StatelessEntityValidator>& pValidator, const model::WeakEntityInfos& entityInfos)
-					: m_pValidator(pValidator)
-					, m_entityInfos(entityInfos)
+			explicit BasicValidationWork(const model::WeakEntityInfos& entityInfos)
+					: m_entityInfos(entityInfos)
 					, m_impl(m_entityInfos.size())
 			{}
 
@@ -111,17 +121,43 @@ namespace catapult { namespace validators {
 				m_promise.set_value(std::move(m_impl.result()));
 			}
 
-			bool validateEntity(const model::WeakEntityInfo& entityInfo, size_t index) {
-				return m_impl.validateEntity(*m_pValidator, entityInfo, index);
+		protected:
+			template<typename TValidate>
+			bool validateEntity(TValidate validate, const model::WeakEntityInfo& entityInfo, size_t index) {
+				return m_impl.validateEntity(validate, entityInfo, index);
 			}
 
 		private:
-			std::shared_ptr<const StatelessEntityValidator> m_pValidator;
 			model::WeakEntityInfos m_entityInfos;
 			thread::promise<typename TTraits::ResultType> m_promise;
 			TTraits m_impl;
 		};
 
+		// endregion
+
+		// region DefaultParallelValidationPolicy
+
+		template<typename TTraits>
+		class ValidationWork : public BasicValidationWork<TTraits> {
+		public:
+			ValidationWork(const std::shared_ptr<const StatelessEntityValidator>& pValidator, const model::WeakEntityInfos& entityInfos)
+					: BasicValidationWork<TTraits>(entityInfos)
+					, m_pValidator(pValidator)
+			{}
+
+		public:
+			bool validateEntity(const model::WeakEntityInfo& entityInfo, size_t index) {
+				const auto& validator = *m_pValidator;
+				return BasicValidationWork<TTraits>::validateEntity(
+						[&validator](const auto& info) { return validator.validate(info); },
+						entityInfo,
+						index);
+			}
+
+		private:
+			std::shared_ptr<const StatelessEntityValidator> m_pValidator;
+		};
+
 		class DefaultParallelValidationPolicy final : public ParallelValidationPolicy {
 		public:
 			DefaultParallelValidationPolicy(thread::IoThreadPool& pool, const std::shared_ptr<const StatelessEntityValidator>& pValidator)
@@ -161,6 +197,281 @@ namespace catapult { namespace validators {
 			thread::IoThreadPool& m_pool;
 			std::shared_ptr<const StatelessEntityValidator> m_pValidator;
 		};
+
+		// endregion
+
+		// region ValidationScratch
+
+		// only a fraction of entities is timed because timing every validator call is relatively expensive
+		constexpr uint64_t Timing_Sample_Interval = 16;
+
+		class ValidationScratch {
+		private:
+			using NotificationValidatorPointer = stateless::NotificationValidatorPointerT<model::Notification>;
+
+			class TimedValidator : public stateless::NotificationValidator {
+			public:
+				TimedValidator(NotificationValidatorPointer&& pValidator, ValidationScratch& scratch, size_t index)
+						: m_pValidator(std::move(pValidator))
+						, m_scratch(scratch)
+						, m_index(index)
+				{}
+
+			public:
+				const std::string& name() const override {
+					return m_pValidator->name();
+				}
+
+				ValidationResult validate(const model::Notification& notification) const override {
+					if (!m_scratch.m_isTimingEnabled)
+						return m_pValidator->validate(notification);
+
+					auto start = Clock::now();
+					auto result = m_pValidator->validate(notification);
+					m_scratch.m_validatorElapsedTimes[m_index] += Clock::now() - start;
+					return result;
+				}
+
+			private:
+				NotificationValidatorPointer m_pValidator;
+				ValidationScratch& m_scratch;
+				size_t m_index;
+			};
+
+			// similar to ValidatingNotificationSubscriber but reusable and without owning exclusion filter
+			class ReusableValidatingNotificationSubscriber : public model::NotificationSubscriber {
+			public:
+				ReusableValidatingNotificationSubscriber(
+						const stateless::NotificationValidator& validator,
+						const predicate<model::NotificationType>& exclusionFilter)
+						: m_validator(validator)
+						, m_exclusionFilter(exclusionFilter)
+						, m_result(ValidationResult::Success)
+				{}
+
+			public:
+				ValidationResult result() const {
+					return m_result;
+				}
+
+				void reset() {
+					m_result = ValidationResult::Success;
+				}
+
+			public:
+				void notify(const model::Notification& notification) override {
+					if (!IsSet(notification.Type, model::NotificationChannel::Validator))
+						return;
+
+					if (IsValidationResultFailure(m_result))
+						return;
+
+					if (m_exclusionFilter && m_exclusionFilter(notification.Type))
+						return;
+
+					auto result = m_validator.validate(notification);
+					AggregateValidationResult(m_result, result);
+				}
+
+			private:
+				const stateless::NotificationValidator& m_validator;
+				const predicate<model::NotificationType>& m_exclusionFilter;
+				ValidationResult m_result;
+			};
+
+		public:
+			ValidationScratch(
+					const StatelessNotificationValidatorFactory& validatorFactory,
+					const predicate<model::NotificationType>& exclusionFilter)
+					: m_numEntities(0)
+					, m_isTimingEnabled(false)
+					, m_pValidator(validatorFactory([this](auto&& pValidator) {
+						auto index = m_validatorElapsedTimes.size();
+						m_validatorElapsedTimes.push_back(std::chrono::nanoseconds(0));
+						return std::make_unique<TimedValidator>(std::move(pValidator), *this, index);
+					}))
+					, m_subscriber(*m_pValidator, exclusionFilter)
+			{}
+
+		public:
+			ValidationResult validate(const model::NotificationPublisher& publisher, const model::WeakEntityInfo& entityInfo) {
+				m_isTimingEnabled = 0 == m_numEntities++ % Timing_Sample_Interval;
+
+				m_subscriber.reset();
+				publisher.publish(entityInfo, m_subscriber);
+				return m_subscriber.result();
+			}
+
+			void flush(StatelessValidationStatistics& statistics) {
+				// scale sampled timings to estimate the total time spent in each validator
+				for (auto& elapsedTime : m_validatorElapsedTimes)
+					elapsedTime *= Timing_Sample_Interval;
+
+				statistics.addValidatorElapsedTimes(m_validatorElapsedTimes);
+				std::fill(m_validatorElapsedTimes.begin(), m_validatorElapsedTimes.end(), std::chrono::nanoseconds(0));
+			}
+
+		private:
+			uint64_t m_numEntities;
+			bool m_isTimingEnabled;
+			std::vector<std::chrono::nanoseconds> m_validatorElapsedTimes;
+			std::unique_ptr<const stateless::AggregateNotificationValidator> m_pValidator;
+			ReusableValidatingNotificationSubscriber m_subscriber;
+		};
+
+		// endregion
+
+		// region ValidationEngine
+
+		class ValidationEngine {
+		public:
+			ValidationEngine(
+					const StatelessNotificationValidatorFactory& validatorFactory,
+					std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+					const predicate<model::NotificationType>& exclusionFilter,
+					const std::shared_ptr<StatelessValidationStatistics>& pStatistics,
+					size_t numWorkerThreads)
+					: m_validatorFactory(validatorFactory)
+					, m_pPublisher(std::move(pPublisher))
+					, m_exclusionFilter(exclusionFilter)
+					, m_pStatistics(pStatistics) {
+				// create one scratch per worker upfront so that validators are not created during validation
+				for (auto i = 0u; i < numWorkerThreads; ++i)
+					m_scratches.push_back(std::make_unique<ValidationScratch>(m_validatorFactory, m_exclusionFilter));
+			}
+
+		public:
+			const model::NotificationPublisher& publisher() const {
+				return *m_pPublisher;
+			}
+
+			StatelessValidationStatistics& statistics() const {
+				return *m_pStatistics;
+			}
+
+		public:
+			std::unique_ptr<ValidationScratch> acquireScratch() {
+				{
+					utils::SpinLockGuard guard(m_lock);
+					if (!m_scratches.empty()) {
+						auto pScratch = std::move(m_scratches.back());
+						m_scratches.pop_back();
+						return pScratch;
+					}
+				}
+
+				// additional scratch is only created when multiple batches are validated concurrently
+				return std::make_unique<ValidationScratch>(m_validatorFactory, m_exclusionFilter);
+			}
+
+			void releaseScratch(std::unique_ptr<ValidationScratch>&& pScratch) {
+				pScratch->flush(*m_pStatistics);
+
+				utils::SpinLockGuard guard(m_lock);
+				m_scratches.push_back(std::move(pScratch));
+			}
+
+		private:
+			StatelessNotificationValidatorFactory m_validatorFactory;
+			std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+			predicate<model::NotificationType> m_exclusionFilter;
+			std::shared_ptr<StatelessValidationStatistics> m_pStatistics;
+
+			std::vector<std::unique_ptr<ValidationScratch>> m_scratches;
+			utils::SpinLock m_lock;
+		};
+
+		// endregion
+
+		// region ScratchParallelValidationPolicy
+
+		template<typename TTraits>
+		class ScratchValidationWork : public BasicValidationWork<TTraits> {
+		public:
+			ScratchValidationWork(const std::shared_ptr<ValidationEngine>& pEngine, const model::WeakEntityInfos& entityInfos)
+					: BasicValidationWork<TTraits>(entityInfos)
+					, m_pEngine(pEngine)
+					, m_numValidatedEntities(0)
+					, m_startTime(Clock::now())
+			{}
+
+		public:
+			template<typename TIterator>
+			void validatePartition(TIterator itBegin, TIterator itEnd, size_t startIndex) {
+				auto pScratch = m_pEngine->acquireScratch();
+				auto& scratch = *pScratch;
+				const auto& publisher = m_pEngine->publisher();
+				auto validate = [&scratch, &publisher](const auto& entityInfo) {
+					return scratch.validate(publisher, entityInfo);
+				};
+
+				auto index = startIndex;
+				for (auto iter = itBegin; itEnd != iter; ++iter, ++index) {
+					if (!this->validateEntity(validate, *iter, index))
+						break;
+
+					++m_numValidatedEntities;
+				}
+
+				m_pEngine->releaseScratch(std::move(pScratch));
+			}
+
+			void complete() {
+				m_pEngine->statistics().addBatch(m_numValidatedEntities, Clock::now() - m_startTime);
+				BasicValidationWork<TTraits>::complete();
+			}
+
+		private:
+			std::shared_ptr<ValidationEngine> m_pEngine;
+			std::atomic<size_t> m_numValidatedEntities;
+			Clock::time_point m_startTime;
+		};
+
+		class ScratchParallelValidationPolicy final : public ParallelValidationPolicy {
+		public:
+			ScratchParallelValidationPolicy(thread::IoThreadPool& pool, const std::shared_ptr<ValidationEngine>& pEngine)
+					: m_pool(pool)
+					, m_pEngine(pEngine) {
+				CATAPULT_LOG(trace) << "ScratchParallelValidationPolicy created with " << m_pool.numWorkerThreads() << " worker threads";
+			}
+
+		private:
+			template<typename TTraits>
+			auto validateT(const model::WeakEntityInfos& entityInfos) const {
+				auto pWork = std::make_shared<ScratchValidationWork<TTraits>>(m_pEngine, entityInfos);
+
+				auto workProcessPartitionCallback = [pWork](auto itBegin, auto itEnd, auto startIndex, auto) {
+					pWork->validatePartition(itBegin, itEnd, startIndex);
+				};
+				auto workCompleteCallback = [pWork](const auto&) {
+					pWork->complete();
+					return pWork->future();
+				};
+
+				return thread::compose(
+						thread::ParallelForPartition(
+								m_pool.ioContext(),
+								pWork->entityInfos(),
+								m_pool.numWorkerThreads(),
+								workProcessPartitionCallback),
+						workCompleteCallback);
+			}
+
+		public:
+			thread::future<ValidationResult> validateShortCircuit(const model::WeakEntityInfos& entityInfos) const override {
+				return validateT<ShortCircuitTraits>(entityInfos);
+			}
+
+			thread::future<std::vector<ValidationResult>> validateAll(const model::WeakEntityInfos& entityInfos) const override {
+				return validateT<AllTraits>(entityInfos);
+			}
+
+		private:
+			thread::IoThreadPool& m_pool;
+			std::shared_ptr<ValidationEngine> m_pEngine;
+		};
+
+		// endregion
 	}
 
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
@@ -168,4 +479,19 @@ namespace catapult { namespace validators {
 			const std::shared_ptr<const StatelessEntityValidator>& pValidator) {
 		return std::make_shared<const DefaultParallelValidationPolicy>(pool, pValidator);
 	}
+
+	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
+			thread::IoThreadPool& pool,
+			const StatelessNotificationValidatorFactory& validatorFactory,
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			const predicate<model::NotificationType>& exclusionFilter,
+			const std::shared_ptr<StatelessValidationStatistics>& pStatistics) {
+		auto pEngine = std::make_shared<ValidationEngine>(
+				validatorFactory,
+				std::move(pPublisher),
+				exclusionFilter,
+				pStatistics,
+				pool.numWorkerThreads());
+		return std::make_shared<const ScratchParallelValidationPolicy>(pool, pEngine);
+	}
 }}
@@ -23,7 +23,11 @@
 #include "ValidatorTypes.h"
 #include "catapult/thread/Future.h"
 
-namespace catapult { namespace thread { class IoThreadPool; } }
+namespace catapult {
+	namespace model { class NotificationPublisher; }
+	namespace thread { class IoThreadPool; }
+	namespace validators { class StatelessValidationStatistics; }
+}
 
 namespace catapult { namespace validators {
 
@@ -44,4 +48,18 @@ namespace catapult { namespace validators {
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
 			thread::IoThreadPool& pool,
 			const std::shared_ptr<const StatelessEntityValidator>& pValidator);
+
+	/// Factory for creating a stateless notification validator that wraps all sub validators with a decorator.
+	using StatelessNotificationValidatorFactory = std::function<
+		std::unique_ptr<const stateless::AggregateNotificationValidator> (const stateless::NotificationValidatorDecorator&)>;
+
+	/// Creates a parallel validation policy using \a pool for parallelization that validates all notifications published by
+	/// \a pPublisher, except notifications matching \a exclusionFilter, with validators created by \a validatorFactory.
+	/// Each worker reuses its own validator and scratch state across batches and adds its timings to \a pStatistics.
+	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
+			thread::IoThreadPool& pool,
+			const StatelessNotificationValidatorFactory& validatorFactory,
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			const predicate<model::NotificationType>& exclusionFilter,
+			const std::shared_ptr<StatelessValidationStatistics>& pStatistics);
 }}
@@ -0,0 +1,70 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationValidator.h"
+#include "catapult/utils/ExecutionProfile.h"
+#include <memory>
+
+namespace catapult { namespace validators {
+
+	/// Notification validator decorator that records the call count and elapsed time of every validation in a profile entry.
+	template<typename... TArgs>
+	class ProfilingNotificationValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+	private:
+		using Clock = std::chrono::steady_clock;
+		using NotificationValidatorPointer = std::unique_ptr<const NotificationValidatorT<model::Notification, TArgs...>>;
+
+	public:
+		/// Creates a decorator around \a pValidator that records into \a entry.
+		ProfilingNotificationValidator(NotificationValidatorPointer&& pValidator, utils::ExecutionProfile::Entry& entry)
+				: m_pValidator(std::move(pValidator))
+				, m_entry(entry)
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_pValidator->name();
+		}
+
+		ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+			auto start = Clock::now();
+			auto result = m_pValidator->validate(notification, std::forward<TArgs>(args)...);
+			m_entry.record(Clock::now() - start);
+			return result;
+		}
+
+	private:
+		NotificationValidatorPointer m_pValidator;
+		utils::ExecutionProfile::Entry& m_entry;
+	};
+
+	/// Creates a validator decorator that wraps validators in profiling validators recording into \a profile.
+	/// \note Profile entry names are composed of \a namePrefix and validator names.
+	template<typename... TArgs>
+	auto CreateProfilingValidatorDecorator(utils::ExecutionProfile& profile, const std::string& namePrefix) {
+		using NotificationValidatorPointer = std::unique_ptr<const NotificationValidatorT<model::Notification, TArgs...>>;
+		return [&profile, namePrefix](NotificationValidatorPointer&& pValidator) -> NotificationValidatorPointer {
+			auto& entry = profile.entry(namePrefix + pValidator->name());
+			return std::make_unique<ProfilingNotificationValidator<TArgs...>>(std::move(pValidator), entry);
+		};
+	}
+}}
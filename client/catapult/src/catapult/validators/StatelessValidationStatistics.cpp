@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StatelessValidationStatistics.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace validators {
+
+	StatelessValidationStatistics::StatelessValidationStatistics(const std::vector<std::string>& validatorNames)
+			: m_validatorNames(validatorNames)
+			, m_numEntities(0)
+			, m_elapsedNanoseconds(0)
+			, m_validatorElapsedTimes(validatorNames.size())
+	{}
+
+	const std::vector<std::string>& StatelessValidationStatistics::validatorNames() const {
+		return m_validatorNames;
+	}
+
+	uint64_t StatelessValidationStatistics::numEntities() const {
+		return m_numEntities;
+	}
+
+	std::chrono::microseconds StatelessValidationStatistics::elapsedTime() const {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(m_elapsedNanoseconds));
+	}
+
+	uint64_t StatelessValidationStatistics::entitiesPerSecond() const {
+		auto elapsedNanoseconds = m_elapsedNanoseconds.load();
+		auto numEntities = m_numEntities.load();
+		if (0 == elapsedNanoseconds)
+			return 0;
+
+		return static_cast<uint64_t>(static_cast<double>(numEntities) * 1'000'000'000 / static_cast<double>(elapsedNanoseconds));
+	}
+
+	std::vector<StatelessValidationStatistics::ValidatorElapsedTime> StatelessValidationStatistics::validatorElapsedTimes() const {
+		std::vector<ValidatorElapsedTime> validatorElapsedTimes;
+		{
+			utils::SpinLockGuard guard(m_validatorElapsedTimesLock);
+			for (auto i = 0u; i < m_validatorNames.size(); ++i) {
+				auto elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(m_validatorElapsedTimes[i]);
+				validatorElapsedTimes.push_back(ValidatorElapsedTime{ m_validatorNames[i], elapsedTime });
+			}
+		}
+
+		std::stable_sort(validatorElapsedTimes.begin(), validatorElapsedTimes.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.ElapsedTime > rhs.ElapsedTime;
+		});
+		return validatorElapsedTimes;
+	}
+
+	void StatelessValidationStatistics::addBatch(size_t numEntities, std::chrono::nanoseconds elapsedTime) {
+		m_elapsedNanoseconds += static_cast<uint64_t>(elapsedTime.count());
+		m_numEntities += numEntities;
+	}
+
+	void StatelessValidationStatistics::addValidatorElapsedTimes(const std::vector<std::chrono::nanoseconds>& validatorElapsedTimes) {
+		if (m_validatorElapsedTimes.size() != validatorElapsedTimes.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("validator elapsed times has wrong size", validatorElapsedTimes.size());
+
+		utils::SpinLockGuard guard(m_validatorElapsedTimesLock);
+		for (auto i = 0u; i < m_validatorElapsedTimes.size(); ++i)
+			m_validatorElapsedTimes[i] += validatorElapsedTimes[i];
+	}
+}}
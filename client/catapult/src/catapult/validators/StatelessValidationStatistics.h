@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/SpinLock.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace validators {
+
+	/// Name of the service holding the statistics collected during parallel stateless validation.
+	constexpr auto Stateless_Validation_Statistics_Service_Name = "dispatcher.statelessValidation";
+
+	/// Statistics collected during parallel stateless validation.
+	class StatelessValidationStatistics {
+	public:
+		/// Elapsed time of a single (named) validator.
+		struct ValidatorElapsedTime {
+			/// Validator name.
+			std::string Name;
+
+			/// Estimated cumulative time spent in validator.
+			std::chrono::microseconds ElapsedTime;
+		};
+
+	public:
+		/// Creates statistics for validators with \a validatorNames.
+		explicit StatelessValidationStatistics(const std::vector<std::string>& validatorNames);
+
+	public:
+		/// Gets the names of all tracked validators.
+		const std::vector<std::string>& validatorNames() const;
+
+		/// Gets the total number of validated entities.
+		uint64_t numEntities() const;
+
+		/// Gets the total (wall clock) time spent validating entities.
+		std::chrono::microseconds elapsedTime() const;
+
+		/// Gets the average number of entities validated per second.
+		uint64_t entitiesPerSecond() const;
+
+		/// Gets the elapsed times of all tracked validators sorted by decreasing elapsed time.
+		std::vector<ValidatorElapsedTime> validatorElapsedTimes() const;
+
+	public:
+		/// Adds a batch of \a numEntities entities that were validated in \a elapsedTime.
+		void addBatch(size_t numEntities, std::chrono::nanoseconds elapsedTime);
+
+		/// Adds \a validatorElapsedTimes to the elapsed times of all tracked validators.
+		/// \note \a validatorElapsedTimes must be ordered in the same way as validatorNames.
+		void addValidatorElapsedTimes(const std::vector<std::chrono::nanoseconds>& validatorElapsedTimes);
+
+	private:
+		std::vector<std::string> m_validatorNames;
+		std::atomic<uint64_t> m_numEntities;
+		std::atomic<uint64_t> m_elapsedNanoseconds;
+
+		std::vector<std::chrono::nanoseconds> m_validatorElapsedTimes;
+		mutable utils::SpinLock m_validatorElapsedTimesLock;
+	};
+}}
@@ -39,6 +39,11 @@ namespace catapult { namespace validators {
 	/// Validation result predicate.
 	using ValidationResultPredicate = predicate<ValidationResult>;
 
+	/// Function that wraps a validator with another validator.
+	template<typename... TArgs>
+	using NotificationValidatorDecoratorT = std::function<std::unique_ptr<const NotificationValidatorT<model::Notification, TArgs...>> (
+			std::unique_ptr<const NotificationValidatorT<model::Notification, TArgs...>>&&)>;
+
 	namespace stateless {
 		template<typename TNotification>
 		using NotificationValidatorT = catapult::validators::NotificationValidatorT<TNotification>;
@@ -52,6 +57,7 @@ namespace catapult { namespace validators {
 
 		using AggregateNotificationValidator = AggregateNotificationValidatorT<model::Notification>;
 		using DemuxValidatorBuilder = DemuxValidatorBuilderT<>;
+		using NotificationValidatorDecorator = NotificationValidatorDecoratorT<>;
 	}
 
 	namespace stateful {
@@ -68,6 +74,7 @@ namespace catapult { namespace validators {
 
 		using AggregateNotificationValidator = AggregateNotificationValidatorT<model::Notification, const ValidatorContext&>;
 		using DemuxValidatorBuilder = DemuxValidatorBuilderT<const ValidatorContext&>;
+		using NotificationValidatorDecorator = NotificationValidatorDecoratorT<const ValidatorContext&>;
 	}
 
 /// Declares a stateless validator with \a NAME for notifications of type \a NOTIFICATION_TYPE.
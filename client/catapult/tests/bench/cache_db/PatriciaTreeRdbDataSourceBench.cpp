@@ -0,0 +1,215 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/tree/BasePatriciaTree.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Num_Leaves = 2'000'000u;
+		constexpr auto Num_Leaves_Per_Seed_Block = 100'000u;
+		constexpr auto Num_Updates_Per_Block = 1'000u;
+
+		// region utils
+
+		class HashKeyEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using TreeType = tree::BasePatriciaTree<HashKeyEncoder, PatriciaTreeRdbDataSource, utils::ArrayHasher<Hash256>>;
+
+		auto CreateSettings(const std::string& directory, size_t maxNodeCacheSize) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			config.PatriciaTreeNodeCacheSize = static_cast<uint32_t>(maxNodeCacheSize);
+			return RocksDatabaseSettings(directory, config, { "default" }, FilterPruningMode::Disabled);
+		}
+
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		void ApplyAndCommit(TreeType& tree, const std::vector<Hash256>& keys, const std::vector<Hash256>& values) {
+			std::vector<TreeType::DeltaType::Modification> modifications;
+			for (auto i = 0u; i < keys.size(); ++i)
+				modifications.push_back({ &keys[i], &values[i] });
+
+			auto pDelta = tree.rebase();
+			pDelta->apply(modifications);
+			benchmark::DoNotOptimize(pDelta->root());
+			tree.commit();
+		}
+
+		// endregion
+
+		// region database
+
+		class TreeDatabase {
+		public:
+			TreeDatabase(const std::string& directory, size_t maxNodeCacheSize)
+					: m_database(CreateSettings(directory, maxNodeCacheSize))
+					, m_container(m_database, 0)
+					, m_dataSource(m_container, m_database.databaseConfig().PatriciaTreeNodeCacheSize)
+					, m_tree(m_dataSource)
+			{}
+
+			TreeDatabase(const std::string& directory, size_t maxNodeCacheSize, const Hash256& rootHash)
+					: m_database(CreateSettings(directory, maxNodeCacheSize))
+					, m_container(m_database, 0)
+					, m_dataSource(m_container, m_database.databaseConfig().PatriciaTreeNodeCacheSize)
+					, m_tree(m_dataSource, rootHash)
+			{}
+
+		public:
+			const PatriciaTreeRdbDataSource& dataSource() const {
+				return m_dataSource;
+			}
+
+			TreeType& tree() {
+				return m_tree;
+			}
+
+		public:
+			void flush() {
+				m_database.flush();
+			}
+
+		private:
+			RocksDatabase m_database;
+			PatriciaTreeContainer m_container;
+			PatriciaTreeRdbDataSource m_dataSource;
+			TreeType m_tree;
+		};
+
+		class DatabaseDirectory {
+		public:
+			DatabaseDirectory()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.catapult.cache_db." + std::to_string(bench::Random())))
+					, m_keys(GenerateRandomHashes(Num_Leaves)) {
+				TreeDatabase database(name(), 0);
+				for (auto i = 0u; i < Num_Leaves; i += Num_Leaves_Per_Seed_Block) {
+					auto blockKeys = std::vector<Hash256>(m_keys.cbegin() + i, m_keys.cbegin() + i + Num_Leaves_Per_Seed_Block);
+					ApplyAndCommit(database.tree(), blockKeys, blockKeys);
+					database.flush();
+				}
+
+				m_rootHash = database.tree().root();
+			}
+
+			~DatabaseDirectory() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string name() const {
+				return m_directory.generic_string();
+			}
+
+			const Hash256& rootHash() const {
+				return m_rootHash;
+			}
+
+			std::vector<Hash256> sampleKeys(size_t count) const {
+				std::vector<Hash256> keys;
+				for (auto i = 0u; i < count; ++i)
+					keys.push_back(m_keys[bench::Random() % m_keys.size()]);
+
+				return keys;
+			}
+
+		private:
+			std::filesystem::path m_directory;
+			std::vector<Hash256> m_keys;
+			Hash256 m_rootHash;
+		};
+
+		const DatabaseDirectory& GetDatabaseDirectory() {
+			// seeding millions of leaves is slow, so share a single database across all benchmarks
+			static DatabaseDirectory directory;
+			return directory;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkUpdateMerkleRoot(benchmark::State& state) {
+			auto maxNodeCacheSize = static_cast<size_t>(state.range(0));
+
+			// each benchmark modifies the shared tree, so start from the (committed) root of the previous one
+			const auto& directory = GetDatabaseDirectory();
+			static auto rootHash = directory.rootHash();
+			TreeDatabase database(directory.name(), maxNodeCacheSize, rootHash);
+
+			// each iteration simulates a block that modifies random existing leaves, calculates the state hash and commits
+			auto values = GenerateRandomHashes(Num_Updates_Per_Block);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = directory.sampleKeys(Num_Updates_Per_Block);
+				state.ResumeTiming();
+
+				ApplyAndCommit(database.tree(), keys, values);
+				database.flush();
+			}
+
+			rootHash = database.tree().root();
+
+			auto statistics = database.dataSource().nodeCacheStatistics();
+			state.counters["hits"] = static_cast<double>(statistics.NumHits);
+			state.counters["misses"] = static_cast<double>(statistics.NumMisses);
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Updates_Per_Block * state.iterations()));
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+
+	benchmark::RegisterBenchmark("BenchmarkUpdateMerkleRoot", BenchmarkUpdateMerkleRoot)
+			->ArgNames({ "cache" })
+			->Arg(0)
+			->Arg(50'000)
+			->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,164 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Num_Accounts = 2'000'000u;
+		constexpr auto Account_State_Size = 128u;
+
+		// region database
+
+		auto CreateSettings(const std::string& directory) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			return RocksDatabaseSettings(directory, config, { "default" }, FilterPruningMode::Disabled);
+		}
+
+		rocksdb::Slice ToSlice(const Address& address) {
+			return rocksdb::Slice(reinterpret_cast<const char*>(address.data()), address.size());
+		}
+
+		class DatabaseDirectory {
+		public:
+			DatabaseDirectory()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.catapult.cache_db." + std::to_string(bench::Random()))) {
+				RocksDatabase database(CreateSettings(name()));
+
+				std::string accountState(Account_State_Size, 0);
+				m_addresses.resize(Num_Accounts);
+				for (auto& address : m_addresses) {
+					bench::FillWithRandomData(address);
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(accountState.data()), accountState.size() });
+					database.put(0, ToSlice(address), accountState);
+				}
+
+				database.flush();
+			}
+
+			~DatabaseDirectory() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string name() const {
+				return m_directory.generic_string();
+			}
+
+			std::vector<Address> sampleAddresses(size_t count) const {
+				std::vector<Address> addresses;
+				for (auto i = 0u; i < count; ++i)
+					addresses.push_back(m_addresses[bench::Random() % m_addresses.size()]);
+
+				return addresses;
+			}
+
+		private:
+			std::filesystem::path m_directory;
+			std::vector<Address> m_addresses;
+		};
+
+		const DatabaseDirectory& GetDatabaseDirectory() {
+			// seeding millions of accounts is slow, so share a single database across all benchmarks
+			static DatabaseDirectory directory;
+			return directory;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		enum class CacheState { Warm, Cold };
+
+		template<typename TLookup>
+		void RunBenchmark(benchmark::State& state, TLookup lookup) {
+			auto numKeys = static_cast<size_t>(state.range(0));
+			auto cacheState = static_cast<CacheState>(state.range(1));
+
+			// lookup random accounts like the ones touched by a single block
+			const auto& directory = GetDatabaseDirectory();
+			auto addresses = directory.sampleAddresses(numKeys);
+
+			std::vector<rocksdb::Slice> keys;
+			for (const auto& address : addresses)
+				keys.push_back(ToSlice(address));
+
+			auto pDatabase = std::make_unique<RocksDatabase>(CreateSettings(directory.name()));
+			if (CacheState::Warm == cacheState)
+				lookup(*pDatabase, keys);
+
+			for (auto _ : state) {
+				if (CacheState::Cold == cacheState) {
+					// reopen the database in order to drop its block cache (the os page cache is not dropped)
+					state.PauseTiming();
+					pDatabase.reset();
+					pDatabase = std::make_unique<RocksDatabase>(CreateSettings(directory.name()));
+					state.ResumeTiming();
+				}
+
+				lookup(*pDatabase, keys);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numKeys * state.iterations()));
+		}
+
+		void BenchmarkGet(benchmark::State& state) {
+			RunBenchmark(state, [](auto& database, const auto& keys) {
+				for (const auto& key : keys) {
+					RdbDataIterator iter;
+					database.get(0, key, iter);
+					benchmark::DoNotOptimize(iter.buffer());
+				}
+			});
+		}
+
+		void BenchmarkMultiGet(benchmark::State& state) {
+			RunBenchmark(state, [](auto& database, const auto& keys) {
+				std::vector<RdbDataIterator> iters;
+				database.multiGet(0, keys, iters);
+				benchmark::DoNotOptimize(iters.data());
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "keys", "cold" })
+				->ArgsProduct({ { 100, 1'000, 10'000 }, { 0, 1 } })
+				->Unit(benchmark::kMicrosecond);
+	};
+
+	registerBenchmark("BenchmarkGet", BenchmarkGet);
+	registerBenchmark("BenchmarkMultiGet", BenchmarkMultiGet);
+}
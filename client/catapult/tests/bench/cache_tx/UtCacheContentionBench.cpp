@@ -0,0 +1,135 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Num_Seed_Transactions = 50'000u;
+		constexpr auto Num_Writer_Transactions = 1'000u;
+		constexpr auto Num_Selected_Transactions = 100u;
+		constexpr auto Transaction_Size = static_cast<uint32_t>(sizeof(model::Transaction));
+
+		// region MixedLoadContext
+
+		model::TransactionInfo CreateTransactionInfo() {
+			auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(Transaction_Size);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+			pTransaction->Size = Transaction_Size;
+			pTransaction->MaxFee = Amount(Transaction_Size * (bench::Random() % 1'000));
+
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			bench::FillWithRandomData(transactionInfo.EntityHash);
+			return transactionInfo;
+		}
+
+		class MixedLoadContext {
+		public:
+			explicit MixedLoadContext(uint32_t numShards)
+					: m_cache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1024), numShards)) {
+				auto modifier = m_cache.modifier();
+				for (auto i = 0u; i < Num_Seed_Transactions; ++i) {
+					auto transactionInfo = CreateTransactionInfo();
+					m_seedHashes.push_back(transactionInfo.EntityHash);
+					modifier.add(transactionInfo);
+				}
+
+				for (auto i = 0u; i < Num_Writer_Transactions; ++i)
+					m_writerTransactionInfos.push_back(CreateTransactionInfo());
+			}
+
+		public:
+			// simulates tx dispatcher adding a new transaction and block dispatcher removing it
+			void write(size_t index) {
+				const auto& transactionInfo = m_writerTransactionInfos[index % Num_Writer_Transactions];
+				auto modifier = m_cache.modifier();
+				modifier.add(transactionInfo);
+				modifier.remove(transactionInfo.EntityHash);
+			}
+
+			// simulates hash lookup followed by harvester selection of best transactions
+			void read(size_t index) const {
+				auto view = m_cache.view();
+				benchmark::DoNotOptimize(view.contains(m_seedHashes[index % Num_Seed_Transactions]));
+
+				auto numSelected = 0u;
+				view.forEachByDescendingFeeMultiplier([&numSelected](const auto& transactionInfo) {
+					benchmark::DoNotOptimize(transactionInfo.pEntity.get());
+					return Num_Selected_Transactions != ++numSelected;
+				});
+			}
+
+		private:
+			MemoryUtCache m_cache;
+			std::vector<Hash256> m_seedHashes;
+			std::vector<model::TransactionInfo> m_writerTransactionInfos;
+		};
+
+		// context is shared by all benchmark threads and replaced by first thread before each run
+		std::unique_ptr<MixedLoadContext> g_pContext;
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkMixedLoad(benchmark::State& state) {
+			if (0 == state.thread_index())
+				g_pContext = std::make_unique<MixedLoadContext>(static_cast<uint32_t>(state.range(0)));
+
+			// first thread writes, all other threads read
+			auto isWriter = 0 == state.thread_index();
+			size_t index = static_cast<size_t>(state.thread_index()) * Num_Seed_Transactions / 16;
+			for (auto _ : state) {
+				if (isWriter)
+					g_pContext->write(index++);
+				else
+					g_pContext->read(index++);
+			}
+
+			auto numIterations = static_cast<double>(state.iterations());
+			state.counters["writes"] = benchmark::Counter(isWriter ? numIterations : 0, benchmark::Counter::kIsRate);
+			state.counters["reads"] = benchmark::Counter(isWriter ? 0 : numIterations, benchmark::Counter::kIsRate);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+
+	benchmark::RegisterBenchmark("BenchmarkMixedLoad", BenchmarkMixedLoad)
+			->ArgNames({ "shards" })
+			->Arg(1)
+			->Arg(4)
+			->Arg(16)
+			->UseRealTime()
+			->Threads(2)
+			->Threads(4)
+			->Threads(8)
+			->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,136 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCacheUtils.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/model/FeeUtils.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Transaction_Limit = 6'000u;
+		constexpr auto Transaction_Size = static_cast<uint32_t>(sizeof(model::Transaction));
+
+		// region utils
+
+		model::TransactionInfo CreateTransactionInfo() {
+			auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(Transaction_Size);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+			pTransaction->Size = Transaction_Size;
+			pTransaction->MaxFee = Amount(Transaction_Size * (bench::Random() % 1'000));
+
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			bench::FillWithRandomData(transactionInfo.EntityHash);
+			return transactionInfo;
+		}
+
+		std::unique_ptr<MemoryUtCache> CreateUtCache(size_t numTransactions) {
+			auto cacheOptions = MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1024));
+			auto pUtCache = std::make_unique<MemoryUtCache>(cacheOptions);
+
+			auto modifier = pUtCache->modifier();
+			for (auto i = 0u; i < numTransactions; ++i)
+				modifier.add(CreateTransactionInfo());
+
+			return pUtCache;
+		}
+
+		uint32_t CountAsOne(const model::Transaction&) {
+			return 1;
+		}
+
+		bool SelectAllFilter(const model::TransactionInfo&) {
+			return true;
+		}
+
+		template<typename TSelect>
+		void RunSelectionBenchmark(benchmark::State& state, TSelect select) {
+			auto pUtCache = CreateUtCache(static_cast<size_t>(state.range(0)));
+			auto order = static_cast<FeeMultiplierOrder>(state.range(1));
+
+			for (auto _ : state) {
+				auto utCacheView = pUtCache->view();
+				auto candidates = select(utCacheView, order);
+				benchmark::DoNotOptimize(candidates.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Transaction_Limit * state.iterations()));
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		// selects candidates by sorting all transaction infos, which is what harvesting did before the fee multiplier index
+		auto SelectSorted(const MemoryUtCacheView& utCacheView, FeeMultiplierOrder order) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			transactionInfoPointers.reserve(utCacheView.size());
+			utCacheView.forEach([&transactionInfoPointers](const auto& transactionInfo) {
+				transactionInfoPointers.push_back(&transactionInfo);
+				return true;
+			});
+
+			auto isAscending = FeeMultiplierOrder::Ascending == order;
+			std::stable_sort(transactionInfoPointers.begin(), transactionInfoPointers.end(), [isAscending](
+					const auto* pLhs,
+					const auto* pRhs) {
+				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
+				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
+				return isAscending ? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier : lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
+			});
+
+			transactionInfoPointers.resize(std::min<size_t>(transactionInfoPointers.size(), Transaction_Limit));
+			return transactionInfoPointers;
+		}
+
+		void BenchmarkSortedSelection(benchmark::State& state) {
+			RunSelectionBenchmark(state, SelectSorted);
+		}
+
+		void BenchmarkIndexedSelection(benchmark::State& state) {
+			RunSelectionBenchmark(state, [](const auto& utCacheView, auto order) {
+				return GetFirstTransactionInfoPointers(utCacheView, Transaction_Limit, CountAsOne, order, SelectAllFilter);
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+
+	// orders: 0 = ascending (minimize fee), 1 = descending (maximize fee)
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "uts", "order" })
+				->ArgsProduct({ { 10'000, 100'000, 500'000 }, { 0, 1 } })
+				->Unit(benchmark::kMicrosecond);
+	};
+
+	registerBenchmark("BenchmarkSortedSelection", BenchmarkSortedSelection);
+	registerBenchmark("BenchmarkIndexedSelection", BenchmarkIndexedSelection);
+}
@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/RecentHashCache.h"
+#include "catapult/utils/SpinLock.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		constexpr auto Num_Hashes = 1u << 20;
+		constexpr auto Options = HashCheckOptions(600'000, 60'000, 10'000'000);
+
+		// region caches
+
+		// recent hash cache guarded by a spin lock, which was used to share a recent hash cache across threads
+		class SpinLockedRecentHashCache {
+		public:
+			SpinLockedRecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options)
+					: m_recentHashCache(timeSupplier, options)
+			{}
+
+		public:
+			bool add(const Hash256& hash) {
+				utils::SpinLockGuard guard(m_lock);
+				return m_recentHashCache.add(hash);
+			}
+
+		private:
+			RecentHashCache m_recentHashCache;
+			utils::SpinLock m_lock;
+		};
+
+		// endregion
+
+		// region context
+
+		template<typename TCache>
+		class HashCheckContext {
+		public:
+			HashCheckContext()
+					: m_time(1)
+					, m_cache([&time = m_time]() { return Timestamp(time.load()); }, Options)
+					, m_hashes(Num_Hashes) {
+				for (auto& hash : m_hashes)
+					bench::FillWithRandomData(hash);
+
+				// seed the cache with half of the hashes so that lookups are a mix of known and unknown hashes
+				for (auto i = 0u; i < Num_Hashes; i += 2)
+					m_cache.add(m_hashes[i]);
+			}
+
+		public:
+			bool add(size_t index) {
+				// advance time regularly so that pruning is part of the measured work
+				if (0 == index % 1024)
+					m_time += 1'000;
+
+				return m_cache.add(m_hashes[index % Num_Hashes]);
+			}
+
+		private:
+			std::atomic<uint64_t> m_time;
+			TCache m_cache;
+			std::vector<Hash256> m_hashes;
+		};
+
+		// context is shared by all benchmark threads and replaced by first thread before each run
+		template<typename TCache>
+		std::unique_ptr<HashCheckContext<TCache>> g_pContext;
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TCache>
+		void BenchmarkAdd(benchmark::State& state) {
+			if (0 == state.thread_index())
+				g_pContext<TCache> = std::make_unique<HashCheckContext<TCache>>();
+
+			auto index = static_cast<size_t>(state.thread_index()) * Num_Hashes / 16;
+			for (auto _ : state)
+				benchmark::DoNotOptimize(g_pContext<TCache>->add(index++));
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::consumers;
+
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->UseRealTime()
+				->Threads(1)
+				->Threads(2)
+				->Threads(4)
+				->Threads(8)
+				->Unit(benchmark::kNanosecond);
+	};
+
+	registerBenchmark("BenchmarkAddSpinLocked", BenchmarkAdd<SpinLockedRecentHashCache>);
+	registerBenchmark("BenchmarkAddLockFree", BenchmarkAdd<SynchronizedRecentHashCache>);
+}
@@ -90,6 +90,52 @@ namespace catapult { namespace crypto {
 			if (0 != numFailures)
 				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
 		}
+
+		// region capture
+
+		// signature input as captured before inline buffers were introduced
+		struct VectorSignatureInput {
+			const Key& PublicKey;
+			std::vector<RawBuffer> Buffers;
+			const catapult::Signature& Signature;
+		};
+
+		struct VectorCaptureTraits {
+			using SignatureInputType = VectorSignatureInput;
+			using BuffersType = std::vector<RawBuffer>;
+		};
+
+		struct InlineCaptureTraits {
+			using SignatureInputType = SignatureInput;
+			using BuffersType = SignatureInputBuffers;
+		};
+
+		template<typename TTraits>
+		void BenchmarkCaptureSignatureInputs(benchmark::State& state) {
+			// capture mirrors BatchSignatureConsumer: each input references generation hash seed and transaction data
+			auto numTransactions = static_cast<size_t>(state.range(0));
+			auto generationHashSeed = GenerationHashSeed();
+			auto publicKey = Key();
+			auto signature = catapult::Signature();
+			std::vector<uint8_t> buffer(Data_Size);
+
+			for (auto _ : state) {
+				std::vector<typename TTraits::SignatureInputType> inputs;
+				inputs.reserve(numTransactions);
+				for (auto i = 0u; i < numTransactions; ++i) {
+					typename TTraits::BuffersType buffers;
+					buffers.push_back(generationHashSeed);
+					buffers.push_back(buffer);
+					inputs.push_back({ publicKey, buffers, signature });
+				}
+
+				benchmark::DoNotOptimize(inputs.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numTransactions * state.iterations()));
+		}
+
+		// endregion
 	}
 }}
 
@@ -108,4 +154,13 @@ void RegisterTests() {
 			->Threads(2)
 			->Threads(4)
 			->Threads(8);
+
+	using namespace catapult::crypto;
+	benchmark::RegisterBenchmark("BenchmarkCaptureSignatureInputs_Vector", BenchmarkCaptureSignatureInputs<VectorCaptureTraits>)
+			->Arg(1'000)
+			->Arg(10'000);
+
+	benchmark::RegisterBenchmark("BenchmarkCaptureSignatureInputs_Inline", BenchmarkCaptureSignatureInputs<InlineCaptureTraits>)
+			->Arg(1'000)
+			->Arg(10'000);
 }
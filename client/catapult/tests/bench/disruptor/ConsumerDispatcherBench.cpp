@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/RangeTypes.h"
+#include "catapult/thread/ThreadGroup.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		constexpr auto Num_Elements = 16'000u;
+		constexpr auto Num_Consumers = 2u;
+
+		// region utils
+
+		ConsumerInput CreateInput() {
+			uint8_t* pRangeData;
+			auto range = model::TransactionRange::PrepareFixed(1, &pRangeData);
+			reinterpret_cast<model::Transaction&>(*pRangeData).Size = sizeof(model::Transaction);
+			return ConsumerInput(std::move(range));
+		}
+
+		auto CreateDispatcher(ConsumerWaitStrategy waitStrategy) {
+			// disruptor is large enough to hold all elements pushed in a single iteration
+			auto options = ConsumerDispatcherOptions("bench dispatcher", 2 * Num_Elements);
+			options.ElementTraceInterval = 0;
+			options.ShouldThrowWhenFull = false;
+			options.WaitStrategy = waitStrategy;
+
+			std::vector<DisruptorConsumer> consumers(Num_Consumers, [](const auto&) { return ConsumerResult::Continue(); });
+			return std::make_unique<ConsumerDispatcher>(options, consumers);
+		}
+
+		template<typename TCreateProcessingComplete>
+		void RunProducers(ConsumerDispatcher& dispatcher, size_t numProducers, TCreateProcessingComplete createProcessingComplete) {
+			thread::ThreadGroup threads;
+			for (auto i = 0u; i < numProducers; ++i) {
+				threads.spawn([&dispatcher, numProducers, createProcessingComplete]() {
+					for (auto j = 0u; j < Num_Elements / numProducers; ++j) {
+						while (0 == dispatcher.processElement(CreateInput(), createProcessingComplete()))
+							std::this_thread::yield();
+					}
+				});
+			}
+		}
+
+		void WaitForCompletion(const std::atomic<size_t>& numCompletedElements) {
+			while (Num_Elements != numCompletedElements)
+				std::this_thread::yield();
+		}
+
+		uint64_t GetPercentile(std::vector<uint64_t>& values, size_t percentile) {
+			auto index = (values.size() - 1) * percentile / 100;
+			std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+			return values[index];
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkThroughput(benchmark::State& state) {
+			auto numProducers = static_cast<size_t>(state.range(0));
+			auto pDispatcher = CreateDispatcher(static_cast<ConsumerWaitStrategy>(state.range(1)));
+
+			for (auto _ : state) {
+				std::atomic<size_t> numCompletedElements(0);
+				RunProducers(*pDispatcher, numProducers, [&numCompletedElements]() {
+					return [&numCompletedElements](auto, const auto&) { ++numCompletedElements; };
+				});
+
+				WaitForCompletion(numCompletedElements);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Elements * state.iterations()));
+		}
+
+		void BenchmarkLatency(benchmark::State& state) {
+			auto numProducers = static_cast<size_t>(state.range(0));
+			auto pDispatcher = CreateDispatcher(static_cast<ConsumerWaitStrategy>(state.range(1)));
+
+			// completion handlers are always called from the thread of the last consumer, so latencies don't need to be synchronized
+			std::vector<uint64_t> latencies;
+			latencies.reserve(Num_Elements);
+
+			for (auto _ : state) {
+				std::atomic<size_t> numCompletedElements(0);
+				RunProducers(*pDispatcher, numProducers, [&numCompletedElements, &latencies]() {
+					return [&numCompletedElements, &latencies, startTime = std::chrono::steady_clock::now()](auto, const auto&) {
+						auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+						auto elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedTime).count();
+						latencies.push_back(static_cast<uint64_t>(elapsedNanoseconds));
+						++numCompletedElements;
+					};
+				});
+
+				WaitForCompletion(numCompletedElements);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Elements * state.iterations()));
+			state.counters["p50_us"] = static_cast<double>(GetPercentile(latencies, 50)) / 1000;
+			state.counters["p99_us"] = static_cast<double>(GetPercentile(latencies, 99)) / 1000;
+			state.counters["max_us"] = static_cast<double>(*std::max_element(latencies.cbegin(), latencies.cend())) / 1000;
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::disruptor;
+
+	// wait strategies: 0 = sleep, 1 = busy spin, 2 = yield, 3 = blocking
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "producers", "wait" })
+				->ArgsProduct({ { 1, 4, 16 }, { 0, 1, 2, 3 } })
+				->UseRealTime()
+				->Unit(benchmark::kMillisecond);
+	};
+
+	registerBenchmark("BenchmarkThroughput", BenchmarkThroughput);
+	registerBenchmark("BenchmarkLatency", BenchmarkLatency);
+}
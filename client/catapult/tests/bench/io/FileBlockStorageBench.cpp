@@ -0,0 +1,151 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/model/Elements.h"
+#include "catapult/model/EntityType.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Blocks = 1'000u;
+		constexpr auto Num_Transactions_Per_Block = 20u;
+		constexpr auto Transaction_Size = 256u;
+		constexpr auto File_Database_Batch_Size = 100u;
+
+		// region storage
+
+		std::shared_ptr<model::Block> CreateBlock(Height height) {
+			auto headerSize = model::GetBlockHeaderSize(model::Entity_Type_Block_Normal);
+			auto size = headerSize + Num_Transactions_Per_Block * Transaction_Size;
+			auto pBlock = utils::MakeSharedWithSize<model::Block>(size);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pBlock.get()), size });
+
+			pBlock->Size = size;
+			pBlock->Type = model::Entity_Type_Block_Normal;
+			pBlock->Height = height;
+
+			auto* pTransactionData = reinterpret_cast<uint8_t*>(pBlock.get()) + headerSize;
+			for (auto i = 0u; i < Num_Transactions_Per_Block; ++i)
+				reinterpret_cast<model::Transaction&>(pTransactionData[i * Transaction_Size]).Size = Transaction_Size;
+
+			return pBlock;
+		}
+
+		class StorageDirectory {
+		public:
+			StorageDirectory()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.catapult.io." + std::to_string(bench::Random()))) {
+				std::filesystem::create_directories(m_directory);
+
+				FileBlockStorage storage(name(), File_Database_Batch_Size, FileBlockStorageMode::None);
+				for (auto i = 1u; i <= Num_Blocks; ++i) {
+					auto pBlock = CreateBlock(Height(i));
+					model::BlockElement blockElement(*pBlock);
+					for (const auto& transaction : pBlock->Transactions())
+						blockElement.Transactions.push_back(model::TransactionElement(transaction));
+
+					storage.saveBlock(blockElement);
+				}
+			}
+
+			~StorageDirectory() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string name() const {
+				return m_directory.generic_string();
+			}
+
+		private:
+			std::filesystem::path m_directory;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		enum class AccessPattern { Sequential, Random };
+
+		std::vector<Height> CreateHeights(AccessPattern accessPattern) {
+			std::vector<Height> heights;
+			for (auto i = 1u; i <= Num_Blocks; ++i)
+				heights.push_back(Height(i));
+
+			if (AccessPattern::Random == accessPattern) {
+				for (auto i = heights.size() - 1; i > 0; --i)
+					std::swap(heights[i], heights[bench::Random() % (i + 1)]);
+			}
+
+			return heights;
+		}
+
+		template<typename TLoad>
+		void RunBenchmark(benchmark::State& state, TLoad load) {
+			auto readMode = static_cast<FileDatabaseReadMode>(state.range(0));
+			auto heights = CreateHeights(static_cast<AccessPattern>(state.range(1)));
+
+			StorageDirectory directory;
+			FileBlockStorage storage(directory.name(), File_Database_Batch_Size, FileBlockStorageMode::None, readMode);
+
+			for (auto _ : state) {
+				for (auto height : heights)
+					benchmark::DoNotOptimize(load(storage, height));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Blocks * state.iterations()));
+		}
+
+		void BenchmarkLoadBlock(benchmark::State& state) {
+			RunBenchmark(state, [](const auto& storage, auto height) {
+				return storage.loadBlock(height);
+			});
+		}
+
+		void BenchmarkLoadBlockElement(benchmark::State& state) {
+			RunBenchmark(state, [](const auto& storage, auto height) {
+				return storage.loadBlockElement(height);
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::io;
+
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "mapped", "random" })
+				->ArgsProduct({ { 0, 1 }, { 0, 1 } })
+				->Unit(benchmark::kMillisecond);
+	};
+
+	registerBenchmark("BenchmarkLoadBlock", BenchmarkLoadBlock);
+	registerBenchmark("BenchmarkLoadBlockElement", BenchmarkLoadBlockElement);
+}
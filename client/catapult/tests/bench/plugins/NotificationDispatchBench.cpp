@@ -0,0 +1,285 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sdk/src/builders/AccountMetadataBuilder.h"
+#include "sdk/src/builders/MosaicDefinitionBuilder.h"
+#include "sdk/src/builders/NamespaceRegistrationBuilder.h"
+#include "sdk/src/builders/SecretLockBuilder.h"
+#include "sdk/src/builders/TransferBuilder.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/plugins/PluginLoader.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/utils/ConfigurationBag.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <filesystem>
+
+namespace catapult { namespace plugins {
+
+	namespace {
+		constexpr auto Num_Transaction_Groups = 200u;
+		constexpr auto Plugins_Directory = "";
+
+		// region plugin manager
+
+		model::BlockchainConfiguration LoadBlockchainConfiguration() {
+			auto configurationPath = std::filesystem::path("..") / "resources" / "config-network.properties";
+			return model::BlockchainConfiguration::LoadFromBag(utils::ConfigurationBag::FromPath(configurationPath.generic_string()));
+		}
+
+		class PluginManagerContext {
+		public:
+			PluginManagerContext()
+					: m_pPluginManager(std::make_unique<PluginManager>(
+							LoadBlockchainConfiguration(),
+							StorageConfiguration(),
+							config::UserConfiguration::Uninitialized(),
+							config::InflationConfiguration::Uninitialized())) {
+				LoadPluginByName(*m_pPluginManager, m_modules, Plugins_Directory, "catapult.plugins.coresystem");
+
+				for (const auto& pair : m_pPluginManager->config().Plugins)
+					LoadPluginByName(*m_pPluginManager, m_modules, Plugins_Directory, pair.first);
+			}
+
+			~PluginManagerContext() {
+				// destroy the plugin manager before the modules
+				m_pPluginManager.reset();
+			}
+
+		public:
+			const PluginManager& pluginManager() const {
+				return *m_pPluginManager;
+			}
+
+		private:
+			std::vector<PluginModule> m_modules;
+			std::unique_ptr<PluginManager> m_pPluginManager;
+		};
+
+		// endregion
+
+		// region block
+
+		template<typename TBuilder>
+		std::shared_ptr<const model::Transaction> Build(TBuilder& builder) {
+			builder.setDeadline(Timestamp(bench::Random()));
+			builder.setMaxFee(Amount(bench::Random() % 1'000'000));
+			return builder.build();
+		}
+
+		Key GenerateRandomKey() {
+			Key key;
+			bench::FillWithRandomData(key);
+			return key;
+		}
+
+		UnresolvedAddress GenerateRandomUnresolvedAddress() {
+			UnresolvedAddress address;
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(address.data()), address.size() });
+			return address;
+		}
+
+		model::Transactions CreateTransactions(model::NetworkIdentifier networkIdentifier) {
+			// use a transaction mix dominated by transfers that touches most of the registered plugins
+			model::Transactions transactions;
+			for (auto i = 0u; i < Num_Transaction_Groups; ++i) {
+				for (auto j = 0u; j < 3; ++j) {
+					builders::TransferBuilder builder(networkIdentifier, GenerateRandomKey());
+					builder.setRecipientAddress(GenerateRandomUnresolvedAddress());
+					builder.addMosaic({ UnresolvedMosaicId(bench::Random()), Amount(bench::Random() % 1'000) });
+					builder.setMessage({ reinterpret_cast<const uint8_t*>("bench message"), 13 });
+					transactions.push_back(Build(builder));
+				}
+
+				{
+					builders::MosaicDefinitionBuilder builder(networkIdentifier, GenerateRandomKey());
+					builder.setNonce(MosaicNonce(static_cast<uint32_t>(bench::Random())));
+					builder.setDuration(BlockDuration(1'000));
+					builder.setDivisibility(3);
+					transactions.push_back(Build(builder));
+				}
+
+				{
+					builders::NamespaceRegistrationBuilder builder(networkIdentifier, GenerateRandomKey());
+					builder.setName({ reinterpret_cast<const uint8_t*>("bench"), 5 });
+					builder.setDuration(BlockDuration(1'000));
+					transactions.push_back(Build(builder));
+				}
+
+				{
+					builders::SecretLockBuilder builder(networkIdentifier, GenerateRandomKey());
+					Hash256 secret;
+					bench::FillWithRandomData(secret);
+					builder.setRecipientAddress(GenerateRandomUnresolvedAddress());
+					builder.setSecret(secret);
+					builder.setMosaic({ UnresolvedMosaicId(bench::Random()), Amount(100) });
+					builder.setDuration(BlockDuration(100));
+					transactions.push_back(Build(builder));
+				}
+
+				{
+					builders::AccountMetadataBuilder builder(networkIdentifier, GenerateRandomKey());
+					builder.setTargetAddress(GenerateRandomUnresolvedAddress());
+					builder.setScopedMetadataKey(bench::Random());
+					builder.setValueSizeDelta(10);
+					builder.setValue({ reinterpret_cast<const uint8_t*>("bench data"), 10 });
+					transactions.push_back(Build(builder));
+				}
+			}
+
+			return transactions;
+		}
+
+		class BlockContext {
+		public:
+			explicit BlockContext(model::NetworkIdentifier networkIdentifier) {
+				model::PreviousBlockContext previousBlockContext;
+				previousBlockContext.BlockHeight = Height(1234);
+				m_pBlock = model::CreateBlock(
+						model::Entity_Type_Block_Normal,
+						previousBlockContext,
+						networkIdentifier,
+						GenerateRandomKey(),
+						CreateTransactions(networkIdentifier));
+
+				bench::FillWithRandomData(m_blockHash);
+				for (const auto& transaction : m_pBlock->Transactions()) {
+					m_transactionHashes.emplace_back();
+					bench::FillWithRandomData(m_transactionHashes.back());
+					m_entityInfos.emplace_back(transaction, m_transactionHashes.back(), *m_pBlock);
+				}
+
+				m_entityInfos.emplace_back(*m_pBlock, m_blockHash);
+			}
+
+		public:
+			const std::vector<model::WeakEntityInfo>& entityInfos() const {
+				return m_entityInfos;
+			}
+
+		private:
+			std::unique_ptr<model::Block> m_pBlock;
+			Hash256 m_blockHash;
+			std::deque<Hash256> m_transactionHashes;
+			std::vector<model::WeakEntityInfo> m_entityInfos;
+		};
+
+		// endregion
+
+		// region subscribers
+
+		class CountingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			size_t numNotifications() const {
+				return m_numNotifications;
+			}
+
+		public:
+			void notify(const model::Notification&) override {
+				++m_numNotifications;
+			}
+
+		private:
+			size_t m_numNotifications = 0;
+		};
+
+		class ExhaustiveValidatingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			explicit ExhaustiveValidatingNotificationSubscriber(const validators::stateless::NotificationValidator& validator)
+					: m_validator(validator)
+			{}
+
+		public:
+			size_t numFailures() const {
+				return m_numFailures;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				// unlike ValidatingNotificationSubscriber, continue after failures so that every notification is dispatched
+				if (!IsSet(notification.Type, model::NotificationChannel::Validator))
+					return;
+
+				if (validators::IsValidationResultFailure(m_validator.validate(notification)))
+					++m_numFailures;
+			}
+
+		private:
+			const validators::stateless::NotificationValidator& m_validator;
+			size_t m_numFailures = 0;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TSubscriber>
+		void RunBenchmark(
+				benchmark::State& state,
+				const PluginManager& pluginManager,
+				const model::NotificationPublisher& publisher,
+				TSubscriber& subscriber) {
+			BlockContext blockContext(pluginManager.config().Network.Identifier);
+
+			for (auto _ : state) {
+				for (const auto& entityInfo : blockContext.entityInfos())
+					publisher.publish(entityInfo, subscriber);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(blockContext.entityInfos().size() * state.iterations()));
+		}
+
+		void BenchmarkPublishBlock(benchmark::State& state) {
+			PluginManagerContext context;
+			auto pPublisher = context.pluginManager().createNotificationPublisher();
+
+			CountingNotificationSubscriber subscriber;
+			RunBenchmark(state, context.pluginManager(), *pPublisher, subscriber);
+			benchmark::DoNotOptimize(subscriber.numNotifications());
+		}
+
+		void BenchmarkValidateBlockStateless(benchmark::State& state) {
+			PluginManagerContext context;
+			auto pPublisher = context.pluginManager().createNotificationPublisher();
+			auto pValidator = context.pluginManager().createStatelessValidator();
+
+			ExhaustiveValidatingNotificationSubscriber subscriber(*pValidator);
+			RunBenchmark(state, context.pluginManager(), *pPublisher, subscriber);
+			benchmark::DoNotOptimize(subscriber.numFailures());
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::plugins;
+
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)->Unit(benchmark::kMicrosecond);
+	};
+
+	registerBenchmark("BenchmarkPublishBlock", BenchmarkPublishBlock);
+	registerBenchmark("BenchmarkValidateBlockStateless", BenchmarkValidateBlockStateless);
+}
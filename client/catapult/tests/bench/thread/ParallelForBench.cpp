@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		constexpr auto Num_Items = 10'000u;
+
+		// region workload
+
+		enum class Skew { None, Front, Back };
+
+		std::vector<uint32_t> CreateWorkload(Skew skew) {
+			// every tenth item is 50x more expensive than the others; all expensive items are clustered when skewed
+			std::vector<uint32_t> costs(Num_Items, 1);
+			auto numExpensiveItems = Num_Items / 10;
+			for (auto i = 0u; i < numExpensiveItems; ++i) {
+				auto index = Skew::None == skew ? i * 10 : Skew::Front == skew ? i : Num_Items - 1 - i;
+				costs[index] = 50;
+			}
+
+			return costs;
+		}
+
+		void Process(uint32_t cost) {
+			// simulate work proportional to cost
+			uint64_t value = cost;
+			for (auto i = 0u; i < cost * 1000; ++i)
+				value = value * 6364136223846793005ull + 1442695040888963407ull;
+
+			benchmark::DoNotOptimize(value);
+		}
+
+		auto ProcessRange() {
+			return [](auto itBegin, auto itEnd, auto, auto) {
+				for (auto iter = itBegin; itEnd != iter; ++iter)
+					Process(*iter);
+			};
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TParallelFor>
+		void RunBenchmark(benchmark::State& state, TParallelFor parallelFor) {
+			auto skew = static_cast<Skew>(state.range(0));
+			auto numThreads = static_cast<size_t>(state.range(1));
+			auto items = CreateWorkload(skew);
+
+			auto pPool = CreateIoThreadPool(numThreads, "bench");
+			pPool->start();
+
+			for (auto _ : state)
+				parallelFor(pPool->ioContext(), items, numThreads);
+
+			pPool->join();
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Items * state.iterations()));
+		}
+
+		void BenchmarkParallelForPartition(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, auto& items, auto numThreads) {
+				ParallelForPartition(ioContext, items, numThreads, ProcessRange()).get();
+			});
+		}
+
+		void BenchmarkWorkStealingParallelForPartition(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, auto& items, auto numThreads) {
+				WorkStealingParallelForPartition(ioContext, items, numThreads, WorkStealingOptions(), ProcessRange()).get();
+			});
+		}
+
+		void BenchmarkWorkStealingParallelForPartitionWithCostHint(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, auto& items, auto numThreads) {
+				auto costSupplier = [](auto cost) { return cost; };
+				WorkStealingParallelForPartition(ioContext, items, numThreads, costSupplier, WorkStealingOptions(), ProcessRange()).get();
+			});
+		}
+
+		void BenchmarkWorkStealingParallelForPartitionWithCallingThread(benchmark::State& state) {
+			RunBenchmark(state, [](auto& ioContext, auto& items, auto numThreads) {
+				auto costSupplier = [](auto cost) { return cost; };
+				WorkStealingParallelForPartition(ioContext, items, numThreads, costSupplier, { 4, true }, ProcessRange()).get();
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::thread;
+
+	auto registerBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "skew", "threads" })
+				->ArgsProduct({ { 0, 1, 2 }, { 2, 4, 8 } })
+				->UseRealTime()
+				->Unit(benchmark::kMillisecond);
+	};
+
+	registerBenchmark("BenchmarkParallelForPartition", BenchmarkParallelForPartition);
+	registerBenchmark("BenchmarkWorkStealingParallelForPartition", BenchmarkWorkStealingParallelForPartition);
+	registerBenchmark("BenchmarkWorkStealingParallelForPartitionWithCostHint", BenchmarkWorkStealingParallelForPartitionWithCostHint);
+	registerBenchmark("BenchmarkWorkStealingParallelForPartitionWithCallingThread", BenchmarkWorkStealingParallelForPartitionWithCallingThread);
+}
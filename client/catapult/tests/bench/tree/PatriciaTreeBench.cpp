@@ -0,0 +1,206 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/BasePatriciaTree.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr auto Num_Updates_Per_Block = 1'000u;
+		constexpr auto Num_Lookups_Per_Request = 1'000u;
+
+		// region utils
+
+		class HashKeyEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using TreeType = BasePatriciaTree<HashKeyEncoder, MemoryDataSource, utils::ArrayHasher<Hash256>>;
+
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		void AddAll(TreeType& tree, const std::vector<Hash256>& keys) {
+			auto pDelta = tree.rebase();
+			for (const auto& key : keys)
+				pDelta->set(key, key);
+
+			tree.commit();
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkBuildTree(benchmark::State& state) {
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+
+			size_t numNodes = 0;
+			size_t memoryCapacity = 0;
+			for (auto _ : state) {
+				MemoryDataSource dataSource;
+				TreeType tree(dataSource);
+				AddAll(tree, keys);
+
+				numNodes = dataSource.size();
+				memoryCapacity = dataSource.memoryCapacity();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size() * state.iterations()));
+			state.counters["nodes"] = static_cast<double>(numNodes);
+			state.counters["arena_bytes_per_node"] = static_cast<double>(memoryCapacity) / static_cast<double>(numNodes);
+			state.counters["tree_node_size"] = static_cast<double>(sizeof(TreeNode));
+		}
+
+		template<typename TModify>
+		void BenchmarkUpdateTree(benchmark::State& state, TModify modify) {
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+
+			MemoryDataSource dataSource;
+			TreeType tree(dataSource);
+			AddAll(tree, keys);
+
+			// each iteration simulates a block that modifies existing leaves, calculates the state hash and commits
+			auto values = GenerateRandomHashes(Num_Updates_Per_Block);
+			size_t keyIndex = 0;
+			for (auto _ : state) {
+				std::vector<TreeType::DeltaType::Modification> modifications;
+				for (const auto& value : values)
+					modifications.push_back({ &keys[keyIndex++ % keys.size()], &value });
+
+				auto pDelta = tree.rebase();
+				modify(*pDelta, modifications);
+
+				benchmark::DoNotOptimize(pDelta->root());
+				tree.commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Updates_Per_Block * state.iterations()));
+		}
+
+		void BenchmarkUpdateTreeIndividually(benchmark::State& state) {
+			BenchmarkUpdateTree(state, [](auto& delta, const auto& modifications) {
+				for (const auto& modification : modifications)
+					delta.set(*modification.pKey, *modification.pValue);
+			});
+		}
+
+		void BenchmarkUpdateTreeAsBatch(benchmark::State& state) {
+			BenchmarkUpdateTree(state, [](auto& delta, const auto& modifications) {
+				delta.apply(modifications);
+			});
+		}
+
+		template<typename TLookup>
+		void BenchmarkLookupProofs(benchmark::State& state, TLookup lookup) {
+			auto keys = GenerateRandomHashes(static_cast<size_t>(state.range(0)));
+
+			MemoryDataSource dataSource;
+			TreeType tree(dataSource);
+			AddAll(tree, keys);
+
+			// each iteration simulates a client requesting proofs for random existing keys
+			size_t numProofNodes = 0;
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<Hash256> requestKeys;
+				for (auto i = 0u; i < Num_Lookups_Per_Request; ++i)
+					requestKeys.push_back(keys[bench::Random() % keys.size()]);
+
+				state.ResumeTiming();
+
+				numProofNodes = lookup(tree, requestKeys);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Lookups_Per_Request * state.iterations()));
+			state.counters["proof_nodes"] = static_cast<double>(numProofNodes);
+		}
+
+		void BenchmarkLookupProofsIndividually(benchmark::State& state) {
+			BenchmarkLookupProofs(state, [](const auto& tree, const auto& keys) {
+				// retain all node paths because all of them are needed to build a response
+				size_t numProofNodes = 0;
+				std::vector<std::vector<TreeNode>> nodePaths(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i) {
+					tree.lookup(keys[i], nodePaths[i]);
+					numProofNodes += nodePaths[i].size();
+				}
+
+				return numProofNodes;
+			});
+		}
+
+		void BenchmarkLookupProofsAsBatch(benchmark::State& state) {
+			BenchmarkLookupProofs(state, [](const auto& tree, const auto& keys) {
+				PatriciaTreeMultiProof proof;
+				tree.lookup(keys, proof);
+				return proof.Nodes.size();
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::tree;
+
+	benchmark::RegisterBenchmark("BenchmarkBuildTree", BenchmarkBuildTree)
+			->ArgNames({ "leaves" })
+			->Arg(10'000)
+			->Arg(100'000)
+			->Unit(benchmark::kMillisecond);
+
+	auto registerLeavesBenchmark = [](const char* name, auto benchmarkFunc) {
+		benchmark::RegisterBenchmark(name, benchmarkFunc)
+				->ArgNames({ "leaves" })
+				->Arg(100'000)
+				->Arg(1'000'000)
+				->Unit(benchmark::kMillisecond);
+	};
+
+	registerLeavesBenchmark("BenchmarkUpdateTreeIndividually", BenchmarkUpdateTreeIndividually);
+	registerLeavesBenchmark("BenchmarkUpdateTreeAsBatch", BenchmarkUpdateTreeAsBatch);
+
+	registerLeavesBenchmark("BenchmarkLookupProofsIndividually", BenchmarkLookupProofsIndividually);
+	registerLeavesBenchmark("BenchmarkLookupProofsAsBatch", BenchmarkLookupProofsAsBatch);
+}
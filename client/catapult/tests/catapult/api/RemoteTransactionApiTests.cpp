@@ -112,6 +112,46 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct FilteredUtTraits : public UtTraits {
+			static constexpr uint32_t Request_Data_Size = sizeof(utils::BloomFilterHeader) + 4;
+
+			static utils::BloomFilter KnownShortHashesFilter() {
+				return utils::BloomFilter(987, 3, { 0x12, 0x34, 0x56, 0x78 });
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.filteredUnconfirmedTransactions(Timestamp(84), BlockFeeMultiplier(17), KnownShortHashesFilter());
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = UtTraits::CreateValidResponsePacket();
+				pResponsePacket->Type = ionet::PacketType::Pull_Filtered_Transactions;
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Filtered_Transactions, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + Request_Data_Size, packet.Size);
+				EXPECT_EQ(Timestamp(84), reinterpret_cast<const Timestamp&>(*packet.Data()));
+				EXPECT_EQ(BlockFeeMultiplier(17), reinterpret_cast<const BlockFeeMultiplier&>(packet.Data()[sizeof(Timestamp)]));
+
+				const auto& filterHeader = reinterpret_cast<const utils::BloomFilterHeader&>(packet.Data()[Request_Data_Header_Size]);
+				EXPECT_EQ(4u, filterHeader.Size);
+				EXPECT_EQ(987u, filterHeader.Seed);
+				EXPECT_EQ(3u, filterHeader.NumHashFunctions);
+
+				auto expectedFilterData = std::vector<uint8_t>{ 0x12, 0x34, 0x56, 0x78 };
+				EXPECT_EQ_MEMORY(packet.Data() + Request_Data_Header_Size + sizeof(utils::BloomFilterHeader), expectedFilterData.data(), 4);
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -126,4 +166,5 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, FilteredUt)
 }}
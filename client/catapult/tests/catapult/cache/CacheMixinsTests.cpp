@@ -23,6 +23,7 @@
 #include "tests/test/cache/TestCacheTypes.h"
 #include "tests/TestHarness.h"
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -37,6 +38,7 @@ namespace catapult { namespace cache {
 
 		using HeightGroupedBaseSetType = test::TestCacheTypes::HeightGroupedBaseSetType;
 		using BaseSetType = test::TestCacheTypes::BaseSetType;
+		using BaseSetDeltaType = test::TestCacheTypes::BaseSetDeltaType;
 		using BaseActivitySetType = test::TestCacheTypes::BaseActivitySetType;
 
 		auto SeedThreeDelta(BaseSetType& set) {
@@ -118,6 +120,50 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region PrefetchMixin
+
+	TEST(TEST_CLASS, PrefetchMixin_DoesNotChangeMemoryCache) {
+		// Arrange:
+		BaseSetType set;
+		SeedThree(set);
+		auto pDelta = set.rebase();
+		auto mixin = PrefetchMixin<BaseSetDeltaType, TestCacheDescriptor>(*pDelta);
+
+		// Act:
+		mixin.prefetch({ 1, 2, 3 });
+
+		// Assert:
+		EXPECT_EQ(3u, pDelta->size());
+		EXPECT_TRUE(pDelta->contains(1));
+		EXPECT_FALSE(pDelta->contains(2));
+		EXPECT_TRUE(pDelta->contains(3));
+	}
+
+	namespace {
+		// set that captures all prefetched keys
+		struct PrefetchAwareSetType {
+			mutable std::vector<int> PrefetchedKeys;
+
+			void prefetch(const std::vector<int>& keys) const {
+				PrefetchedKeys.insert(PrefetchedKeys.end(), keys.cbegin(), keys.cend());
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, PrefetchMixin_ForwardsKeysToSet) {
+		// Arrange:
+		PrefetchAwareSetType set;
+		auto mixin = PrefetchMixin<PrefetchAwareSetType, TestCacheDescriptor>(set);
+
+		// Act:
+		mixin.prefetch({ 4, 2, 7 });
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 4, 2, 7 }), set.PrefetchedKeys);
+	}
+
+	// endregion
+
 	// region IterationMixin
 
 	namespace {
@@ -21,6 +21,7 @@
 
 #include "catapult/cache/PatriciaTreeCacheMixins.h"
 #include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -159,6 +160,60 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region PatriciaTreeMixin - patriciaTreeNodeCacheStatistics
+
+	namespace {
+		class NodeCacheStatisticsTree {
+		public:
+			using KeyType = uint32_t;
+
+		private:
+			class DataSource {
+			public:
+				PatriciaTreeNodeCacheStatistics nodeCacheStatistics() const {
+					return { 11, 7, 5 };
+				}
+			};
+
+		public:
+			const DataSource& dataSource() const {
+				return m_dataSource;
+			}
+
+		private:
+			DataSource m_dataSource;
+		};
+	}
+
+	TEST(TEST_CLASS, ViewMixin_NodeCacheStatisticsAreZeroWhenTreeIsNullptr) {
+		// Arrange:
+		auto mixin = PatriciaTreeMixin<NodeCacheStatisticsTree>(nullptr);
+
+		// Act:
+		auto statistics = mixin.patriciaTreeNodeCacheStatistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(0u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.Size);
+	}
+
+	TEST(TEST_CLASS, ViewMixin_NodeCacheStatisticsForwardsToUnderlyingDataSourceWhenTreeIsValid) {
+		// Arrange:
+		NodeCacheStatisticsTree tree;
+		auto mixin = PatriciaTreeMixin<NodeCacheStatisticsTree>(&tree);
+
+		// Act:
+		auto statistics = mixin.patriciaTreeNodeCacheStatistics();
+
+		// Assert:
+		EXPECT_EQ(11u, statistics.NumHits);
+		EXPECT_EQ(7u, statistics.NumMisses);
+		EXPECT_EQ(5u, statistics.Size);
+	}
+
+	// endregion
+
 	// region PatriciaTreeDeltaMixin - supportsMerkleRoot
 
 	TEST(TEST_CLASS, DeltaMixin_SupportsReturnsFalseWhenTreeIsNullptr) {
@@ -351,6 +406,72 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(dataSource.get(expectedRoots[2]).empty());
 	}
 
+	TEST(TEST_CLASS, DeltaMixin_ParallelUpdateHasNoEffectWhenTreeIsNullptr) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		DeltasWrapper deltaset;
+		auto mixin = PatriciaTreeDeltaMixin<DeltasWrapper, test::MemoryBasePatriciaTree::DeltaType>(deltaset, nullptr);
+
+		// Act:
+		mixin.updateMerkleRoot(Height(123), *pPool);
+		auto result = mixin.tryGetMerkleRoot();
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+
+		EXPECT_EQ(1u, deltaset.generationId());
+	}
+
+	TEST(TEST_CLASS, DeltaMixin_ParallelUpdateProducesSameRootAsSequentialUpdate) {
+		// Arrange: seed a tree with a root branch node so that modifications are partitioned
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		tree::MemoryDataSource dataSource;
+		test::MemoryBasePatriciaTree tree(dataSource);
+		test::SeedTreeWithFourNodes(tree);
+		{
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x26'54'32'10, "alpha");
+			tree.commit();
+		}
+
+		DeltasWrapper deltaset;
+		deltaset.Added.emplace(0x46'54'32'10, "lion");
+		deltaset.Added.emplace(0x86'54'32'10, "tiger");
+		deltaset.Removed.emplace(0x64'6F'67'65, "coin");
+		deltaset.Copied.emplace(0x26'54'32'10, "beta");
+
+		// - mark the last modification as belonging to a different generation
+		deltaset.setGenerationId(0x26'54'32'10, 2);
+
+		auto pDeltaTree = tree.rebase();
+		auto mixin = PatriciaTreeDeltaMixin<DeltasWrapper, test::MemoryBasePatriciaTree::DeltaType>(deltaset, pDeltaTree);
+
+		// Act:
+		mixin.updateMerkleRoot(Height(123), *pPool); // generation 1
+		mixin.updateMerkleRoot(Height(124), *pPool); // generation 2
+		auto result = mixin.tryGetMerkleRoot();
+
+		// Assert:
+		auto expectedRoot = test::CalculateRootHash({
+			{ 0x64'6F'00'00, "verb" },
+			{ 0x64'6F'67'00, "puppy" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x26'54'32'10, "beta" },
+			{ 0x46'54'32'10, "lion" },
+			{ 0x86'54'32'10, "tiger" }
+		});
+
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(expectedRoot, result.first);
+
+		EXPECT_EQ(3u, deltaset.generationId());
+
+		// Sanity: the (delta) tree was modified
+		EXPECT_EQ(expectedRoot, pDeltaTree->root());
+	}
+
 	// endregion
 
 	// region PatriciaTreeDeltaMixin - setMerkleRoot
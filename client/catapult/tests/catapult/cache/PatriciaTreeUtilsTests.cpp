@@ -21,8 +21,11 @@
 
 #include "catapult/cache/PatriciaTreeUtils.h"
 #include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
 #include "tests/TestHarness.h"
+#include <algorithm>
+#include <mutex>
 
 namespace catapult { namespace cache {
 
@@ -557,4 +560,161 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region forEachBranch
+
+	namespace {
+		void SeedTreeWithFiveNodes(MemoryPatriciaTree& tree) {
+			// root is a branch node because keys have different first nibbles
+			test::SeedTreeWithFourNodes(tree);
+			tree.set(0x26'54'32'10, "alpha");
+		}
+
+		template<typename TDeltaSet>
+		std::vector<std::vector<size_t>> ApplyDeltasToTreeWithForEachBranch(MemoryPatriciaTree& tree, const TDeltaSet& deltaset) {
+			std::vector<std::vector<size_t>> capturedBranchIndexes;
+			ApplyDeltasToTree(tree, deltaset, 1, Height(1), [&capturedBranchIndexes](const auto& branchIndexes, const auto& updateBranch) {
+				capturedBranchIndexes.push_back(branchIndexes);
+				for (auto branchIndex : branchIndexes)
+					updateBranch(branchIndex);
+			});
+
+			return capturedBranchIndexes;
+		}
+	}
+
+	TEST(TEST_CLASS, AllDeltaChangesAreAppliedToTreeWithForEachBranch_RootExtensionNode) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		test::SeedTreeWithFourNodes(tree);
+
+		DeltasWrapper deltaset;
+		deltaset.Added.emplace(0x26'54'32'10, "alpha");
+		deltaset.Removed.emplace(0x64'6F'67'65, "coin");
+		deltaset.Copied.emplace(0x64'6F'00'00, "noun");
+
+		// Act:
+		auto capturedBranchIndexes = ApplyDeltasToTreeWithForEachBranch(tree, deltaset);
+
+		// Assert: modifications are not partitioned because root is not a branch node
+		auto expectedRoot = test::CalculateRootHash({
+			{ 0x64'6F'00'00, "noun" },
+			{ 0x64'6F'67'00, "puppy" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x26'54'32'10, "alpha" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_TRUE(capturedBranchIndexes.empty());
+	}
+
+	TEST(TEST_CLASS, AllDeltaChangesAreAppliedToTreeWithForEachBranch_RootBranchNode) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		SeedTreeWithFiveNodes(tree);
+
+		DeltasWrapper deltaset;
+		deltaset.Added.emplace(0x46'54'32'10, "lion");
+		deltaset.Removed.emplace(0x64'6F'67'65, "coin");
+		deltaset.Copied.emplace(0x26'54'32'10, "beta");
+
+		// Act:
+		auto capturedBranchIndexes = ApplyDeltasToTreeWithForEachBranch(tree, deltaset);
+
+		// Assert:
+		auto expectedRoot = test::CalculateRootHash({
+			{ 0x64'6F'00'00, "verb" },
+			{ 0x64'6F'67'00, "puppy" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x26'54'32'10, "beta" },
+			{ 0x46'54'32'10, "lion" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(std::vector<std::vector<size_t>>({ { 2, 4, 6 } }), capturedBranchIndexes);
+	}
+
+	TEST(TEST_CLASS, AllDeltaChangesAreAppliedToTreeWithForEachBranchDeterministically) {
+		// Arrange: added < copied < removed
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		SeedTreeWithFiveNodes(tree);
+
+		DeltasWrapper deltaset;
+		deltaset.Added.emplace(0x26'54'32'10, "pug");
+		deltaset.Copied.emplace(0x26'54'32'10, "terrier");
+		deltaset.Removed.emplace(0x26'54'32'10, "terrier");
+
+		deltaset.Copied.emplace(0x64'6F'00'00, "noun");
+		deltaset.Removed.emplace(0x64'6F'00'00, "noun");
+
+		deltaset.Added.emplace(0x46'54'32'10, "lion");
+		deltaset.Copied.emplace(0x46'54'32'10, "tiger");
+
+		// Act:
+		auto capturedBranchIndexes = ApplyDeltasToTreeWithForEachBranch(tree, deltaset);
+
+		// Assert:
+		auto expectedRoot = test::CalculateRootHash({
+			{ 0x64'6F'67'00, "puppy" },
+			{ 0x64'6F'67'65, "coin" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x46'54'32'10, "tiger" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(std::vector<std::vector<size_t>>({ { 2, 4, 6 } }), capturedBranchIndexes);
+	}
+
+	// endregion
+
+	// region ParallelForEachTreeBranch
+
+	TEST(TEST_CLASS, ParallelForEachTreeBranchUpdatesAllBranches) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		std::vector<size_t> branchIndexes{ 0, 3, 4, 7, 11, 15 };
+
+		// Act:
+		std::mutex mutex;
+		std::vector<size_t> updatedBranchIndexes;
+		ParallelForEachTreeBranch(*pPool, branchIndexes, [&mutex, &updatedBranchIndexes](auto branchIndex) {
+			std::lock_guard<std::mutex> lock(mutex);
+			updatedBranchIndexes.push_back(branchIndex);
+		});
+
+		// Assert:
+		std::sort(updatedBranchIndexes.begin(), updatedBranchIndexes.end());
+		EXPECT_EQ(branchIndexes, updatedBranchIndexes);
+	}
+
+	TEST(TEST_CLASS, ParallelForEachTreeBranchCanProcessZeroBranches) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto numUpdates = 0u;
+
+		// Act:
+		ParallelForEachTreeBranch(*pPool, {}, [&numUpdates](auto) {
+			++numUpdates;
+		});
+
+		// Assert:
+		EXPECT_EQ(0u, numUpdates);
+	}
+
+	TEST(TEST_CLASS, ParallelForEachTreeBranchPropagatesBranchUpdateException) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		std::vector<size_t> branchIndexes{ 0, 3, 4, 7, 11, 15 };
+
+		// Act + Assert:
+		EXPECT_THROW(ParallelForEachTreeBranch(*pPool, branchIndexes, [](auto branchIndex) {
+			if (7 == branchIndex)
+				CATAPULT_THROW_RUNTIME_ERROR("update failed");
+		}), catapult_runtime_error);
+	}
+
+	// endregion
 }}
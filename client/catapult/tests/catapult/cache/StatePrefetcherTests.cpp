@@ -0,0 +1,451 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/StatePrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS StatePrefetcherTests
+
+	namespace {
+		// region MockNotificationPublisher
+
+		class MockNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				// raise one notification for the signer and one for the entity hash coerced to a public key
+				subscriber.notify(model::AccountPublicKeyNotification(entityInfo.entity().SignerPublicKey));
+				subscriber.notify(model::AccountPublicKeyNotification(reinterpret_cast<const Key&>(entityInfo.hash())));
+			}
+		};
+
+		// endregion
+
+		// region MockSubCachePrefetcher
+
+		struct PrefetchParams {
+		public:
+			size_t Id;
+			std::vector<Key> NotifiedKeys;
+			const CatapultCacheDelta* pCache;
+			std::thread::id ThreadId;
+		};
+
+		class PrefetchCapture {
+		public:
+			std::vector<PrefetchParams> params() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				auto params = m_params;
+				std::sort(params.begin(), params.end(), [](const auto& lhs, const auto& rhs) { return lhs.Id < rhs.Id; });
+				return params;
+			}
+
+		public:
+			void push(PrefetchParams&& params) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_params.push_back(std::move(params));
+			}
+
+		private:
+			mutable std::mutex m_mutex;
+			std::vector<PrefetchParams> m_params;
+		};
+
+		class MockSubCachePrefetcher : public SubCachePrefetcher {
+		public:
+			MockSubCachePrefetcher(size_t id, PrefetchCapture& capture, bool shouldThrow)
+					: m_id(id)
+					, m_capture(capture)
+					, m_shouldThrow(shouldThrow)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_notifiedKeys.push_back(static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey);
+			}
+
+			void prefetch(const CatapultCacheDelta& cache) const override {
+				m_capture.push({ m_id, m_notifiedKeys, &cache, std::this_thread::get_id() });
+
+				if (m_shouldThrow)
+					CATAPULT_THROW_RUNTIME_ERROR("prefetch failed");
+			}
+
+		private:
+			size_t m_id;
+			PrefetchCapture& m_capture;
+			bool m_shouldThrow;
+			std::vector<Key> m_notifiedKeys;
+		};
+
+		// endregion
+
+		// region TestContext
+
+		class TestContext {
+		public:
+			explicit TestContext(size_t numPrefetchers, size_t throwingPrefetcherId = std::numeric_limits<size_t>::max())
+					: m_numFactoryCalls(0)
+					, m_cache(test::CreateEmptyCatapultCache())
+					, m_pLastCache(nullptr)
+					, m_transactions(test::GenerateRandomTransactions(3)) {
+				for (auto i = 0u; i < numPrefetchers; ++i) {
+					m_factories.push_back([this, i, throwingPrefetcherId]() {
+						++m_numFactoryCalls;
+						return std::make_unique<MockSubCachePrefetcher>(i, m_capture, throwingPrefetcherId == i);
+					});
+				}
+
+				// generate all hashes before creating entity infos so that hash references remain valid
+				for (auto i = 0u; i < m_transactions.size(); ++i)
+					m_hashes.push_back(test::GenerateRandomByteArray<Hash256>());
+
+				for (auto i = 0u; i < m_transactions.size(); ++i)
+					m_entityInfos.emplace_back(*m_transactions[i], m_hashes[i]);
+			}
+
+		public:
+			size_t numFactoryCalls() const {
+				return m_numFactoryCalls;
+			}
+
+			const auto& capture() const {
+				return m_capture;
+			}
+
+			const auto& entityInfos() const {
+				return m_entityInfos;
+			}
+
+			auto createPrefetcher() const {
+				return StatePrefetcher(m_factories);
+			}
+
+		public:
+			std::vector<Key> expectedNotifiedKeys() const {
+				std::vector<Key> keys;
+				for (const auto& entityInfo : m_entityInfos) {
+					keys.push_back(entityInfo.entity().SignerPublicKey);
+					keys.push_back(reinterpret_cast<const Key&>(entityInfo.hash()));
+				}
+
+				return keys;
+			}
+
+			void prefetch(const model::WeakEntityInfos& entityInfos) {
+				auto delta = m_cache.createDelta();
+				createPrefetcher().prefetch(entityInfos, MockNotificationPublisher(), delta);
+				m_pLastCache = &delta;
+			}
+
+			void prefetch(const model::WeakEntityInfos& entityInfos, thread::IoThreadPool& pool) {
+				auto delta = m_cache.createDelta();
+				createPrefetcher().prefetch(entityInfos, MockNotificationPublisher(), delta, pool);
+				m_pLastCache = &delta;
+			}
+
+			const CatapultCacheDelta* lastCache() const {
+				return m_pLastCache;
+			}
+
+		private:
+			size_t m_numFactoryCalls;
+			PrefetchCapture m_capture;
+			std::vector<SubCachePrefetcherFactory> m_factories;
+
+			CatapultCache m_cache;
+			const CatapultCacheDelta* m_pLastCache;
+
+			test::MutableTransactions m_transactions;
+			std::vector<Hash256> m_hashes;
+			model::WeakEntityInfos m_entityInfos;
+		};
+
+		// endregion
+
+		// region traits
+
+		struct SequentialTraits {
+			// sub caches following the failing one are not prefetched
+			static size_t NumPrefetchesAfterFailure(size_t throwingPrefetcherId, size_t) {
+				return throwingPrefetcherId + 1;
+			}
+
+			static void Prefetch(TestContext& context, const model::WeakEntityInfos& entityInfos) {
+				context.prefetch(entityInfos);
+			}
+		};
+
+		struct PoolTraits {
+			// all sub caches are prefetched even when one fails
+			static size_t NumPrefetchesAfterFailure(size_t, size_t numPrefetchers) {
+				return numPrefetchers;
+			}
+
+			static void Prefetch(TestContext& context, const model::WeakEntityInfos& entityInfos) {
+				auto pPool = test::CreateStartedIoThreadPool(2);
+				context.prefetch(entityInfos, *pPool);
+			}
+		};
+
+		// endregion
+	}
+
+#define PREFETCH_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SequentialTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Pool) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PoolTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreatePrefetcherWithoutSubCachePrefetchers) {
+		// Arrange:
+		TestContext context(0);
+
+		// Act:
+		auto prefetcher = context.createPrefetcher();
+
+		// Assert:
+		EXPECT_EQ(0u, prefetcher.size());
+	}
+
+	TEST(TEST_CLASS, CanCreatePrefetcherWithSubCachePrefetchers) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		auto prefetcher = context.createPrefetcher();
+
+		// Assert: factories are only called during prefetch
+		EXPECT_EQ(3u, prefetcher.size());
+		EXPECT_EQ(0u, context.numFactoryCalls());
+	}
+
+	// endregion
+
+	// region prefetch
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchIsBypassedWhenThereAreNoEntities) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		TTraits::Prefetch(context, {});
+
+		// Assert:
+		EXPECT_EQ(0u, context.numFactoryCalls());
+		EXPECT_TRUE(context.capture().params().empty());
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchWithoutSubCachePrefetchersHasNoEffect) {
+		// Arrange:
+		TestContext context(0);
+
+		// Act + Assert:
+		EXPECT_NO_THROW(TTraits::Prefetch(context, context.entityInfos()));
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchForwardsAllNotificationsToSingleSubCachePrefetcher) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		TTraits::Prefetch(context, context.entityInfos());
+
+		// Assert:
+		EXPECT_EQ(1u, context.numFactoryCalls());
+
+		auto params = context.capture().params();
+		ASSERT_EQ(1u, params.size());
+		EXPECT_EQ(context.expectedNotifiedKeys(), params[0].NotifiedKeys);
+		EXPECT_EQ(context.lastCache(), params[0].pCache);
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchForwardsAllNotificationsToMultipleSubCachePrefetchers) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		TTraits::Prefetch(context, context.entityInfos());
+
+		// Assert:
+		EXPECT_EQ(3u, context.numFactoryCalls());
+
+		auto params = context.capture().params();
+		ASSERT_EQ(3u, params.size());
+		for (auto i = 0u; i < params.size(); ++i) {
+			EXPECT_EQ(i, params[i].Id) << i;
+			EXPECT_EQ(context.expectedNotifiedKeys(), params[i].NotifiedKeys) << i;
+			EXPECT_EQ(context.lastCache(), params[i].pCache) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchWithoutPoolProcessesSubCachePrefetchersOnCallingThread) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		context.prefetch(context.entityInfos());
+
+		// Assert:
+		auto params = context.capture().params();
+		ASSERT_EQ(3u, params.size());
+		for (const auto& param : params)
+			EXPECT_EQ(std::this_thread::get_id(), param.ThreadId) << param.Id;
+	}
+
+	TEST(TEST_CLASS, PrefetchWithPoolProcessesSubCachePrefetchersOnPoolAndCallingThreads) {
+		// Arrange:
+		TestContext context(6);
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		context.prefetch(context.entityInfos(), *pPool);
+
+		// Assert: no threads other than the pool threads and the calling thread were used
+		auto params = context.capture().params();
+		ASSERT_EQ(6u, params.size());
+
+		std::unordered_set<std::thread::id> threadIds;
+		for (const auto& param : params)
+			threadIds.insert(param.ThreadId);
+
+		EXPECT_LE(threadIds.size(), 3u);
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchCreatesNewSubCachePrefetchersForEachCall) {
+		// Arrange:
+		TestContext context(2);
+
+		// Act:
+		TTraits::Prefetch(context, context.entityInfos());
+		TTraits::Prefetch(context, context.entityInfos());
+
+		// Assert: keys are not accumulated across calls
+		EXPECT_EQ(4u, context.numFactoryCalls());
+
+		auto params = context.capture().params();
+		ASSERT_EQ(4u, params.size());
+		for (const auto& param : params)
+			EXPECT_EQ(context.expectedNotifiedKeys(), param.NotifiedKeys) << param.Id;
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertPrefetchRethrowsSubCachePrefetcherException(size_t throwingPrefetcherId) {
+			// Arrange:
+			TestContext context(3, throwingPrefetcherId);
+
+			// Act + Assert:
+			EXPECT_THROW(TTraits::Prefetch(context, context.entityInfos()), catapult_runtime_error);
+
+			EXPECT_EQ(TTraits::NumPrefetchesAfterFailure(throwingPrefetcherId, 3), context.capture().params().size());
+		}
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchRethrowsExceptionRaisedByFirstSubCachePrefetcher) {
+		AssertPrefetchRethrowsSubCachePrefetcherException<TTraits>(0);
+	}
+
+	PREFETCH_TRAITS_BASED_TEST(PrefetchRethrowsExceptionRaisedByLastSubCachePrefetcher) {
+		AssertPrefetchRethrowsSubCachePrefetcherException<TTraits>(2);
+	}
+
+	// endregion
+
+	// region BasicSubCachePrefetcher
+
+	namespace {
+		class AccountPublicKeyPrefetcher : public BasicSubCachePrefetcher<AccountStateCache, Address, utils::ArrayHasher<Address>> {
+		public:
+			void notify(const model::Notification& notification) override {
+				const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+				add(model::PublicKeyToAddress(publicKey, model::NetworkIdentifier::Testnet));
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, BasicSubCachePrefetcherInitiallyHasNoKeys) {
+		// Act:
+		AccountPublicKeyPrefetcher prefetcher;
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	TEST(TEST_CLASS, BasicSubCachePrefetcherCollectsUniqueKeys) {
+		// Arrange:
+		AccountPublicKeyPrefetcher prefetcher;
+		auto keys = test::GenerateRandomDataVector<Key>(3);
+
+		// Act:
+		for (auto i : { 0u, 1u, 0u, 2u, 1u })
+			prefetcher.notify(model::AccountPublicKeyNotification(keys[i]));
+
+		// Assert:
+		AccountPublicKeyPrefetcher::KeySet expectedAddresses;
+		for (const auto& key : keys)
+			expectedAddresses.insert(model::PublicKeyToAddress(key, model::NetworkIdentifier::Testnet));
+
+		EXPECT_EQ(expectedAddresses, prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, BasicSubCachePrefetcherCanPrefetchFromSubCache) {
+		// Arrange:
+		auto cache = test::CreateEmptyCatapultCache();
+		auto keys = test::GenerateRandomDataVector<Key>(3);
+		{
+			auto delta = cache.createDelta();
+			delta.sub<AccountStateCache>().addAccount(keys[0], Height(1));
+			cache.commit(Height(1));
+		}
+
+		AccountPublicKeyPrefetcher prefetcher;
+		for (const auto& key : keys)
+			prefetcher.notify(model::AccountPublicKeyNotification(key));
+
+		// Act:
+		auto delta = cache.createDelta();
+		prefetcher.prefetch(delta);
+
+		// Assert: prefetching does not change the cache
+		const auto& accountStateCacheDelta = delta.sub<AccountStateCache>();
+		EXPECT_EQ(1u, accountStateCacheDelta.size());
+		EXPECT_TRUE(accountStateCacheDelta.contains(keys[0]));
+		EXPECT_FALSE(accountStateCacheDelta.contains(keys[1]));
+		EXPECT_FALSE(accountStateCacheDelta.contains(keys[2]));
+	}
+
+	// endregion
+}}
@@ -23,6 +23,7 @@
 #include "catapult/cache/CatapultCache.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -415,6 +416,37 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	TEST(TEST_CLASS, CanUpdateMerkleRootWithPoolWhenSupportedAndEnabledAndDelta) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		RunTestForMerkleRootSupportedAndEnabled([&pPool](auto& view, const auto& expectedMerkleRoot) {
+			auto expectedUpdatedMerkleRoot = expectedMerkleRoot;
+			expectedUpdatedMerkleRoot[0] = 3;
+
+			// Act: SimpleCache does not support parallel updates, so sequential update is used
+			view.updateMerkleRoot(Height(3), *pPool);
+
+			// Assert:
+			Hash256 merkleRoot;
+			EXPECT_TRUE(view.tryGetMerkleRoot(merkleRoot));
+			EXPECT_EQ(expectedUpdatedMerkleRoot, merkleRoot);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotUpdateMerkleRootWithPoolWhenSupportedAndEnabledButView) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		RunTestForMerkleRootSupportedAndEnabledView([&pPool](auto& view, const auto& expectedMerkleRoot) {
+			// Act: even if const is improperly casted away, operation should fail on const view
+			const_cast<SubCacheView&>(view).updateMerkleRoot(Height(3), *pPool);
+
+			// Assert:
+			Hash256 merkleRoot;
+			EXPECT_TRUE(view.tryGetMerkleRoot(merkleRoot));
+			EXPECT_EQ(expectedMerkleRoot, merkleRoot);
+		});
+	}
+
 	// endregion
 
 	// region prune
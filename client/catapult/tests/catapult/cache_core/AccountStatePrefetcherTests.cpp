@@ -0,0 +1,136 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/AccountStatePrefetcher.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS AccountStatePrefetcherTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Testnet;
+
+		UnresolvedAddress GenerateRandomUnresolvedAddress(bool isAlias) {
+			auto unresolvedAddress = test::GenerateRandomUnresolvedAddress();
+			unresolvedAddress[0] = static_cast<uint8_t>(isAlias ? (unresolvedAddress[0] | 1) : (unresolvedAddress[0] & 0xFE));
+			return unresolvedAddress;
+		}
+
+		Address ToAddress(const UnresolvedAddress& unresolvedAddress) {
+			return unresolvedAddress.copyTo<Address>();
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherInitiallyHasNoKeys) {
+		// Act:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsResolvedAddresses) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+		auto address = test::GenerateRandomAddress();
+
+		// Act:
+		prefetcher.notify(model::AccountAddressNotification(address));
+
+		// Assert:
+		EXPECT_EQ(AccountStatePrefetcher::KeySet({ address }), prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsUnresolvedAddressesThatAreNotAliases) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+		auto unresolvedAddress = GenerateRandomUnresolvedAddress(false);
+
+		// Act:
+		prefetcher.notify(model::AccountAddressNotification(unresolvedAddress));
+
+		// Assert:
+		EXPECT_EQ(AccountStatePrefetcher::KeySet({ ToAddress(unresolvedAddress) }), prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, PrefetcherIgnoresUnresolvedAddressesThatAreAliases) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+		auto unresolvedAddress = GenerateRandomUnresolvedAddress(true);
+
+		// Act:
+		prefetcher.notify(model::AccountAddressNotification(unresolvedAddress));
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsAddressesOfPublicKeys) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+
+		// Act:
+		prefetcher.notify(model::AccountPublicKeyNotification(publicKey));
+
+		// Assert:
+		EXPECT_EQ(AccountStatePrefetcher::KeySet({ model::PublicKeyToAddress(publicKey, Network_Identifier) }), prefetcher.keys());
+	}
+
+	TEST(TEST_CLASS, PrefetcherIgnoresOtherNotifications) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+
+		// Act:
+		prefetcher.notify(model::BalanceTransferNotification(
+				test::GenerateRandomAddress(),
+				test::GenerateRandomUnresolvedAddress(),
+				test::GenerateRandomValue<UnresolvedMosaicId>(),
+				Amount(100)));
+
+		// Assert:
+		EXPECT_TRUE(prefetcher.keys().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsUniqueAddressesFromMultipleNotifications) {
+		// Arrange:
+		AccountStatePrefetcher prefetcher(Network_Identifier);
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		auto address1 = test::GenerateRandomAddress();
+		auto address2 = model::PublicKeyToAddress(publicKey, Network_Identifier);
+		auto unresolvedAddress = GenerateRandomUnresolvedAddress(false);
+
+		// Act:
+		prefetcher.notify(model::AccountAddressNotification(address1));
+		prefetcher.notify(model::AccountPublicKeyNotification(publicKey));
+		prefetcher.notify(model::AccountAddressNotification(unresolvedAddress));
+		prefetcher.notify(model::AccountAddressNotification(address2));
+		prefetcher.notify(model::AccountAddressNotification(address1));
+		prefetcher.notify(model::AccountAddressNotification(GenerateRandomUnresolvedAddress(true)));
+
+		// Assert:
+		EXPECT_EQ(AccountStatePrefetcher::KeySet({ address1, address2, ToAddress(unresolvedAddress) }), prefetcher.keys());
+	}
+}}
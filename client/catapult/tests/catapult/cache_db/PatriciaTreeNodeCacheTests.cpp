@@ -0,0 +1,288 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		tree::TreeNode CreateRandomLeafNode() {
+			return tree::TreeNode(tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>()));
+		}
+
+		std::vector<tree::TreeNode> CreateRandomLeafNodes(size_t count) {
+			std::vector<tree::TreeNode> nodes;
+			for (auto i = 0u; i < count; ++i)
+				nodes.push_back(CreateRandomLeafNode());
+
+			return nodes;
+		}
+
+		bool Contains(const PatriciaTreeNodeCache& cache, const tree::TreeNode& node) {
+			return !cache.find(node.hash()).empty();
+		}
+
+		void AssertStatistics(
+				const PatriciaTreeNodeCache& cache,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses,
+				uint64_t expectedSize) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+			EXPECT_EQ(expectedSize, statistics.Size);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateCacheWithZeroMaxSize) {
+		EXPECT_THROW(PatriciaTreeNodeCache(0), catapult_invalid_argument);
+		EXPECT_THROW(PatriciaTreeNodeCache(0, 1), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateCache) {
+		// Act:
+		PatriciaTreeNodeCache cache(123);
+
+		// Assert:
+		EXPECT_EQ(123u, cache.maxSize());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheWithMoreShardsThanMaxSize) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(2, 16);
+		auto nodes = CreateRandomLeafNodes(10);
+
+		// Act:
+		for (const auto& node : nodes)
+			cache.add(node);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.maxSize());
+		EXPECT_GE(2u, cache.statistics().Size);
+	}
+
+	// endregion
+
+	// region add / find
+
+	TEST(TEST_CLASS, FindReturnsEmptyNodeWhenNodeIsNotCached) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		cache.add(CreateRandomLeafNode());
+
+		// Act:
+		auto node = cache.find(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_TRUE(node.empty());
+		AssertStatistics(cache, 0, 1, 1);
+	}
+
+	TEST(TEST_CLASS, CanAddAndFindLeafNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto leafNode = CreateRandomLeafNode();
+
+		// Act:
+		cache.add(leafNode);
+		auto node = cache.find(leafNode.hash());
+
+		// Assert:
+		ASSERT_TRUE(node.isLeaf());
+		EXPECT_EQ(leafNode.hash(), node.hash());
+		EXPECT_EQ(leafNode.asLeafNode().value(), node.asLeafNode().value());
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, CanAddAndFindBranchNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto branchNode = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'00));
+		branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 2);
+		branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 11);
+
+		// Act:
+		cache.add(tree::TreeNode(branchNode));
+		auto node = cache.find(branchNode.hash());
+
+		// Assert:
+		ASSERT_TRUE(node.isBranch());
+		EXPECT_EQ(branchNode.hash(), node.hash());
+		EXPECT_EQ(2u, node.asBranchNode().numLinks());
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, FindReturnsIndependentCopies) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto branchNode = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'00));
+		branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 2);
+		cache.add(tree::TreeNode(branchNode));
+
+		// Act: modify a found node
+		auto node1 = cache.find(branchNode.hash());
+		node1.setPath(tree::TreeNodePath(0x12'34'56'00));
+		auto node2 = cache.find(branchNode.hash());
+
+		// Assert: the cached node is unchanged
+		EXPECT_NE(branchNode.hash(), node1.hash());
+		EXPECT_EQ(branchNode.hash(), node2.hash());
+		EXPECT_EQ(1u, node2.asBranchNode().numLinks());
+	}
+
+	TEST(TEST_CLASS, AddingCachedNodeIsNoOp) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto leafNode = CreateRandomLeafNode();
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			cache.add(leafNode);
+
+		// Assert:
+		EXPECT_TRUE(Contains(cache, leafNode));
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, AddEvictsNodesInInsertionOrderWhenNoNodesAreReferenced) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 1);
+		auto nodes = CreateRandomLeafNodes(5);
+
+		// Act:
+		for (const auto& node : nodes)
+			cache.add(node);
+
+		// Assert: the oldest nodes were evicted
+		EXPECT_FALSE(Contains(cache, nodes[0]));
+		EXPECT_FALSE(Contains(cache, nodes[1]));
+		EXPECT_TRUE(Contains(cache, nodes[2]));
+		EXPECT_TRUE(Contains(cache, nodes[3]));
+		EXPECT_TRUE(Contains(cache, nodes[4]));
+		AssertStatistics(cache, 3, 2, 3);
+	}
+
+	TEST(TEST_CLASS, AddGivesReferencedNodesSecondChance) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 1);
+		auto nodes = CreateRandomLeafNodes(5);
+		for (auto i = 0u; i < 3; ++i)
+			cache.add(nodes[i]);
+
+		// - reference the oldest node
+		cache.find(nodes[0].hash());
+
+		// Act:
+		cache.add(nodes[3]);
+		cache.add(nodes[4]);
+
+		// Assert: the referenced node survived both evictions
+		EXPECT_TRUE(Contains(cache, nodes[0]));
+		EXPECT_FALSE(Contains(cache, nodes[1]));
+		EXPECT_FALSE(Contains(cache, nodes[2]));
+		EXPECT_TRUE(Contains(cache, nodes[3]));
+		EXPECT_TRUE(Contains(cache, nodes[4]));
+		AssertStatistics(cache, 4, 2, 3);
+	}
+
+	TEST(TEST_CLASS, AddEvictsNodeWhenAllNodesAreReferenced) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 1);
+		auto nodes = CreateRandomLeafNodes(4);
+		for (auto i = 0u; i < 3; ++i) {
+			cache.add(nodes[i]);
+			cache.find(nodes[i].hash());
+		}
+
+		// Act:
+		cache.add(nodes[3]);
+
+		// Assert: after a full sweep, the oldest node was evicted
+		EXPECT_FALSE(Contains(cache, nodes[0]));
+		EXPECT_TRUE(Contains(cache, nodes[1]));
+		EXPECT_TRUE(Contains(cache, nodes[2]));
+		EXPECT_TRUE(Contains(cache, nodes[3]));
+		AssertStatistics(cache, 6, 1, 3);
+	}
+
+	TEST(TEST_CLASS, SizeIsBoundedByMaxSize) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(20);
+		auto nodes = CreateRandomLeafNodes(200);
+
+		// Act:
+		for (const auto& node : nodes)
+			cache.add(node);
+
+		// Assert:
+		EXPECT_GE(20u, cache.statistics().Size);
+		EXPECT_TRUE(Contains(cache, nodes.back()));
+	}
+
+	// endregion
+
+	// region concurrency
+
+	TEST(TEST_CLASS, CanAccessCacheConcurrently) {
+		// Arrange:
+		constexpr auto Num_Nodes_Per_Thread = 500u;
+		auto numThreads = 2 * test::GetNumDefaultPoolThreads();
+		PatriciaTreeNodeCache cache(numThreads * Num_Nodes_Per_Thread / 2);
+
+		std::vector<std::vector<tree::TreeNode>> nodeGroups;
+		for (auto i = 0u; i < numThreads; ++i)
+			nodeGroups.push_back(CreateRandomLeafNodes(Num_Nodes_Per_Thread));
+
+		// Act: each thread adds its own nodes and then looks each of them up
+		thread::ThreadGroup threads;
+		for (const auto& nodes : nodeGroups) {
+			threads.spawn([&cache, &nodes]() {
+				for (const auto& node : nodes)
+					cache.add(node);
+
+				for (const auto& node : nodes) {
+					auto cachedNode = cache.find(node.hash());
+					EXPECT_TRUE(cachedNode.empty() || node.hash() == cachedNode.hash());
+				}
+			});
+		}
+
+		threads.join();
+
+		// Assert:
+		auto statistics = cache.statistics();
+		EXPECT_EQ(numThreads * Num_Nodes_Per_Thread, statistics.NumHits + statistics.NumMisses);
+		EXPECT_GE(cache.maxSize(), statistics.Size);
+	}
+
+	// endregion
+}}
@@ -33,12 +33,13 @@ namespace catapult { namespace cache {
 			return RocksDatabaseSettings(dbName, { "default" }, FilterPruningMode::Disabled);
 		}
 
+		template<size_t MaxNodeCacheSize>
 		class RocksDataSourceWrapper {
 		public:
 			RocksDataSourceWrapper()
 					: m_db(DefaultSettings(m_dbDirGuard.name()))
 					, m_container(m_db, 0)
-					, m_dataSource(m_container) {
+					, m_dataSource(m_container, MaxNodeCacheSize) {
 				m_container.setSize(0);
 			}
 
@@ -47,6 +48,10 @@ namespace catapult { namespace cache {
 				return m_dataSource.size();
 			}
 
+			auto nodeCacheStatistics() const {
+				return m_dataSource.nodeCacheStatistics();
+			}
+
 			tree::TreeNode get(const Hash256& hash) {
 				return m_dataSource.get(hash);
 			}
@@ -69,9 +74,87 @@ namespace catapult { namespace cache {
 		};
 
 		struct RocksDataSourceTraits {
-			using DataSourceType = RocksDataSourceWrapper;
+			using DataSourceType = RocksDataSourceWrapper<0>;
 		};
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	TEST(TEST_CLASS, NodeCacheStatisticsAreZeroWhenNodeCacheIsDisabled) {
+		// Arrange:
+		RocksDataSourceWrapper<0> dataSource;
+		dataSource.set(tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>()));
+
+		// Act:
+		auto node = dataSource.get(test::GenerateRandomByteArray<Hash256>());
+		auto statistics = dataSource.nodeCacheStatistics();
+
+		// Assert:
+		EXPECT_TRUE(node.empty());
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(0u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.Size);
+	}
+
+	TEST(TEST_CLASS, SetNodesAreAddedToNodeCache) {
+		// Arrange:
+		RocksDataSourceWrapper<3> dataSource;
+		auto leafNode = tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		dataSource.set(leafNode);
+		auto node = dataSource.get(leafNode.hash());
+		auto statistics = dataSource.nodeCacheStatistics();
+
+		// Assert:
+		EXPECT_EQ(leafNode.hash(), node.hash());
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(0u, statistics.NumMisses);
+		EXPECT_EQ(1u, statistics.Size);
+	}
+
+	TEST(TEST_CLASS, UnknownNodesAreNotAddedToNodeCache) {
+		// Arrange:
+		RocksDataSourceWrapper<3> dataSource;
+
+		// Act:
+		auto node1 = dataSource.get(test::GenerateRandomByteArray<Hash256>());
+		auto node2 = dataSource.get(test::GenerateRandomByteArray<Hash256>());
+		auto statistics = dataSource.nodeCacheStatistics();
+
+		// Assert:
+		EXPECT_TRUE(node1.empty());
+		EXPECT_TRUE(node2.empty());
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(2u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.Size);
+	}
+
+	TEST(TEST_CLASS, NodesLoadedFromContainerAreAddedToNodeCache) {
+		// Arrange: set more nodes than fit in the node cache so that some are only in the container
+		RocksDataSourceWrapper<3> dataSource;
+		std::vector<tree::LeafTreeNode> leafNodes;
+		for (auto i = 0u; i < 5; ++i) {
+			leafNodes.emplace_back(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+			dataSource.set(leafNodes.back());
+		}
+
+		// Act: load all nodes twice
+		for (auto i = 0u; i < 2; ++i) {
+			for (const auto& leafNode : leafNodes)
+				EXPECT_EQ(leafNode.hash(), dataSource.get(leafNode.hash()).hash());
+		}
+
+		auto statistics = dataSource.nodeCacheStatistics();
+
+		// Assert: all lookups are resolved (at least the evicted nodes are loaded from the container) and the node cache remains bounded
+		EXPECT_EQ(10u, statistics.NumHits + statistics.NumMisses);
+		EXPECT_LE(2u, statistics.NumMisses);
+		EXPECT_LE(1u, statistics.Size);
+		EXPECT_GE(3u, statistics.Size);
+	}
+
+	// endregion
 }}
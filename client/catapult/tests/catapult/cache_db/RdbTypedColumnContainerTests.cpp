@@ -82,6 +82,15 @@ namespace catapult { namespace cache {
 			RdbDataIterator* pIterator;
 		};
 
+		struct FindAllParamsType {
+		public:
+			explicit FindAllParamsType(const std::vector<RawBuffer>& keys) : Keys(keys)
+			{}
+
+		public:
+			std::vector<RawBuffer> Keys;
+		};
+
 		struct PruneParamsType {
 		public:
 			explicit PruneParamsType(uint64_t boundary) : Boundary(boundary)
@@ -115,6 +124,19 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				FindAllParams.push(keys);
+				if (FindAllHook)
+					FindAllHook();
+
+				iterators.clear();
+				for (auto i = 0u; i < keys.size(); ++i) {
+					RdbDataIterator iterator;
+					iterator.setFound(IsKeyFound);
+					iterators.push_back(std::move(iterator));
+				}
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -126,9 +148,11 @@ namespace catapult { namespace cache {
 		public:
 			size_t Size = 0;
 			size_t NumPruned = 0;
+			action FindAllHook;
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable test::ParamsCapture<FindAllParamsType> FindAllParams;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -152,6 +176,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.findAll(keys, iterators);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -284,6 +312,211 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region findAll + prefetch
+
+	TEST(TEST_CLASS, FindAllSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ "hello", "world", "apple" };
+		auto iters = container.findAll(keys);
+
+		// Assert:
+		ASSERT_EQ(1u, db.FindAllParams.params().size());
+		const auto& params = db.FindAllParams.params()[0];
+		ASSERT_EQ(3u, params.Keys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), params.Keys[i].pData) << "key at " << i;
+			EXPECT_EQ(keys[i].size(), params.Keys[i].Size) << "key at " << i;
+		}
+
+		ASSERT_EQ(3u, iters.size());
+		for (const auto& iter : iters)
+			EXPECT_EQ(container.cend(), iter);
+
+		EXPECT_EQ(0u, db.FindParams.params().size());
+	}
+
+	TEST(TEST_CLASS, FindAllReturnsDereferenceableIteratorsForFoundKeys) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+
+		// Act:
+		auto iters = container.findAll({ "hello", "world" });
+
+		// Assert: dereferenced values contain dummy data set by deserializer
+		ASSERT_EQ(2u, iters.size());
+		for (const auto& iter : iters) {
+			ASSERT_NE(container.cend(), iter);
+			EXPECT_EQ("world", iter->first.str());
+			EXPECT_EQ(54321, iter->second.Integer);
+		}
+	}
+
+	TEST(TEST_CLASS, FindReturnsPrefetchedElementWithoutAccessingContainer) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		container.prefetch({ "hello", "world" });
+
+		// Act:
+		auto iter = container.find("hello");
+
+		// Assert:
+		EXPECT_EQ(1u, db.FindAllParams.params().size());
+		EXPECT_EQ(0u, db.FindParams.params().size());
+
+		ASSERT_NE(container.cend(), iter);
+		EXPECT_EQ("world", iter->first.str());
+		EXPECT_EQ(54321, iter->second.Integer);
+	}
+
+	TEST(TEST_CLASS, FindCanReturnSamePrefetchedElementMultipleTimes) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		container.prefetch({ "hello", "world" });
+
+		// Act:
+		auto iter1 = container.find("hello");
+		auto iter2 = container.find("hello");
+
+		// Assert:
+		EXPECT_EQ(0u, db.FindParams.params().size());
+
+		ASSERT_NE(container.cend(), iter1);
+		ASSERT_NE(container.cend(), iter2);
+		EXPECT_EQ(&*iter1, &*iter2);
+	}
+
+	TEST(TEST_CLASS, FindReturnsCendForPrefetchedUnknownKeyWithoutAccessingContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+		container.prefetch({ "hello", "world" });
+
+		// Act:
+		auto iter = container.find("world");
+
+		// Assert:
+		EXPECT_EQ(0u, db.FindParams.params().size());
+		EXPECT_EQ(container.cend(), iter);
+	}
+
+	TEST(TEST_CLASS, FindForwardsToContainerWhenKeyIsNotPrefetched) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		container.prefetch({ "hello", "world" });
+
+		// Act:
+		auto iter = container.find("apple");
+
+		// Assert:
+		EXPECT_EQ(1u, db.FindParams.params().size());
+		EXPECT_NE(container.cend(), iter);
+	}
+
+	TEST(TEST_CLASS, PrefetchReplacesPreviouslyPrefetchedElements) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		container.prefetch({ "hello", "world" });
+
+		// Act:
+		test::StringKey key1("apple");
+		test::StringKey key2("hello");
+		container.prefetch({ key1 });
+		container.find(key1);
+		container.find(key2);
+
+		// Assert: only the key that is no longer prefetched is forwarded to container
+		EXPECT_EQ(2u, db.FindAllParams.params().size());
+		ASSERT_EQ(1u, db.FindParams.params().size());
+		EXPECT_EQ(test::AsBytePointer(key2.data()), db.FindParams.params()[0].Key.pData);
+	}
+
+	namespace {
+		template<typename TAction>
+		void AssertPrefetchedElementsAreInvalidated(TAction action, size_t numExpectedFinds) {
+			// Arrange:
+			MockDb db(true);
+			auto container = CreateContainer(db);
+			container.prefetch({ "hello", "world" });
+
+			// Act:
+			action(container);
+			container.find("hello");
+			container.find("world");
+
+			// Assert:
+			EXPECT_EQ(numExpectedFinds, db.FindParams.params().size());
+		}
+	}
+
+	TEST(TEST_CLASS, InsertInvalidatesPrefetchedElement) {
+		AssertPrefetchedElementsAreInvalidated([](auto& container) {
+			container.insert(ColumnDescriptor::StorageType("hello", { "hello", 456, 3.1415 }));
+		}, 1);
+	}
+
+	TEST(TEST_CLASS, RemoveInvalidatesPrefetchedElement) {
+		AssertPrefetchedElementsAreInvalidated([](auto& container) {
+			container.remove("world");
+		}, 1);
+	}
+
+	TEST(TEST_CLASS, PruneInvalidatesAllPrefetchedElements) {
+		AssertPrefetchedElementsAreInvalidated([](auto& container) {
+			container.prune("hello");
+		}, 2);
+	}
+
+	TEST(TEST_CLASS, ClearPrefetchedInvalidatesAllPrefetchedElements) {
+		AssertPrefetchedElementsAreInvalidated([](auto& container) {
+			container.clearPrefetched();
+		}, 2);
+	}
+
+	TEST(TEST_CLASS, PrefetchDiscardsElementsWhenContainerIsModifiedDuringPrefetch) {
+		// Arrange: modify the container while the batched lookup is in progress
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		db.FindAllHook = [&container]() {
+			container.remove("other");
+		};
+
+		// Act:
+		container.prefetch({ "hello", "world" });
+		container.find("hello");
+		container.find("world");
+
+		// Assert: the (potentially stale) prefetched elements were discarded
+		EXPECT_EQ(1u, db.FindAllParams.params().size());
+		EXPECT_EQ(2u, db.FindParams.params().size());
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotDiscardElementsWhenContainerIsModifiedBeforePrefetch) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+		container.remove("other");
+
+		// Act:
+		container.prefetch({ "hello", "world" });
+		container.find("hello");
+		container.find("world");
+
+		// Assert:
+		EXPECT_EQ(1u, db.FindAllParams.params().size());
+		EXPECT_EQ(0u, db.FindParams.params().size());
+	}
+
+	// endregion
+
 	// region iterator tests
 
 	TEST(TEST_CLASS, ConstAndNonConstDbIteratorReturnSameObject) {
@@ -211,6 +211,100 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, MultiGetWithoutKeysReturnsNoIterators) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters(2);
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, MultiGetCanReadMultipleValuesFromDb) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "hello", "apple" }, iters);
+
+		// Assert: iterators are in same order as keys
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("amazing", iters[1]);
+		test::AssertIteratorValue("incredible", iters[2]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReturnsSentinelValuesForNonexistentKeys) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "nonexistent", "hello", "world", "apple" }, iters);
+
+		// Assert:
+		ASSERT_EQ(4u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("amazing", iters[1]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[2]);
+		test::AssertIteratorValue("incredible", iters[3]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReadsFromSpecifiedColumn) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReplacesExistingIterators) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+		});
+		auto& database = context.database();
+
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "world", "apple" }, iters);
+
+		// Act:
+		database.multiGet(0, { "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(1u, iters.size());
+		test::AssertIteratorValue("amazing", iters[0]);
+	}
+
+	// endregion
+
 	// region default db ctor
 
 	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowGet) {
@@ -222,6 +316,15 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(database.get(0, "hello", iter), catapult_invalid_argument);
 	}
 
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowPut) {
 		// Arrange:
 		RocksDatabase database;
@@ -130,6 +130,29 @@ namespace catapult { namespace cache {
 
 	DEFINE_UPDATE_SET_TESTS(RdbStorageTraits)
 
+	TEST(TEST_CLASS, UpdateSetClearsPrefetchedElements) {
+		// Arrange: create two containers around the same column
+		auto databaseDirectory = test::TempDirectoryGuard::DefaultName();
+		test::RdbTestContext context(RocksDatabaseSettings(databaseDirectory, { "default" }, FilterPruningMode::Disabled));
+		Types::StorageMapType set1(context.database(), 0);
+		Types::StorageMapType set2(context.database(), 0);
+
+		// - prefetch an unknown key and insert it through the other container, which does not invalidate it
+		set1.prefetch({ "bbb" });
+		RdbStorageTraits::AddElement(set2, "bbb", 7);
+
+		// Sanity: the prefetched miss is served from memory
+		EXPECT_EQ(set1.cend(), set1.find("bbb"));
+
+		// Act: commit (empty) changes
+		Types::MemoryMapType emptySet;
+		auto deltas = deltaset::DeltaElements<Types::MemoryMapType>(emptySet, emptySet, emptySet);
+		UpdateSet<deltaset::MapKeyTraits<Types::MemoryMapType>>(set1, deltas);
+
+		// Assert: the element is loaded from the database
+		EXPECT_TRUE(RdbStorageTraits::Contains(set1, "bbb", 7));
+	}
+
 	// endregion
 
 	// region prune base set
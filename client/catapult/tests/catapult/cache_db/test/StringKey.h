@@ -54,6 +54,11 @@ namespace catapult { namespace test {
 		}
 
 	public:
+		/// Returns \c true if this is equal to \a rhs.
+		bool operator==(const StringKey& rhs) const {
+			return m_data == rhs.m_data;
+		}
+
 		/// Returns \c true if this is less than \a rhs.
 		bool operator<(const StringKey& rhs) const {
 			return m_data < rhs.m_data;
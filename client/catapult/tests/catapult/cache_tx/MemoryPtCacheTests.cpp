@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/cache_tx/MemoryPtCache.h"
+#include "catapult/cache_tx/ShortHashFilters.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/Cosignature.h"
 #include "tests/catapult/cache_tx/test/TransactionCacheTests.h"
@@ -857,6 +858,78 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region filteredUnknownTransactions
+
+	namespace {
+		ShortHashPairFilter CreateFilter(std::initializer_list<ShortHashPair> shortHashPairs) {
+			// use oversized filters so that false positives are (practically) impossible
+			ShortHashPairFilter filter{ utils::BloomFilter(1024, 17), utils::BloomFilter(1024, 17) };
+			for (const auto& shortHashPair : shortHashPairs)
+				Insert(filter, shortHashPair);
+
+			return filter;
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredUnknownTransactionsReturnsTransactionAndCosignaturesWhenTransactionIsUnknown) {
+		// Arrange:
+		RunUnknownTransactionWithCosignaturesTest([](const auto& cache, const auto& info, const auto& cosignatures, auto) {
+			// Act:
+			auto unknownInfos = cache.view().filteredUnknownTransactions(Timestamp(), CreateFilter({}));
+
+			// Assert:
+			ASSERT_EQ(1u, unknownInfos.size());
+			EXPECT_EQ(info.EntityHash, unknownInfos[0].EntityHash);
+			EXPECT_EQ(info.pEntity, unknownInfos[0].pTransaction);
+			test::AssertCosignatures(cosignatures, unknownInfos[0].Cosignatures);
+		});
+	}
+
+	TEST(TEST_CLASS, FilteredUnknownTransactionsReturnsOnlyCosignaturesWhenTransactionIsKnownButHasDifferentCosignatures) {
+		// Arrange:
+		RunUnknownTransactionWithCosignaturesTest([](const auto& cache, const auto& info, const auto& cosignatures, auto shortHashPair) {
+			// Act:
+			auto unknownInfos = cache.view().filteredUnknownTransactions(Timestamp(), CreateFilter({
+				{ shortHashPair.TransactionShortHash, utils::ShortHash() }
+			}));
+
+			// Assert:
+			ASSERT_EQ(1u, unknownInfos.size());
+			EXPECT_EQ(info.EntityHash, unknownInfos[0].EntityHash);
+			EXPECT_FALSE(!!unknownInfos[0].pTransaction);
+			test::AssertCosignatures(cosignatures, unknownInfos[0].Cosignatures);
+		});
+	}
+
+	TEST(TEST_CLASS, FilteredUnknownTransactionsReturnsNothingWhenTransactionAndCosignaturesBothMatch) {
+		// Arrange:
+		RunUnknownTransactionWithCosignaturesTest([](const auto& cache, const auto&, const auto&, auto shortHashPair) {
+			// Act:
+			auto unknownInfos = cache.view().filteredUnknownTransactions(Timestamp(), CreateFilter({ shortHashPair }));
+
+			// Assert:
+			EXPECT_TRUE(unknownInfos.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, FilteredUnknownTransactionsExcludesFalsePositives) {
+		// Arrange: create single byte filters with all bits set
+		MemoryPtCache cache(Default_Options);
+		AddAll(cache, test::CreateTransactionInfos(5));
+		ShortHashPairFilter filter{
+			utils::BloomFilter(17, 1, std::vector<uint8_t>{ 0xFF }),
+			utils::BloomFilter(17, 1, std::vector<uint8_t>{ 0xFF })
+		};
+
+		// Act:
+		auto unknownInfos = cache.view().filteredUnknownTransactions(Timestamp(), filter);
+
+		// Assert: every transaction matches the filter
+		EXPECT_TRUE(unknownInfos.empty());
+	}
+
+	// endregion
+
 	// region unknownTransactions - max response size
 
 	namespace {
@@ -20,10 +20,12 @@
 **/
 
 #include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/cache_tx/ShortHashFilters.h"
 #include "catapult/utils/ShortHash.h"
 #include "tests/catapult/cache_tx/test/TransactionCacheTests.h"
 #include "tests/test/cache/UtTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/nodeps/LockTestUtils.h"
 #include "tests/TestHarness.h"
@@ -522,6 +524,152 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEachByAscendingFeeMultiplier / forEachByDescendingFeeMultiplier
+
+	namespace {
+		struct AscendingFeeMultiplierTraits {
+			static void ForEach(const MemoryUtCacheView& view, const predicate<const model::TransactionInfo&>& consumer) {
+				view.forEachByAscendingFeeMultiplier(consumer);
+			}
+		};
+
+		struct DescendingFeeMultiplierTraits {
+			static void ForEach(const MemoryUtCacheView& view, const predicate<const model::TransactionInfo&>& consumer) {
+				view.forEachByDescendingFeeMultiplier(consumer);
+			}
+		};
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithMaxFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			// max fee multiplier of each transaction is (200 * 10 * multiplier / 10) / 200 == multiplier
+			std::vector<std::pair<uint32_t, uint32_t>> sizeMultiplierPairs;
+			for (auto feeMultiplier : feeMultipliers)
+				sizeMultiplierPairs.emplace_back(200, feeMultiplier * 10);
+
+			return test::CreateTransactionInfosFromSizeMultiplierPairs(sizeMultiplierPairs);
+		}
+
+		template<typename TTraits>
+		std::vector<size_t> ForEachByFeeMultiplier(
+				const MemoryUtCache& cache,
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			// map each visited transaction info back to its index in transactionInfos
+			std::vector<size_t> indexes;
+			TTraits::ForEach(cache.view(), [&transactionInfos, numRequested, &indexes](const auto& info) {
+				auto iter = std::find_if(transactionInfos.cbegin(), transactionInfos.cend(), [&info](const auto& transactionInfo) {
+					return transactionInfo.EntityHash == info.EntityHash;
+				});
+				indexes.push_back(static_cast<size_t>(std::distance(transactionInfos.cbegin(), iter)));
+				return numRequested != indexes.size();
+			});
+			return indexes;
+		}
+
+		template<typename TTraits>
+		void AssertForEachByFeeMultiplier(
+				const std::vector<uint32_t>& feeMultipliers,
+				size_t numRequested,
+				const std::vector<size_t>& expectedIndexes) {
+			// Arrange:
+			MemoryUtCache cache(Default_Options);
+			auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers(feeMultipliers);
+			test::AddAll(cache, transactionInfos);
+
+			// Act:
+			auto indexes = ForEachByFeeMultiplier<TTraits>(cache, transactionInfos, numRequested);
+
+			// Assert:
+			EXPECT_EQ(expectedIndexes, indexes);
+		}
+
+		const std::vector<uint32_t> Seed_Fee_Multipliers{ 3, 1, 4, 1, 5, 9, 2, 6 };
+	}
+
+	TEST(TEST_CLASS, ForEachByAscendingFeeMultiplierForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		AssertForEachByFeeMultiplier<AscendingFeeMultiplierTraits>({}, 3, {});
+	}
+
+	TEST(TEST_CLASS, ForEachByDescendingFeeMultiplierForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		AssertForEachByFeeMultiplier<DescendingFeeMultiplierTraits>({}, 3, {});
+	}
+
+	TEST(TEST_CLASS, ForEachByAscendingFeeMultiplierForwardsAllTransactionsWhenNotShortCircuited) {
+		// Assert: equal multipliers are forwarded from oldest to newest
+		AssertForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(Seed_Fee_Multipliers, 100, { 1, 3, 6, 0, 2, 4, 7, 5 });
+	}
+
+	TEST(TEST_CLASS, ForEachByDescendingFeeMultiplierForwardsAllTransactionsWhenNotShortCircuited) {
+		// Assert: equal multipliers are forwarded from oldest to newest
+		AssertForEachByFeeMultiplier<DescendingFeeMultiplierTraits>(Seed_Fee_Multipliers, 100, { 5, 7, 4, 2, 0, 6, 1, 3 });
+	}
+
+	TEST(TEST_CLASS, ForEachByAscendingFeeMultiplierForwardsSubsetOfTransactionsWhenShortCircuited) {
+		AssertForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(Seed_Fee_Multipliers, 3, { 1, 3, 6 });
+	}
+
+	TEST(TEST_CLASS, ForEachByDescendingFeeMultiplierForwardsSubsetOfTransactionsWhenShortCircuited) {
+		AssertForEachByFeeMultiplier<DescendingFeeMultiplierTraits>(Seed_Fee_Multipliers, 3, { 5, 7, 4 });
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierExcludesRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers(Seed_Fee_Multipliers);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[3].EntityHash);
+			modifier.remove(transactionInfos[4].EntityHash);
+		}
+
+		auto ascendingIndexes = ForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(cache, transactionInfos);
+		auto descendingIndexes = ForEachByFeeMultiplier<DescendingFeeMultiplierTraits>(cache, transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 6, 0, 2, 7, 5 }), ascendingIndexes);
+		EXPECT_EQ(std::vector<size_t>({ 5, 7, 2, 0, 6, 1 }), descendingIndexes);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierExcludesAllTransactionsAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers(Seed_Fee_Multipliers);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		cache.modifier().removeAll();
+
+		auto ascendingIndexes = ForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(cache, transactionInfos);
+		auto descendingIndexes = ForEachByFeeMultiplier<DescendingFeeMultiplierTraits>(cache, transactionInfos);
+
+		// Assert:
+		EXPECT_TRUE(ascendingIndexes.empty());
+		EXPECT_TRUE(descendingIndexes.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierIncludesReaddedTransactionsAsNewest) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers(Seed_Fee_Multipliers);
+		test::AddAll(cache, transactionInfos);
+
+		// Act: remove and readd the older of the transactions with multiplier 1
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[1].EntityHash);
+			modifier.add(transactionInfos[1]);
+		}
+
+		auto ascendingIndexes = ForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(cache, transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3, 1, 6, 0, 2, 4, 7, 5 }), ascendingIndexes);
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsShortHashesForAllTransactions) {
@@ -588,6 +736,38 @@ namespace catapult { namespace cache {
 
 	DEFINE_BASIC_UNKNOWN_TRANSACTIONS_TESTS(MemoryUtCacheTests, MemoryUtCacheUnknownTransactionsTraits)
 
+	namespace {
+		struct MemoryUtCacheFilteredUnknownTransactionsTraits : public MemoryUtCacheUnknownTransactionsTraits {
+		public:
+			static UnknownTransactions GetUnknownTransactions(
+					const MemoryUtCacheView& view,
+					Timestamp minDeadline,
+					const utils::ShortHashesSet& knownShortHashes) {
+				// use an oversized filter so that false positives are (practically) impossible
+				utils::BloomFilter filter(1024, 17);
+				for (auto shortHash : knownShortHashes)
+					Insert(filter, shortHash);
+
+				return view.filteredUnknownTransactions(minDeadline, BlockFeeMultiplier(10), filter);
+			}
+		};
+	}
+
+	DEFINE_BASIC_UNKNOWN_TRANSACTIONS_TESTS(MemoryUtCacheFilteredTests, MemoryUtCacheFilteredUnknownTransactionsTraits)
+
+	TEST(TEST_CLASS, FilteredUnknownTransactionsExcludesFalsePositives) {
+		// Arrange: create a single byte filter with all bits set
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(5));
+		utils::BloomFilter filter(17, 1, std::vector<uint8_t>{ 0xFF });
+
+		// Act:
+		auto transactions = cache.view().filteredUnknownTransactions(Timestamp(), BlockFeeMultiplier(10), filter);
+
+		// Assert: every transaction matches the filter
+		EXPECT_TRUE(transactions.empty());
+	}
+
 	namespace {
 		void AssertMaxResponseSizeIsRespected(uint32_t numExpectedTransactions, size_t maxResponseSize) {
 			// Arrange:
@@ -733,15 +913,232 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region sharding
+
+	namespace {
+		constexpr auto Sharded_Options = MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1), 4);
+		constexpr auto Num_Sharded_Transactions = 20u;
+
+		std::vector<Timestamp::ValueType> GetSequentialDeadlines(uint32_t count) {
+			std::vector<Timestamp::ValueType> deadlines;
+			for (auto i = 1u; i <= count; ++i)
+				deadlines.push_back(i);
+
+			return deadlines;
+		}
+
+		template<typename TTraits, typename TIsBefore>
+		void AssertShardedForEachByFeeMultiplier(TIsBefore isBefore) {
+			// Arrange: use enough transactions so that all shards are populated
+			std::vector<uint32_t> feeMultipliers;
+			for (auto i = 0u; i < Num_Sharded_Transactions; ++i)
+				feeMultipliers.push_back(Seed_Fee_Multipliers[i % Seed_Fee_Multipliers.size()] + i % 3);
+
+			MemoryUtCache cache(Sharded_Options);
+			auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers(feeMultipliers);
+			test::AddAll(cache, transactionInfos);
+
+			// - equal multipliers are forwarded from oldest to newest
+			std::vector<size_t> expectedIndexes;
+			for (auto i = 0u; i < Num_Sharded_Transactions; ++i)
+				expectedIndexes.push_back(i);
+
+			std::stable_sort(expectedIndexes.begin(), expectedIndexes.end(), [&feeMultipliers, isBefore](auto lhs, auto rhs) {
+				return isBefore(feeMultipliers[lhs], feeMultipliers[rhs]);
+			});
+
+			// Act:
+			auto indexes = ForEachByFeeMultiplier<TTraits>(cache, transactionInfos);
+
+			// Assert:
+			EXPECT_EQ(expectedIndexes, indexes);
+		}
+	}
+
+	TEST(TEST_CLASS, ShardedCacheSizesIncludeAllShards) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+
+		// Act:
+		test::AddAll(cache, test::CreateTransactionInfos(Num_Sharded_Transactions));
+
+		// Assert:
+		AssertCacheSize(cache, Num_Sharded_Transactions);
+	}
+
+	TEST(TEST_CLASS, ShardedCacheForEachForwardsTransactionsInArrivalOrder) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+		auto transactionInfos = test::CreateTransactionInfos(Num_Sharded_Transactions);
+
+		// Act:
+		test::AddAll(cache, transactionInfos);
+
+		// Assert:
+		test::AssertDeadlines(cache, GetSequentialDeadlines(Num_Sharded_Transactions));
+	}
+
+	TEST(TEST_CLASS, ShardedCacheForEachByAscendingFeeMultiplierForwardsTransactionsInGlobalOrder) {
+		AssertShardedForEachByFeeMultiplier<AscendingFeeMultiplierTraits>(std::less<uint32_t>());
+	}
+
+	TEST(TEST_CLASS, ShardedCacheForEachByDescendingFeeMultiplierForwardsTransactionsInGlobalOrder) {
+		AssertShardedForEachByFeeMultiplier<DescendingFeeMultiplierTraits>(std::greater<uint32_t>());
+	}
+
+	TEST(TEST_CLASS, ShardedCacheCanRemoveTransactionInfosByHash) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+		auto transactionInfos = test::CreateTransactionInfos(Num_Sharded_Transactions);
+		test::AddAll(cache, transactionInfos);
+		auto hashes = ExtractEverySecondHash(cache);
+
+		// Act:
+		test::RemoveAll(cache, hashes);
+
+		// Assert:
+		AssertCacheSize(cache, Num_Sharded_Transactions / 2);
+		test::AssertContainsNone(cache, hashes);
+
+		std::vector<Timestamp::ValueType> expectedDeadlines;
+		for (auto i = 2u; i <= Num_Sharded_Transactions; i += 2)
+			expectedDeadlines.push_back(i);
+
+		test::AssertDeadlines(cache, expectedDeadlines);
+	}
+
+	TEST(TEST_CLASS, ShardedCacheRemoveAllReturnsTransactionsInArrivalOrder) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+		auto transactionInfos = test::CreateTransactionInfos(Num_Sharded_Transactions);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto removedTransactionInfos = cache.modifier().removeAll();
+
+		// Assert:
+		AssertCacheSize(cache, 0);
+		test::AssertContainsNone(cache, removedTransactionInfos);
+		AssertDeadlines(removedTransactionInfos, GetSequentialDeadlines(Num_Sharded_Transactions));
+	}
+
+	TEST(TEST_CLASS, ShardedCacheShortHashesAreReturnedInArrivalOrder) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+		auto transactionInfos = test::CreateTransactionInfos(Num_Sharded_Transactions);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto shortHashes = cache.view().shortHashes();
+
+		// Assert:
+		ASSERT_EQ(Num_Sharded_Transactions, shortHashes.size());
+
+		auto i = 0u;
+		for (const auto& shortHash : shortHashes) {
+			EXPECT_EQ(utils::ToShortHash(transactionInfos[i].EntityHash), shortHash) << "at index " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, ShardedCacheUnknownTransactionsAreReturnedInArrivalOrder) {
+		// Arrange:
+		MemoryUtCache cache(Sharded_Options);
+		auto transactionInfos = test::CreateTransactionInfos(Num_Sharded_Transactions);
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet knownShortHashes;
+		for (auto i = 0u; i < Num_Sharded_Transactions; i += 2)
+			knownShortHashes.insert(utils::ToShortHash(transactionInfos[i].EntityHash));
+
+		// Act:
+		auto transactions = cache.view().unknownTransactions(Timestamp(), BlockFeeMultiplier(10), knownShortHashes);
+
+		// Assert:
+		std::vector<Timestamp::ValueType> expectedDeadlines;
+		for (auto i = 2u; i <= Num_Sharded_Transactions; i += 2)
+			expectedDeadlines.push_back(i);
+
+		AssertDeadlines(transactions, expectedDeadlines);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
-		auto CreateLockProvider() {
-			return std::make_unique<MemoryUtCache>(Default_Options);
+		template<typename TAction>
+		void RunSynchronizationTest(TAction action) {
+			// Arrange:
+			MemoryUtCache cache(Sharded_Options);
+			auto transactionInfos = test::CreateTransactionInfos(2);
+			cache.modifier().add(transactionInfos[0]);
+
+			// Act + Assert:
+			action(cache, transactionInfos);
 		}
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(MemoryUtCacheTests)
+	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) {
+		RunSynchronizationTest([](auto& cache, const auto&) {
+			test::AssertMultipleViewsCanBeAcquired(cache);
+		});
+	}
+
+	TEST(TEST_CLASS, ModifierIsBlockedByModifier) {
+		RunSynchronizationTest([](auto& cache, const auto&) {
+			test::AssertModifierIsBlockedByModifier(cache);
+		});
+	}
+
+	TEST(TEST_CLASS, ModifierAddIsBlockedByView) {
+		RunSynchronizationTest([](auto& cache, const auto& transactionInfos) {
+			test::AssertExclusiveLocks(
+					[&cache]() { return cache.view(); },
+					[&cache, &transactionInfos]() { return cache.modifier().add(transactionInfos[1]); });
+		});
+	}
+
+	TEST(TEST_CLASS, ModifierRemoveIsBlockedByView) {
+		RunSynchronizationTest([](auto& cache, const auto& transactionInfos) {
+			test::AssertExclusiveLocks(
+					[&cache]() { return cache.view(); },
+					[&cache, &transactionInfos]() { return cache.modifier().remove(transactionInfos[0].EntityHash); });
+		});
+	}
+
+	TEST(TEST_CLASS, ModifierRemoveAllIsBlockedByView) {
+		RunSynchronizationTest([](auto& cache, const auto&) {
+			test::AssertExclusiveLocks([&cache]() { return cache.view(); }, [&cache]() { return cache.modifier().removeAll(); });
+		});
+	}
+
+	TEST(TEST_CLASS, ViewIsNotBlockedByModifier) {
+		RunSynchronizationTest([](auto& cache, const auto& transactionInfos) {
+			// Arrange:
+			auto modifier = cache.modifier();
+
+			// Act: add a transaction while the modifier is still active
+			modifier.add(transactionInfos[1]);
+			auto view = cache.view();
+
+			// Assert: the view is acquired and contains all completed changes
+			EXPECT_EQ(2u, view.size());
+			EXPECT_TRUE(view.contains(transactionInfos[1].EntityHash));
+		});
+	}
+
+	TEST(TEST_CLASS, ViewIsBlockedByModifierAfterRemoveAll) {
+		RunSynchronizationTest([](auto& cache, const auto&) {
+			test::AssertExclusiveLocks(
+					[&cache]() {
+						auto modifier = cache.modifier();
+						modifier.removeAll();
+						return modifier;
+					},
+					[&cache]() { return cache.view(); });
+		});
+	}
 
 	// endregion
 }}
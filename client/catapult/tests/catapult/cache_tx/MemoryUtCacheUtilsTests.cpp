@@ -21,6 +21,7 @@
 
 #include "catapult/cache_tx/MemoryUtCacheUtils.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -40,15 +41,6 @@ namespace catapult { namespace cache {
 			return static_cast<uint32_t>(1 + (base > deadline ? base - deadline : deadline - base).unwrap());
 		}
 
-		bool CompareNaturalOrder(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
-			// test::CreateSeededMemoryUtCache seeds with transactions sorted by deadline
-			return pLhs->pEntity->Deadline < pRhs->pEntity->Deadline;
-		}
-
-		bool CompareReverseOrder(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
-			return pLhs->pEntity->Deadline > pRhs->pEntity->Deadline;
-		}
-
 		bool SelectAllFilter(const model::TransactionInfo&) {
 			return true;
 		}
@@ -64,19 +56,12 @@ namespace catapult { namespace cache {
 				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, SelectAllFilter);
 			}
 		};
-
-		struct GetFirstSortedFilteredTraits {
-			static auto GetFirst(const MemoryUtCacheView& utCacheView, uint32_t count, const EmbeddedCountRetriever& countRetriever) {
-				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, CompareNaturalOrder, SelectAllFilter);
-			}
-		};
 	}
 
 #define GET_FIRST_TRAITS_BASED_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_Ordinal) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrdinalTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Filtered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstFilteredTraits>(); } \
-	TEST(TEST_CLASS, TEST_NAME##_SortedFiltered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstSortedFilteredTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// endregion
@@ -154,81 +139,79 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	// region SortedFiltered
+	// region FeeMultiplierOrdered
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesSorting_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		auto utCacheView = pUtCache->view();
+	namespace {
+		std::unique_ptr<MemoryUtCache> CreateMemoryUtCacheWithMaxFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			// max fee multiplier of each transaction is (200 * 10 * multiplier / 10) / 200 == multiplier
+			std::vector<std::pair<uint32_t, uint32_t>> sizeMultiplierPairs;
+			for (auto feeMultiplier : feeMultipliers)
+				sizeMultiplierPairs.emplace_back(200, feeMultiplier * 10);
+
+			auto cacheOptions = MemoryCacheOptions(utils::FileSize::FromKilobytes(1), utils::FileSize::FromMegabytes(1));
+			auto pUtCache = std::make_unique<MemoryUtCache>(cacheOptions);
+			test::AddAll(*pUtCache, test::CreateTransactionInfosFromSizeMultiplierPairs(sizeMultiplierPairs));
+			return pUtCache;
+		}
 
-		// Act: apply a reverse sort
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareReverseOrder, [](const auto&) {
-			return true;
-		});
+		uint64_t GetMaxFeeMultiplier(const model::TransactionInfo& transactionInfo) {
+			return transactionInfo.pEntity->MaxFee.unwrap() / transactionInfo.pEntity->Size;
+		}
 
-		// Assert: (9, 8, 7) should be returned; if count was applied first, wrong (2, 1, 0) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[10 - i - 1], *transactionInfos[i], "transaction at " + std::to_string(i));
-	}
+		void AssertMaxFeeMultipliers(
+				const std::vector<const model::TransactionInfo*>& transactionInfos,
+				const std::vector<uint32_t>& expectedFeeMultipliers) {
+			std::vector<uint32_t> feeMultipliers;
+			for (const auto* pTransactionInfo : transactionInfos)
+				feeMultipliers.push_back(static_cast<uint32_t>(GetMaxFeeMultiplier(*pTransactionInfo)));
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesStableSorting_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		test::AddAll(*pUtCache, test::CreateTransactionInfos(4, [](auto i) {
-			return 0 == i % 2 ? Timestamp(10) : Timestamp(9);
-		}));
-		auto utCacheView = pUtCache->view();
+			EXPECT_EQ(expectedFeeMultipliers, feeMultipliers);
+		}
 
-		// Act: apply a reverse sort
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 4, CountAsOne, CompareReverseOrder, [](const auto&) {
-			return true;
-		});
+		void AssertFeeMultiplierOrdering(
+				uint32_t numRequested,
+				FeeMultiplierOrder order,
+				const std::vector<uint32_t>& expectedFeeMultipliers) {
+			// Arrange:
+			auto pUtCache = CreateMemoryUtCacheWithMaxFeeMultipliers({ 3, 1, 4, 1, 5, 9, 2, 6 });
+			auto utCacheView = pUtCache->view();
+
+			// Act:
+			auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, numRequested, CountAsOne, order, SelectAllFilter);
 
-		// Assert:
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 14);
-		ASSERT_EQ(4u, transactionInfos.size());
-		test::AssertEqual(*allTransactionInfos[9], *transactionInfos[0], "transaction at 0");
-		test::AssertEqual(*allTransactionInfos[10], *transactionInfos[1], "transaction at 1");
-		test::AssertEqual(*allTransactionInfos[12], *transactionInfos[2], "transaction at 2");
-		test::AssertEqual(*allTransactionInfos[8], *transactionInfos[3], "transaction at 3");
+			// Assert:
+			AssertMaxFeeMultipliers(transactionInfos, expectedFeeMultipliers);
+		}
 	}
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesFiltering_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		auto utCacheView = pUtCache->view();
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosWhenZeroAreRequested_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(0, FeeMultiplierOrder::Ascending, {});
+		AssertFeeMultiplierOrdering(0, FeeMultiplierOrder::Descending, {});
+	}
 
-		// Act: filter odd deadline txes
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareNaturalOrder, [](
-				const auto& transactionInfo) {
-			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
-		});
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrdering_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(3, FeeMultiplierOrder::Ascending, { 1, 1, 2 });
+		AssertFeeMultiplierOrdering(10, FeeMultiplierOrder::Ascending, { 1, 1, 2, 3, 4, 5, 6, 9 });
+	}
 
-		// Assert: (1, 3, 5) should be returned; if count was applied first, wrong (1) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[1 + i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrdering_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(3, FeeMultiplierOrder::Descending, { 9, 6, 5 });
+		AssertFeeMultiplierOrdering(10, FeeMultiplierOrder::Descending, { 9, 6, 5, 4, 3, 2, 1, 1 });
 	}
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesSortingAndFiltering_SortedFiltered) {
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesOrderingAndFiltering_FeeMultiplierOrdered) {
 		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
+		auto pUtCache = CreateMemoryUtCacheWithMaxFeeMultipliers({ 3, 1, 4, 1, 5, 9, 2, 6 });
 		auto utCacheView = pUtCache->view();
 
-		// Act: apply a reverse sort AND filter odd deadline txes
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareReverseOrder, [](
+		// Act: filter odd multiplier txes
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, FeeMultiplierOrder::Descending, [](
 				const auto& transactionInfo) {
-			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+			return 0 == GetMaxFeeMultiplier(transactionInfo) % 2;
 		});
 
-		// Assert: (9, 7, 5) should be returned; if count was applied first, wrong (1) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[9 - i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
+		// Assert: (6, 4, 2) should be returned; if count was applied first, wrong (6) would be returned
+		AssertMaxFeeMultipliers(transactionInfos, { 6, 4, 2 });
 	}
 
 	// endregion
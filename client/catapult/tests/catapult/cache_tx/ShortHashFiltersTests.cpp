@@ -0,0 +1,131 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/ShortHashFilters.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS ShortHashFiltersTests
+
+	namespace {
+		constexpr size_t Num_Values = 100;
+
+		std::vector<utils::ShortHash> GenerateShortHashes(size_t count) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(test::GenerateRandomValue<utils::ShortHash>());
+
+			return shortHashes;
+		}
+
+		std::vector<ShortHashPair> GenerateShortHashPairs(size_t count) {
+			std::vector<ShortHashPair> shortHashPairs;
+			for (auto i = 0u; i < count; ++i)
+				shortHashPairs.push_back({ test::GenerateRandomValue<utils::ShortHash>(), test::GenerateRandomValue<utils::ShortHash>() });
+
+			return shortHashPairs;
+		}
+	}
+
+	// region short hashes
+
+	TEST(TEST_CLASS, CanCreateShortHashesFilterAroundEmptyRange) {
+		// Act:
+		auto filter = CreateShortHashesFilter(model::ShortHashRange(), 17);
+
+		// Assert:
+		EXPECT_EQ(17u, filter.seed());
+		EXPECT_EQ(1u, filter.data().size());
+		EXPECT_FALSE(MightContain(filter, test::GenerateRandomValue<utils::ShortHash>()));
+	}
+
+	TEST(TEST_CLASS, ShortHashesFilterContainsAllInputShortHashes) {
+		// Arrange:
+		auto shortHashes = GenerateShortHashes(Num_Values);
+
+		// Act:
+		auto filter = CreateShortHashesFilter(model::ShortHashRange::CopyFixed(
+				reinterpret_cast<const uint8_t*>(shortHashes.data()),
+				shortHashes.size()), 17);
+
+		// Assert:
+		EXPECT_EQ(17u, filter.seed());
+		EXPECT_EQ(Num_Values, filter.data().size());
+		for (auto shortHash : shortHashes)
+			EXPECT_TRUE(MightContain(filter, shortHash)) << shortHash;
+	}
+
+	// endregion
+
+	// region short hash pairs
+
+	TEST(TEST_CLASS, CanCreateShortHashPairFilterAroundEmptyRange) {
+		// Act:
+		auto filter = CreateShortHashPairFilter(ShortHashPairRange(), 17);
+
+		// Assert:
+		EXPECT_EQ(17u, filter.TransactionShortHashes.seed());
+		EXPECT_EQ(17u, filter.ShortHashPairs.seed());
+		EXPECT_FALSE(MightContainTransaction(filter, test::GenerateRandomValue<utils::ShortHash>()));
+		EXPECT_FALSE(MightContain(filter, { test::GenerateRandomValue<utils::ShortHash>(), utils::ShortHash() }));
+	}
+
+	TEST(TEST_CLASS, ShortHashPairFilterContainsAllInputShortHashPairs) {
+		// Arrange:
+		auto shortHashPairs = GenerateShortHashPairs(Num_Values);
+
+		// Act:
+		auto filter = CreateShortHashPairFilter(ShortHashPairRange::CopyFixed(
+				reinterpret_cast<const uint8_t*>(shortHashPairs.data()),
+				shortHashPairs.size()), 17);
+
+		// Assert:
+		EXPECT_EQ(Num_Values, filter.TransactionShortHashes.data().size());
+		EXPECT_EQ(Num_Values, filter.ShortHashPairs.data().size());
+		for (const auto& shortHashPair : shortHashPairs) {
+			EXPECT_TRUE(MightContainTransaction(filter, shortHashPair.TransactionShortHash)) << shortHashPair.TransactionShortHash;
+			EXPECT_TRUE(MightContain(filter, shortHashPair)) << shortHashPair.TransactionShortHash;
+		}
+	}
+
+	TEST(TEST_CLASS, ShortHashPairFilterDistinguishesCosignaturesShortHashes) {
+		// Arrange:
+		auto shortHashPairs = GenerateShortHashPairs(Num_Values);
+		auto filter = CreateShortHashPairFilter(ShortHashPairRange::CopyFixed(
+				reinterpret_cast<const uint8_t*>(shortHashPairs.data()),
+				shortHashPairs.size()), 17);
+
+		// Act: change all cosignatures short hashes
+		auto numPairMatches = 0u;
+		for (auto shortHashPair : shortHashPairs) {
+			shortHashPair.CosignaturesShortHash = utils::ShortHash(shortHashPair.CosignaturesShortHash.unwrap() ^ 0xFFFF'FFFF);
+			if (MightContain(filter, shortHashPair))
+				++numPairMatches;
+		}
+
+		// Assert: only (rare) false positives match
+		EXPECT_GT(10u, numPairMatches);
+	}
+
+	// endregion
+}}
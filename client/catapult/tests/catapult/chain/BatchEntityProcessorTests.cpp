@@ -20,7 +20,9 @@
 **/
 
 #include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/MockExecutionConfiguration.h"
 #include "tests/TestHarness.h"
 
@@ -269,4 +271,343 @@ namespace catapult { namespace chain {
 		context.assertContexts(Height(248), Timestamp(725));
 		context.assertEntityInfos(entityInfos);
 	}
+
+	// region state prefetcher
+
+	namespace {
+		struct PrefetchCapture {
+			size_t NumNotifications = 0;
+			size_t NumPrefetches = 0;
+			size_t NumObserverCallsAtPrefetch = 0;
+		};
+
+		class MockSubCachePrefetcher : public cache::SubCachePrefetcher {
+		public:
+			MockSubCachePrefetcher(PrefetchCapture& capture, const test::MockAggregateNotificationObserver& observer)
+					: m_capture(capture)
+					, m_observer(observer)
+			{}
+
+		public:
+			void notify(const model::Notification&) override {
+				++m_capture.NumNotifications;
+			}
+
+			void prefetch(const cache::CatapultCacheDelta&) const override {
+				++m_capture.NumPrefetches;
+				m_capture.NumObserverCallsAtPrefetch = m_observer.params().size();
+			}
+
+		private:
+			PrefetchCapture& m_capture;
+			const test::MockAggregateNotificationObserver& m_observer;
+		};
+	}
+
+	namespace {
+		template<typename TCreateProcessor>
+		void AssertStatePrefetcherIsCalledBeforeEntitiesAreExecuted(TCreateProcessor createProcessor) {
+			// Arrange:
+			PrefetchCapture capture;
+			test::MockExecutionConfiguration executionConfig;
+			const auto& observer = *executionConfig.pObserver;
+			auto pStatePrefetcher = std::make_shared<cache::StatePrefetcher>(std::vector<cache::SubCachePrefetcherFactory>{
+				[&capture, &observer]() { return std::make_unique<MockSubCachePrefetcher>(capture, observer); }
+			});
+			executionConfig.Config.pStatePrefetcher = pStatePrefetcher;
+			auto processor = createProcessor(executionConfig.Config);
+
+			auto pBlock = test::GenerateBlockWithTransactions(3);
+			auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+			auto cache = test::CreateCatapultCacheWithMarkerAccount();
+			auto delta = cache.createDelta();
+			auto observerState = observers::ObserverState(delta);
+
+			// Act:
+			auto result = processor(Height(247), Timestamp(723), entityInfos, observerState);
+
+			// Assert: prefetcher was passed all notifications (two per entity) before any observer was called
+			EXPECT_EQ(ValidationResult::Success, result);
+			EXPECT_EQ(8u, capture.NumNotifications);
+			EXPECT_EQ(1u, capture.NumPrefetches);
+			EXPECT_EQ(0u, capture.NumObserverCallsAtPrefetch);
+
+			// - publisher was called twice for each entity (once for prefetching and once for execution)
+			EXPECT_EQ(8u, executionConfig.pNotificationPublisher->params().size());
+			EXPECT_EQ(8u, executionConfig.pObserver->params().size());
+		}
+	}
+
+	TEST(TEST_CLASS, StatePrefetcherIsCalledBeforeEntitiesAreExecuted) {
+		AssertStatePrefetcherIsCalledBeforeEntitiesAreExecuted([](const auto& config) {
+			return CreateBatchEntityProcessor(config);
+		});
+	}
+
+	TEST(TEST_CLASS, StatePrefetcherIsCalledBeforeEntitiesAreExecutedWhenPoolIsProvided) {
+		auto pPool = test::CreateStartedIoThreadPool();
+		AssertStatePrefetcherIsCalledBeforeEntitiesAreExecuted([&pool = *pPool](const auto& config) {
+			return CreateBatchEntityProcessor(config, pool);
+		});
+	}
+
+	// endregion
+
+	// region SpeculativeValidationStatistics
+
+	TEST(TEST_CLASS, CanCreateSpeculativeValidationStatistics) {
+		// Act:
+		SpeculativeValidationStatistics statistics;
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.numSpeculativeResults());
+		EXPECT_EQ(0u, statistics.numReusedResults());
+	}
+
+	TEST(TEST_CLASS, CanAddBatchesToSpeculativeValidationStatistics) {
+		// Arrange:
+		SpeculativeValidationStatistics statistics;
+
+		// Act:
+		statistics.addBatch(10, 7);
+		statistics.addBatch(5, 0);
+		statistics.addBatch(8, 8);
+
+		// Assert:
+		EXPECT_EQ(23u, statistics.numSpeculativeResults());
+		EXPECT_EQ(15u, statistics.numReusedResults());
+	}
+
+	// endregion
+
+	// region speculative - test utils
+
+	namespace {
+		// publishes an account address notification for every entity (using the entity hash as the address)
+		// and an additional unregistered notification for every entity with a zero first hash byte
+		class AddressNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				auto address = ToAddress(entityInfo.hash());
+				subscriber.notify(model::AccountAddressNotification(address.copyTo<UnresolvedAddress>()));
+
+				if (0 == entityInfo.hash()[0])
+					subscriber.notify(test::MockNotification(entityInfo.hash(), 1));
+			}
+
+		public:
+			static Address ToAddress(const Hash256& hash) {
+				Address address;
+				std::memcpy(address.data(), hash.data(), Address::Size);
+				return address;
+			}
+		};
+
+		// fails when an account with the notification address is already present
+		// (this validator is thread safe because it is called concurrently during speculation)
+		class UniqueAddressValidator : public stateful::AggregateNotificationValidator {
+		public:
+			UniqueAddressValidator() : m_name("UniqueAddressValidator")
+			{}
+
+		public:
+			size_t numValidateCalls() const {
+				return m_numValidateCalls;
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				++m_numValidateCalls;
+				if (model::AccountAddressNotification::Notification_Type != notification.Type)
+					return ValidationResult::Success;
+
+				const auto& addressNotification = static_cast<const model::AccountAddressNotification&>(notification);
+				auto address = addressNotification.Address.resolved(context.Resolvers);
+				const auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
+				return accountStateCache.contains(address) ? ValidationResult::Failure : ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			mutable std::atomic<size_t> m_numValidateCalls = 0;
+		};
+
+		// adds an account for every account address notification
+		class AddAccountObserver : public observers::AggregateNotificationObserver {
+		public:
+			AddAccountObserver() : m_name("AddAccountObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			void notify(const model::Notification& notification, observers::ObserverContext& context) const override {
+				if (model::AccountAddressNotification::Notification_Type != notification.Type)
+					return;
+
+				const auto& addressNotification = static_cast<const model::AccountAddressNotification&>(notification);
+				auto address = addressNotification.Address.resolved(context.Resolvers);
+				context.Cache.sub<cache::AccountStateCache>().addAccount(address, context.Height);
+			}
+
+		private:
+			std::string m_name;
+		};
+
+		struct ProcessResult {
+			ValidationResult Result;
+			size_t NumValidateCalls;
+			size_t NumAccounts;
+			uint64_t NumSpeculativeResults;
+			uint64_t NumReusedResults;
+		};
+
+		class SpeculativeProcessorTestContext {
+		public:
+			explicit SpeculativeProcessorTestContext(const std::vector<uint8_t>& hashSeeds)
+					: m_pBlock(test::GenerateBlockWithTransactions(hashSeeds.size()))
+					, m_pPool(test::CreateStartedIoThreadPool(1)) {
+				for (auto seed : hashSeeds) {
+					Hash256 hash;
+					std::memset(hash.data(), seed & 0xF0, Hash256::Size);
+					hash[1] = static_cast<uint8_t>(seed & 0x0F);
+					m_hashes.push_back(hash);
+				}
+
+				auto i = 0u;
+				for (const auto& transaction : m_pBlock->Transactions())
+					m_entityInfos.emplace_back(transaction, m_hashes[i++]);
+			}
+
+		public:
+			ProcessResult process(bool isSpeculative) {
+				auto pValidator = std::make_shared<UniqueAddressValidator>();
+				chain::ExecutionConfiguration config;
+				config.Network.Identifier = test::Mock_Execution_Configuration_Network_Identifier;
+				config.ResolverContextFactory = [](const auto&) { return model::ResolverContext(); };
+				config.pObserver = std::make_shared<AddAccountObserver>();
+				config.pValidator = pValidator;
+				config.pNotificationPublisher = std::make_shared<AddressNotificationPublisher>();
+				config.pNotificationAccessExtractor = std::make_shared<model::NotificationAccessExtractor>(config.Network.Identifier);
+
+				auto pStatistics = std::make_shared<SpeculativeValidationStatistics>();
+				auto processor = isSpeculative
+						? CreateSpeculativeBatchEntityProcessor(config, *m_pPool, pStatistics)
+						: CreateBatchEntityProcessor(config);
+
+				auto cache = test::CreateCatapultCacheWithMarkerAccount();
+				auto delta = cache.createDelta();
+				auto observerState = observers::ObserverState(delta);
+				auto numInitialAccounts = delta.sub<cache::AccountStateCache>().size();
+				auto result = processor(Height(246), Timestamp(721), m_entityInfos, observerState);
+				return {
+					result,
+					pValidator->numValidateCalls(),
+					delta.sub<cache::AccountStateCache>().size() - numInitialAccounts,
+					pStatistics->numSpeculativeResults(),
+					pStatistics->numReusedResults()
+				};
+			}
+
+		private:
+			std::unique_ptr<model::Block> m_pBlock;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::vector<Hash256> m_hashes;
+			model::WeakEntityInfos m_entityInfos;
+		};
+
+		ProcessResult AssertSpeculativeProcessorIsEquivalent(const std::vector<uint8_t>& hashSeeds) {
+			// Arrange:
+			SpeculativeProcessorTestContext context(hashSeeds);
+
+			// Act:
+			auto defaultResult = context.process(false);
+			auto speculativeResult = context.process(true);
+
+			// Assert: speculation does not change processing results
+			EXPECT_EQ(defaultResult.Result, speculativeResult.Result);
+			EXPECT_EQ(defaultResult.NumAccounts, speculativeResult.NumAccounts);
+			return speculativeResult;
+		}
+	}
+
+	// endregion
+
+	// region speculative
+
+	TEST(TEST_CLASS, CannotCreateSpeculativeProcessorWithoutNotificationAccessExtractor) {
+		// Arrange:
+		test::MockExecutionConfiguration executionConfig;
+		auto pPool = test::CreateStartedIoThreadPool(1);
+
+		// Act + Assert:
+		auto pStatistics = std::make_shared<SpeculativeValidationStatistics>();
+		EXPECT_THROW(CreateSpeculativeBatchEntityProcessor(executionConfig.Config, *pPool, pStatistics), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, SpeculativeProcessorCanProcessZeroEntities) {
+		// Act:
+		auto result = AssertSpeculativeProcessorIsEquivalent({});
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, result.Result);
+		EXPECT_EQ(0u, result.NumValidateCalls);
+		EXPECT_EQ(0u, result.NumSpeculativeResults);
+		EXPECT_EQ(0u, result.NumReusedResults);
+	}
+
+	TEST(TEST_CLASS, SpeculativeProcessorReusesValidationResultsOfIndependentEntities) {
+		// Act:
+		auto result = AssertSpeculativeProcessorIsEquivalent({ 0x11, 0x12, 0x13, 0x14 });
+
+		// Assert: each entity is only validated speculatively
+		EXPECT_EQ(ValidationResult::Success, result.Result);
+		EXPECT_EQ(4u, result.NumValidateCalls);
+		EXPECT_EQ(4u, result.NumAccounts);
+		EXPECT_EQ(4u, result.NumSpeculativeResults);
+		EXPECT_EQ(4u, result.NumReusedResults);
+	}
+
+	TEST(TEST_CLASS, SpeculativeProcessorRevalidatesConflictingEntities) {
+		// Act: third entity reads the account written by the first one
+		auto result = AssertSpeculativeProcessorIsEquivalent({ 0x11, 0x12, 0x11, 0x14 });
+
+		// Assert: third entity passes speculative validation but fails serial validation
+		EXPECT_EQ(ValidationResult::Failure, result.Result);
+		EXPECT_EQ(4u + 1, result.NumValidateCalls);
+		EXPECT_EQ(2u, result.NumAccounts);
+		EXPECT_EQ(4u, result.NumSpeculativeResults);
+		EXPECT_EQ(2u, result.NumReusedResults);
+	}
+
+	TEST(TEST_CLASS, SpeculativeProcessorRevalidatesAllEntitiesFollowingUnknownNotification) {
+		// Act: second entity raises a notification with unknown access
+		auto result = AssertSpeculativeProcessorIsEquivalent({ 0x11, 0x02, 0x13, 0x14 });
+
+		// Assert:
+		// - speculation: one call for each address notification (unknown notification is not speculatively validated)
+		// - serial: one call for unknown notification and one call for each address notification following it
+		EXPECT_EQ(ValidationResult::Success, result.Result);
+		EXPECT_EQ(4u + 1 + 2, result.NumValidateCalls);
+		EXPECT_EQ(4u, result.NumAccounts);
+		EXPECT_EQ(4u, result.NumSpeculativeResults);
+		EXPECT_EQ(2u, result.NumReusedResults);
+	}
+
+	// endregion
 }}
@@ -115,7 +115,8 @@ namespace catapult { namespace chain {
 				return ConsumerMode::Normal == mode ? context.BlockRangeConsumerCalls : 0;
 			};
 
-			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, blockRangeConsumer);
+			// - local hashes are pulled from the mock chain api
+			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, {}, blockRangeConsumer);
 		}
 
 		disruptor::ConsumerCompletionResult CreateContinueResult() {
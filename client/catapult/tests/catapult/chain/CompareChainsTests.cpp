@@ -784,6 +784,129 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region hash (local hash height supplier)
+
+	namespace {
+		CompareChainsOptions CreateCompareChainsOptions(
+				uint32_t hashesPerBatch,
+				Height::ValueType finalizedHeight,
+				const CompareHashesMockChainApi& local) {
+			auto options = CreateCompareChainsOptions(hashesPerBatch, finalizedHeight);
+			options.LocalHashHeightSupplier = [&local](const auto& hash) {
+				const auto& hashes = local.m_hashes;
+				auto iter = std::find(hashes.cbegin(), hashes.cend(), hash);
+				return hashes.cend() == iter ? Height() : Height(static_cast<Height::ValueType>(iter - hashes.cbegin() + 1));
+			};
+			return options;
+		}
+	}
+
+	TEST(TEST_CLASS, RemoteIsForkedWhenTheFirstLocalAndRemoteHashesDoNotMatch_LocalHashHeightSupplier) {
+		// Arrange: Local { A, B, C }, Remote { D, B, C }
+		CompareHashesMockChainApi local(ChainScore(10), Height(3));
+		CompareHashesMockChainApi remote(ChainScore(11), Height(3));
+		remote.syncHashes(local, 0, 0);
+		remote.m_hashes[0] = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(1000, 1, local)).get();
+
+		// Assert:
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Forked, result.Code);
+		AssertDefaultChainStatistics(result);
+		EXPECT_TRUE(local.hashesFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, RemoteLiedAboutChainScoreWhenLocalContainsAllHashesInRemoteChain_LocalHashHeightSupplier) {
+		// Arrange: Local { ... A, B, C }, Remote { ... A, B, C }
+		CompareHashesMockChainApi local(ChainScore(10), Height(103));
+		CompareHashesMockChainApi remote(ChainScore(11), Height(103));
+		remote.syncHashes(local, 0, 0);
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(20, 1, local)).get();
+
+		// Assert:
+		EXPECT_EQ(ChainComparisonCode::Remote_Lied_About_Chain_Score, result.Code);
+		AssertDefaultChainStatistics(result);
+		EXPECT_TRUE(local.hashesFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, RemoteIsNotSyncedWhenLocalIsSmallerThanRemoteChainAndContainsAllHashesInRemoteChain_LocalHashHeightSupplier) {
+		// Arrange: Local { ... A, B }, Remote { ... A, B, C }
+		CompareHashesMockChainApi local(ChainScore(10), Height(102));
+		CompareHashesMockChainApi remote(ChainScore(11), Height(103));
+		remote.syncHashes(local, 0, 1);
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(20, 1, local)).get();
+
+		// Assert:
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+		EXPECT_EQ(Height(102), result.CommonBlockHeight);
+		EXPECT_EQ(0u, result.ForkDepth);
+		EXPECT_TRUE(local.hashesFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, RemoteIsNotSyncedDeepFork_LocalHashHeightSupplier) {
+		// Arrange: Local { ..., A, B, C, D, ... }, Remote { ..., A, B, C, E, ... }
+		static constexpr auto Finalized_Height = Height(7);
+
+		CompareHashesMockChainApi local(ChainScore(10), Finalized_Height + Height(111));
+		CompareHashesMockChainApi remote(ChainScore(11), Finalized_Height + Height(111));
+		remote.syncHashes(local, 54 - 118, 118 - 54);
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(20, Finalized_Height.unwrap(), local)).get();
+
+		// Assert: same result and remote requests as when local hashes are pulled
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+		EXPECT_EQ(Height(54), result.CommonBlockHeight);
+		EXPECT_EQ(118u - 54, result.ForkDepth);
+
+		auto expectedHashesFromRequests = std::vector<std::pair<Height, uint32_t>>{
+			{ Height(7), 20 },
+			{ Height(62), 20 }, // (7 + 118) / 2
+			{ Height(34), 20 }, // (7 + 62) / 2
+			{ Height(48), 20 } // (34 + 62) / 2
+		};
+		EXPECT_TRUE(local.hashesFromRequests().empty());
+		EXPECT_EQ(expectedHashesFromRequests, remote.hashesFromRequests());
+	}
+
+	TEST(TEST_CLASS, RemoteHasSmallerBatchSizeThanLocal_LocalHashHeightSupplier) {
+		// Arrange: Local { ..., A, B }, Remote { ..., C, D, E, F }
+		// - batch sizes: { remote = 100, local = 1210 }
+		CompareHashesMockChainApi local(ChainScore(10), Height(4261));
+		CompareHashesMockChainApi remote(ChainScore(11), Height(4263));
+		local.syncHashes(remote, -4, 2);
+		remote.setMaxHashesBatchSize(100);
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(1210, 1, local)).get();
+
+		// Assert:
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+		EXPECT_EQ(Height(4259), result.CommonBlockHeight);
+		EXPECT_EQ(2u, result.ForkDepth);
+		EXPECT_TRUE(local.hashesFromRequests().empty());
+		EXPECT_EQ(7u, remote.hashesFromRequests().size());
+	}
+
+	TEST(TEST_CLASS, LocalChainStatisticsExceptionIsPropagatedDuringHashComparison_LocalHashHeightSupplier) {
+		// Arrange: queue an exception for the chain statistics request issued after the remote hashes are pulled
+		CompareHashesMockChainApi local(ChainScore(10), Height(10));
+		CompareHashesMockChainApi remote(ChainScore(11), Height(10));
+		remote.syncHashes(local, 0, 0);
+		local.pushChainScore(ChainScore(10));
+		local.pushChainScore(CompareHashesMockChainApi::ChainScoreExceptionTrigger());
+
+		// Act + Assert:
+		EXPECT_THROW(CompareChains(local, remote, CreateCompareChainsOptions(20, 1, local)).get(), catapult_runtime_error);
+	}
+
+	// endregion
+
 	// region regression tests
 
 	TEST(TEST_CLASS, RemoteHasSmallerBatchSizeThanLocal) {
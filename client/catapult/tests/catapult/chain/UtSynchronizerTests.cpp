@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/chain/UtSynchronizer.h"
+#include "catapult/cache_tx/ShortHashFilters.h"
 #include "tests/catapult/chain/test/MockTransactionApi.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/other/EntitiesSynchronizerTestUtils.h"
@@ -100,4 +101,102 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_CONDITIONAL_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region filtered
+
+#define TEST_CLASS UtSynchronizerTests
+
+	namespace {
+		struct FilteredTestContext {
+		public:
+			explicit FilteredTestContext(uint32_t numShortHashes)
+					: ShortHashes(UtSynchronizerTraits::CreateRequestRange(numShortHashes))
+					, NumConsumerCalls(0)
+			{}
+
+		public:
+			model::ShortHashRange ShortHashes;
+			size_t NumConsumerCalls;
+		};
+
+		auto CreateFilteredSynchronizer(FilteredTestContext& context, bool shouldExecute = true) {
+			return CreateFilteredUtSynchronizer(
+					BlockFeeMultiplier(17),
+					[]() { return Timestamp(84); },
+					[&context]() { return model::ShortHashRange::CopyRange(context.ShortHashes); },
+					[&context](const auto&) { ++context.NumConsumerCalls; },
+					[shouldExecute]() { return shouldExecute; });
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerSendsFilterContainingAllKnownShortHashes) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(test::CreateTransactionEntityRange(3));
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		EXPECT_TRUE(remoteApi.utRequests().empty());
+
+		ASSERT_EQ(1u, remoteApi.filteredUtRequests().size());
+		const auto& request = remoteApi.filteredUtRequests()[0];
+		EXPECT_EQ(Timestamp(84), request.Deadline);
+		EXPECT_EQ(BlockFeeMultiplier(17), request.FeeMultiplier);
+		EXPECT_EQ(5u, request.ShortHashesFilter.data().size());
+		for (auto shortHash : context.ShortHashes)
+			EXPECT_TRUE(cache::MightContain(request.ShortHashesFilter, shortHash)) << shortHash;
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerUsesDifferentSeedForEachRequest) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(test::CreateTransactionEntityRange(3));
+
+		// Act:
+		synchronizer(remoteApi).get();
+		synchronizer(remoteApi).get();
+
+		// Assert:
+		ASSERT_EQ(2u, remoteApi.filteredUtRequests().size());
+		EXPECT_NE(remoteApi.filteredUtRequests()[0].ShortHashesFilter.seed(), remoteApi.filteredUtRequests()[1].ShortHashesFilter.seed());
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerFailsWhenRemoteApiThrows) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context);
+		MockRemoteApi remoteApi(test::CreateTransactionEntityRange(3));
+		remoteApi.setError(MockRemoteApi::EntryPoint::Filtered_Unconfirmed_Transactions);
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+		EXPECT_EQ(1u, remoteApi.filteredUtRequests().size());
+	}
+
+	TEST(TEST_CLASS, FilteredSynchronizerBypassesRequestWhenConditionIsNotSatisfied) {
+		// Arrange:
+		FilteredTestContext context(5);
+		auto synchronizer = CreateFilteredSynchronizer(context, false);
+		MockRemoteApi remoteApi(test::CreateTransactionEntityRange(3));
+
+		// Act:
+		auto code = synchronizer(remoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+		EXPECT_TRUE(remoteApi.filteredUtRequests().empty());
+	}
+
+	// endregion
 }}
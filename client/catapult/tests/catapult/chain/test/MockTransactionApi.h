@@ -31,7 +31,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Filtered_Unconfirmed_Transactions
 		};
 
 		struct UtRequest {
@@ -40,6 +41,12 @@ namespace catapult { namespace mocks {
 			model::ShortHashRange ShortHashes;
 		};
 
+		struct FilteredUtRequest {
+			Timestamp Deadline;
+			BlockFeeMultiplier FeeMultiplier;
+			utils::BloomFilter ShortHashesFilter;
+		};
+
 	public:
 		/// Creates a transaction api around a range of transactions (\a transactionRange).
 		explicit MockTransactionApi(const model::TransactionRange& transactionRange)
@@ -59,6 +66,11 @@ namespace catapult { namespace mocks {
 			return m_utRequests;
 		}
 
+		/// Gets a vector of parameters that were passed to the filtered unconfirmed transactions requests.
+		const auto& filteredUtRequests() const {
+			return m_filteredUtRequests;
+		}
+
 	public:
 		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minDeadline, \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -73,6 +85,19 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactionRange));
 		}
 
+		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Filtered_Unconfirmed_Transactions.
+		/// \note The \a minDeadline, \a minFeeMultiplier and \a knownShortHashesFilter parameters are captured.
+		thread::future<model::TransactionRange> filteredUnconfirmedTransactions(
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				utils::BloomFilter&& knownShortHashesFilter) const override {
+			m_filteredUtRequests.emplace_back(FilteredUtRequest{ minDeadline, minFeeMultiplier, std::move(knownShortHashesFilter) });
+			if (shouldRaiseException(EntryPoint::Filtered_Unconfirmed_Transactions))
+				return CreateFutureException<model::TransactionRange>("filtered unconfirmed transactions error has been set");
+
+			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactionRange));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -87,5 +112,6 @@ namespace catapult { namespace mocks {
 		model::TransactionRange m_transactionRange;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<UtRequest> m_utRequests;
+		mutable std::vector<FilteredUtRequest> m_filteredUtRequests;
 	};
 }}
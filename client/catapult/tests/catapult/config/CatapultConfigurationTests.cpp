@@ -115,6 +115,7 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_FALSE(config.EnableMemoryMappedBlockStorage);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -130,9 +131,11 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(BlockFeeMultiplier(0), config.MinFeeMultiplier);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.MaxTimeBehindPullTransactionsStart);
+			EXPECT_FALSE(config.EnableFilteredTransactionsPull);
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_EQ(1u, config.UnconfirmedTransactionsCacheNumShards);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -144,6 +147,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(4096u, config.BlockDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(300), config.BlockDisruptorMaxMemorySize);
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
+			EXPECT_EQ(0u, config.BlockStreamingSignatureBatchSize);
 
 			EXPECT_EQ(8192u, config.TransactionDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.TransactionDisruptorMaxMemorySize);
@@ -151,6 +155,10 @@ namespace catapult { namespace config {
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+			EXPECT_EQ(disruptor::ConsumerWaitStrategy::Sleep, config.DispatcherWaitStrategy);
+
+			EXPECT_FALSE(config.EnableExecutionProfiling);
+			EXPECT_FALSE(config.EnableSpeculativeStatefulValidation);
 
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
@@ -169,6 +177,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
+			EXPECT_EQ(50'000u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
@@ -45,6 +45,7 @@ namespace catapult { namespace config {
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "enableMemoryMappedBlockStorage", "true" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -60,9 +61,11 @@ namespace catapult { namespace config {
 
 							{ "minFeeMultiplier", "864" },
 							{ "maxTimeBehindPullTransactionsStart", "10s" },
+							{ "enableFilteredTransactionsPull", "true" },
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98MB" },
+							{ "unconfirmedTransactionsCacheNumShards", "6" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -74,6 +77,7 @@ namespace catapult { namespace config {
 							{ "blockDisruptorSlotCount", "1000" },
 							{ "blockDisruptorMaxMemorySize", "15MB" },
 							{ "blockElementTraceInterval", "34" },
+							{ "blockStreamingSignatureBatchSize", "128" },
 
 							{ "transactionDisruptorSlotCount", "9876" },
 							{ "transactionDisruptorMaxMemorySize", "101KB" },
@@ -81,6 +85,10 @@ namespace catapult { namespace config {
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
+							{ "dispatcherWaitStrategy", "blocking" },
+
+							{ "enableExecutionProfiling", "true" },
+							{ "enableSpeculativeStatefulValidation", "true" },
 
 							{ "maxTrackedNodes", "222" },
 
@@ -102,7 +110,8 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+							{ "patriciaTreeNodeCacheSize", "12'345" }
 						}
 					},
 					{
@@ -167,6 +176,7 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_FALSE(config.EnableMemoryMappedBlockStorage);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -182,9 +192,11 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(BlockFeeMultiplier(0), config.MinFeeMultiplier);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.MaxTimeBehindPullTransactionsStart);
+				EXPECT_FALSE(config.EnableFilteredTransactionsPull);
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheNumShards);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -196,6 +208,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockDisruptorMaxMemorySize);
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
+				EXPECT_EQ(0u, config.BlockStreamingSignatureBatchSize);
 
 				EXPECT_EQ(0u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.TransactionDisruptorMaxMemorySize);
@@ -203,6 +216,10 @@ namespace catapult { namespace config {
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Sleep, config.DispatcherWaitStrategy);
+
+				EXPECT_FALSE(config.EnableExecutionProfiling);
+				EXPECT_FALSE(config.EnableSpeculativeStatefulValidation);
 
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
@@ -221,6 +238,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(0u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -262,6 +280,7 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_TRUE(config.EnableMemoryMappedBlockStorage);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -277,9 +296,11 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(BlockFeeMultiplier(864), config.MinFeeMultiplier);
 				EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.MaxTimeBehindPullTransactionsStart);
+				EXPECT_TRUE(config.EnableFilteredTransactionsPull);
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(98), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(6u, config.UnconfirmedTransactionsCacheNumShards);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -291,6 +312,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(1000u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(15), config.BlockDisruptorMaxMemorySize);
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
+				EXPECT_EQ(128u, config.BlockStreamingSignatureBatchSize);
 
 				EXPECT_EQ(9876u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(101), config.TransactionDisruptorMaxMemorySize);
@@ -298,6 +320,10 @@ namespace catapult { namespace config {
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Blocking, config.DispatcherWaitStrategy);
+
+				EXPECT_TRUE(config.EnableExecutionProfiling);
+				EXPECT_TRUE(config.EnableSpeculativeStatefulValidation);
 
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
@@ -316,6 +342,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(45), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(12'345u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
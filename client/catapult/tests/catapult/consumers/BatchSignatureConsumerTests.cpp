@@ -30,6 +30,7 @@
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/TestHarness.h"
+#include <mutex>
 
 namespace catapult { namespace consumers {
 
@@ -103,6 +104,8 @@ namespace catapult { namespace consumers {
 
 		public:
 			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				// serialize publishing because streaming consumers publish from multiple threads
+				std::lock_guard<std::mutex> lock(m_mutex);
 				auto isAlwaysVerifiable = m_alwaysVerifiableIndexes.cend() != m_alwaysVerifiableIndexes.find(m_entityInfos.size());
 				m_entityInfos.push_back(entityInfo);
 
@@ -137,6 +140,7 @@ namespace catapult { namespace consumers {
 			const GenerationHashSeed& m_generationHashSeed;
 			std::vector<NotificationDescriptor> m_descriptors;
 			std::unordered_set<size_t> m_alwaysVerifiableIndexes;
+			mutable std::mutex m_mutex;
 			mutable model::WeakEntityInfos m_entityInfos;
 
 			// backing for data stored by reference in SignatureNotification (for test purposes, only sign hashes)
@@ -159,7 +163,8 @@ namespace catapult { namespace consumers {
 			};
 		}
 
-		struct BlockTraits {
+		template<uint32_t Streaming_Batch_Size>
+		struct BlockTraitsT {
 		public:
 			struct TestContext {
 			public:
@@ -178,7 +183,8 @@ namespace catapult { namespace consumers {
 								CreateRandomFiller(),
 								pPublisher,
 								*pPool,
-								requiresValidationPredicate))
+								requiresValidationPredicate,
+								Streaming_Batch_Size))
 				{}
 
 			public:
@@ -208,10 +214,17 @@ namespace catapult { namespace consumers {
 				model::WeakEntityInfos expectedEntityInfos;
 				ExtractMatchingEntityInfos(elements, expectedEntityInfos, requiresValidationPredicate);
 
+				// - when streaming, entities are published by multiple threads in nondeterministic order
+				auto actualEntityInfos = entityInfos;
+				if (0 != Streaming_Batch_Size) {
+					SortByEntityPointer(expectedEntityInfos);
+					SortByEntityPointer(actualEntityInfos);
+				}
+
 				// Assert:
-				EXPECT_EQ(numExpectedEntities, entityInfos.size());
-				EXPECT_EQ(expectedEntityInfos.size(), entityInfos.size());
-				EXPECT_EQ(expectedEntityInfos, entityInfos);
+				EXPECT_EQ(numExpectedEntities, actualEntityInfos.size());
+				EXPECT_EQ(expectedEntityInfos.size(), actualEntityInfos.size());
+				EXPECT_EQ(expectedEntityInfos, actualEntityInfos);
 			}
 
 			static void AssertAllSignaturesVerify(const std::vector<NotificationDescriptor>& descriptors) {
@@ -254,8 +267,20 @@ namespace catapult { namespace consumers {
 				// Assert:
 				test::AssertAborted(result, Failure_Consumer_Batch_Signature_Not_Verifiable, disruptor::ConsumerResultSeverity::Fatal);
 			}
+
+		private:
+			static void SortByEntityPointer(model::WeakEntityInfos& entityInfos) {
+				std::sort(entityInfos.begin(), entityInfos.end(), [](const auto& lhs, const auto& rhs) {
+					return &lhs.entity() < &rhs.entity();
+				});
+			}
 		};
 
+		using BlockTraits = BlockTraitsT<0>;
+
+		// use small batch size so that multiple batches are verified
+		using BlockStreamingTraits = BlockTraitsT<3>;
+
 		// endregion
 
 		// region TransactionTraits
@@ -416,6 +441,7 @@ namespace catapult { namespace consumers {
 #define ALL_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(BLOCK_TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockTraits>(); } \
+	TEST(BLOCK_TEST_CLASS, TEST_NAME##_Streaming) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockStreamingTraits>(); } \
 	TEST(TRANSACTION_TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<TransactionTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
@@ -488,21 +514,47 @@ namespace catapult { namespace consumers {
 
 	// region block only
 
-	TEST(BLOCK_TEST_CLASS, CanProcessEntitiesWithSignatureNotifications_AllVerifiable_Mixed_NotAllRequired) {
+#define BLOCK_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(BLOCK_TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockTraits>(); } \
+	TEST(BLOCK_TEST_CLASS, TEST_NAME##_Streaming) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockStreamingTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	BLOCK_TEST(CanProcessEntitiesWithSignatureNotifications_AllVerifiable_Mixed_NotAllRequired) {
 		// Arrange:
-		auto elements = BlockTraits::CreateMultipleEntityElements();
+		auto elements = TTraits::CreateMultipleEntityElements();
 		auto requiresValidationPredicate = [&elements](auto, auto, const auto& hash) {
 			return elements[1].EntityHash != hash && elements[2].EntityHash != hash;
 		};
 
-		BlockTraits::TestContext context(GetMixedDescriptors(), {}, requiresValidationPredicate);
+		typename TTraits::TestContext context(GetMixedDescriptors(), {}, requiresValidationPredicate);
 
 		// Act:
 		auto result = context.Consumer(elements);
 
 		// Assert:
 		test::AssertContinued(result);
-		BlockTraits::AssertEntities(elements, context.pPublisher->entityInfos(), 8, requiresValidationPredicate);
+		TTraits::AssertEntities(elements, context.pPublisher->entityInfos(), 8, requiresValidationPredicate);
+	}
+
+	BLOCK_TEST(CanProcessManyEntitiesWithSignatureNotifications) {
+		// Arrange: create enough entities to span many batches and chunks
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<const model::Block*> blockPointers;
+		for (auto i = 0u; i < 20; ++i) {
+			blocks.push_back(test::GenerateBlockWithTransactions(i % 5, Height(246 + i)));
+			blockPointers.push_back(blocks.back().get());
+		}
+
+		auto elements = test::CreateBlockElements(blockPointers);
+		typename TTraits::TestContext context(GetMixedDescriptors());
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert: 20 blocks with 40 transactions
+		test::AssertContinued(result);
+		TTraits::AssertEntities(elements, context.pPublisher->entityInfos(), 60, RequiresAllPredicate);
 	}
 
 	// endregion
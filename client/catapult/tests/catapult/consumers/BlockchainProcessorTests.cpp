@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
@@ -208,15 +209,33 @@ namespace catapult { namespace consumers {
 			explicit ProcessorTestContext(ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled)
 					: BlockHitPredicateFactory(BlockHitPredicate) {
 				Processor = CreateBlockchainProcessor(
-						[this](const auto& cache) {
-							return BlockHitPredicateFactory(cache);
-						},
-						[this](auto height, auto timestamp, const auto& entities, auto& state) {
-							return BatchEntityProcessor(height, timestamp, entities, state);
-						},
+						createBlockHitPredicateFactory(),
+						createBatchEntityProcessor(),
 						receiptValidationMode);
 			}
 
+			ProcessorTestContext(ReceiptValidationMode receiptValidationMode, thread::IoThreadPool& stateHashPool)
+					: BlockHitPredicateFactory(BlockHitPredicate) {
+				Processor = CreateBlockchainProcessor(
+						createBlockHitPredicateFactory(),
+						createBatchEntityProcessor(),
+						receiptValidationMode,
+						stateHashPool);
+			}
+
+		private:
+			consumers::BlockHitPredicateFactory createBlockHitPredicateFactory() {
+				return [this](const auto& cache) {
+					return BlockHitPredicateFactory(cache);
+				};
+			}
+
+			chain::BatchEntityProcessor createBatchEntityProcessor() {
+				return [this](auto height, auto timestamp, const auto& entities, auto& state) {
+					return BatchEntityProcessor(height, timestamp, entities, state);
+				};
+			}
+
 		public:
 			MockBlockHitPredicate BlockHitPredicate;
 			MockBlockHitPredicateFactory BlockHitPredicateFactory;
@@ -493,6 +512,49 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region valid - state hash pool
+
+	TEST(TEST_CLASS, CanProcessMultipleBlocksWithStateHashPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, *pPool);
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result);
+		EXPECT_EQ(3u, context.BlockHitPredicate.params().size());
+		EXPECT_EQ(3u, context.BatchEntityProcessor.params().size());
+		context.assertBlockHitPredicateCalls(*pParentBlock, elements);
+		context.assertBatchEntityProcessorCalls(elements);
+	}
+
+	TEST(TEST_CLASS, ExecuteShortCircuitsOnInconsistentStateHashWithStateHashPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, *pPool);
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// - invalidate the second block state hash
+		test::FillWithRandomData(const_cast<model::Block&>(elements[1].Block).StateHash);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+		EXPECT_EQ(2u, context.BlockHitPredicate.params().size());
+		EXPECT_EQ(2u, context.BatchEntityProcessor.params().size());
+	}
+
+	// endregion
+
 	// region valid - remote harvester
 
 	namespace {
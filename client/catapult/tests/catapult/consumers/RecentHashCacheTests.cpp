@@ -22,6 +22,7 @@
 #include "catapult/consumers/RecentHashCache.h"
 #include "tests/test/nodeps/TimeSupplier.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace consumers {
 
@@ -341,6 +342,53 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region SynchronizedRecentHashCache - ctor
+
+	namespace {
+		class SettableTimeSupplier {
+		public:
+			SettableTimeSupplier() : m_pTime(std::make_shared<std::atomic<uint64_t>>(1))
+			{}
+
+		public:
+			chain::TimeSupplier supplier() const {
+				return [pTime = m_pTime]() { return Timestamp(pTime->load()); };
+			}
+
+			void setSeconds(uint64_t seconds) {
+				*m_pTime = seconds * 1000;
+			}
+
+		private:
+			std::shared_ptr<std::atomic<uint64_t>> m_pTime;
+		};
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_CacheIsInitiallyEmpty) {
+		// Act:
+		auto cache = SynchronizedRecentHashCache(DefaultTimeSupplier(), Default_Options);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(2048u, cache.capacity());
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_CapacityIsPowerOfTwoWithHeadroomForMaxCacheSize) {
+		// Arrange:
+		auto createCache = [](uint64_t maxCacheSize) {
+			return SynchronizedRecentHashCache(DefaultTimeSupplier(), HashCheckOptions(600'000, 60'000, maxCacheSize));
+		};
+
+		// Act + Assert: capacity is a power of two of at least 1.25 * max cache size and at least one bucket
+		EXPECT_EQ(8u, createCache(0).capacity());
+		EXPECT_EQ(8u, createCache(6).capacity());
+		EXPECT_EQ(16u, createCache(7).capacity());
+		EXPECT_EQ(1024u, createCache(819).capacity());
+		EXPECT_EQ(2048u, createCache(820).capacity());
+	}
+
+	// endregion
+
 	// region SynchronizedRecentHashCache - add
 
 	TEST(TEST_CLASS, SynchronizedRecentHashCache_AddBehaviorIsConsistentWithNonSynchronizedCache) {
@@ -359,6 +407,161 @@ namespace catapult { namespace consumers {
 		EXPECT_TRUE(result2);
 		EXPECT_FALSE(result3);
 		EXPECT_TRUE(result4);
+
+		EXPECT_EQ(3u, cache.size());
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(cache.contains(hash));
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_ContainsReturnsFalseWhenHashIsUnknown) {
+		// Arrange:
+		auto cache = SynchronizedRecentHashCache(DefaultTimeSupplier(), Default_Options);
+		for (auto i = 0u; i < 100; ++i)
+			cache.add(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_EQ(100u, cache.size());
+		for (auto i = 0u; i < 100; ++i)
+			EXPECT_FALSE(cache.contains(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_HashIsNotEvictedBeforeEndOfLastLiveEpoch) {
+		// Arrange: epochs are 60s long and hashes live for 10 epochs
+		SettableTimeSupplier timeSupplier;
+		auto cache = SynchronizedRecentHashCache(timeSupplier.supplier(), Default_Options);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		timeSupplier.setSeconds(11); // epoch 0
+		cache.add(hash);
+
+		// Act + Assert:
+		for (auto seconds : { 611u, 612u, 659u }) {
+			timeSupplier.setSeconds(seconds); // epoch 10
+			EXPECT_TRUE(cache.contains(hash)) << seconds;
+			EXPECT_EQ(1u, cache.size()) << seconds;
+		}
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_HashIsEvictedAfterEndOfLastLiveEpoch) {
+		// Arrange: epochs are 60s long and hashes live for 10 epochs
+		SettableTimeSupplier timeSupplier;
+		auto cache = SynchronizedRecentHashCache(timeSupplier.supplier(), Default_Options);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		timeSupplier.setSeconds(11); // epoch 0
+		cache.add(hash);
+
+		// Act:
+		timeSupplier.setSeconds(660); // epoch 11
+		auto isContained = cache.contains(hash);
+		auto size = cache.size();
+		auto result = cache.add(hash);
+
+		// Assert: the expired hash is unknown and can be added again
+		EXPECT_FALSE(isContained);
+		EXPECT_EQ(0u, size);
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_KnownHashCannotSelfEvict) {
+		// Arrange:
+		SettableTimeSupplier timeSupplier;
+		auto cache = SynchronizedRecentHashCache(timeSupplier.supplier(), Default_Options);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		timeSupplier.setSeconds(11); // epoch 0
+		auto result1 = cache.add(hash);
+
+		// Act: re-adding the hash in epoch 10 extends its lifetime until end of epoch 20
+		timeSupplier.setSeconds(612);
+		auto result2 = cache.add(hash);
+
+		timeSupplier.setSeconds(1259);
+		auto isContained = cache.contains(hash);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_TRUE(isContained);
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_CannotAddUnknownHashWhenBucketsAreFull) {
+		// Arrange: single bucket cache
+		constexpr auto Options = HashCheckOptions(600'000, 60'000, 5);
+		auto cache = SynchronizedRecentHashCache(DefaultTimeSupplier(), Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(8);
+		for (const auto& hash : hashes)
+			cache.add(hash);
+
+		// Sanity:
+		EXPECT_EQ(8u, cache.size());
+
+		// Act:
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash);
+
+		// Assert: hash is unknown but was not added
+		EXPECT_TRUE(result);
+		EXPECT_EQ(8u, cache.size());
+		EXPECT_FALSE(cache.contains(hash));
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_CanAddUnknownHashWhenBucketsAreFullButAtLeastOneHashIsExpired) {
+		// Arrange: single bucket cache
+		constexpr auto Options = HashCheckOptions(600'000, 60'000, 5);
+		SettableTimeSupplier timeSupplier;
+		auto cache = SynchronizedRecentHashCache(timeSupplier.supplier(), Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(8);
+
+		timeSupplier.setSeconds(11); // epoch 0
+		cache.add(hashes[0]);
+
+		timeSupplier.setSeconds(71); // epoch 1
+		for (auto i = 1u; i < hashes.size(); ++i)
+			cache.add(hashes[i]);
+
+		// Act:
+		timeSupplier.setSeconds(660); // epoch 11
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash);
+
+		// Assert: expired slot was reused
+		EXPECT_TRUE(result);
+		EXPECT_EQ(8u, cache.size());
+		EXPECT_TRUE(cache.contains(hash));
+		EXPECT_FALSE(cache.contains(hashes[0]));
+	}
+
+	TEST(TEST_CLASS, SynchronizedRecentHashCache_CanAddHashesFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Hashes = 500u;
+		auto cache = SynchronizedRecentHashCache(DefaultTimeSupplier(), Default_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
+		std::vector<std::atomic<uint32_t>> numAdds(Num_Hashes);
+
+		// Act: all threads add all hashes
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&cache, &hashes, &numAdds, i] {
+				for (auto j = 0u; j < Num_Hashes; ++j) {
+					auto index = (j + i * Num_Hashes / Num_Threads) % Num_Hashes;
+					if (cache.add(hashes[index]))
+						++numAdds[index];
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert: each hash was reported as unknown exactly once
+		EXPECT_EQ(Num_Hashes, cache.size());
+		for (auto i = 0u; i < Num_Hashes; ++i) {
+			EXPECT_EQ(1u, numAdds[i]) << "hash at index " << i;
+			EXPECT_TRUE(cache.contains(hashes[i])) << "hash at index " << i;
+		}
 	}
 
 	// endregion
@@ -61,6 +61,64 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region SignatureInputBuffers
+
+	TEST(TEST_CLASS, CanCreateEmptySignatureInputBuffers) {
+		// Act:
+		SignatureInputBuffers buffers;
+
+		// Assert:
+		EXPECT_TRUE(buffers.empty());
+		EXPECT_EQ(0u, buffers.size());
+		EXPECT_EQ(buffers.begin(), buffers.end());
+	}
+
+	TEST(TEST_CLASS, CanCreateSignatureInputBuffersAroundInitializerList) {
+		// Arrange:
+		auto buffer1 = test::GenerateRandomVector(50);
+		auto buffer2 = test::GenerateRandomVector(70);
+
+		// Act:
+		SignatureInputBuffers buffers{ buffer1, buffer2 };
+
+		// Assert:
+		EXPECT_FALSE(buffers.empty());
+		ASSERT_EQ(2u, buffers.size());
+		EXPECT_EQ(buffer1.data(), buffers[0].pData);
+		EXPECT_EQ(50u, buffers[0].Size);
+		EXPECT_EQ(buffer2.data(), buffers[1].pData);
+		EXPECT_EQ(70u, buffers[1].Size);
+		EXPECT_EQ(2, std::distance(buffers.begin(), buffers.end()));
+	}
+
+	TEST(TEST_CLASS, CanPushBackSignatureInputBuffersUpToCapacity) {
+		// Arrange:
+		auto buffer1 = test::GenerateRandomVector(50);
+		auto buffer2 = test::GenerateRandomVector(70);
+		SignatureInputBuffers buffers;
+
+		// Act:
+		buffers.push_back(buffer1);
+		buffers.push_back(buffer2);
+
+		// Assert:
+		ASSERT_EQ(SignatureInputBuffers::Capacity, buffers.size());
+		EXPECT_EQ(buffer1.data(), buffers[0].pData);
+		EXPECT_EQ(buffer2.data(), buffers[1].pData);
+	}
+
+	TEST(TEST_CLASS, CannotPushBackSignatureInputBuffersBeyondCapacity) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(50);
+		SignatureInputBuffers buffers{ buffer, buffer };
+
+		// Act + Assert:
+		EXPECT_THROW(buffers.push_back(buffer), catapult_out_of_range);
+		EXPECT_THROW(SignatureInputBuffers({ buffer, buffer, buffer }), catapult_out_of_range);
+	}
+
+	// endregion
+
 	// region VerifyMulti
 
 	namespace {
@@ -116,11 +174,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -131,6 +188,15 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58 }, mutator);
+		}
+
+		void CorruptRPart(std::vector<SignatureInput>& signatureInputs, size_t index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -202,9 +268,16 @@ namespace catapult { namespace crypto {
 	}
 
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentRPart) {
-		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
-			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
-		});
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(CorruptRPart);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailureInSecondBatch) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 70, 99 }, CorruptRPart);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailureInTrailingSignatures) {
+		// last two signatures are not batch verified
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(66, { 65 }, CorruptRPart);
 	}
 
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentSPart) {
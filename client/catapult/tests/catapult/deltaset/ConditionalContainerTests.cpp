@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/deltaset/ConditionalContainer.h"
+#include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/OrderedSet.h"
 #include "catapult/utils/ContainerHelpers.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
@@ -363,6 +364,106 @@ namespace catapult { namespace deltaset {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		using Types = test::DeltaElementsTestUtils::Types;
+		using PrefetchKeys = std::vector<Types::StorageMapType::key_type>;
+
+		// storage map that captures all prefetched keys
+		class PrefetchAwareStorageMap : public Types::StorageMapType {
+		public:
+			explicit PrefetchAwareStorageMap(PrefetchKeys& prefetchedKeys) : m_prefetchedKeys(prefetchedKeys)
+			{}
+
+		public:
+			void prefetch(const PrefetchKeys& keys) const {
+				m_prefetchedKeys.insert(m_prefetchedKeys.end(), keys.cbegin(), keys.cend());
+			}
+
+		private:
+			PrefetchKeys& m_prefetchedKeys;
+		};
+
+		using PrefetchAwareContainerType = ConditionalContainer<
+			Types::StorageTraits::KeyTraits,
+			PrefetchAwareStorageMap,
+			Types::MemoryMapType>;
+	}
+
+	TEST(TEST_CLASS, PrefetchIsForwardedToUnderlyingStorageContainer) {
+		// Arrange:
+		PrefetchKeys prefetchedKeys;
+		PrefetchAwareContainerType container(ConditionalContainerMode::Storage, prefetchedKeys);
+
+		// Act:
+		container.prefetch({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) });
+
+		// Assert:
+		EXPECT_EQ(PrefetchKeys({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) }), prefetchedKeys);
+	}
+
+	TEST(TEST_CLASS, PrefetchIsNoOpForUnderlyingMemoryContainer) {
+		// Arrange:
+		PrefetchKeys prefetchedKeys;
+		PrefetchAwareContainerType container(ConditionalContainerMode::Memory, prefetchedKeys);
+
+		// Act:
+		container.prefetch({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) });
+
+		// Assert:
+		EXPECT_TRUE(prefetchedKeys.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchBaseSetIsForwardedToContainer) {
+		// Arrange:
+		PrefetchKeys prefetchedKeys;
+		PrefetchAwareContainerType container(ConditionalContainerMode::Storage, prefetchedKeys);
+
+		// Act:
+		PrefetchBaseSet(container, PrefetchKeys{ std::make_pair("alpha", 5), std::make_pair("gamma", 7) });
+
+		// Assert:
+		EXPECT_EQ(PrefetchKeys({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) }), prefetchedKeys);
+	}
+
+	namespace {
+		using PrefetchAwareDeltaType = BaseSetDelta<
+			test::MutableElementValueTraits,
+			MapStorageTraits<PrefetchAwareContainerType, test::TestElementToKeyConverter<test::MutableTestElement>, Types::MemoryMapType>>;
+	}
+
+	TEST(TEST_CLASS, BaseSetDeltaPrefetchIsForwardedOnlyForUntrackedKeys) {
+		// Arrange:
+		PrefetchKeys prefetchedKeys;
+		PrefetchAwareContainerType container(ConditionalContainerMode::Storage, prefetchedKeys);
+		PrefetchAwareDeltaType delta(container);
+		delta.emplace("beta", 6u);
+
+		// Act:
+		delta.prefetch({ std::make_pair("alpha", 5), std::make_pair("beta", 6), std::make_pair("gamma", 7) });
+
+		// Assert: tracked key (beta) is not prefetched
+		EXPECT_EQ(PrefetchKeys({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) }), prefetchedKeys);
+	}
+
+	TEST(TEST_CLASS, BaseSetDeltaPrefetchIsBypassedWhenAllKeysAreTracked) {
+		// Arrange:
+		PrefetchKeys prefetchedKeys;
+		PrefetchAwareContainerType container(ConditionalContainerMode::Storage, prefetchedKeys);
+		PrefetchAwareDeltaType delta(container);
+		delta.emplace("alpha", 5u);
+		delta.emplace("gamma", 7u);
+
+		// Act:
+		delta.prefetch({ std::make_pair("alpha", 5), std::make_pair("gamma", 7) });
+
+		// Assert:
+		EXPECT_TRUE(prefetchedKeys.empty());
+	}
+
+	// endregion
+
 	// region iterable
 
 	TEST(TEST_CLASS, StorageBasedCacheIsNotIterable) {
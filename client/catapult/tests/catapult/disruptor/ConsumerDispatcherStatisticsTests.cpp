@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcherStatistics.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerDispatcherStatisticsTests
+
+	namespace {
+		constexpr auto Sleep_Duration = std::chrono::milliseconds(5);
+		constexpr uint64_t Sleep_Microseconds = 5'000;
+
+		void Sleep() {
+			std::this_thread::sleep_for(Sleep_Duration);
+		}
+
+		void ProcessConsumer(DisruptorElement& element, size_t level, bool shouldSleep) {
+			element.markConsumerStart(level);
+			if (shouldSleep)
+				Sleep();
+
+			element.markConsumerEnd(level);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateStatistics) {
+		// Act:
+		ConsumerDispatcherStatistics statistics(3);
+
+		// Assert:
+		EXPECT_EQ(3u, statistics.numConsumers());
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(0u, statistics.waitTimes(i).count()) << i;
+			EXPECT_EQ(0u, statistics.processingTimes(i).count()) << i;
+		}
+
+		EXPECT_EQ(0u, statistics.totalTimes().count());
+	}
+
+	TEST(TEST_CLASS, CanAddElementProcessedByAllConsumers) {
+		// Arrange:
+		ConsumerDispatcherStatistics statistics(3);
+		DisruptorElement element;
+		element.markQueued(3);
+
+		// - first consumer waits, second consumer is slow
+		Sleep();
+		ProcessConsumer(element, 0, false);
+		ProcessConsumer(element, 1, true);
+		ProcessConsumer(element, 2, false);
+
+		// Act:
+		statistics.add(element, DisruptorClock::now());
+
+		// Assert:
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(1u, statistics.waitTimes(i).count()) << i;
+			EXPECT_EQ(1u, statistics.processingTimes(i).count()) << i;
+		}
+
+		EXPECT_LE(Sleep_Microseconds, statistics.waitTimes(0).max());
+		EXPECT_LE(Sleep_Microseconds, statistics.processingTimes(1).max());
+
+		EXPECT_EQ(1u, statistics.totalTimes().count());
+		EXPECT_LE(2 * Sleep_Microseconds, statistics.totalTimes().max());
+	}
+
+	TEST(TEST_CLASS, CanAddElementSkippedByConsumers) {
+		// Arrange: second consumer aborts, so third consumer skips the element
+		ConsumerDispatcherStatistics statistics(3);
+		DisruptorElement element;
+		element.markQueued(3);
+		ProcessConsumer(element, 0, false);
+		ProcessConsumer(element, 1, false);
+
+		// Act:
+		statistics.add(element, DisruptorClock::now());
+
+		// Assert:
+		EXPECT_EQ(1u, statistics.waitTimes(0).count());
+		EXPECT_EQ(1u, statistics.waitTimes(1).count());
+		EXPECT_EQ(0u, statistics.waitTimes(2).count());
+
+		EXPECT_EQ(1u, statistics.processingTimes(0).count());
+		EXPECT_EQ(1u, statistics.processingTimes(1).count());
+		EXPECT_EQ(0u, statistics.processingTimes(2).count());
+
+		EXPECT_EQ(1u, statistics.totalTimes().count());
+	}
+
+	TEST(TEST_CLASS, CanAddMultipleElements) {
+		// Arrange:
+		ConsumerDispatcherStatistics statistics(2);
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i) {
+			DisruptorElement element;
+			element.markQueued(2);
+			ProcessConsumer(element, 0, false);
+			ProcessConsumer(element, 1, false);
+			statistics.add(element, DisruptorClock::now());
+		}
+
+		// Assert:
+		for (auto i = 0u; i < 2; ++i) {
+			EXPECT_EQ(5u, statistics.waitTimes(i).count()) << i;
+			EXPECT_EQ(5u, statistics.processingTimes(i).count()) << i;
+		}
+
+		EXPECT_EQ(5u, statistics.totalTimes().count());
+	}
+}}
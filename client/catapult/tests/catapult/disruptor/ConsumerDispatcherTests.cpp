@@ -26,6 +26,7 @@
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace disruptor {
 
@@ -475,6 +476,200 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region wait strategies
+
+	namespace {
+		void AssertCanConsumeAndInspectAllElements(ConsumerWaitStrategy waitStrategy) {
+			// Arrange:
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			CollectedHeights collectedHeights[2];
+			CollectedHeights inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+			EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+			EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+			EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+			EXPECT_EQ(expectedHeights, inspectedHeights.get());
+			EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Sleep) {
+		AssertCanConsumeAndInspectAllElements(ConsumerWaitStrategy::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_BusySpin) {
+		AssertCanConsumeAndInspectAllElements(ConsumerWaitStrategy::Busy_Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Yield) {
+		AssertCanConsumeAndInspectAllElements(ConsumerWaitStrategy::Yield);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Blocking) {
+		AssertCanConsumeAndInspectAllElements(ConsumerWaitStrategy::Blocking);
+	}
+
+	TEST(TEST_CLASS, ShutdownWakesBlockedConsumers) {
+		// Arrange: create a dispatcher with multiple idle consumers
+		auto options = Test_Dispatcher_Options;
+		options.WaitStrategy = ConsumerWaitStrategy::Blocking;
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer(), CreateNoOpConsumer(), CreateNoOpConsumer() });
+		test::Pause();
+
+		// Act: shutdown must not hang
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_EQ(3u, dispatcher.size());
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	// endregion
+
+	// region multiple producers
+
+	namespace {
+		void AssertCanProcessElementsFromMultipleProducers(ConsumerWaitStrategy waitStrategy) {
+			// Arrange:
+			constexpr auto Num_Producers = 4u;
+			constexpr auto Num_Elements_Per_Producer = 50u;
+			constexpr auto Num_Elements = Num_Producers * Num_Elements_Per_Producer;
+
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			std::vector<std::vector<model::BlockRange>> producerRanges;
+			std::vector<std::vector<Heights>> producerExpectedHeights;
+			for (auto i = 0u; i < Num_Producers; ++i) {
+				producerRanges.push_back(test::PrepareRanges(Num_Elements_Per_Producer));
+				producerExpectedHeights.push_back(GetExpectedHeights(producerRanges.back()));
+			}
+
+			CollectedHeights collectedHeights[2];
+			CollectedHeights inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// Act: push elements from all producers concurrently
+			std::vector<std::vector<DisruptorElementId>> producerIds(Num_Producers);
+			{
+				thread::ThreadGroup threads;
+				for (auto i = 0u; i < Num_Producers; ++i) {
+					threads.spawn([&dispatcher, &ranges = producerRanges[i], &ids = producerIds[i]]() {
+						for (auto& range : ranges)
+							ids.push_back(dispatcher.processElement(ConsumerInput(std::move(range))));
+					});
+				}
+			}
+
+			WAIT_FOR_VALUE_EXPR(Num_Elements, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert: every element was assigned a unique id
+			std::set<DisruptorElementId> allIds;
+			for (const auto& ids : producerIds) {
+				EXPECT_TRUE(std::is_sorted(ids.cbegin(), ids.cend()));
+				allIds.insert(ids.cbegin(), ids.cend());
+			}
+
+			EXPECT_EQ(Num_Elements, allIds.size());
+			EXPECT_EQ(1u, *allIds.cbegin());
+			EXPECT_EQ(Num_Elements, *allIds.crbegin());
+
+			// - all consumers and the inspector observed elements in the same order
+			EXPECT_EQ(Num_Elements, dispatcher.numAddedElements());
+			EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+			EXPECT_EQ(inspectedHeights.get(), collectedHeights[0].get());
+			EXPECT_EQ(inspectedHeights.get(), collectedHeights[1].get());
+			EXPECT_EQ(std::vector<CompletionStatus>(Num_Elements, CompletionStatus::Normal), inspectedStatuses);
+
+			// - elements from each producer were observed in the order they were pushed
+			for (auto i = 0u; i < Num_Producers; ++i) {
+				const auto& expectedHeights = producerExpectedHeights[i];
+				std::vector<Heights> observedHeights;
+				for (const auto& heights : inspectedHeights.get()) {
+					if (expectedHeights.cend() != std::find(expectedHeights.cbegin(), expectedHeights.cend(), heights))
+						observedHeights.push_back(heights);
+				}
+
+				EXPECT_EQ(expectedHeights, observedHeights) << "producer " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanProcessElementsFromMultipleProducers_Sleep) {
+		AssertCanProcessElementsFromMultipleProducers(ConsumerWaitStrategy::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanProcessElementsFromMultipleProducers_Blocking) {
+		AssertCanProcessElementsFromMultipleProducers(ConsumerWaitStrategy::Blocking);
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsIncludeAllCompletedElements) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Sanity:
+		EXPECT_EQ(2u, dispatcher.statistics().numConsumers());
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(5));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		const auto& statistics = dispatcher.statistics();
+		for (auto i = 0u; i < 2; ++i) {
+			EXPECT_EQ(5u, statistics.waitTimes(i).count()) << i;
+			EXPECT_EQ(5u, statistics.processingTimes(i).count()) << i;
+		}
+
+		EXPECT_EQ(5u, statistics.totalTimes().count());
+	}
+
+	TEST(TEST_CLASS, StatisticsExcludeConsumersSkippingElements) {
+		// Arrange: first consumer aborts all elements
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ [](const auto&) { return ConsumerResult::Abort(); }, CreateNoOpConsumer() });
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(5));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		const auto& statistics = dispatcher.statistics();
+		EXPECT_EQ(5u, statistics.processingTimes(0).count());
+		EXPECT_EQ(0u, statistics.processingTimes(1).count());
+		EXPECT_EQ(5u, statistics.totalTimes().count());
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -590,6 +785,85 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region producer exception
+
+	namespace {
+		// completion handler that optionally fails when it is copied for the (one-based) n-th time
+		class CopyCountingProcessingComplete {
+		public:
+			explicit CopyCountingProcessingComplete(size_t throwingCopyIndex)
+					: m_pNumCopies(std::make_shared<size_t>(0))
+					, m_throwingCopyIndex(throwingCopyIndex)
+			{}
+
+			CopyCountingProcessingComplete(CopyCountingProcessingComplete&&) = default;
+
+			CopyCountingProcessingComplete(const CopyCountingProcessingComplete& rhs)
+					: m_pNumCopies(rhs.m_pNumCopies)
+					, m_throwingCopyIndex(rhs.m_throwingCopyIndex) {
+				if (m_throwingCopyIndex == ++*m_pNumCopies)
+					CATAPULT_THROW_RUNTIME_ERROR("dummy processing complete copy exception");
+			}
+
+		public:
+			size_t numCopies() const {
+				return *m_pNumCopies;
+			}
+
+		public:
+			void operator()(DisruptorElementId, const ConsumerCompletionResult&) const
+			{}
+
+		private:
+			std::shared_ptr<size_t> m_pNumCopies;
+			size_t m_throwingCopyIndex;
+		};
+
+		size_t CountProcessingCompleteCopies() {
+			ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer() });
+			auto processingComplete = CopyCountingProcessingComplete(0);
+			dispatcher.processElement(ConsumerInput(test::CreateBlockEntityRange(1)), ProcessingCompleteFunc(processingComplete));
+			return processingComplete.numCopies();
+		}
+	}
+
+	TEST(TEST_CLASS, ExceptionThrownAfterClaimingPositionDoesNotBlockSubsequentProducers) {
+		// Arrange: the last copy of the completion handler is made when the element is added at its claimed position
+		auto numCopies = CountProcessingCompleteCopies();
+		auto ranges = test::PrepareRanges(2);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights;
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateConsumer(collectedHeights) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Sanity:
+		ASSERT_LT(1u, numCopies);
+
+		// Act: fail to add the first element after its position has been claimed
+		auto processingComplete = CopyCountingProcessingComplete(numCopies);
+		EXPECT_THROW(dispatcher.processElement(ConsumerInput(std::move(ranges[0])), ProcessingCompleteFunc(processingComplete)),
+				catapult_runtime_error);
+
+		// - add the second element, which can only be published after the abandoned position
+		auto id = dispatcher.processElement(ConsumerInput(std::move(ranges[1])));
+		WAIT_FOR_ONE_EXPR(inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: the abandoned element was skipped by the consumer and the inspector
+		EXPECT_EQ(2u, id);
+		EXPECT_EQ(1u, dispatcher.numAddedElements());
+		EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+		EXPECT_EQ(std::vector<Heights>{ expectedHeights[1] }, collectedHeights.get());
+		EXPECT_EQ(std::vector<Heights>{ expectedHeights[1] }, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>{ CompletionStatus::Normal }, inspectedStatuses);
+	}
+
+	// endregion
+
 	// region space exhaustion
 
 	namespace {
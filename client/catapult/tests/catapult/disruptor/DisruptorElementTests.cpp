@@ -106,6 +106,46 @@ namespace catapult { namespace disruptor {
 		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
 	}
 
+	TEST(TEST_CLASS, CanMarkDisruptorElementAsQueued) {
+		// Arrange:
+		DisruptorElement element;
+
+		// Sanity:
+		EXPECT_TRUE(element.consumerTimestamps().empty());
+
+		// Act:
+		auto startTime = DisruptorClock::now();
+		element.markQueued(3);
+		auto endTime = DisruptorClock::now();
+
+		// Assert:
+		EXPECT_LE(startTime, element.queueTime());
+		EXPECT_GE(endTime, element.queueTime());
+
+		ASSERT_EQ(3u, element.consumerTimestamps().size());
+		for (const auto& timestamps : element.consumerTimestamps()) {
+			EXPECT_EQ(DisruptorClock::time_point(), timestamps.Start);
+			EXPECT_EQ(DisruptorClock::time_point(), timestamps.End);
+		}
+	}
+
+	TEST(TEST_CLASS, CanMarkConsumerStartAndEnd) {
+		// Arrange:
+		DisruptorElement element;
+		element.markQueued(3);
+
+		// Act:
+		element.markConsumerStart(1);
+		element.markConsumerEnd(1);
+
+		// Assert: only timestamps of the second consumer are set
+		const auto& consumerTimestamps = element.consumerTimestamps();
+		EXPECT_EQ(DisruptorClock::time_point(), consumerTimestamps[0].Start);
+		EXPECT_LE(element.queueTime(), consumerTimestamps[1].Start);
+		EXPECT_LE(consumerTimestamps[1].Start, consumerTimestamps[1].End);
+		EXPECT_EQ(DisruptorClock::time_point(), consumerTimestamps[2].Start);
+	}
+
 	TEST(TEST_CLASS, CanOutputDisruptorElement) {
 		// Arrange:
 		auto pTransaction1 = test::GenerateRandomTransaction();
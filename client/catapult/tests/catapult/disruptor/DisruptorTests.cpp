@@ -187,6 +187,30 @@ namespace catapult { namespace disruptor {
 				});
 	}
 
+	TEST(TEST_CLASS, CanAbandonElement) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PrepareDisruptor(disruptor);
+
+		// Act:
+		disruptor.abandon(7);
+
+		// Assert: the abandoned element is empty and skipped
+		EXPECT_EQ(16u, disruptor.size());
+		EXPECT_EQ(20u, disruptor.added());
+		EXPECT_TRUE(disruptor.elementAt(7).input().empty());
+		EXPECT_TRUE(disruptor.isSkipped(7));
+		test::AssertAborted(disruptor.elementAt(7).completionResult(), 0, ConsumerResultSeverity::Failure, 7);
+
+		// - other elements are unchanged
+		for (auto i = 0u; i < 16; ++i) {
+			if (7 != i) {
+				EXPECT_FALSE(disruptor.elementAt(i).input().empty()) << i;
+				EXPECT_FALSE(disruptor.isSkipped(i)) << i;
+			}
+		}
+	}
+
 	TEST(TEST_CLASS, CanMarkElements) {
 		// Arrange:
 		Disruptor disruptor(16);
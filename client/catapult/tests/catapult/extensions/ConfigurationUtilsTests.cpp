@@ -32,6 +32,7 @@ namespace catapult { namespace extensions {
 		auto config = config::NodeConfiguration::Uninitialized();
 		config.UnconfirmedTransactionsCacheMaxResponseSize = utils::FileSize::FromKilobytes(4);
 		config.UnconfirmedTransactionsCacheMaxSize = utils::FileSize::FromBytes(234);
+		config.UnconfirmedTransactionsCacheNumShards = 7;
 
 		// Act:
 		auto options = GetUtCacheOptions(config);
@@ -39,5 +40,6 @@ namespace catapult { namespace extensions {
 		// Assert:
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), options.MaxResponseSize);
 		EXPECT_EQ(utils::FileSize::FromBytes(234), options.MaxCacheSize);
+		EXPECT_EQ(7u, options.NumShards);
 	}
 }}
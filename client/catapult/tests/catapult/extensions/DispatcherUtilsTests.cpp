@@ -114,11 +114,17 @@ namespace catapult { namespace extensions {
 			counters[counter.id().name()] = counter.value();
 
 		// Assert:
-		ASSERT_EQ(3u, counters.size());
+		ASSERT_EQ(7u, counters.size());
 		EXPECT_EQ(3u, counters.at("XYZ ELEM TOT"));
 		EXPECT_EQ(2u, counters.at("XYZ ELEM ACT"));
 		EXPECT_EQ(0u, counters.at("XYZ ELEM MEM")); // total size is less than 1MB
 
+		// - latency counters are present (values depend on timing)
+		EXPECT_EQ(1u, counters.count("XYZ LAT MED"));
+		EXPECT_EQ(1u, counters.count("XYZ LAT TAIL"));
+		EXPECT_EQ(0u, counters.at("XYZ SLOW STG")); // dispatcher has a single consumer
+		EXPECT_EQ(1u, counters.count("XYZ SLOW TAIL"));
+
 		// Cleanup:
 		isElementCallbackUnblocked.state()->set();
 	}
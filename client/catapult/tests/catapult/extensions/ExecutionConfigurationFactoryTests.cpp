@@ -37,6 +37,7 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(!!config.pObserver);
 		EXPECT_TRUE(!!config.pValidator);
 		EXPECT_TRUE(!!config.pNotificationPublisher);
+		EXPECT_TRUE(!!config.pNotificationAccessExtractor);
 		EXPECT_TRUE(!!config.ResolverContextFactory);
 
 		// - notice that only observers and validators registered in CreateDefaultPluginManagerWithRealPlugins are present
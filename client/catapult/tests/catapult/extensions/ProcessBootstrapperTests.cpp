@@ -52,6 +52,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(15u, pluginManager.config().BlockTimeSmoothingFactor);
 		EXPECT_TRUE(pluginManager.storageConfig().PreferCacheDatabase);
 		EXPECT_EQ("base_data_dir/statedb", pluginManager.storageConfig().CacheDatabaseDirectory);
+		EXPECT_FALSE(!!pluginManager.executionProfile());
 
 		// - resources path and disposition should be correct
 		EXPECT_EQ("resources path", bootstrapper.resourcesPath());
@@ -68,6 +69,19 @@ namespace catapult { namespace extensions {
 		bootstrapper.subscriptionManager();
 	}
 
+	TEST(TEST_CLASS, CanCreateBootstrapperWithExecutionProfilingEnabled) {
+		// Arrange:
+		test::MutableCatapultConfiguration config;
+		config.Node.FileDatabaseBatchSize = test::File_Database_Batch_Size;
+		config.Node.EnableExecutionProfiling = true;
+
+		// Act:
+		ProcessBootstrapper bootstrapper(config.ToConst(), "resources path", ProcessDisposition::Recovery, "bootstrapper");
+
+		// Assert:
+		EXPECT_TRUE(!!bootstrapper.pluginManager().executionProfile());
+	}
+
 	// endregion
 
 	// region loadExtensions
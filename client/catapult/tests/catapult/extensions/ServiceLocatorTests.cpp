@@ -103,6 +103,53 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	TEST(TEST_CLASS, TryServiceReturnsNullWhenServiceIsNotRegistered) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint64_t>(12);
+			locator.registerService("foo", pService);
+
+			// Act:
+			auto pLocatedService = locator.tryService<uint64_t>("bar");
+
+			// Assert:
+			EXPECT_FALSE(!!pLocatedService);
+			EXPECT_EQ(1u, locator.numServices());
+		});
+	}
+
+	TEST(TEST_CLASS, TryServiceReturnsNonNullWhenServiceIsRegisteredAndNotDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint64_t>(12);
+			locator.registerService("foo", pService);
+
+			// Act:
+			auto pLocatedService = locator.tryService<uint64_t>("foo");
+
+			// Assert:
+			EXPECT_TRUE(!!pLocatedService);
+			EXPECT_EQ(pService.get(), pLocatedService.get());
+			EXPECT_EQ(1u, locator.numServices());
+		});
+	}
+
+	TEST(TEST_CLASS, TryServiceReturnsNullWhenServiceIsRegisteredAndDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint64_t>(12);
+			locator.registerService("foo", pService);
+			pService.reset();
+
+			// Act:
+			auto pLocatedService = locator.tryService<uint64_t>("foo");
+
+			// Assert:
+			EXPECT_FALSE(!!pLocatedService);
+			EXPECT_EQ(1u, locator.numServices());
+		});
+	}
+
 	TEST(TEST_CLASS, CannotRegisterSameServiceMultipleTimes) {
 		// Arrange:
 		RunLocatorTest([](ServiceLocator& locator) {
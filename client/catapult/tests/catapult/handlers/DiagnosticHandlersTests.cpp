@@ -25,7 +25,10 @@
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DispatcherLatencyEntry.h"
+#include "catapult/model/ExecutionProfileEntry.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/ExecutionProfile.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
 #include "tests/test/core/BlockStatementTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -479,4 +482,231 @@ namespace catapult { namespace handlers {
 	}
 
 	// endregion
+
+	// region DiagnosticExecutionProfileHandler
+
+	TEST(TEST_CLASS, DiagnosticExecutionProfileHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		utils::ExecutionProfile profile;
+		RegisterDiagnosticExecutionProfileHandler(handlers, profile);
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Execution_Profile);
+	}
+
+	namespace {
+		template<typename TAssertHandlerContext>
+		void AssertDiagnosticExecutionProfileHandlerWritesEntriesInResponseToValidRequest(
+				const utils::ExecutionProfile& profile,
+				size_t expectedPayloadSize,
+				TAssertHandlerContext assertHandlerContext) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterDiagnosticExecutionProfileHandler(handlers, profile);
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Execution_Profile;
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + expectedPayloadSize;
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Execution_Profile);
+
+			// - entries are written
+			assertHandlerContext(handlerContext);
+		}
+
+		void AssertExecutionProfileEntry(
+				const model::ExecutionProfileEntry& entry,
+				const std::string& expectedName,
+				uint64_t expectedNumCalls,
+				uint64_t expectedTotalElapsedNanoseconds,
+				uint64_t expectedMaxElapsedNanoseconds) {
+			EXPECT_EQ(sizeof(model::ExecutionProfileEntry) + expectedName.size(), entry.Size) << expectedName;
+			ASSERT_EQ(expectedName.size(), entry.NameSize) << expectedName;
+			EXPECT_EQ(expectedName, std::string(entry.NamePtr(), entry.NameSize));
+			EXPECT_EQ(expectedNumCalls, entry.NumCalls) << expectedName;
+			EXPECT_EQ(expectedTotalElapsedNanoseconds, entry.TotalElapsedNanoseconds) << expectedName;
+			EXPECT_EQ(expectedMaxElapsedNanoseconds, entry.MaxElapsedNanoseconds) << expectedName;
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticExecutionProfileHandler_WritesEntriesInResponseToValidRequest_ZeroEntries) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+
+		// Assert:
+		AssertDiagnosticExecutionProfileHandlerWritesEntriesInResponseToValidRequest(profile, 0, [](const auto& handlerContext) {
+			EXPECT_TRUE(handlerContext.response().buffers().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticExecutionProfileHandler_WritesEntriesInResponseToValidRequest_SingleEntry) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		profile.entry("alpha").record(std::chrono::nanoseconds(123));
+
+		// Assert:
+		auto expectedPayloadSize = sizeof(model::ExecutionProfileEntry) + 5;
+		AssertDiagnosticExecutionProfileHandlerWritesEntriesInResponseToValidRequest(profile, expectedPayloadSize, [](
+				const auto& handlerContext) {
+			const auto* pEntry = reinterpret_cast<const model::ExecutionProfileEntry*>(test::GetSingleBufferData(handlerContext));
+			AssertExecutionProfileEntry(*pEntry, "alpha", 1, 123, 123);
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticExecutionProfileHandler_WritesEntriesInResponseToValidRequest_MultipleEntries) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		profile.entry("alpha").record(std::chrono::nanoseconds(50));
+		profile.entry("gamma").record(std::chrono::nanoseconds(200));
+		profile.entry("gamma").record(std::chrono::nanoseconds(40));
+		profile.entry("beta_validator").record(std::chrono::nanoseconds(100));
+
+		// Assert: entries are sorted by decreasing total elapsed time
+		auto expectedPayloadSize = 3 * sizeof(model::ExecutionProfileEntry) + 5 + 5 + 14;
+		AssertDiagnosticExecutionProfileHandlerWritesEntriesInResponseToValidRequest(profile, expectedPayloadSize, [](
+				const auto& handlerContext) {
+			const auto* pData = test::GetSingleBufferData(handlerContext);
+			const auto* pEntry = reinterpret_cast<const model::ExecutionProfileEntry*>(pData);
+			AssertExecutionProfileEntry(*pEntry, "gamma", 2, 240, 200);
+
+			pData += pEntry->Size;
+			pEntry = reinterpret_cast<const model::ExecutionProfileEntry*>(pData);
+			AssertExecutionProfileEntry(*pEntry, "beta_validator", 1, 100, 100);
+
+			pData += pEntry->Size;
+			pEntry = reinterpret_cast<const model::ExecutionProfileEntry*>(pData);
+			AssertExecutionProfileEntry(*pEntry, "alpha", 1, 50, 50);
+		});
+	}
+
+	// endregion
+
+	// region DiagnosticDispatcherLatenciesHandler
+
+	namespace {
+		using DispatcherLatenciesVector = std::vector<DispatcherConsumerLatencies>;
+
+		utils::LatencySummary CreateLatencySummary(uint64_t seed) {
+			return { seed, seed + 1, seed + 2, seed + 3, seed + 4 };
+		}
+
+		void AssertEqual(const utils::LatencySummary& expected, const utils::LatencySummary& actual, const std::string& message) {
+			EXPECT_EQ(expected.Count, actual.Count) << message;
+			EXPECT_EQ(expected.Median, actual.Median) << message;
+			EXPECT_EQ(expected.P90, actual.P90) << message;
+			EXPECT_EQ(expected.P99, actual.P99) << message;
+			EXPECT_EQ(expected.Max, actual.Max) << message;
+		}
+
+		void AssertDispatcherLatencyEntry(const DispatcherConsumerLatencies& expected, const model::DispatcherLatencyEntry& entry) {
+			auto message = expected.DispatcherName + " " + std::to_string(expected.ConsumerLevel);
+			EXPECT_EQ(sizeof(model::DispatcherLatencyEntry) + expected.DispatcherName.size(), entry.Size) << message;
+			ASSERT_EQ(expected.DispatcherName.size(), entry.NameSize) << message;
+			EXPECT_EQ(expected.DispatcherName, std::string(entry.NamePtr(), entry.NameSize));
+			EXPECT_EQ(expected.ConsumerLevel, entry.ConsumerLevel) << message;
+			AssertEqual(expected.WaitTimes, entry.WaitTimes, message);
+			AssertEqual(expected.ProcessingTimes, entry.ProcessingTimes, message);
+		}
+
+		template<typename TAssertHandlerContext>
+		void AssertDiagnosticDispatcherLatenciesHandlerWritesEntriesInResponseToValidRequest(
+				const DispatcherLatenciesVector& allLatencies,
+				size_t expectedPayloadSize,
+				TAssertHandlerContext assertHandlerContext) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			auto numSupplierCalls = 0u;
+			RegisterDiagnosticDispatcherLatenciesHandler(handlers, [&allLatencies, &numSupplierCalls]() {
+				++numSupplierCalls;
+				return allLatencies;
+			});
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Dispatcher_Latencies;
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: supplier was called once
+			EXPECT_EQ(1u, numSupplierCalls);
+
+			// - header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + expectedPayloadSize;
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Dispatcher_Latencies);
+
+			// - entries are written
+			assertHandlerContext(handlerContext);
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticDispatcherLatenciesHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto numSupplierCalls = 0u;
+		RegisterDiagnosticDispatcherLatenciesHandler(handlers, [&numSupplierCalls]() {
+			++numSupplierCalls;
+			return DispatcherLatenciesVector();
+		});
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Dispatcher_Latencies);
+		EXPECT_EQ(0u, numSupplierCalls);
+	}
+
+	TEST(TEST_CLASS, DiagnosticDispatcherLatenciesHandler_WritesEntriesInResponseToValidRequest_ZeroEntries) {
+		// Arrange:
+		DispatcherLatenciesVector allLatencies;
+
+		// Assert:
+		AssertDiagnosticDispatcherLatenciesHandlerWritesEntriesInResponseToValidRequest(allLatencies, 0, [](const auto& handlerContext) {
+			EXPECT_TRUE(handlerContext.response().buffers().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticDispatcherLatenciesHandler_WritesEntriesInResponseToValidRequest_SingleEntry) {
+		// Arrange:
+		DispatcherLatenciesVector allLatencies{
+			{ "alpha", 2, CreateLatencySummary(10), CreateLatencySummary(20) }
+		};
+
+		// Assert:
+		auto expectedPayloadSize = sizeof(model::DispatcherLatencyEntry) + 5;
+		AssertDiagnosticDispatcherLatenciesHandlerWritesEntriesInResponseToValidRequest(allLatencies, expectedPayloadSize, [&allLatencies](
+				const auto& handlerContext) {
+			const auto* pEntry = reinterpret_cast<const model::DispatcherLatencyEntry*>(test::GetSingleBufferData(handlerContext));
+			AssertDispatcherLatencyEntry(allLatencies[0], *pEntry);
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticDispatcherLatenciesHandler_WritesEntriesInResponseToValidRequest_MultipleEntries) {
+		// Arrange:
+		DispatcherLatenciesVector allLatencies{
+			{ "alpha", 0, CreateLatencySummary(10), CreateLatencySummary(20) },
+			{ "alpha", model::DispatcherLatencyEntry::Total_Consumer_Level, utils::LatencySummary(), CreateLatencySummary(30) },
+			{ "beta_dispatcher", 0, CreateLatencySummary(40), CreateLatencySummary(50) }
+		};
+
+		// Assert: entries are written in supplied order
+		auto expectedPayloadSize = 3 * sizeof(model::DispatcherLatencyEntry) + 5 + 5 + 15;
+		AssertDiagnosticDispatcherLatenciesHandlerWritesEntriesInResponseToValidRequest(allLatencies, expectedPayloadSize, [&allLatencies](
+				const auto& handlerContext) {
+			const auto* pData = test::GetSingleBufferData(handlerContext);
+			for (const auto& latencies : allLatencies) {
+				const auto* pEntry = reinterpret_cast<const model::DispatcherLatencyEntry*>(pData);
+				AssertDispatcherLatencyEntry(latencies, *pEntry);
+				pData += pEntry->Size;
+			}
+		});
+	}
+
+	// endregion
 }}
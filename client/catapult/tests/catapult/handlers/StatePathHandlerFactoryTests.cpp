@@ -32,6 +32,7 @@ namespace catapult { namespace handlers {
 
 	namespace {
 		constexpr auto Mock_Packet_Type = static_cast<ionet::PacketType>(0x1234);
+		constexpr auto Mock_Batch_Packet_Type = static_cast<ionet::PacketType>(0x1235);
 		using TestPayloadType = uint64_t;
 		constexpr auto Payload_Size = sizeof(TestPayloadType);
 
@@ -68,9 +69,11 @@ namespace catapult { namespace handlers {
 
 		class MockCacheView {
 		public:
-			MockCacheView(bool result, const StatePath& path)
+			MockCacheView(bool result, const StatePath& path, const StatePath& proofNodes, std::vector<uint64_t>& lookupKeys)
 					: m_result(result)
 					, m_path(path)
+					, m_proofNodes(proofNodes)
+					, m_lookupKeys(lookupKeys)
 			{}
 
 		public:
@@ -81,9 +84,27 @@ namespace catapult { namespace handlers {
 				return std::make_pair(Hash256(), m_result);
 			}
 
+			auto tryLookup(const std::vector<uint64_t>& keys, tree::PatriciaTreeMultiProof& proof) const {
+				m_lookupKeys = keys;
+
+				// path of key at index i is composed of the first (i % (num nodes + 1)) nodes
+				for (const auto& node : m_proofNodes)
+					proof.Nodes.push_back(node.copy());
+
+				proof.Paths.resize(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i) {
+					for (auto j = 0u; j < i % (m_proofNodes.size() + 1); ++j)
+						proof.Paths[i].push_back(j);
+				}
+
+				return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), m_result));
+			}
+
 		private:
 			const bool m_result;
 			const StatePath& m_path;
+			const StatePath& m_proofNodes;
+			std::vector<uint64_t>& m_lookupKeys;
 		};
 
 		class MockCache {
@@ -94,7 +115,8 @@ namespace catapult { namespace handlers {
 		public:
 			auto createView() const {
 				auto readLock = m_lock.acquireReader();
-				return cache::LockedCacheView<MockCacheView>(MockCacheView(m_lookupResult, m_path), std::move(readLock));
+				auto view = MockCacheView(m_lookupResult, m_path, m_proofNodes, m_lookupKeys);
+				return cache::LockedCacheView<MockCacheView>(std::move(view), std::move(readLock));
 			}
 
 		public:
@@ -107,10 +129,23 @@ namespace catapult { namespace handlers {
 				return SerializePath(m_path);
 			}
 
+			auto setProofNodes(size_t numNodes) {
+				for (auto i = 0u; i < numNodes; ++i)
+					m_proofNodes.push_back(i % 2 ? tree::TreeNode(CreateRandomBranchNode()) : tree::TreeNode(CreateRandomLeafNode()));
+
+				return SerializePath(m_proofNodes);
+			}
+
+			const auto& lookupKeys() const {
+				return m_lookupKeys;
+			}
+
 		private:
 			mutable utils::SpinReaderWriterLock m_lock;
 			bool m_lookupResult;
 			StatePath m_path;
+			StatePath m_proofNodes;
+			mutable std::vector<uint64_t> m_lookupKeys;
 		};
 
 		// endregion
@@ -156,6 +191,26 @@ namespace catapult { namespace handlers {
 			}
 		};
 
+		struct StatePathsRequestTraits {
+			static constexpr ionet::PacketType Packet_Type = Mock_Batch_Packet_Type;
+
+			using RequestStructureType = TestPayloadType;
+		};
+
+		struct StatePathsHandlerFactoryTraits {
+		public:
+			static constexpr auto Packet_Type = Mock_Batch_Packet_Type;
+			static constexpr auto Valid_Request_Payload_Size = Payload_Size;
+
+			using RequestPayloadType = TestPayloadType;
+			using TestContext = StatePathHandlerFactoryTraits::TestContext;
+
+		public:
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, const MockCache& cache) {
+				RegisterStatePathsHandler<StatePathsRequestTraits>(handlers, cache);
+			}
+		};
+
 		// endregion
 
 		// region base tests
@@ -173,6 +228,10 @@ namespace catapult { namespace handlers {
 			StatePathHandlerFactoryTraits,
 			CacheHandlerTraits<StatePathHandlerFactoryTraits>>;
 
+		using BasicBatchHandlerTests = test::BasicBatchHandlerTests<
+			StatePathsHandlerFactoryTraits,
+			CacheHandlerTraits<StatePathsHandlerFactoryTraits>>;
+
 		// endregion
 
 		// region valid packet tests
@@ -253,4 +312,165 @@ namespace catapult { namespace handlers {
 					AssertReturnedValue(expectedResponse, handlerContext.response());
 				});
 	}
+
+	// region batch
+
+#define MAKE_BASIC_STATE_PATHS_HANDLER_TEST(NAME) TEST(TEST_CLASS, Batch_##NAME) { BasicBatchHandlerTests::Assert##NAME(); }
+
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(TooSmallPacketIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithWrongTypeIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithInvalidPayloadIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithTooSmallPayloadIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithNoPayloadIsRejected)
+
+	namespace {
+		template<typename TArrange, typename TAssertResponse>
+		void RunBatchPacketTest(uint32_t numKeys, uint32_t maxPacketDataSize, TArrange arrange, TAssertResponse assertResponse) {
+			// Arrange:
+			StatePathsHandlerFactoryTraits::TestContext testContext;
+			ionet::ServerPacketHandlers handlers(maxPacketDataSize);
+			StatePathsHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+			auto pPacket = test::CreateRandomPacket(numKeys * Payload_Size, Mock_Batch_Packet_Type);
+			arrange(testContext);
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert:
+			const auto* pKeys = reinterpret_cast<const uint64_t*>(pPacket->Data());
+			assertResponse(handlerContext, std::vector<uint64_t>(pKeys, pKeys + numKeys), testContext.getCache().lookupKeys());
+		}
+
+		template<typename TArrange, typename TAssertResponse>
+		void AssertBatchPacketIsAccepted(uint32_t numKeys, TArrange arrange, TAssertResponse assertResponse) {
+			RunBatchPacketTest(numKeys, Default_Max_Packet_Data_Size, arrange, [assertResponse](
+					const auto& handlerContext,
+					const auto& requestKeys,
+					const auto& lookupKeys) {
+				// Assert: the handler was called with all keys
+				EXPECT_EQ(requestKeys, lookupKeys);
+
+				ASSERT_TRUE(handlerContext.hasResponse());
+				assertResponse(handlerContext);
+			});
+		}
+
+		template<typename TValue>
+		void AppendValue(std::vector<uint8_t>& buffer, TValue value) {
+			const auto* pData = reinterpret_cast<const uint8_t*>(&value);
+			buffer.insert(buffer.end(), pData, pData + sizeof(TValue));
+		}
+	}
+
+	TEST(TEST_CLASS, Batch_ValidPacketIsAcceptedWhenCacheIsEmpty) {
+		// Arrange: no element in cache, so response contains sizes and empty paths
+		std::vector<uint8_t> expectedResponse;
+		AppendValue<uint32_t>(expectedResponse, 0);
+		AppendValue<uint32_t>(expectedResponse, 3);
+		for (auto i = 0u; i < 3; ++i)
+			AppendValue<uint8_t>(expectedResponse, 0);
+
+		AssertBatchPacketIsAccepted(
+				3,
+				[](const auto&) {},
+				[&expectedResponse](const auto& handlerContext) {
+					// Assert:
+					test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + expectedResponse.size(), Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_MultiProofIsReturnedForAllKeys) {
+		// Arrange:
+		std::vector<uint8_t> expectedResponse;
+
+		AssertBatchPacketIsAccepted(
+				5,
+				[&expectedResponse](auto& testContext) {
+					// - make tryLookup return a multiproof with three nodes
+					auto serializedNodes = testContext.getCache().setProofNodes(3);
+
+					AppendValue<uint32_t>(expectedResponse, 3);
+					AppendValue<uint32_t>(expectedResponse, 5);
+					expectedResponse.insert(expectedResponse.end(), serializedNodes.cbegin(), serializedNodes.cend());
+					for (auto i = 0u; i < 5; ++i) {
+						AppendValue<uint8_t>(expectedResponse, static_cast<uint8_t>(i % 4));
+						for (auto j = 0u; j < i % 4; ++j)
+							AppendValue<uint32_t>(expectedResponse, j);
+					}
+				},
+				[&expectedResponse](const auto& handlerContext) {
+					// Assert: response packet contains serialized multiproof
+					test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + expectedResponse.size(), Mock_Batch_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_PacketWithMaxKeysIsAccepted) {
+		AssertBatchPacketIsAccepted(
+				Max_State_Paths_Request_Keys,
+				[](const auto&) {},
+				[](const auto& handlerContext) {
+					// Assert: response contains sizes and empty paths
+					auto expectedSize = sizeof(ionet::PacketHeader) + 2 * sizeof(uint32_t) + Max_State_Paths_Request_Keys;
+					test::AssertPacketHeader(handlerContext, expectedSize, Mock_Batch_Packet_Type);
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_PacketWithTooManyKeysIsRejected) {
+		RunBatchPacketTest(
+				Max_State_Paths_Request_Keys + 1,
+				Default_Max_Packet_Data_Size,
+				[](const auto&) {},
+				[](const auto& handlerContext, const auto&, const auto& lookupKeys) {
+					// Assert: the cache was not queried and there is no response
+					EXPECT_TRUE(lookupKeys.empty());
+					EXPECT_FALSE(handlerContext.hasResponse());
+				});
+	}
+
+	namespace {
+		template<typename TAssertResponse>
+		void RunBatchPacketWithMaxPacketDataSizeTest(int32_t maxPacketDataSizeDelta, TAssertResponse assertResponse) {
+			// Arrange: prepare a handler with a max packet data size relative to the size of the multiproof
+			// - serialized node sizes do not depend on random data, so nodes matching those set by setProofNodes can be used
+			StatePath nodes;
+			nodes.push_back(tree::TreeNode(CreateRandomLeafNode()));
+			nodes.push_back(tree::TreeNode(CreateRandomBranchNode()));
+			nodes.push_back(tree::TreeNode(CreateRandomLeafNode()));
+			auto serializedNodes = SerializePath(nodes);
+
+			// - response contains sizes, nodes and five paths composed of (0, 1, 2, 3, 0) node indexes
+			auto multiProofSize = static_cast<uint32_t>(2 * sizeof(uint32_t) + serializedNodes.size() + 5 + 6 * sizeof(uint32_t));
+			auto maxPacketDataSize = static_cast<uint32_t>(static_cast<int32_t>(multiProofSize) + maxPacketDataSizeDelta);
+
+			RunBatchPacketTest(
+					5,
+					maxPacketDataSize,
+					[](auto& testContext) {
+						testContext.getCache().setProofNodes(3);
+					},
+					[multiProofSize, assertResponse](const auto& handlerContext, const auto& requestKeys, const auto& lookupKeys) {
+						// Assert: the handler was called with all keys
+						EXPECT_EQ(requestKeys, lookupKeys);
+						assertResponse(handlerContext, multiProofSize);
+					});
+		}
+	}
+
+	TEST(TEST_CLASS, Batch_ResponseIsSentWhenMultiProofFitsMaxPacketDataSize) {
+		RunBatchPacketWithMaxPacketDataSizeTest(0, [](const auto& handlerContext, auto multiProofSize) {
+			ASSERT_TRUE(handlerContext.hasResponse());
+			test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + multiProofSize, Mock_Batch_Packet_Type);
+		});
+	}
+
+	TEST(TEST_CLASS, Batch_ResponseIsNotSentWhenMultiProofExceedsMaxPacketDataSize) {
+		RunBatchPacketWithMaxPacketDataSizeTest(-1, [](const auto& handlerContext, auto) {
+			EXPECT_FALSE(handlerContext.hasResponse());
+		});
+	}
+
+	// endregion
 }}
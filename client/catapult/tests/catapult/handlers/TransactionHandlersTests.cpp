@@ -167,4 +167,162 @@ namespace catapult { namespace handlers {
 			test::PullEntitiesHandlerAssertAdapter<PullTransactionsRequestResponseTraits>::AssertFunc)
 
 	// endregion
+
+	// region PullFilteredTransactionsHandler
+
+	namespace {
+		constexpr auto Filtered_Packet_Type = ionet::PacketType::Pull_Filtered_Transactions;
+		constexpr auto Filtered_Data_Header_Size = sizeof(Timestamp) + sizeof(BlockFeeMultiplier);
+
+		std::shared_ptr<ionet::Packet> CreatePullFilteredTransactionsPacket(
+				Timestamp deadline,
+				BlockFeeMultiplier feeMultiplier,
+				const utils::BloomFilter& filter,
+				uint32_t numTrailingBytes = 0) {
+			auto filterSize = static_cast<uint32_t>(sizeof(utils::BloomFilterHeader) + filter.data().size());
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(
+					static_cast<uint32_t>(Filtered_Data_Header_Size) + filterSize + numTrailingBytes);
+			pPacket->Type = Filtered_Packet_Type;
+
+			auto* pData = pPacket->Data();
+			reinterpret_cast<Timestamp&>(*pData) = deadline;
+			reinterpret_cast<BlockFeeMultiplier&>(*(pData + sizeof(Timestamp))) = feeMultiplier;
+			pData += Filtered_Data_Header_Size;
+
+			reinterpret_cast<utils::BloomFilterHeader&>(*pData) = filter.header();
+			std::memcpy(pData + sizeof(utils::BloomFilterHeader), filter.data().data(), filter.data().size());
+			return pPacket;
+		}
+
+		struct FilteredUtRetrieverParams {
+		public:
+			FilteredUtRetrieverParams(Timestamp deadline, BlockFeeMultiplier feeMultiplier, const utils::BloomFilter& filter)
+					: Deadline(deadline)
+					, FeeMultiplier(feeMultiplier)
+					, Filter(filter)
+			{}
+
+		public:
+			Timestamp Deadline;
+			BlockFeeMultiplier FeeMultiplier;
+			utils::BloomFilter Filter;
+		};
+
+		template<typename TAction>
+		void RunPullFilteredTransactionsTest(const ionet::Packet& packet, const UnconfirmedTransactions& transactions, TAction action) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			std::vector<FilteredUtRetrieverParams> params;
+			RegisterPullFilteredTransactionsHandler(handlers, [&params, &transactions](
+					auto deadline,
+					auto feeMultiplier,
+					const auto& filter) {
+				params.emplace_back(deadline, feeMultiplier, filter);
+				return transactions;
+			});
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(packet, handlerContext));
+
+			// Assert:
+			action(params, handlerContext);
+		}
+
+		void AssertPullFilteredTransactionsPacketIsRejected(const ionet::Packet& packet) {
+			RunPullFilteredTransactionsTest(packet, {}, [](const auto& params, const auto& handlerContext) {
+				EXPECT_TRUE(params.empty());
+				test::AssertNoResponse(handlerContext);
+			});
+		}
+
+		utils::BloomFilter CreateRandomFilter(size_t size) {
+			return utils::BloomFilter(static_cast<uint32_t>(test::Random()), 3, test::GenerateRandomVector(size));
+		}
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithWrongTypeIsRejected) {
+		// Arrange:
+		auto pPacket = CreatePullFilteredTransactionsPacket(Timestamp(), BlockFeeMultiplier(), CreateRandomFilter(8));
+		pPacket->Type = ionet::PacketType::Pull_Transactions;
+
+		// Act:
+		ionet::ServerPacketHandlers handlers;
+		RegisterPullFilteredTransactionsHandler(handlers, [](auto, auto, const auto&) { return UnconfirmedTransactions(); });
+		ionet::ServerPacketHandlerContext handlerContext;
+		auto isProcessed = handlers.process(*pPacket, handlerContext);
+
+		// Assert:
+		EXPECT_FALSE(isProcessed);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithoutFilterValueIsRejected) {
+		// Arrange:
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(static_cast<uint32_t>(Filtered_Data_Header_Size - 1));
+		pPacket->Type = Filtered_Packet_Type;
+
+		// Act + Assert:
+		AssertPullFilteredTransactionsPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithoutFilterIsRejected) {
+		// Arrange:
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(static_cast<uint32_t>(Filtered_Data_Header_Size));
+		pPacket->Type = Filtered_Packet_Type;
+
+		// Act + Assert:
+		AssertPullFilteredTransactionsPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithMalformedFilterIsRejected) {
+		// Arrange: zero hash functions are not allowed
+		auto pPacket = CreatePullFilteredTransactionsPacket(Timestamp(), BlockFeeMultiplier(), CreateRandomFilter(8));
+		reinterpret_cast<utils::BloomFilterHeader&>(*(pPacket->Data() + Filtered_Data_Header_Size)).NumHashFunctions = 0;
+
+		// Act + Assert:
+		AssertPullFilteredTransactionsPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_PacketWithTrailingDataIsRejected) {
+		// Arrange:
+		auto pPacket = CreatePullFilteredTransactionsPacket(Timestamp(), BlockFeeMultiplier(), CreateRandomFilter(8), 1);
+
+		// Act + Assert:
+		AssertPullFilteredTransactionsPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullFilteredTransactions_ValidPacketIsAccepted) {
+		// Arrange:
+		auto filter = CreateRandomFilter(8);
+		auto pPacket = CreatePullFilteredTransactionsPacket(Timestamp(123), BlockFeeMultiplier(234), filter);
+
+		UnconfirmedTransactions transactions;
+		for (uint16_t i = 0u; i < 3; ++i)
+			transactions.push_back(mocks::CreateMockTransaction(static_cast<uint16_t>(i + 1)));
+
+		// Act:
+		RunPullFilteredTransactionsTest(*pPacket, transactions, [&filter, &transactions](const auto& params, const auto& handlerContext) {
+			// Assert: the requested values were passed to the retriever
+			ASSERT_EQ(1u, params.size());
+			EXPECT_EQ(Timestamp(123), params[0].Deadline);
+			EXPECT_EQ(BlockFeeMultiplier(234), params[0].FeeMultiplier);
+			EXPECT_EQ(filter.seed(), params[0].Filter.seed());
+			EXPECT_EQ(3u, params[0].Filter.numHashFunctions());
+			EXPECT_EQ(filter.data(), params[0].Filter.data());
+
+			// - the response contains all retrieved transactions
+			ASSERT_TRUE(handlerContext.hasResponse());
+			auto payload = handlerContext.response();
+			test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + test::TotalSize(transactions), Filtered_Packet_Type);
+			ASSERT_EQ(3u, payload.buffers().size());
+
+			auto i = 0u;
+			for (const auto& pExpectedTransaction : transactions) {
+				const auto& transaction = reinterpret_cast<const mocks::MockTransaction&>(*payload.buffers()[i++].pData);
+				EXPECT_EQ(*pExpectedTransaction, transaction);
+			}
+		});
+	}
+
+	// endregion
 }}
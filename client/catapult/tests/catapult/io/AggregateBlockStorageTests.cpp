@@ -171,6 +171,36 @@ namespace catapult { namespace io {
 		EXPECT_EQ(pBlockElement.get(), context.subscriber().blockElements()[0]);
 	}
 
+	TEST(TEST_CLASS, SaveBlocksDelegatesToStorageAndPublisher) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			std::vector<const std::vector<model::BlockElement>*> ElementsGroups;
+
+		public:
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				ElementsGroups.push_back(&blockElements);
+			}
+		};
+
+		TestContext<MockBlockStorage, mocks::MockBlockChangeSubscriber> context;
+
+		auto pBlock1 = test::GenerateEmptyRandomBlock();
+		auto pBlock2 = test::GenerateEmptyRandomBlock();
+		std::vector<model::BlockElement> blockElements{ model::BlockElement(*pBlock1), model::BlockElement(*pBlock2) };
+
+		// Act:
+		context.aggregate().saveBlocks(blockElements);
+
+		// Assert: all elements are saved together
+		ASSERT_EQ(1u, context.storage().ElementsGroups.size());
+		EXPECT_EQ(&blockElements, context.storage().ElementsGroups[0]);
+
+		ASSERT_EQ(2u, context.subscriber().blockElements().size());
+		EXPECT_EQ(&blockElements[0], context.subscriber().blockElements()[0]);
+		EXPECT_EQ(&blockElements[1], context.subscriber().blockElements()[1]);
+	}
+
 	TEST(TEST_CLASS, DropBlocksAfterDelegatesToStorageAndPublisher) {
 		// Arrange:
 		class MockBlockStorage : public UnsupportedBlockStorage {
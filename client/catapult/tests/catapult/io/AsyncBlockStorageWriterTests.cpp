@@ -0,0 +1,258 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/AsyncBlockStorageWriter.h"
+#include "catapult/io/BlockStorage.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/nodeps/Atomics.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS AsyncBlockStorageWriterTests
+
+	namespace {
+		// region MockGroupCommitBlockStorage
+
+		class MockGroupCommitBlockStorage : public LightBlockStorage {
+		public:
+			explicit MockGroupCommitBlockStorage(bool shouldThrow = false)
+					: m_shouldThrow(shouldThrow)
+					, m_numSaveBlocksCalls(0)
+			{}
+
+		public:
+			size_t numSaveBlocksCalls() const {
+				return m_numSaveBlocksCalls;
+			}
+
+			std::vector<std::vector<Height>> groups() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_groups;
+			}
+
+		public:
+			void blockFirstGroup(const test::AutoSetFlag& isUnblocked) {
+				m_pIsUnblocked = isUnblocked.state();
+			}
+
+		public:
+			Height chainHeight() const override {
+				CATAPULT_THROW_RUNTIME_ERROR("chainHeight - not supported in mock");
+			}
+
+			model::HashRange loadHashesFrom(Height, size_t) const override {
+				CATAPULT_THROW_RUNTIME_ERROR("loadHashesFrom - not supported in mock");
+			}
+
+			void saveBlock(const model::BlockElement&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("saveBlock - not supported in mock");
+			}
+
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				if (1 == ++m_numSaveBlocksCalls && m_pIsUnblocked)
+					m_pIsUnblocked->wait();
+
+				if (m_shouldThrow)
+					CATAPULT_THROW_RUNTIME_ERROR("saveBlocks failed");
+
+				std::vector<Height> heights;
+				for (const auto& blockElement : blockElements)
+					heights.push_back(blockElement.Block.Height);
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_groups.push_back(heights);
+			}
+
+			void dropBlocksAfter(Height) override {
+				CATAPULT_THROW_RUNTIME_ERROR("dropBlocksAfter - not supported in mock");
+			}
+
+		private:
+			bool m_shouldThrow;
+			std::shared_ptr<test::AutoSetFlag::State> m_pIsUnblocked;
+			std::atomic<size_t> m_numSaveBlocksCalls;
+			std::vector<std::vector<Height>> m_groups;
+			mutable std::mutex m_mutex;
+		};
+
+		// endregion
+
+		// region test utils
+
+		class BlockElementsFactory {
+		public:
+			std::vector<std::shared_ptr<const model::BlockElement>> create(std::initializer_list<uint64_t> heights) {
+				std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+				for (auto height : heights) {
+					m_blocks.push_back(test::GenerateBlockWithTransactions(0, Height(height)));
+					blockElements.push_back(std::make_shared<model::BlockElement>(*m_blocks.back()));
+				}
+
+				return blockElements;
+			}
+
+		private:
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+		};
+
+		std::vector<Height> ToHeights(std::initializer_list<uint64_t> rawHeights) {
+			std::vector<Height> heights;
+			for (auto rawHeight : rawHeights)
+				heights.push_back(Height(rawHeight));
+
+			return heights;
+		}
+
+		// endregion
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CanCreateAndDestroyWriterWithoutSavingBlocks) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage;
+
+		{
+			// Act:
+			AsyncBlockStorageWriter writer(storage);
+			writer.flush();
+
+			// Assert:
+			EXPECT_EQ(0u, writer.numGroupCommits());
+		}
+
+		// Assert:
+		EXPECT_EQ(0u, storage.numSaveBlocksCalls());
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocks) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage;
+		AsyncBlockStorageWriter writer(storage);
+		BlockElementsFactory factory;
+
+		// Act:
+		writer.saveBlocks(factory.create({ 7, 8, 9 }));
+		writer.flush();
+
+		// Assert:
+		EXPECT_EQ(1u, writer.numGroupCommits());
+		EXPECT_EQ(std::vector<std::vector<Height>>({ ToHeights({ 7, 8, 9 }) }), storage.groups());
+	}
+
+	TEST(TEST_CLASS, FlushedBlocksAreSavedInSeparateGroups) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage;
+		AsyncBlockStorageWriter writer(storage);
+		BlockElementsFactory factory;
+
+		// Act:
+		writer.saveBlocks(factory.create({ 7, 8 }));
+		writer.flush();
+		writer.saveBlocks(factory.create({ 9 }));
+		writer.flush();
+
+		// Assert:
+		EXPECT_EQ(2u, writer.numGroupCommits());
+		EXPECT_EQ(std::vector<std::vector<Height>>({ ToHeights({ 7, 8 }), ToHeights({ 9 }) }), storage.groups());
+	}
+
+	TEST(TEST_CLASS, BlocksQueuedWhileWriterIsBusyAreSavedAsSingleGroup) {
+		// Arrange: block the first group commit
+		test::AutoSetFlag isUnblocked;
+		MockGroupCommitBlockStorage storage;
+		storage.blockFirstGroup(isUnblocked);
+
+		AsyncBlockStorageWriter writer(storage);
+		BlockElementsFactory factory;
+
+		// Act:
+		writer.saveBlocks(factory.create({ 7 }));
+		WAIT_FOR_ONE_EXPR(storage.numSaveBlocksCalls());
+
+		writer.saveBlocks(factory.create({ 8, 9 }));
+		writer.saveBlocks(factory.create({ 10 }));
+		isUnblocked.state()->set();
+		writer.flush();
+
+		// Assert:
+		EXPECT_EQ(2u, writer.numGroupCommits());
+		EXPECT_EQ(std::vector<std::vector<Height>>({ ToHeights({ 7 }), ToHeights({ 8, 9, 10 }) }), storage.groups());
+	}
+
+	TEST(TEST_CLASS, DestructorSavesAllQueuedBlocks) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage;
+		BlockElementsFactory factory;
+
+		// Act:
+		{
+			AsyncBlockStorageWriter writer(storage);
+			writer.saveBlocks(factory.create({ 7, 8 }));
+			writer.saveBlocks(factory.create({ 9 }));
+		}
+
+		// Assert: grouping depends on timing, but all blocks are saved in order
+		std::vector<Height> heights;
+		for (const auto& group : storage.groups())
+			heights.insert(heights.end(), group.cbegin(), group.cend());
+
+		EXPECT_EQ(ToHeights({ 7, 8, 9 }), heights);
+	}
+
+	// endregion
+
+	// region error handling
+
+	TEST(TEST_CLASS, FlushRethrowsStorageError) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage(true);
+		AsyncBlockStorageWriter writer(storage);
+		BlockElementsFactory factory;
+
+		// Act:
+		writer.saveBlocks(factory.create({ 7, 8 }));
+
+		// Assert:
+		EXPECT_THROW(writer.flush(), catapult_runtime_error);
+		EXPECT_EQ(0u, writer.numGroupCommits());
+	}
+
+	TEST(TEST_CLASS, NoBlocksAreSavedAfterStorageError) {
+		// Arrange:
+		MockGroupCommitBlockStorage storage(true);
+		AsyncBlockStorageWriter writer(storage);
+		BlockElementsFactory factory;
+
+		writer.saveBlocks(factory.create({ 7, 8 }));
+		EXPECT_THROW(writer.flush(), catapult_runtime_error);
+
+		// Act:
+		writer.saveBlocks(factory.create({ 9 }));
+
+		// Assert: error is sticky and no further blocks are passed to storage
+		EXPECT_THROW(writer.flush(), catapult_runtime_error);
+		EXPECT_EQ(1u, storage.numSaveBlocksCalls());
+	}
+
+	// endregion
+}}
@@ -21,6 +21,7 @@
 
 #include "catapult/io/BlockElementSerializer.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/SerializerTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
@@ -298,6 +299,31 @@ namespace catapult { namespace io {
 		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
 	}
 
+	TEST(TEST_CLASS, CanReadBlockElementMetadataAroundExistingBlock) {
+		// Arrange: only pass metadata to the stream
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBlock = std::shared_ptr<const model::Block>(test::CopyEntity(*context.pBlock));
+		auto metadataBuffer = std::vector<uint8_t>(context.Buffer.cbegin() + pBlock->Size, context.Buffer.cend());
+		mocks::MockMemoryStream inputStream(metadataBuffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementMetadata(pBlock, inputStream);
+
+		// Assert: block is not copied and is kept alive by element
+		EXPECT_EQ(pBlock.get(), &pBlockElement->Block);
+		EXPECT_EQ(2, pBlock.use_count());
+		EXPECT_EQ(metadataBuffer.size(), inputStream.position());
+
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
 	// endregion
 
 	// region Roundtrip
@@ -60,6 +60,10 @@ namespace catapult { namespace io {
 			}
 
 		public: // BlockStorage
+			Height findHeight(const Hash256& hash) const override {
+				return m_cache.view().findHeight(hash);
+			}
+
 			std::shared_ptr<const model::Block> loadBlock(Height height) const override {
 				return m_cache.view().loadBlock(height);
 			}
@@ -180,6 +184,29 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region findHeight
+
+	TEST(TEST_CLASS, FindHeightDelegatesToStorage) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0));
+
+		for (auto i = 1u; i <= Delegation_Chain_Size; ++i) {
+			// Act:
+			Height height(i);
+			auto hash = *pStorageRaw->loadHashesFrom(height, 1).cbegin();
+			auto cacheHeight = cache.view().findHeight(hash);
+
+			// Assert:
+			EXPECT_EQ(height, cacheHeight);
+		}
+
+		EXPECT_EQ(Height(0), cache.view().findHeight(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	// endregion
+
 	// region loadBlock(Element)
 
 	TEST(TEST_CLASS, LoadBlockDelegatesToStorage) {
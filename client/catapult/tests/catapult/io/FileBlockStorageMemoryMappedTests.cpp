@@ -0,0 +1,135 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS FileBlockStorageMemoryMappedTests
+
+	namespace {
+		struct MemoryMappedFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = FileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination, uint32_t fileDatabaseBatchSize = 1) {
+				return std::make_unique<StorageType>(
+						destination,
+						fileDatabaseBatchSize,
+						FileBlockStorageMode::Hash_Index,
+						FileDatabaseReadMode::Memory_Mapped);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination, test::File_Database_Batch_Size);
+			}
+		};
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(MemoryMappedFileTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(MemoryMappedFileTraits)
+
+	// region view lifetime
+
+	TEST(TEST_CLASS, LoadedBlocksAreNotInvalidatedByRewrite) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(blockElement);
+
+		auto pLoadedBlock = pStorage->loadBlock(Height(2));
+		auto pLoadedBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act: replace the block
+		auto pNewBlock = test::GenerateBlockWithTransactions(3, Height(2));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		pStorage->dropBlocksAfter(Height(1));
+		pStorage->saveBlock(newBlockElement);
+
+		auto pNewLoadedBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Assert: previously loaded views still reference the original block
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+		test::AssertEqual(blockElement, *pLoadedBlockElement);
+		test::AssertEqual(newBlockElement, *pNewLoadedBlockElement);
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksOutliveStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(blockElement);
+
+		auto pLoadedBlock = pStorage->loadBlock(Height(2));
+		auto pLoadedBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage.reset();
+
+		// Assert:
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+		test::AssertEqual(blockElement, *pLoadedBlockElement);
+	}
+
+	// endregion
+
+	// region storage trailing data
+
+	TEST(TEST_CLASS, CannotReadSavedBlockElementWithTrailingData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = MemoryMappedFileTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// - append some data
+		{
+			io::RawFile file(tempDir.name() + "/00000/00000.dat", io::OpenMode::Read_Append);
+			file.seek(file.size());
+			std::vector<uint8_t> buffer{ 42 };
+			file.write(buffer);
+		}
+
+		// Act + Assert
+		auto pStorage = MemoryMappedFileTraits::OpenStorage(tempDir.name(), test::File_Database_Batch_Size);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_runtime_error);
+	}
+
+	// endregion
+}}
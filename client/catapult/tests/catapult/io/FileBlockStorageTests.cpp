@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/IndexFile.h"
 #include "tests/test/core/BlockStorageTests.h"
 #include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -94,6 +95,7 @@ namespace catapult { namespace io {
 
 		// Assert: hashes are not present
 		EXPECT_THROW(storage.loadHashesFrom(Height(1), 100), catapult_invalid_argument);
+		EXPECT_EQ(Height(1), storage.findHeight(blockElement.EntityHash));
 		test::AssertEqual(blockElement, *pStorageBlockElement);
 	}
 
@@ -192,4 +194,160 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region hash height index
+
+	namespace {
+		constexpr auto Hash_Height_Index_Filename = "hashes.index";
+
+		std::vector<Hash256> LoadAllHashes(const FileBlockStorage& storage) {
+			auto hashes = storage.loadHashesFrom(Height(1), storage.chainHeight().unwrap());
+			return std::vector<Hash256>(hashes.cbegin(), hashes.cend());
+		}
+
+		void AssertCanFindHeights(const FileBlockStorage& storage, const std::vector<Hash256>& hashes, size_t numExpectedHashes) {
+			auto height = Height(1);
+			for (const auto& hash : hashes) {
+				auto expectedHeight = height.unwrap() <= numExpectedHashes ? height : Height(0);
+				EXPECT_EQ(expectedHeight, storage.findHeight(hash)) << "at " << height;
+				height = height + Height(1);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, HashHeightIndexIsPersistedAcrossDifferentStorageInstances) {
+		// Arrange:
+		auto context = test::PrepareStorageWithBlocks<FileTraits>(10);
+		auto hashes = LoadAllHashes(*context);
+		auto directory = context.pTempDirectoryGuard->name();
+		context.pStorage.reset();
+
+		// Sanity:
+		EXPECT_TRUE(std::filesystem::exists(std::filesystem::path(directory) / Hash_Height_Index_Filename));
+
+		// Act:
+		FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+
+		// Assert:
+		AssertCanFindHeights(storage, hashes, 10);
+	}
+
+	TEST(TEST_CLASS, HashHeightIndexIsRebuiltWhenMissing) {
+		// Arrange:
+		auto context = test::PrepareStorageWithBlocks<FileTraits>(10);
+		auto hashes = LoadAllHashes(*context);
+		auto directory = context.pTempDirectoryGuard->name();
+		context.pStorage.reset();
+
+		std::filesystem::remove(std::filesystem::path(directory) / Hash_Height_Index_Filename);
+
+		// Act:
+		FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+
+		// Assert:
+		AssertCanFindHeights(storage, hashes, 10);
+		EXPECT_TRUE(std::filesystem::exists(std::filesystem::path(directory) / Hash_Height_Index_Filename));
+	}
+
+	TEST(TEST_CLASS, HashHeightIndexIsUpdatedWhenBehindChainHeight) {
+		// Arrange: the most recently saved hashes are still pending when the storage is destroyed
+		auto context = test::PrepareStorageWithBlocks<FileTraits>(10);
+		auto hashes = LoadAllHashes(*context);
+		auto directory = context.pTempDirectoryGuard->name();
+		context.pStorage.reset();
+
+		auto indexFilePath = (std::filesystem::path(directory) / Hash_Height_Index_Filename).generic_string();
+
+		// Sanity:
+		EXPECT_GT(Height(10), HashHeightIndex(indexFilePath).height());
+
+		// Act:
+		FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+
+		// Assert:
+		AssertCanFindHeights(storage, hashes, 10);
+	}
+
+	TEST(TEST_CLASS, HashHeightIndexIsRebuiltWhenAheadOfChainHeight) {
+		// Arrange: simulate a crash after the hash height index was updated but before the index file was updated
+		auto context = test::PrepareStorageWithBlocks<FileTraits>(10);
+		auto hashes = LoadAllHashes(*context);
+		auto directory = context.pTempDirectoryGuard->name();
+		context.pStorage.reset();
+
+		IndexFile((std::filesystem::path(directory) / "index.dat").generic_string()).set(7);
+
+		// Act:
+		FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+
+		// Assert:
+		AssertCanFindHeights(storage, hashes, 7);
+	}
+
+	TEST(TEST_CLASS, HashHeightIndexIsRebuiltBeforeSavingBlocks) {
+		// Arrange:
+		auto context = test::PrepareStorageWithBlocks<FileTraits>(10);
+		auto directory = context.pTempDirectoryGuard->name();
+		context.pStorage.reset();
+
+		std::filesystem::remove(std::filesystem::path(directory) / Hash_Height_Index_Filename);
+
+		// Act:
+		FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(11));
+		storage.saveBlock(test::CreateBlockElementForSaveTests(*pBlock));
+
+		// Assert:
+		AssertCanFindHeights(storage, LoadAllHashes(storage), 11);
+	}
+
+	namespace {
+		auto PrepareStorageWithoutHashIndex(size_t numBlocks, std::vector<Hash256>& hashes) {
+			auto context = test::PrepareStorageWithBlocks<FileTraits>(numBlocks);
+			hashes = LoadAllHashes(*context);
+
+			// - reopen the storage without a hash height index
+			context.pStorage.reset();
+			context.pStorage = std::make_unique<FileBlockStorage>(
+					context.pTempDirectoryGuard->name(),
+					test::File_Database_Batch_Size,
+					FileBlockStorageMode::None);
+			return context;
+		}
+	}
+
+	TEST(TEST_CLASS, FindHeightCanFindAllSavedBlocksWhenHashIndexIsDisabled) {
+		// Arrange:
+		std::vector<Hash256> hashes;
+		auto context = PrepareStorageWithoutHashIndex(10, hashes);
+
+		// Act + Assert:
+		AssertCanFindHeights(*context, hashes, 10);
+	}
+
+	TEST(TEST_CLASS, FindHeightReturnsZeroWhenHashIsUnknownAndHashIndexIsDisabled) {
+		// Arrange:
+		std::vector<Hash256> hashes;
+		auto context = PrepareStorageWithoutHashIndex(10, hashes);
+
+		// Act:
+		auto height = context->findHeight(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_EQ(Height(0), height);
+	}
+
+	TEST(TEST_CLASS, FindHeightReturnsZeroWhenBlockIsDroppedAndHashIndexIsDisabled) {
+		// Arrange:
+		std::vector<Hash256> hashes;
+		auto context = PrepareStorageWithoutHashIndex(10, hashes);
+
+		// Act:
+		context->dropBlocksAfter(Height(6));
+
+		// Assert:
+		AssertCanFindHeights(*context, hashes, 6);
+	}
+
+	// endregion
 }}
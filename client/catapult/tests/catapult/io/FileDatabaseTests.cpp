@@ -35,8 +35,8 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, FileDatabaseReadMode readMode = FileDatabaseReadMode::Stream)
+					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" }, readMode)
 			{}
 
 		public:
@@ -282,9 +282,9 @@ namespace catapult { namespace io {
 
 	namespace {
 		template<typename TAction>
-		void RunRewriteTest(size_t rewriteId, TAction action) {
+		void RunRewriteTest(size_t rewriteId, FileDatabaseReadMode readMode, TAction action) {
 			// Arrange:
-			TestContext context;
+			TestContext context(Batch_Size, readMode);
 
 			auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
 			WriteAll(context.database(), 10, payloads);
@@ -303,25 +303,66 @@ namespace catapult { namespace io {
 	}
 
 	TEST(TEST_CLASS, CanRewriteFirstPayloadInFile) {
-		RunRewriteTest(10, [](const auto& contents, const auto&, const auto& newPayload) {
+		RunRewriteTest(10, FileDatabaseReadMode::Stream, [](const auto& contents, const auto&, const auto& newPayload) {
 			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), newPayload }), contents);
 		});
 	}
 
 	TEST(TEST_CLASS, CanRewriteMiddlePayloadInFile) {
-		RunRewriteTest(12, [](const auto& contents, const auto& payloads, const auto& newPayload) {
+		RunRewriteTest(12, FileDatabaseReadMode::Stream, [](const auto& contents, const auto& payloads, const auto& newPayload) {
 			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 100, 0, 0 }), payloads[0], payloads[1], newPayload }), contents);
 		});
 	}
 
 	TEST(TEST_CLASS, CanRewriteLastPayloadInFile) {
-		RunRewriteTest(14, [](const auto& contents, const auto& payloads, const auto& newPayload) {
+		RunRewriteTest(14, FileDatabaseReadMode::Stream, [](const auto& contents, const auto& payloads, const auto& newPayload) {
+			EXPECT_EQ(
+					Concatenate({ MakeHeader({ 40, 90, 100, 130, 150 }), payloads[0], payloads[1], payloads[2], payloads[3], newPayload }),
+					contents);
+		});
+	}
+
+	TEST(TEST_CLASS, CanRewriteFirstPayloadInFile_MemoryMapped) {
+		RunRewriteTest(10, FileDatabaseReadMode::Memory_Mapped, [](const auto& contents, const auto&, const auto& newPayload) {
+			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), newPayload }), contents);
+		});
+	}
+
+	TEST(TEST_CLASS, CanRewriteMiddlePayloadInFile_MemoryMapped) {
+		RunRewriteTest(12, FileDatabaseReadMode::Memory_Mapped, [](const auto& contents, const auto& payloads, const auto& newPayload) {
+			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 100, 0, 0 }), payloads[0], payloads[1], newPayload }), contents);
+		});
+	}
+
+	TEST(TEST_CLASS, CanRewriteLastPayloadInFile_MemoryMapped) {
+		RunRewriteTest(14, FileDatabaseReadMode::Memory_Mapped, [](const auto& contents, const auto& payloads, const auto& newPayload) {
 			EXPECT_EQ(
 					Concatenate({ MakeHeader({ 40, 90, 100, 130, 150 }), payloads[0], payloads[1], payloads[2], payloads[3], newPayload }),
 					contents);
 		});
 	}
 
+	TEST(TEST_CLASS, RepeatedRewritesDoNotGrowFile_MemoryMapped) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			WriteAll(context.database(), 12, { payloads[2], payloads[3], payloads[4] });
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+
+		auto contents = context.readAll(10);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 90, 100, 130, 150 }), payloads[0], payloads[1], payloads[2], payloads[3], payloads[4] }),
+				contents);
+	}
+
 	// endregion
 
 	// region write - gaps
@@ -679,4 +720,304 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region payload view
+
+	TEST(TEST_CLASS, CannotViewPayloadInStreamReadMode) {
+		// Arrange:
+		TestContext context;
+		WriteAll(context.database(), 10, CreatePayloads({ 50 }));
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(10), catapult_invalid_argument);
+	}
+
+	namespace {
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	READ_TEST(CanViewPayloadInFile) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView = context.database().payloadView(10 + Payload_Index);
+
+		// Assert:
+		ASSERT_TRUE(!!payloadView.pFile);
+		EXPECT_EQ(payloads[Payload_Index], ToVector(payloadView.Payload));
+	}
+
+	TEST(TEST_CLASS, CanViewLastPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[2], ToVector(payloadView.Payload));
+	}
+
+	TEST(TEST_CLASS, CannotViewUnwrittenPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+		WriteAll(context.database(), 10, CreatePayloads({ 50, 10, 30 }));
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotViewPayloadInMissingFile) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(10), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanViewPayloadsAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15, 25, 35 });
+		WriteAll(context.database(), 3, payloads);
+
+		// Act + Assert:
+		for (auto i = 0u; i < payloads.size(); ++i)
+			EXPECT_EQ(payloads[i], ToVector(context.database().payloadView(3 + i).Payload)) << i;
+	}
+
+	TEST(TEST_CLASS, CanViewPayloadAppendedAfterPreviousView) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10 });
+		WriteAll(context.database(), 10, { payloads[0] });
+		auto payloadView1 = context.database().payloadView(10);
+
+		// Act:
+		WriteAll(context.database(), 11, { payloads[1] });
+		auto payloadView2 = context.database().payloadView(11);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payloadView1.Payload));
+		EXPECT_EQ(payloads[1], ToVector(payloadView2.Payload));
+	}
+
+	namespace {
+		void AssertPayloadViewIsNotInvalidatedByRewrite(size_t batchSize) {
+			// Arrange:
+			TestContext context(batchSize, FileDatabaseReadMode::Memory_Mapped);
+
+			auto payloads = CreatePayloads({ 50, 10, 30 });
+			WriteAll(context.database(), 10, payloads);
+			auto payloadView = context.database().payloadView(11);
+
+			// Act:
+			auto newPayload = test::GenerateRandomVector(7);
+			WriteAll(context.database(), 11, { newPayload });
+			auto newPayloadView = context.database().payloadView(11);
+
+			// Assert:
+			EXPECT_EQ(payloads[1], ToVector(payloadView.Payload));
+			EXPECT_EQ(newPayload, ToVector(newPayloadView.Payload));
+		}
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsNotInvalidatedByRewrite) {
+		AssertPayloadViewIsNotInvalidatedByRewrite(Batch_Size);
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsNotInvalidatedByRewriteInHeaderlessMode) {
+		AssertPayloadViewIsNotInvalidatedByRewrite(1);
+	}
+
+	TEST(TEST_CLASS, CanViewPrecedingPayloadAfterRewrite) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+		auto payloadView = context.database().payloadView(10);
+
+		// Assert: preceding payload does not include any rewritten data
+		EXPECT_EQ(payloads[0], ToVector(payloadView.Payload));
+	}
+
+	TEST(TEST_CLASS, CanViewInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView1 = context.database().payloadView(10);
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payloadView1.Payload));
+		EXPECT_EQ(payloads[2], ToVector(payloadView2.Payload));
+	}
+
+	TEST(TEST_CLASS, CanReadViaStreamInMemoryMappedMode) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		size_t streamSize = 0;
+		auto pInputStream = context.database().inputStream(11, &streamSize);
+
+		std::vector<uint8_t> readBuffer(streamSize);
+		pInputStream->read(readBuffer);
+
+		// Assert:
+		EXPECT_EQ(payloads[1], readBuffer);
+		EXPECT_TRUE(pInputStream->eof());
+	}
+
+	// endregion
+
+	// region writeAll
+
+	namespace {
+		std::vector<RawBuffer> ToBuffers(const std::vector<std::vector<uint8_t>>& payloads) {
+			std::vector<RawBuffer> buffers;
+			for (const auto& payload : payloads)
+				buffers.push_back(payload);
+
+			return buffers;
+		}
+	}
+
+	TEST(TEST_CLASS, WriteAllWithoutPayloadsDoesNotCreateFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.database().writeAll(13, {});
+
+		// Assert:
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	TEST(TEST_CLASS, CanWriteAllAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		context.database().writeAll(13, ToBuffers(payloads));
+
+		// Assert: files are identical to files written via output streams
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 80, 100, 190 }), payloads[2], payloads[3], payloads[4], payloads[5], payloads[6] }),
+				contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4);
+	}
+
+	TEST(TEST_CLASS, CanWriteAllPayloadsAdjacentInMemory) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		auto aggregatePayload = Concatenate(payloads);
+
+		// Act: all payloads are views into the same buffer
+		context.database().writeAll(10, {
+			{ aggregatePayload.data(), 50 },
+			{ aggregatePayload.data() + 50, 10 },
+			{ aggregatePayload.data() + 60, 30 }
+		});
+
+		// Assert:
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 100, 0, 0 }), payloads[0], payloads[1], payloads[2] }), context.readAll(10));
+
+		for (auto i = 0u; i < payloads.size(); ++i) {
+			size_t streamSize = 0;
+			auto pInputStream = context.database().inputStream(10 + i, &streamSize);
+
+			std::vector<uint8_t> readBuffer(streamSize);
+			pInputStream->read(readBuffer);
+			EXPECT_EQ(payloads[i], readBuffer) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanWriteAllOverExistingPayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 50, 25 });
+		context.database().writeAll(17, ToBuffers(newPayloads));
+
+		// Assert: payloads after the first rewritten payload are removed
+		auto contents3 = context.readAll(15);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 80, 130, 0 }), payloads[2], payloads[3], newPayloads[0], newPayloads[1] }),
+				contents3);
+	}
+
+	TEST(TEST_CLASS, CanWriteAllInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		context.database().writeAll(10, ToBuffers(payloads));
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		EXPECT_EQ(payloads[0], context.readAll(10));
+		EXPECT_EQ(payloads[1], context.readAll(11));
+		EXPECT_EQ(payloads[2], context.readAll(12));
+	}
+
+	TEST(TEST_CLASS, WriteAllDoesNotInvalidatePayloadViews) {
+		// Arrange:
+		TestContext context(Batch_Size, FileDatabaseReadMode::Memory_Mapped);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		context.database().writeAll(10, ToBuffers(payloads));
+		auto payloadView = context.database().payloadView(11);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 7, 9 });
+		context.database().writeAll(11, ToBuffers(newPayloads));
+
+		// Assert:
+		EXPECT_EQ(payloads[1], ToVector(payloadView.Payload));
+		EXPECT_EQ(newPayloads[0], ToVector(context.database().payloadView(11).Payload));
+		EXPECT_EQ(newPayloads[1], ToVector(context.database().payloadView(12).Payload));
+	}
+
+	// endregion
 }}
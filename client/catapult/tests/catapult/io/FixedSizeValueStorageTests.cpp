@@ -261,4 +261,75 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region saving multiple
+
+	namespace {
+		std::vector<ValueType> ToValues(uint64_t startSeed, size_t count) {
+			std::vector<ValueType> values;
+			for (auto i = 0u; i < count; ++i)
+				values.push_back(ToValue(startSeed + i));
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveNoValues) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveAll(Height(2), {});
+
+		// Assert:
+		ASSERT_EQ(2 * ValueType::Size, fs::file_size(context.filename("00000")));
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveMultipleValues) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveAll(Height(2), ToValues(12, 3));
+
+		auto values = context.hashFile().loadRangeFrom(Height(2), 3);
+
+		// Assert:
+		ASSERT_EQ(5 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, { 12, 13, 14 });
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveMultipleValuesSpanningMultipleFiles) {
+		// Arrange:
+		TestContext context;
+		context.seed(Files_Per_Storage_Directory - 5);
+
+		// Act:
+		context.hashFile().saveAll(Height(Files_Per_Storage_Directory - 5), ToValues(Files_Per_Storage_Directory - 5, 15));
+
+		auto values = context.hashFile().loadRangeFrom(Height(Files_Per_Storage_Directory - 10), 20);
+
+		// Assert:
+		ASSERT_EQ(Files_Per_Storage_Directory * ValueType::Size, fs::file_size(context.filename("00000")));
+		ASSERT_EQ(10 * ValueType::Size, fs::file_size(context.filename("00001")));
+		AssertValues(values, Files_Per_Storage_Directory - 10, 20);
+	}
+
+	TEST(TEST_CLASS, StorageCanOverwriteExistingKeysWithMultipleValues) {
+		// Arrange:
+		TestContext context;
+		context.seed(5);
+
+		// Act:
+		context.hashFile().saveAll(Height(2), ToValues(12, 2));
+
+		auto values = context.hashFile().loadRangeFrom(Height(1), 4);
+
+		// Assert: values at heights 1 and 4 come from seed, values at heights 2 and 3 are different (were overwritten)
+		AssertValues(values, { 1, 12, 13, 4 });
+	}
+
+	// endregion
 }}
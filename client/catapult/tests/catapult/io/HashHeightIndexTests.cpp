@@ -0,0 +1,531 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/HashHeightIndex.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+using catapult::test::TempFileGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS HashHeightIndexTests
+
+	namespace {
+		constexpr auto Index_Filename = "hashes.index";
+		constexpr size_t Min_Capacity = 1024;
+
+		bool AcceptAll(Height) {
+			return true;
+		}
+
+		Hash256 GenerateHashWithFingerprint(uint64_t fingerprint) {
+			auto hash = test::GenerateRandomByteArray<Hash256>();
+			std::memcpy(hash.data(), &fingerprint, sizeof(uint64_t));
+			return hash;
+		}
+
+		std::vector<Hash256> GenerateHashesWithSamePreferredSlot(size_t count) {
+			// all fingerprints map to the same slot when there are fewer than 2^16 slots
+			std::vector<Hash256> hashes;
+			for (auto i = 0u; i < count; ++i)
+				hashes.push_back(GenerateHashWithFingerprint(0x1234 + (static_cast<uint64_t>(i + 1) << 16)));
+
+			return hashes;
+		}
+
+		void AssertCanFind(const HashHeightIndex& index, Height startHeight, const std::vector<Hash256>& hashes) {
+			auto height = startHeight;
+			for (const auto& hash : hashes) {
+				EXPECT_EQ(height, index.find(hash, AcceptAll)) << "at " << height;
+				height = height + Height(1);
+			}
+		}
+
+		void AssertCannotFind(const HashHeightIndex& index, const std::vector<Hash256>& hashes) {
+			for (const auto& hash : hashes)
+				EXPECT_EQ(Height(0), index.find(hash, AcceptAll)) << hash;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyIndex) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+
+		// Act:
+		HashHeightIndex index(guard.name());
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(0u, index.capacity());
+		EXPECT_EQ(Height(0), index.height());
+		EXPECT_EQ(Height(0), index.find(test::GenerateRandomByteArray<Hash256>(), AcceptAll));
+		EXPECT_FALSE(std::filesystem::exists(guard.name()));
+	}
+
+	TEST(TEST_CLASS, CanOpenPersistedIndex) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		{
+			HashHeightIndex index(guard.name());
+			index.append(Height(1), hashes);
+		}
+
+		// Act:
+		HashHeightIndex index(guard.name());
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		EXPECT_EQ(Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(10), index.height());
+		AssertCanFind(index, Height(1), hashes);
+	}
+
+	namespace {
+		void AssertInvalidIndexIsDiscarded(const consumer<RawFile&>& corrupt) {
+			// Arrange:
+			TempFileGuard guard(Index_Filename);
+			{
+				HashHeightIndex index(guard.name());
+				index.append(Height(1), test::GenerateRandomDataVector<Hash256>(10));
+			}
+
+			{
+				RawFile file(guard.name(), OpenMode::Read_Append);
+				corrupt(file);
+			}
+
+			// Act:
+			HashHeightIndex index(guard.name());
+
+			// Assert:
+			EXPECT_EQ(0u, index.size());
+			EXPECT_EQ(0u, index.capacity());
+			EXPECT_EQ(Height(0), index.height());
+			EXPECT_FALSE(std::filesystem::exists(guard.name()));
+		}
+	}
+
+	TEST(TEST_CLASS, TruncatedIndexIsDiscarded) {
+		AssertInvalidIndexIsDiscarded([](auto& file) {
+			file.seek(file.size() - 1);
+			file.truncate();
+		});
+	}
+
+	TEST(TEST_CLASS, IndexWithTruncatedHeaderIsDiscarded) {
+		AssertInvalidIndexIsDiscarded([](auto& file) {
+			file.seek(10);
+			file.truncate();
+		});
+	}
+
+	TEST(TEST_CLASS, DirtyIndexIsDiscarded) {
+		AssertInvalidIndexIsDiscarded([](auto& file) {
+			// dirty flag is the last header field
+			file.seek(3 * sizeof(uint64_t));
+			file.write(std::vector<uint8_t>{ 1 });
+		});
+	}
+
+	// endregion
+
+	// region append
+
+	TEST(TEST_CLASS, CanAppendHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+
+		// Act:
+		index.append(Height(1), hashes);
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		EXPECT_EQ(Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(10), index.height());
+		AssertCanFind(index, Height(1), hashes);
+		AssertCannotFind(index, test::GenerateRandomDataVector<Hash256>(10));
+	}
+
+	TEST(TEST_CLASS, CanAppendHashesMultipleTimes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(10);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(5);
+
+		// Act:
+		index.append(Height(1), hashes1);
+		index.append(Height(11), hashes2);
+
+		// Assert:
+		EXPECT_EQ(15u, index.size());
+		EXPECT_EQ(Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(15), index.height());
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(11), hashes2);
+	}
+
+	TEST(TEST_CLASS, AppendingZeroHashesDoesNotChangeIndex) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		index.append(Height(1), test::GenerateRandomDataVector<Hash256>(10));
+
+		// Act:
+		index.append(Height(11), {});
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		EXPECT_EQ(Height(10), index.height());
+	}
+
+	TEST(TEST_CLASS, CannotAppendHashesWithHeightGap) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		index.append(Height(1), test::GenerateRandomDataVector<Hash256>(10));
+
+		// Act + Assert:
+		EXPECT_THROW(index.append(Height(10), test::GenerateRandomDataVector<Hash256>(1)), catapult_invalid_argument);
+		EXPECT_THROW(index.append(Height(12), test::GenerateRandomDataVector<Hash256>(1)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, AppendGrowsIndexWhenHalfFull) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(Min_Capacity / 2);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(1);
+		index.append(Height(1), hashes1);
+
+		// Sanity:
+		EXPECT_EQ(Min_Capacity, index.capacity());
+
+		// Act:
+		index.append(Height(Min_Capacity / 2 + 1), hashes2);
+
+		// Assert:
+		EXPECT_EQ(Min_Capacity / 2 + 1, index.size());
+		EXPECT_EQ(2 * Min_Capacity, index.capacity());
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(Min_Capacity / 2 + 1), hashes2);
+	}
+
+	TEST(TEST_CLASS, CanAppendHashesWithSamePreferredSlot) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = GenerateHashesWithSamePreferredSlot(10);
+
+		// Act:
+		index.append(Height(1), { hashes.cbegin(), hashes.cbegin() + 5 });
+		index.append(Height(6), { hashes.cbegin() + 5, hashes.cend() });
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		AssertCanFind(index, Height(1), hashes);
+	}
+
+	// endregion
+
+	// region flush
+
+	namespace {
+		Height GetPersistedHeight(const std::string& filePath) {
+			return HashHeightIndex(filePath).height();
+		}
+	}
+
+	TEST(TEST_CLASS, AppendedHashesArePendingUntilFlush) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(10);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(5);
+		index.append(Height(1), hashes1);
+
+		// Act:
+		index.append(Height(11), hashes2);
+
+		// Assert: pending hashes can be found but are not yet written
+		EXPECT_EQ(15u, index.size());
+		EXPECT_EQ(Height(15), index.height());
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(11), hashes2);
+
+		EXPECT_EQ(Height(10), GetPersistedHeight(guard.name()));
+	}
+
+	TEST(TEST_CLASS, FlushWritesPendingHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(10);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(5);
+		{
+			HashHeightIndex index(guard.name());
+			index.append(Height(1), hashes1);
+			index.append(Height(11), hashes2);
+
+			// Act:
+			index.flush();
+		}
+
+		// Assert:
+		HashHeightIndex index(guard.name());
+		EXPECT_EQ(15u, index.size());
+		EXPECT_EQ(Height(15), index.height());
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(11), hashes2);
+	}
+
+	TEST(TEST_CLASS, AppendFlushesWhenMaxPendingHashesAreReached) {
+		// Arrange: create index with enough capacity to hold all pending hashes without growing
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		index.append(Height(1), test::GenerateRandomDataVector<Hash256>(2100));
+		index.append(Height(2101), test::GenerateRandomDataVector<Hash256>(999));
+
+		// Sanity:
+		EXPECT_EQ(8 * Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(2100), GetPersistedHeight(guard.name()));
+
+		// Act:
+		index.append(Height(3100), test::GenerateRandomDataVector<Hash256>(1));
+
+		// Assert:
+		EXPECT_EQ(8 * Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(3100), GetPersistedHeight(guard.name()));
+	}
+
+	TEST(TEST_CLASS, GrowWritesPendingHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(10);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(Min_Capacity / 2 - 10);
+		auto hashes3 = test::GenerateRandomDataVector<Hash256>(1);
+		index.append(Height(1), hashes1);
+		index.append(Height(11), hashes2);
+
+		// Act:
+		index.append(Height(Min_Capacity / 2 + 1), hashes3);
+
+		// Assert:
+		EXPECT_EQ(2 * Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(Min_Capacity / 2 + 1), GetPersistedHeight(guard.name()));
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(11), hashes2);
+		AssertCanFind(index, Height(Min_Capacity / 2 + 1), hashes3);
+	}
+
+	// endregion
+
+	// region find
+
+	TEST(TEST_CLASS, FindChecksAllCandidatesWithMatchingFingerprint) {
+		// Arrange: hashes only differ after the fingerprint
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < 3; ++i)
+			hashes.push_back(GenerateHashWithFingerprint(123));
+
+		index.append(Height(1), hashes);
+
+		// Act:
+		std::vector<Height> candidateHeights;
+		auto height = index.find(hashes[1], [&candidateHeights](auto candidateHeight) {
+			candidateHeights.push_back(candidateHeight);
+			return Height(2) == candidateHeight;
+		});
+
+		// Assert:
+		EXPECT_EQ(Height(2), height);
+		EXPECT_EQ(std::vector<Height>({ Height(1), Height(2) }), candidateHeights);
+	}
+
+	TEST(TEST_CLASS, FindReturnsZeroWhenNoCandidateMatches) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		index.append(Height(1), hashes);
+
+		// Act:
+		auto numCandidates = 0u;
+		auto height = index.find(hashes[4], [&numCandidates](auto) {
+			++numCandidates;
+			return false;
+		});
+
+		// Assert:
+		EXPECT_EQ(Height(0), height);
+		EXPECT_EQ(1u, numCandidates);
+	}
+
+	// endregion
+
+	// region dropAfter
+
+	TEST(TEST_CLASS, CanDropHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		index.append(Height(1), hashes);
+
+		// Act:
+		index.dropAfter(Height(6), { hashes.cbegin() + 6, hashes.cend() });
+
+		// Assert:
+		EXPECT_EQ(6u, index.size());
+		EXPECT_EQ(Min_Capacity, index.capacity());
+		EXPECT_EQ(Height(6), index.height());
+		AssertCanFind(index, Height(1), { hashes.cbegin(), hashes.cbegin() + 6 });
+		AssertCannotFind(index, { hashes.cbegin() + 6, hashes.cend() });
+	}
+
+	TEST(TEST_CLASS, CanDropPendingHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(10);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(5);
+		index.append(Height(1), hashes1);
+		index.append(Height(11), hashes2);
+
+		// Act:
+		index.dropAfter(Height(12), { hashes2.cbegin() + 2, hashes2.cend() });
+
+		// Assert:
+		EXPECT_EQ(12u, index.size());
+		EXPECT_EQ(Height(12), index.height());
+		EXPECT_EQ(Height(12), GetPersistedHeight(guard.name()));
+		AssertCanFind(index, Height(1), hashes1);
+		AssertCanFind(index, Height(11), { hashes2.cbegin(), hashes2.cbegin() + 2 });
+		AssertCannotFind(index, { hashes2.cbegin() + 2, hashes2.cend() });
+	}
+
+	TEST(TEST_CLASS, CanDropHashesWithSamePreferredSlot) {
+		// Arrange: interleave hashes with same preferred slot with other hashes
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto clusteredHashes = GenerateHashesWithSamePreferredSlot(10);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(20);
+		for (auto i = 0u; i < clusteredHashes.size(); ++i)
+			hashes[2 * i] = clusteredHashes[i];
+
+		index.append(Height(1), hashes);
+
+		// Act:
+		index.dropAfter(Height(9), { hashes.cbegin() + 9, hashes.cend() });
+
+		// Assert:
+		EXPECT_EQ(9u, index.size());
+		EXPECT_EQ(Height(9), index.height());
+		AssertCanFind(index, Height(1), { hashes.cbegin(), hashes.cbegin() + 9 });
+		AssertCannotFind(index, { hashes.cbegin() + 9, hashes.cend() });
+	}
+
+	TEST(TEST_CLASS, CanAppendHashesAfterDrop) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		auto newHashes = test::GenerateRandomDataVector<Hash256>(3);
+		index.append(Height(1), hashes);
+		index.dropAfter(Height(6), { hashes.cbegin() + 6, hashes.cend() });
+
+		// Act:
+		index.append(Height(7), newHashes);
+
+		// Assert:
+		EXPECT_EQ(9u, index.size());
+		EXPECT_EQ(Height(9), index.height());
+		AssertCanFind(index, Height(1), { hashes.cbegin(), hashes.cbegin() + 6 });
+		AssertCanFind(index, Height(7), newHashes);
+		AssertCannotFind(index, { hashes.cbegin() + 6, hashes.cend() });
+	}
+
+	TEST(TEST_CLASS, DropAfterIgnoresUnknownHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		index.append(Height(1), hashes);
+
+		// Act:
+		index.dropAfter(Height(8), test::GenerateRandomDataVector<Hash256>(2));
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		EXPECT_EQ(Height(8), index.height());
+	}
+
+	TEST(TEST_CLASS, CanDropAfterHeightInEmptyIndex) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+
+		// Act:
+		index.dropAfter(Height(7), {});
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(0u, index.capacity());
+		EXPECT_EQ(Height(7), index.height());
+
+		// - height is persisted
+		EXPECT_EQ(Height(7), HashHeightIndex(guard.name()).height());
+	}
+
+	// endregion
+
+	// region reset
+
+	TEST(TEST_CLASS, ResetRemovesAllHashes) {
+		// Arrange:
+		TempFileGuard guard(Index_Filename);
+		HashHeightIndex index(guard.name());
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		index.append(Height(1), hashes);
+
+		// Act:
+		index.reset();
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(0u, index.capacity());
+		EXPECT_EQ(Height(0), index.height());
+		AssertCannotFind(index, hashes);
+		EXPECT_FALSE(std::filesystem::exists(guard.name()));
+	}
+
+	// endregion
+}}
@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+using catapult::test::TempFileGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		void WriteToFile(const TempFileGuard& guard, const std::vector<uint8_t>& data) {
+			RawFile file(guard.name(), OpenMode::Read_Write);
+			file.write(data);
+		}
+
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotMapNonexistentFile) {
+		// Arrange:
+		TempFileGuard guard("abcdefghijklmnopqrstuvwxyz");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteToFile(guard, {});
+
+		// Act:
+		MemoryMappedFile file(guard.name());
+
+		// Assert:
+		EXPECT_EQ(0u, file.size());
+		EXPECT_FALSE(!!file.data());
+		EXPECT_EQ(0u, file.buffer().Size);
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(1234);
+		WriteToFile(guard, data);
+
+		// Act:
+		MemoryMappedFile file(guard.name());
+
+		// Assert:
+		EXPECT_EQ(1234u, file.size());
+		EXPECT_EQ(file.data(), file.buffer().pData);
+		EXPECT_EQ(data, ToVector(file.buffer()));
+	}
+
+	TEST(TEST_CLASS, MappingIsUnaffectedByAppends) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(100);
+		WriteToFile(guard, data);
+
+		MemoryMappedFile file(guard.name());
+
+		// Act:
+		{
+			RawFile rawFile(guard.name(), OpenMode::Read_Append);
+			rawFile.seek(rawFile.size());
+			rawFile.write(test::GenerateRandomVector(50));
+		}
+
+		// Assert:
+		EXPECT_EQ(100u, file.size());
+		EXPECT_EQ(data, ToVector(file.buffer()));
+	}
+}}
@@ -175,6 +175,25 @@ namespace catapult { namespace io {
 		EXPECT_EQ(Height(0), source.chainHeight());
 	}
 
+	TRAITS_BASED_TEST(CanMoveBlockFilesSpanningMultipleGroupCommits) {
+		// Arrange: destination 4 blocks, source 40 blocks (more than fit into a single group commit)
+		auto destination = mocks::MockMemoryBlockStorage();
+		auto source = mocks::MockMemoryBlockStorage();
+		auto destinationBlocks = CreateBlockElements<TTraits>(2, 5);
+		auto sourceBlocks = CreateBlockElements<TTraits>(3, 42);
+
+		PopulateBlockStorage(destination, destinationBlocks);
+		PopulateBlockStorage(source, sourceBlocks);
+
+		// Act:
+		MoveBlockFiles(source, destination, Height(3));
+
+		// Assert: blocks are present in destination, source storage is empty
+		AssertStorage(sourceBlocks, destination);
+		EXPECT_EQ(Height(42), destination.chainHeight());
+		EXPECT_EQ(Height(0), source.chainHeight());
+	}
+
 	TRAITS_BASED_TEST(MoveBlockFilesThrowsWhenStartHeightIsLessThanOne) {
 		// Arrange: destination 0 blocks, source 4 blocks
 		auto destination = mocks::MockMemoryBlockStorage();
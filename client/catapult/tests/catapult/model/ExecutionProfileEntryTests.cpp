@@ -0,0 +1,115 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/ExecutionProfileEntry.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/test/core/VariableSizedEntityTestUtils.h"
+#include "tests/test/nodeps/Alignment.h"
+#include "tests/test/nodeps/NumericTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS ExecutionProfileEntryTests
+
+	// region size + alignment
+
+#define EXECUTION_PROFILE_ENTRY_FIELDS FIELD(NameSize) FIELD(NumCalls) FIELD(TotalElapsedNanoseconds) FIELD(MaxElapsedNanoseconds)
+
+	TEST(TEST_CLASS, EntryHasExpectedSize) {
+		// Arrange:
+		auto expectedSize = sizeof(TrailingVariableDataLayout<ExecutionProfileEntry, char>) + 2;
+
+#define FIELD(X) expectedSize += SizeOf32<decltype(ExecutionProfileEntry::X)>();
+		EXECUTION_PROFILE_ENTRY_FIELDS
+#undef FIELD
+
+		// Assert:
+		EXPECT_EQ(expectedSize, sizeof(ExecutionProfileEntry));
+		EXPECT_EQ(4u + 2 + 2 + 24, sizeof(ExecutionProfileEntry));
+	}
+
+	TEST(TEST_CLASS, EntryHasProperAlignment) {
+#define FIELD(X) EXPECT_ALIGNED(ExecutionProfileEntry, X);
+		EXECUTION_PROFILE_ENTRY_FIELDS
+#undef FIELD
+
+		EXPECT_EQ(0u, sizeof(ExecutionProfileEntry) % 8);
+	}
+
+#undef EXECUTION_PROFILE_ENTRY_FIELDS
+
+	// endregion
+
+	// region CalculateRealSize
+
+	TEST(TEST_CLASS, CanCalculateRealSizeWithReasonableValues) {
+		// Arrange:
+		ExecutionProfileEntry entry;
+		entry.Size = 0;
+		entry.NameSize = 100;
+
+		// Act:
+		auto realSize = ExecutionProfileEntry::CalculateRealSize(entry);
+
+		// Assert:
+		EXPECT_EQ(sizeof(ExecutionProfileEntry) + 100, realSize);
+	}
+
+	TEST(TEST_CLASS, CalculateRealSizeDoesNotOverflowWithMaxValues) {
+		// Arrange:
+		ExecutionProfileEntry entry;
+		entry.Size = 0;
+		test::SetMaxValue(entry.NameSize);
+
+		// Act:
+		auto realSize = ExecutionProfileEntry::CalculateRealSize(entry);
+
+		// Assert:
+		EXPECT_EQ(sizeof(ExecutionProfileEntry) + entry.NameSize, realSize);
+		EXPECT_GE(std::numeric_limits<uint32_t>::max(), realSize);
+	}
+
+	// endregion
+
+	// region data pointers
+
+	namespace {
+		struct ExecutionProfileEntryTraits {
+			static auto GenerateEntityWithAttachments(uint16_t count) {
+				uint32_t entitySize = SizeOf32<ExecutionProfileEntry>() + count;
+				auto pEntry = utils::MakeUniqueWithSize<ExecutionProfileEntry>(entitySize);
+				pEntry->Size = entitySize;
+				pEntry->NameSize = count;
+				return pEntry;
+			}
+
+			template<typename TEntity>
+			static auto GetAttachmentPointer(TEntity& entity) {
+				return entity.NamePtr();
+			}
+		};
+	}
+
+	DEFINE_ATTACHMENT_POINTER_TESTS(TEST_CLASS, ExecutionProfileEntryTraits) // NamePtr
+
+	// endregion
+}}
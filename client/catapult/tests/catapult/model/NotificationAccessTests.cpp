@@ -0,0 +1,298 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationAccess.h"
+#include "catapult/model/Address.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/ResolverTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationAccessTests
+
+	namespace {
+		constexpr auto Network_Identifier = NetworkIdentifier::Testnet;
+
+		using Addresses = std::vector<Address>;
+		using MosaicIds = std::vector<MosaicId>;
+		using Hashes = std::vector<Hash256>;
+
+		NotificationAccess Extract(const Notification& notification) {
+			NotificationAccessExtractor extractor(Network_Identifier);
+			return extractor.extract(notification, test::CreateResolverContextXor());
+		}
+
+		void AssertKeys(
+				const NotificationAccessKeys& keys,
+				const Addresses& expectedAddresses,
+				const MosaicIds& expectedMosaicIds,
+				const Hashes& expectedHashes) {
+			EXPECT_EQ(expectedAddresses, keys.Addresses);
+			EXPECT_EQ(expectedMosaicIds, keys.MosaicIds);
+			EXPECT_EQ(expectedHashes, keys.Hashes);
+		}
+
+		void AssertEmpty(const NotificationAccessKeys& keys) {
+			AssertKeys(keys, {}, {}, {});
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateExtractor) {
+		// Act:
+		NotificationAccessExtractor extractor(Network_Identifier);
+
+		// Assert:
+		EXPECT_EQ(Network_Identifier, extractor.networkIdentifier());
+	}
+
+	// endregion
+
+	// region core notifications
+
+	TEST(TEST_CLASS, AccountAddressNotificationReadsAndWritesResolvedAddress) {
+		// Arrange:
+		auto address = test::GenerateRandomAddress();
+
+		// Act:
+		auto access = Extract(AccountAddressNotification(test::UnresolveXor(address)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { address }, {}, {});
+		AssertKeys(access.Writes, { address }, {}, {});
+	}
+
+	TEST(TEST_CLASS, AccountPublicKeyNotificationReadsAndWritesPublicKeyAddress) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		auto address = PublicKeyToAddress(publicKey, Network_Identifier);
+
+		// Act:
+		auto access = Extract(AccountPublicKeyNotification(publicKey));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { address }, {}, {});
+		AssertKeys(access.Writes, { address }, {}, {});
+	}
+
+	TEST(TEST_CLASS, BalanceTransferNotificationReadsAndWritesResolvedAccounts) {
+		// Arrange:
+		auto sender = test::GenerateRandomAddress();
+		auto recipient = test::GenerateRandomAddress();
+		auto mosaicId = MosaicId(123);
+
+		// Act:
+		auto access = Extract(BalanceTransferNotification(
+				test::UnresolveXor(sender),
+				test::UnresolveXor(recipient),
+				test::UnresolveXor(mosaicId),
+				Amount(100)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { sender, recipient }, { mosaicId }, {});
+		AssertKeys(access.Writes, { sender, recipient }, {}, {});
+	}
+
+	TEST(TEST_CLASS, BalanceDebitNotificationReadsAndWritesResolvedSender) {
+		// Arrange:
+		auto sender = test::GenerateRandomAddress();
+		auto mosaicId = MosaicId(123);
+
+		// Act:
+		auto access = Extract(BalanceDebitNotification(test::UnresolveXor(sender), test::UnresolveXor(mosaicId), Amount(100)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { sender }, { mosaicId }, {});
+		AssertKeys(access.Writes, { sender }, {}, {});
+	}
+
+	TEST(TEST_CLASS, TransactionNotificationReadsSenderAndReadsAndWritesHash) {
+		// Arrange:
+		auto sender = test::GenerateRandomAddress();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto access = Extract(TransactionNotification(sender, hash, static_cast<EntityType>(0x4154), Timestamp(100)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { sender }, {}, { hash });
+		AssertKeys(access.Writes, {}, {}, { hash });
+	}
+
+	TEST(TEST_CLASS, TransactionFeeNotificationReadsAndWritesSender) {
+		// Arrange:
+		auto sender = test::GenerateRandomAddress();
+
+		// Act:
+		auto access = Extract(TransactionFeeNotification(sender, 100, Amount(10), Amount(20)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { sender }, {}, {});
+		AssertKeys(access.Writes, { sender }, {}, {});
+	}
+
+	TEST(TEST_CLASS, SignatureNotificationReadsSignerAddress) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto signature = test::GenerateRandomByteArray<Signature>();
+
+		// Act:
+		auto access = Extract(SignatureNotification(signerPublicKey, signature, {}));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { PublicKeyToAddress(signerPublicKey, Network_Identifier) }, {}, {});
+		AssertEmpty(access.Writes);
+	}
+
+	TEST(TEST_CLASS, AddressInteractionNotificationReadsSourceAndResolvedParticipants) {
+		// Arrange:
+		auto source = test::GenerateRandomAddress();
+		auto participant = test::GenerateRandomAddress();
+
+		// Act:
+		auto access = Extract(AddressInteractionNotification(source, static_cast<EntityType>(0x4154), { test::UnresolveXor(participant) }));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { source, participant }, {}, {});
+		AssertEmpty(access.Writes);
+	}
+
+	TEST(TEST_CLASS, MosaicRequiredNotificationReadsResolvedOwnerAndMosaic) {
+		// Arrange:
+		auto owner = test::GenerateRandomAddress();
+		auto mosaicId = MosaicId(123);
+
+		// Act:
+		auto access = Extract(MosaicRequiredNotification(test::UnresolveXor(owner), test::UnresolveXor(mosaicId)));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { owner }, { mosaicId }, {});
+		AssertEmpty(access.Writes);
+	}
+
+	TEST(TEST_CLASS, StatelessCoreNotificationsDoNotAccessState) {
+		// Act:
+		auto access = Extract(InternalPaddingNotification(0));
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertEmpty(access.Reads);
+		AssertEmpty(access.Writes);
+	}
+
+	TEST(TEST_CLASS, BlockNotificationsHaveUnknownAccess) {
+		// Act:
+		auto access = Extract(BlockTypeNotification(Entity_Type_Block_Normal, Height(10)));
+
+		// Assert:
+		EXPECT_TRUE(access.IsUnknown);
+		AssertEmpty(access.Reads);
+		AssertEmpty(access.Writes);
+	}
+
+	// endregion
+
+	// region custom handlers
+
+	namespace {
+		constexpr auto Custom_Notification_Type = MakeNotificationType(NotificationChannel::All, FacilityCode::Transfer, 0x1234);
+	}
+
+	TEST(TEST_CLASS, UnregisteredNotificationHasUnknownAccess) {
+		// Act:
+		auto access = Extract(Notification(Custom_Notification_Type, sizeof(Notification)));
+
+		// Assert:
+		EXPECT_TRUE(access.IsUnknown);
+	}
+
+	TEST(TEST_CLASS, CanAddHandlersForCustomNotification) {
+		// Arrange:
+		auto address1 = test::GenerateRandomAddress();
+		auto address2 = test::GenerateRandomAddress();
+		NotificationAccessExtractor extractor(Network_Identifier);
+		extractor.add(Custom_Notification_Type, [&address1](const auto&, const auto&, auto& access) {
+			access.Reads.Addresses.push_back(address1);
+		});
+		extractor.add(Custom_Notification_Type, [&address2](const auto&, const auto&, auto& access) {
+			access.Writes.Addresses.push_back(address2);
+		});
+
+		// Act: notification channel is ignored
+		auto notificationType = Custom_Notification_Type;
+		SetNotificationChannel(notificationType, NotificationChannel::Validator);
+		auto access = extractor.extract(Notification(notificationType, sizeof(Notification)), ResolverContext());
+
+		// Assert:
+		EXPECT_FALSE(access.IsUnknown);
+		AssertKeys(access.Reads, { address1 }, {}, {});
+		AssertKeys(access.Writes, { address2 }, {}, {});
+	}
+
+	TEST(TEST_CLASS, CanAddHandlerForCoreNotification) {
+		// Arrange:
+		auto address = test::GenerateRandomAddress();
+		NotificationAccessExtractor extractor(Network_Identifier);
+		extractor.add<AccountAddressNotification>([](const auto&, const auto&, auto& access) {
+			access.IsUnknown = true;
+		});
+
+		// Act:
+		auto access = extractor.extract(AccountAddressNotification(test::UnresolveXor(address)), test::CreateResolverContextXor());
+
+		// Assert: both handlers were called
+		EXPECT_TRUE(access.IsUnknown);
+		AssertKeys(access.Reads, { address }, {}, {});
+		AssertKeys(access.Writes, { address }, {}, {});
+	}
+
+	TEST(TEST_CLASS, NotificationWithThrowingHandlerHasUnknownAccess) {
+		// Arrange:
+		NotificationAccessExtractor extractor(Network_Identifier);
+		extractor.add(Custom_Notification_Type, [](const auto&, const auto&, auto& access) {
+			access.Reads.Addresses.push_back(test::GenerateRandomAddress());
+		});
+		extractor.add(Custom_Notification_Type, [](const auto&, const auto&, const auto&) {
+			CATAPULT_THROW_RUNTIME_ERROR("cannot resolve");
+		});
+
+		// Act:
+		auto access = extractor.extract(Notification(Custom_Notification_Type, sizeof(Notification)), ResolverContext());
+
+		// Assert: partial keys are discarded
+		EXPECT_TRUE(access.IsUnknown);
+		AssertEmpty(access.Reads);
+		AssertEmpty(access.Writes);
+	}
+
+	// endregion
+}}
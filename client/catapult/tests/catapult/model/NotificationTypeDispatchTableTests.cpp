@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationTypeDispatchTable.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationTypeDispatchTableTests
+
+	namespace {
+		using Values = std::vector<std::string>;
+
+		constexpr auto Notification_Type_Alpha = MakeNotificationType(NotificationChannel::All, FacilityCode::Core, 0x1234);
+		constexpr auto Notification_Type_Beta = MakeNotificationType(NotificationChannel::Validator, FacilityCode::Core, 0x1235);
+		constexpr auto Notification_Type_Gamma = MakeNotificationType(NotificationChannel::All, FacilityCode::Transfer, 0x1234);
+	}
+
+	TEST(TEST_CLASS, EmptyTableDoesNotMatchAnyType) {
+		// Arrange:
+		NotificationTypeDispatchTable<std::string> table;
+
+		// Act + Assert:
+		EXPECT_EQ(Values(), table.find(Notification_Type_Alpha));
+		EXPECT_EQ(Values(), table.find(Notification_Type_Gamma));
+	}
+
+	TEST(TEST_CLASS, UniversalValuesMatchAllTypes) {
+		// Arrange:
+		NotificationTypeDispatchTable<std::string> table;
+		table.add("a");
+		table.add("b");
+
+		// Act + Assert:
+		EXPECT_EQ(Values({ "a", "b" }), table.find(Notification_Type_Alpha));
+		EXPECT_EQ(Values({ "a", "b" }), table.find(Notification_Type_Beta));
+		EXPECT_EQ(Values({ "a", "b" }), table.find(Notification_Type_Gamma));
+	}
+
+	TEST(TEST_CLASS, TypedValuesMatchOnlyRegisteredTypes) {
+		// Arrange:
+		NotificationTypeDispatchTable<std::string> table;
+		table.add(Notification_Type_Alpha, "a");
+		table.add(Notification_Type_Beta, "b");
+		table.add(Notification_Type_Alpha, "c");
+
+		// Act + Assert:
+		EXPECT_EQ(Values({ "a", "c" }), table.find(Notification_Type_Alpha));
+		EXPECT_EQ(Values({ "b" }), table.find(Notification_Type_Beta));
+		EXPECT_EQ(Values(), table.find(Notification_Type_Gamma));
+	}
+
+	TEST(TEST_CLASS, TypedValuesMatchTypesIgnoringChannel) {
+		// Arrange:
+		NotificationTypeDispatchTable<std::string> table;
+		table.add(Notification_Type_Alpha, "a");
+		table.add(MakeNotificationType(NotificationChannel::Observer, FacilityCode::Core, 0x1234), "b");
+
+		// Act + Assert:
+		for (auto channel : { NotificationChannel::None, NotificationChannel::Validator, NotificationChannel::Observer }) {
+			auto type = Notification_Type_Alpha;
+			SetNotificationChannel(type, channel);
+			EXPECT_EQ(Values({ "a", "b" }), table.find(type)) << utils::to_underlying_type(channel);
+		}
+	}
+
+	TEST(TEST_CLASS, UniversalAndTypedValuesArePreservedInRegistrationOrder) {
+		// Arrange:
+		NotificationTypeDispatchTable<std::string> table;
+		table.add("u1");
+		table.add(Notification_Type_Alpha, "a1");
+		table.add("u2");
+		table.add(Notification_Type_Beta, "b1");
+		table.add(Notification_Type_Alpha, "a2");
+		table.add("u3");
+
+		// Act + Assert:
+		EXPECT_EQ(Values({ "u1", "a1", "u2", "a2", "u3" }), table.find(Notification_Type_Alpha));
+		EXPECT_EQ(Values({ "u1", "u2", "b1", "u3" }), table.find(Notification_Type_Beta));
+		EXPECT_EQ(Values({ "u1", "u2", "u3" }), table.find(Notification_Type_Gamma));
+	}
+}}
@@ -107,6 +107,58 @@ namespace catapult { namespace observers {
 		EXPECT_EQ(expectedBreadcrumbs, pContext->Breadcrumbs);
 	}
 
+	namespace {
+		class CountingObserver : public NotificationObserver {
+		public:
+			CountingObserver(NotificationObserverPointerT<model::Notification>&& pObserver, size_t& numNotifyCalls)
+					: m_pObserver(std::move(pObserver))
+					, m_numNotifyCalls(numNotifyCalls)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pObserver->name();
+			}
+
+			void notify(const model::Notification& notification, ObserverContext& context) const override {
+				++m_numNotifyCalls;
+				m_pObserver->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerT<model::Notification> m_pObserver;
+			size_t& m_numNotifyCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, CanDecorateAllAddedObservers) {
+		// Arrange:
+		auto pContext = std::make_unique<TestContext>();
+		size_t numDecorations = 0;
+		size_t numNotifyCalls = 0;
+		DemuxObserverBuilder builder([&numDecorations, &numNotifyCalls](auto&& pObserver) {
+			++numDecorations;
+			return std::make_unique<CountingObserver>(std::move(pObserver), numNotifyCalls);
+		});
+
+		// Act:
+		builder
+			.add(mocks::CreateTaggedBreadcrumbObserver(2, pContext->Breadcrumbs))
+			.add(mocks::CreateTaggedBreadcrumbObserver2(3, pContext->Breadcrumbs))
+			.add(mocks::CreateTaggedBreadcrumbObserver(4, pContext->Breadcrumbs));
+		pContext->pDemuxObserver = builder.build();
+
+		pContext->notify(7, NotifyMode::Commit);
+
+		// Assert: all observers were decorated but only matching observers were notified
+		EXPECT_EQ(3u, numDecorations);
+		EXPECT_EQ(2u, numNotifyCalls);
+
+		std::vector<uint16_t> expectedBreadcrumbs{ 0x0702, 0x0704 };
+		EXPECT_EQ(expectedBreadcrumbs, pContext->Breadcrumbs);
+		EXPECT_EQ(std::vector<std::string>({ "2", "3", "4" }), pContext->pDemuxObserver->names());
+	}
+
 	// endregion
 
 	// region commit + rollback
@@ -245,5 +297,55 @@ namespace catapult { namespace observers {
 		});
 	}
 
+	namespace {
+		void AssertFilteredObserversAreInvokedInRegistrationOrder(
+				const model::Notification& notification,
+				NotifyMode mode,
+				const Breadcrumbs& expectedSelectedNames) {
+			// Arrange: interleave observers matching all types with observers matching specific types
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, Height(123), mode);
+
+			builder
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all1"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all2"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all3"));
+			auto pObserver = builder.build();
+
+			// Act:
+			test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+
+			// Assert:
+			Breadcrumbs expectedNames{ "all1", "alpha", "all2", "OMEGA", "beta", "all3" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredObserversAreInvokedInRegistrationOrder_Commit) {
+		AssertFilteredObserversAreInvokedInRegistrationOrder(
+				model::AccountPublicKeyNotification(Key()),
+				NotifyMode::Commit,
+				{ "all1", "alpha", "all2", "beta", "all3" });
+	}
+
+	TEST(TEST_CLASS, FilteredObserversAreInvokedInReverseRegistrationOrder_Rollback) {
+		AssertFilteredObserversAreInvokedInRegistrationOrder(
+				model::AccountPublicKeyNotification(Key()),
+				NotifyMode::Rollback,
+				{ "all3", "beta", "all2", "alpha", "all1" });
+	}
+
+	TEST(TEST_CLASS, FilteredObserversAreInvokedInRegistrationOrder_NoMatches) {
+		AssertFilteredObserversAreInvokedInRegistrationOrder(test::TaggedNotification(7), NotifyMode::Commit, { "all1", "all2", "all3" });
+	}
+
 	// endregion
 }}
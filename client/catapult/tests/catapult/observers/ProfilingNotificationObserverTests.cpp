@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/observers/ProfilingNotificationObserver.h"
+#include "catapult/cache/CatapultCache.h"
+#include "tests/test/core/TaggedNotification.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/test/plugins/ObserverTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace observers {
+
+#define TEST_CLASS ProfilingNotificationObserverTests
+
+	namespace {
+		auto CreateObserver(const std::string& name, std::vector<uint8_t>& breadcrumbs) {
+			using FunctionalObserver = FunctionalNotificationObserverT<model::Notification>;
+			return std::make_unique<FunctionalObserver>(name, [&breadcrumbs](const auto& notification, const auto& context) {
+				auto tag = static_cast<const test::TaggedNotification&>(notification).Tag;
+				breadcrumbs.push_back(static_cast<uint8_t>(NotifyMode::Commit == context.Mode ? tag : 0x80 | tag));
+			});
+		}
+
+		template<typename TAction>
+		void RunObserverTest(TAction action) {
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			action(cacheDelta);
+		}
+	}
+
+	TEST(TEST_CLASS, DecoratorPreservesObserverName) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingObserverDecorator(profile, "observers::");
+
+		// Act:
+		auto pObserver = decorator(CreateObserver("alpha", breadcrumbs));
+
+		// Assert:
+		EXPECT_EQ("alpha", pObserver->name());
+	}
+
+	TEST(TEST_CLASS, DecoratorCreatesProfileEntryWithPrefixedObserverName) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingObserverDecorator(profile, "observers::");
+
+		// Act:
+		auto pObserver1 = decorator(CreateObserver("alpha", breadcrumbs));
+		auto pObserver2 = decorator(CreateObserver("beta", breadcrumbs));
+		auto pObserver3 = decorator(CreateObserver("alpha", breadcrumbs));
+
+		// Assert: observers with same name share a single entry
+		auto values = profile.values();
+		ASSERT_EQ(2u, values.size());
+		EXPECT_EQ("observers::alpha", values[0].Name);
+		EXPECT_EQ("observers::beta", values[1].Name);
+	}
+
+	TEST(TEST_CLASS, NotifyForwardsToDecoratedObserverAndRecordsCall) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingObserverDecorator(profile, "");
+		auto pObserver = decorator(CreateObserver("alpha", breadcrumbs));
+
+		// Act:
+		RunObserverTest([&pObserver](auto& cacheDelta) {
+			auto commitContext = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+			test::ObserveNotification<model::Notification>(*pObserver, test::TaggedNotification(7), commitContext);
+
+			auto rollbackContext = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Rollback);
+			test::ObserveNotification<model::Notification>(*pObserver, test::TaggedNotification(3), rollbackContext);
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 0x07, 0x83 }), breadcrumbs);
+
+		auto values = profile.values();
+		ASSERT_EQ(1u, values.size());
+		EXPECT_EQ(2u, values[0].NumCalls);
+		EXPECT_LE(values[0].MaxElapsedNanoseconds, values[0].TotalElapsedNanoseconds);
+	}
+
+	TEST(TEST_CLASS, NotifyRecordsElapsedTime) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		auto decorator = CreateProfilingObserverDecorator(profile, "");
+		auto pObserver = decorator(std::make_unique<FunctionalNotificationObserverT<model::Notification>>("alpha", [](
+				const auto&,
+				const auto&) {
+			test::Sleep(5);
+		}));
+
+		// Act:
+		RunObserverTest([&pObserver](auto& cacheDelta) {
+			auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+			test::ObserveNotification<model::Notification>(*pObserver, test::TaggedNotification(7), context);
+		});
+
+		// Assert:
+		auto values = profile.values();
+		ASSERT_EQ(1u, values.size());
+		EXPECT_EQ(1u, values[0].NumCalls);
+		EXPECT_LE(5'000'000u, values[0].TotalElapsedNanoseconds);
+		EXPECT_EQ(values[0].TotalElapsedNanoseconds, values[0].MaxElapsedNanoseconds);
+	}
+}}
@@ -282,6 +282,53 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region execution profiling
+
+	TEST(TEST_CLASS, ExecutionProfilingIsDisabledByDefault) {
+		// Act:
+		auto manager = test::CreatePluginManager();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.executionProfile());
+	}
+
+	TEST(TEST_CLASS, CanEnableExecutionProfiling) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+
+		// Act:
+		manager.enableExecutionProfiling();
+
+		// Assert:
+		ASSERT_TRUE(!!manager.executionProfile());
+		EXPECT_EQ(0u, manager.executionProfile()->size());
+	}
+
+	TEST(TEST_CLASS, EnableExecutionProfilingIsIdempotent) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.enableExecutionProfiling();
+		const auto* pExecutionProfile = manager.executionProfile();
+
+		// Act:
+		manager.enableExecutionProfiling();
+
+		// Assert:
+		EXPECT_EQ(pExecutionProfile, manager.executionProfile());
+	}
+
+	namespace {
+		std::map<std::string, uint64_t> GetNumCallsByName(const PluginManager& manager) {
+			std::map<std::string, uint64_t> numCallsByName;
+			for (const auto& values : manager.executionProfile()->values())
+				numCallsByName.emplace(values.Name, values.NumCalls);
+
+			return numCallsByName;
+		}
+	}
+
+	// endregion
+
 	// region validators - helpers
 
 	namespace {
@@ -374,6 +421,73 @@ namespace catapult { namespace plugins {
 		EXPECT_EQ(validators::ValidationResult::Success, result);
 	}
 
+	TEST(TEST_CLASS, CanCreateStatelessValidatorWithDecorator) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.addStatelessValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatelessValidator("alpha"));
+			builder.add(CreateNamedStatelessValidator("beta"));
+		});
+
+		std::vector<std::string> decoratedNames;
+		auto decorator = [&decoratedNames](auto&& pValidator) {
+			decoratedNames.push_back(pValidator->name());
+			return CreateNamedStatelessValidator(pValidator->name() + " (decorated)");
+		};
+
+		// Act:
+		auto pValidator = manager.createStatelessValidator([](auto) { return false; }, decorator);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "alpha", "beta" }), decoratedNames);
+		EXPECT_EQ(std::vector<std::string>({ "alpha (decorated)", "beta (decorated)" }), pValidator->names());
+	}
+
+	TEST(TEST_CLASS, CanCreateStatelessValidatorWithExecutionProfiling) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.enableExecutionProfiling();
+		manager.addStatelessValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatelessValidator("alpha"));
+			builder.add(CreateNamedStatelessValidator("beta"));
+		});
+
+		// Act: beta is not called because alpha fails
+		auto result = ValidateStateless(manager, false);
+
+		// Assert:
+		EXPECT_EQ(validators::ValidationResult::Failure, result);
+
+		auto expectedNumCallsByName = std::map<std::string, uint64_t>{ { "stateless::alpha", 1 }, { "stateless::beta", 0 } };
+		EXPECT_EQ(expectedNumCallsByName, GetNumCallsByName(manager));
+	}
+
+	TEST(TEST_CLASS, CanCreateStatelessValidatorWithDecoratorAndExecutionProfiling) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.enableExecutionProfiling();
+		manager.addStatelessValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatelessValidator("alpha"));
+		});
+
+		std::vector<std::string> decoratedNames;
+		auto decorator = [&decoratedNames](auto&& pValidator) {
+			decoratedNames.push_back(pValidator->name());
+			return std::move(pValidator);
+		};
+
+		// Act:
+		auto pValidator = manager.createStatelessValidator([](auto) { return false; }, decorator);
+		pValidator->validate(model::AccountPublicKeyNotification(test::GenerateRandomByteArray<Key>()));
+
+		// Assert: profiling decorator is applied before custom decorator
+		EXPECT_EQ(std::vector<std::string>({ "alpha" }), decoratedNames);
+		EXPECT_EQ(std::vector<std::string>({ "alpha" }), pValidator->names());
+
+		auto expectedNumCallsByName = std::map<std::string, uint64_t>{ { "stateless::alpha", 1 } };
+		EXPECT_EQ(expectedNumCallsByName, GetNumCallsByName(manager));
+	}
+
 	// endregion
 
 	// region validators - stateful
@@ -437,6 +551,25 @@ namespace catapult { namespace plugins {
 		EXPECT_EQ(validators::ValidationResult::Success, result);
 	}
 
+	TEST(TEST_CLASS, CanCreateStatefulValidatorWithExecutionProfiling) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.enableExecutionProfiling();
+		manager.addStatefulValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatefulValidator("alpha"));
+			builder.add(CreateNamedStatefulValidator("beta"));
+		});
+
+		// Act: beta is not called because alpha fails
+		auto result = ValidateStateful(manager, false);
+
+		// Assert:
+		EXPECT_EQ(validators::ValidationResult::Failure, result);
+
+		auto expectedNumCallsByName = std::map<std::string, uint64_t>{ { "stateful::alpha", 1 }, { "stateful::beta", 0 } };
+		EXPECT_EQ(expectedNumCallsByName, GetNumCallsByName(manager));
+	}
+
 	// endregion
 
 	// region observers
@@ -511,6 +644,45 @@ namespace catapult { namespace plugins {
 		});
 	}
 
+	TEST(TEST_CLASS, CanRegisterObservers_PermanentOnlyWithExecutionProfiling) {
+		// Arrange:
+		RunObserverTest([](auto& manager) {
+			manager.enableExecutionProfiling();
+
+			// Act:
+			auto pObserver = manager.createPermanentObserver();
+
+			// Assert:
+			auto expectedNames = std::vector<std::string>{ "alpha", "beta", "gamma" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+
+			auto expectedNumCallsByName = std::map<std::string, uint64_t>{
+				{ "observers::alpha", 0 }, { "observers::beta", 0 }, { "observers::gamma", 0 }
+			};
+			EXPECT_EQ(expectedNumCallsByName, GetNumCallsByName(manager));
+		});
+	}
+
+	TEST(TEST_CLASS, CanRegisterObservers_AllWithExecutionProfiling) {
+		// Arrange:
+		RunObserverTest([](auto& manager) {
+			manager.enableExecutionProfiling();
+
+			// Act:
+			auto pObserver = manager.createObserver();
+
+			// Assert:
+			auto expectedNames = std::vector<std::string>{ "alpha", "beta", "gamma", "zeta", "omega" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+
+			auto expectedNumCallsByName = std::map<std::string, uint64_t>{
+				{ "observers::alpha", 0 }, { "observers::beta", 0 }, { "observers::gamma", 0 },
+				{ "observers::zeta", 0 }, { "observers::omega", 0 }
+			};
+			EXPECT_EQ(expectedNumCallsByName, GetNumCallsByName(manager));
+		});
+	}
+
 	// endregion
 
 	// region resolvers
@@ -629,6 +801,91 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetchers
+
+	namespace {
+		class MockSubCachePrefetcher : public cache::SubCachePrefetcher {
+		public:
+			void notify(const model::Notification&) override
+			{}
+
+			void prefetch(const cache::CatapultCacheDelta&) const override
+			{}
+		};
+	}
+
+	TEST(TEST_CLASS, CanCreateStatePrefetcherWithoutSubCachePrefetchers) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+
+		// Act:
+		auto pPrefetcher = manager.createStatePrefetcher();
+
+		// Assert:
+		EXPECT_EQ(0u, pPrefetcher->size());
+	}
+
+	TEST(TEST_CLASS, CanCreateStatePrefetcherWithSubCachePrefetchers) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		for (auto i = 0u; i < 3; ++i)
+			manager.addSubCachePrefetcherFactory([]() { return std::make_unique<MockSubCachePrefetcher>(); });
+
+		// Act:
+		auto pPrefetcher = manager.createStatePrefetcher();
+
+		// Assert:
+		EXPECT_EQ(3u, pPrefetcher->size());
+	}
+
+	// endregion
+
+	// region notification access
+
+	namespace {
+		constexpr auto Custom_Notification_Type = model::MakeNotificationType(
+				model::NotificationChannel::All,
+				model::FacilityCode::Transfer,
+				0x1234);
+	}
+
+	TEST(TEST_CLASS, CanCreateNotificationAccessExtractorWithoutHooks) {
+		// Arrange:
+		auto config = model::BlockchainConfiguration::Uninitialized();
+		config.Network.Identifier = model::NetworkIdentifier::Testnet;
+		auto manager = test::CreatePluginManager(config);
+
+		// Act:
+		auto pExtractor = manager.createNotificationAccessExtractor();
+		auto access = pExtractor->extract(model::Notification(Custom_Notification_Type, sizeof(model::Notification)), {});
+
+		// Assert: only core notifications are registered
+		EXPECT_EQ(model::NetworkIdentifier::Testnet, pExtractor->networkIdentifier());
+		EXPECT_TRUE(access.IsUnknown);
+	}
+
+	TEST(TEST_CLASS, CanCreateNotificationAccessExtractorWithHooks) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		for (auto i = 0u; i < 3; ++i) {
+			manager.addNotificationAccessHook([i](auto& extractor) {
+				extractor.add(Custom_Notification_Type, [i](const auto&, const auto&, auto& access) {
+					access.Reads.MosaicIds.push_back(MosaicId(i + 1));
+				});
+			});
+		}
+
+		// Act:
+		auto pExtractor = manager.createNotificationAccessExtractor();
+		auto access = pExtractor->extract(model::Notification(Custom_Notification_Type, sizeof(model::Notification)), {});
+
+		// Assert: all hooks were applied in order
+		EXPECT_FALSE(access.IsUnknown);
+		EXPECT_EQ(std::vector<MosaicId>({ MosaicId(1), MosaicId(2), MosaicId(3) }), access.Reads.MosaicIds);
+	}
+
+	// endregion
+
 	// region notification publisher
 
 	namespace {
@@ -189,6 +189,280 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region WorkStealingParallelForPartition - CalculateChunkEndIndexes
+
+	namespace {
+		auto ItemValueCostSupplier() {
+			return [](auto value) { return static_cast<uint64_t>(value); };
+		}
+	}
+
+	TEST(TEST_CLASS, CalculateChunkEndIndexesReturnsNoChunksWhenThereAreNoItems) {
+		// Act:
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(std::vector<ItemType>(), 4, ItemValueCostSupplier());
+
+		// Assert:
+		EXPECT_TRUE(chunkEndIndexes.empty());
+	}
+
+	TEST(TEST_CLASS, CalculateChunkEndIndexesSplitsUniformCostItemsEvenly) {
+		// Act:
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(std::vector<ItemType>(12, 5), 4, ItemValueCostSupplier());
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3, 6, 9, 12 }), chunkEndIndexes);
+	}
+
+	TEST(TEST_CLASS, CalculateChunkEndIndexesSplitsSkewedCostItemsByCost) {
+		// Arrange: first two items account for half of the total cost
+		auto items = std::vector<ItemType>{ 10, 10, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+		// Act:
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(items, 4, ItemValueCostSupplier());
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 12, 22 }), chunkEndIndexes);
+	}
+
+	TEST(TEST_CLASS, CalculateChunkEndIndexesNeverCreatesEmptyChunks) {
+		// Act:
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(std::vector<ItemType>{ 1, 100, 1 }, 10, ItemValueCostSupplier());
+
+		// Assert: every chunk is nonempty and all items are covered
+		EXPECT_EQ(std::vector<size_t>({ 2, 3 }), chunkEndIndexes);
+	}
+
+	TEST(TEST_CLASS, CalculateChunkEndIndexesTreatsZeroCostItemsAsUnitCost) {
+		// Act:
+		auto chunkEndIndexes = detail::CalculateChunkEndIndexes(std::vector<ItemType>(8, 0), 2, ItemValueCostSupplier());
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 4, 8 }), chunkEndIndexes);
+	}
+
+	// endregion
+
+	// region WorkStealingParallelForPartition
+
+	namespace {
+		struct WorkStealingCapture {
+		public:
+			explicit WorkStealingCapture(size_t numItems)
+					: Sum(0)
+					, NumChunks(0)
+					, IndexFlags(numItems, 0)
+			{}
+
+		public:
+			std::atomic<size_t> Sum;
+			std::atomic<size_t> NumChunks;
+			std::vector<uint8_t> IndexFlags;
+		};
+
+		auto CreateWorkStealingAggregate(WorkStealingCapture& capture) {
+			return [&capture](auto itBegin, auto itEnd, auto startIndex, auto) {
+				// Sanity: fail if any index is too large
+				ASSERT_GT(capture.IndexFlags.size(), startIndex) << "unexpected start index " << startIndex;
+
+				// Act:
+				++capture.NumChunks;
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					++capture.IndexFlags[startIndex++]; // use start index to visit all items
+					capture.Sum += *iter;
+				}
+			};
+		}
+
+		template<typename TTraits>
+		void AssertWorkStealingCanProcessAllItems(const WorkStealingOptions& options) {
+			// Arrange:
+			BasicTestContext<typename TTraits::ContainerType> context;
+
+			// Act:
+			WorkStealingCapture capture(context.Items.size());
+			WorkStealingParallelForPartition(
+					context.pPool->ioContext(),
+					context.Items,
+					context.NumThreads,
+					ItemValueCostSupplier(),
+					options,
+					CreateWorkStealingAggregate(capture)).get();
+
+			// Assert: all items were processed exactly once
+			EXPECT_EQ(context.ItemsSum, capture.Sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+			EXPECT_GE(context.NumThreads * options.NumChunksPerPartition, capture.NumChunks);
+		}
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelForPartition(context.pPool->ioContext(), items, context.NumThreads, WorkStealingOptions(), [&counter](
+				auto,
+				auto,
+				auto,
+				auto) {
+			++counter;
+		}).get();
+
+		// Assert: the chunk callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessAllItems) {
+		AssertWorkStealingCanProcessAllItems<TTraits>(WorkStealingOptions());
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessAllItemsWithSingleChunkPerPartition) {
+		AssertWorkStealingCanProcessAllItems<TTraits>({ 1, false });
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessAllItemsUsingCallingThread) {
+		AssertWorkStealingCanProcessAllItems<TTraits>({ 4, true });
+	}
+
+	TEST(TEST_CLASS, WorkStealingProcessesFirstChunkOnCallingThreadWhenRequested) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto items = CreateIncrementingValues(pPool->numWorkerThreads() * 5);
+
+		// Act:
+		auto callingThreadId = std::this_thread::get_id();
+		std::atomic_bool isFirstChunkProcessedByCallingThread(false);
+		WorkStealingParallelForPartition(pPool->ioContext(), items, pPool->numWorkerThreads(), { 4, true }, [
+				callingThreadId,
+				&isFirstChunkProcessedByCallingThread](auto, auto, auto, auto chunkIndex) {
+			if (0 == chunkIndex)
+				isFirstChunkProcessedByCallingThread = callingThreadId == std::this_thread::get_id();
+		}).get();
+
+		// Assert: the first chunk is reserved for the calling thread
+		EXPECT_TRUE(isFirstChunkProcessedByCallingThread);
+	}
+
+	TEST(TEST_CLASS, WorkStealingBalancesSkewedWorkAcrossThreads) {
+		// Arrange: first item is as expensive as all others combined
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto numThreads = pPool->numWorkerThreads();
+		auto items = std::vector<ItemType>(numThreads * 10, 1);
+		items[0] = static_cast<ItemType>(items.size() - 1);
+
+		// Act: capture the number of items in each chunk
+		std::vector<size_t> chunkSizes(numThreads * 4, 0);
+		auto captureChunkSize = [&chunkSizes](auto itBegin, auto itEnd, auto, auto chunkIndex) {
+			chunkSizes[chunkIndex] = static_cast<size_t>(std::distance(itBegin, itEnd));
+		};
+		auto costSupplier = ItemValueCostSupplier();
+		auto& ioContext = pPool->ioContext();
+		WorkStealingParallelForPartition(ioContext, items, numThreads, costSupplier, WorkStealingOptions(), captureChunkSize).get();
+
+		// Assert: the expensive item is isolated in its own chunk
+		EXPECT_EQ(1u, chunkSizes[0]);
+		EXPECT_EQ(items.size(), std::accumulate(chunkSizes.cbegin(), chunkSizes.cend(), static_cast<size_t>(0)));
+	}
+
+	namespace {
+		void AssertWorkStealingPropagatesException(bool useCallingThread, size_t throwingChunkIndex) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoThreadPool();
+			auto items = CreateIncrementingValues(pPool->numWorkerThreads() * 5);
+
+			// Act: make every chunk run for a while so that chunks are still running when one of them throws
+			std::atomic<size_t> numStartedChunks(0);
+			std::atomic<size_t> numCompletedChunks(0);
+			auto future = WorkStealingParallelForPartition(pPool->ioContext(), items, pPool->numWorkerThreads(), {
+				4,
+				useCallingThread
+			}, [throwingChunkIndex, &numStartedChunks, &numCompletedChunks](auto, auto, auto, auto chunkIndex) {
+				++numStartedChunks;
+				if (throwingChunkIndex == chunkIndex)
+					CATAPULT_THROW_RUNTIME_ERROR("chunk callback failed");
+
+				test::Sleep(5);
+				++numCompletedChunks;
+			});
+
+			// Assert: the exception is delivered through the future only after all other started chunks have completed
+			EXPECT_THROW(future.get(), catapult_runtime_error);
+			EXPECT_LE(1u, numStartedChunks);
+			EXPECT_EQ(numStartedChunks - 1, numCompletedChunks);
+		}
+	}
+
+	TEST(TEST_CLASS, WorkStealingPropagatesExceptionThrownOnPoolThread) {
+		AssertWorkStealingPropagatesException(false, 0);
+	}
+
+	TEST(TEST_CLASS, WorkStealingPropagatesExceptionThrownOnCallingThread) {
+		// Assert: first chunk is always processed by the calling thread
+		AssertWorkStealingPropagatesException(true, 0);
+	}
+
+	TEST(TEST_CLASS, WorkStealingPropagatesExceptionWhenAllChunksThrow) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto items = CreateIncrementingValues(pPool->numWorkerThreads() * 5);
+
+		// Act:
+		std::atomic<size_t> numThrownExceptions(0);
+		auto future = WorkStealingParallelForPartition(pPool->ioContext(), items, pPool->numWorkerThreads(), { 4, true }, [
+				&numThrownExceptions](auto, auto, auto, auto) {
+			++numThrownExceptions;
+			CATAPULT_THROW_RUNTIME_ERROR("chunk callback failed");
+		});
+
+		// Assert: a single exception is delivered and the pool is still usable
+		EXPECT_THROW(future.get(), catapult_runtime_error);
+		EXPECT_LE(1u, numThrownExceptions);
+
+		std::atomic<size_t> numProcessedChunks(0);
+		WorkStealingParallelForPartition(pPool->ioContext(), items, pPool->numWorkerThreads(), WorkStealingOptions(), [
+				&numProcessedChunks](auto, auto, auto, auto) {
+			++numProcessedChunks;
+		}).get();
+		EXPECT_LT(0u, numProcessedChunks);
+	}
+
+	// endregion
+
+	// region ParallelForEachRethrow
+
+	CONTAINER_TEST(ParallelForEachRethrowProcessesAllItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::atomic<size_t> numCalls(0);
+		ParallelForEachRethrow(*context.pPool, context.Items, [&sum, &numCalls](auto item) {
+			sum += item;
+			++numCalls;
+		});
+
+		// Assert: every item was processed exactly once before returning
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(context.NumItems, numCalls);
+	}
+
+	CONTAINER_TEST(ParallelForEachRethrowRethrowsCallbackException) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act + Assert:
+		auto throwingItem = static_cast<ItemType>(context.NumItems / 2);
+		EXPECT_THROW(ParallelForEachRethrow(*context.pPool, context.Items, [throwingItem](auto item) {
+			if (throwingItem == item)
+				CATAPULT_THROW_RUNTIME_ERROR("item callback failed");
+		}), catapult_runtime_error);
+	}
+
+	// endregion
+
 	// region ParallelFor basic
 
 	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_ZeroItems) {
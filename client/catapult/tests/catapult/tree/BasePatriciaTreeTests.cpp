@@ -60,6 +60,24 @@ namespace catapult { namespace tree {
 		}
 	}
 
+	// region dataSource
+
+	TEST(TEST_CLASS, BasePatriciaTreeExposesDataSource) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		const auto& treeDataSource = tree.dataSource();
+
+		// Assert:
+		EXPECT_EQ(&dataSource, &treeDataSource);
+		EXPECT_EQ(7u, treeDataSource.size());
+	}
+
+	// endregion
+
 	// region base + delta root hash forwarding
 
 	TEST(TEST_CLASS, BasePatriciaTreeExposesCorrectRootHash) {
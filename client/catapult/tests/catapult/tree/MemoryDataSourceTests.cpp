@@ -80,6 +80,87 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(0u, dataSource.size());
 	}
 
+	TEST(TEST_CLASS, CanMoveConstructButNotMoveAssignDataSource) {
+		EXPECT_TRUE(std::is_move_constructible_v<MemoryDataSource>);
+		EXPECT_FALSE(std::is_move_assignable_v<MemoryDataSource>);
+		EXPECT_FALSE(std::is_copy_constructible_v<MemoryDataSource>);
+		EXPECT_FALSE(std::is_copy_assignable_v<MemoryDataSource>);
+	}
+
+	TEST(TEST_CLASS, SettingExistingNodesDoesNotConsumeNodeMemory) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'02), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+		dataSource.set(leafNode);
+		dataSource.set(branchNode);
+
+		auto memorySize = dataSource.memorySize();
+
+		// Act:
+		for (auto i = 0u; i < 100; ++i) {
+			dataSource.set(leafNode);
+			dataSource.set(branchNode);
+		}
+
+		// Assert:
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_EQ(memorySize, dataSource.memorySize());
+	}
+
+	TEST(TEST_CLASS, NodeMemoryGrowsLinearlyWithNumberOfNodes) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		dataSource.set(LeafTreeNode(TreeNodePath(0), test::GenerateRandomByteArray<Hash256>()));
+		auto nodeMemorySize = dataSource.memorySize();
+
+		// Act: add enough nodes to rehash the map multiple times
+		for (auto i = 1u; i < 1000; ++i)
+			dataSource.set(LeafTreeNode(TreeNodePath(i), test::GenerateRandomByteArray<Hash256>()));
+
+		// Assert: bucket arrays abandoned by rehashing are not allocated from the arena
+		EXPECT_EQ(1000u, dataSource.size());
+		EXPECT_EQ(1000 * nodeMemorySize, dataSource.memorySize());
+	}
+
+	TEST(TEST_CLASS, ClearReleasesNodeMemory) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		for (auto i = 0u; i < 100; ++i)
+			dataSource.set(LeafTreeNode(TreeNodePath(i), test::GenerateRandomByteArray<Hash256>()));
+
+		// Sanity:
+		EXPECT_EQ(100u, dataSource.size());
+		EXPECT_NE(0u, dataSource.memoryCapacity());
+
+		// Act:
+		dataSource.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_EQ(0u, dataSource.memorySize());
+		EXPECT_EQ(0u, dataSource.memoryCapacity());
+	}
+
+	TEST(TEST_CLASS, CanSetNodesAfterClear) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		dataSource.set(LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>()));
+		dataSource.clear();
+
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'02), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+
+		// Act:
+		dataSource.set(leafNode);
+		dataSource.set(branchNode);
+
+		// Assert:
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_EQ(leafNode.hash(), dataSource.get(leafNode.hash()).hash());
+		EXPECT_EQ(branchNode.hash(), dataSource.get(branchNode.hash()).hash());
+	}
+
 	// region perf
 
 	TEST(TEST_CLASS, SetDoesNotRecalculateHashWhenNotDirty) {
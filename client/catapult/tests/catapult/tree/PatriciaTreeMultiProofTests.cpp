@@ -0,0 +1,216 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/PatriciaTreeMultiProof.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/test/tree/PassThroughEncoder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS PatriciaTreeMultiProofTests
+
+	namespace {
+		using MemoryPatriciaTree = PatriciaTree<test::PassThroughEncoder, MemoryDataSource>;
+
+		constexpr uint32_t Verb_Key = 0x64'6F'00'00;
+		constexpr uint32_t Puppy_Key = 0x64'6F'67'00;
+		constexpr uint32_t Coin_Key = 0x64'6F'67'65;
+		constexpr uint32_t Unknown_Key = 0x64'6F'67'44;
+
+		class TestContext {
+		public:
+			TestContext() : m_tree(m_dataSource) {
+				// root extension node with leaf (verb) and branch (puppy, coin) links
+				m_tree.set(Verb_Key, "verb");
+				m_tree.set(Puppy_Key, "puppy");
+				m_tree.set(Coin_Key, "coin");
+			}
+
+		public:
+			Hash256 root() const {
+				return m_tree.root();
+			}
+
+			PatriciaTreeMultiProof lookup(const std::vector<uint32_t>& keys) const {
+				PatriciaTreeMultiProof proof;
+				m_tree.lookup(keys, proof);
+				return proof;
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			MemoryPatriciaTree m_tree;
+		};
+
+		ProofVerificationResult Verify(const PatriciaTreeMultiProof& proof, size_t pathIndex, uint32_t key, const Hash256& rootHash) {
+			Hash256 value;
+			return VerifyMultiProofPath(proof, pathIndex, TreeNodePath(key), rootHash, value);
+		}
+	}
+
+	// region valid proofs
+
+	TEST(TEST_CLASS, CanVerifyPresentKey) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key, Coin_Key });
+
+		// Act:
+		Hash256 verbValue;
+		auto verbResult = VerifyMultiProofPath(proof, 0, TreeNodePath(Verb_Key), context.root(), verbValue);
+
+		Hash256 coinValue;
+		auto coinResult = VerifyMultiProofPath(proof, 1, TreeNodePath(Coin_Key), context.root(), coinValue);
+
+		// Assert:
+		EXPECT_EQ(ProofVerificationResult::Present, verbResult);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("verb"), verbValue);
+
+		EXPECT_EQ(ProofVerificationResult::Present, coinResult);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("coin"), coinValue);
+	}
+
+	TEST(TEST_CLASS, CanVerifyAbsentKey) {
+		// Arrange: key diverging from leaf, key with unset link and key diverging from root extension
+		TestContext context;
+		auto proof = context.lookup({ 0x64'6F'00'01, Unknown_Key, 0x54'6F'67'00 });
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Absent, Verify(proof, 0, 0x64'6F'00'01, context.root()));
+		EXPECT_EQ(ProofVerificationResult::Absent, Verify(proof, 1, Unknown_Key, context.root()));
+		EXPECT_EQ(ProofVerificationResult::Absent, Verify(proof, 2, 0x54'6F'67'00, context.root()));
+	}
+
+	TEST(TEST_CLASS, CanVerifyAbsentKeyInEmptyTree) {
+		// Arrange:
+		PatriciaTreeMultiProof proof;
+		proof.Paths.resize(1);
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Absent, Verify(proof, 0, Verb_Key, Hash256()));
+	}
+
+	// endregion
+
+	// region invalid proofs
+
+	TEST(TEST_CLASS, CannotVerifyKeyInEmptyTreeWhenRootHashIsNonzero) {
+		// Arrange:
+		PatriciaTreeMultiProof proof;
+		proof.Paths.resize(1);
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Verb_Key, test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithPathIndexOutOfRange) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key });
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 1, Verb_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithNodeIndexOutOfRange) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key });
+		proof.Paths[0].back() = static_cast<uint32_t>(proof.Nodes.size());
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Verb_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithWrongRootHash) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key, Unknown_Key });
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Verb_Key, test::GenerateRandomByteArray<Hash256>()));
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 1, Unknown_Key, test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithTruncatedPath) {
+		// Arrange: remove the leaf from the path
+		TestContext context;
+		auto proof = context.lookup({ Coin_Key });
+		proof.Paths[0].pop_back();
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Coin_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithUnlinkedNode) {
+		// Arrange: replace the coin leaf with the (unlinked) puppy leaf
+		TestContext context;
+		auto proof = context.lookup({ Puppy_Key, Coin_Key });
+		proof.Paths[1].back() = proof.Paths[0].back();
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 1, Coin_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithTamperedNode) {
+		// Arrange: change the value of the verb leaf
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key });
+		auto& leafNode = proof.Nodes[proof.Paths[0].back()];
+		leafNode = TreeNode(LeafTreeNode(leafNode.path(), test::GenerateRandomByteArray<Hash256>()));
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Verb_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithPathContinuingPastLeaf) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key });
+		proof.Paths[0].push_back(proof.Paths[0].back());
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Verb_Key, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyKeyWithPathContinuingPastTerminalBranch) {
+		// Arrange: continue the path of a key diverging from the root extension with an arbitrary node
+		TestContext context;
+		auto proof = context.lookup({ 0x54'6F'67'00, Verb_Key });
+		proof.Paths[0].push_back(proof.Paths[1].back());
+
+		// Act + Assert:
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, 0x54'6F'67'00, context.root()));
+	}
+
+	TEST(TEST_CLASS, CannotVerifyDifferentKey) {
+		// Arrange:
+		TestContext context;
+		auto proof = context.lookup({ Verb_Key });
+
+		// Act + Assert: the verb path does not prove anything about the coin key
+		EXPECT_EQ(ProofVerificationResult::Invalid, Verify(proof, 0, Coin_Key, context.root()));
+	}
+
+	// endregion
+}}
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/tree/TreeNodePath.h"
+#include "tests/test/nodeps/Comparison.h"
 #include "tests/test/nodeps/Equality.h"
 #include "tests/TestHarness.h"
 
@@ -83,6 +84,43 @@ namespace catapult { namespace tree {
 		AssertPath(path, 0, {});
 	}
 
+	TEST(TEST_CLASS, CanCreatePathAroundKeyLargerThanInlineCapacity) {
+		// Arrange:
+		std::vector<uint8_t> key(40);
+		for (auto i = 0u; i < key.size(); ++i)
+			key[i] = static_cast<uint8_t>(i);
+
+		// Act:
+		TreeNodePath path(key);
+
+		// Assert:
+		ASSERT_EQ(80u, path.size());
+		for (auto i = 0u; i < key.size(); ++i) {
+			EXPECT_EQ(key[i] >> 4, path.nibbleAt(2 * i)) << "nibble at index " << 2 * i;
+			EXPECT_EQ(key[i] & 0x0F, path.nibbleAt(2 * i + 1)) << "nibble at index " << 2 * i + 1;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateSubpathsAndJoinsOfPathLargerThanInlineCapacity) {
+		// Arrange:
+		std::vector<uint8_t> key(40);
+		for (auto i = 0u; i < key.size(); ++i)
+			key[i] = static_cast<uint8_t>(0xFF - i);
+
+		TreeNodePath path(key);
+
+		// Act:
+		auto subpath1 = path.subpath(0, 39); // fits inline
+		auto subpath2 = path.subpath(39); // requires heap storage
+		auto joinedPath = TreeNodePath::Join(subpath1, path.nibbleAt(39), subpath2.subpath(1));
+
+		// Assert:
+		EXPECT_EQ(39u, subpath1.size());
+		EXPECT_EQ(41u, subpath2.size());
+		EXPECT_EQ(path.subpath(39, 41), subpath2);
+		EXPECT_EQ(path, joinedPath);
+	}
+
 	// endregion
 
 	// region equality
@@ -122,6 +160,38 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region comparison
+
+	namespace {
+		std::vector<TreeNodePath> GenerateIncreasingValues() {
+			using KeyType = std::array<uint8_t, 4>;
+			TreeNodePath path(KeyType{ { 0x12, 0x34, 0x56, 0x78 } });
+			return {
+				TreeNodePath(),
+				path.subpath(1, 2), // 0x23
+				path.subpath(1, 3), // 0x234
+				path.subpath(1), // 0x2345678
+				TreeNodePath(KeyType{ { 0x23, 0x45, 0x67, 0x90 } }).subpath(0, 7), // 0x2345679
+				TreeNodePath(KeyType{ { 0x23, 0x50, 0x00, 0x00 } }),
+				path.subpath(2, 1) // 0x3
+			};
+		}
+	}
+
+	MAKE_COMPARISON_TEST(TEST_CLASS, OperatorLessThanReturnsTrueOnlyForSmallerValues, GenerateIncreasingValues(), <)
+
+	TEST(TEST_CLASS, OperatorLessThanIgnoresNibbleAdjustment) {
+		// Arrange:
+		using KeyType = std::array<uint8_t, 4>;
+		TreeNodePath path(KeyType{ { 0x12, 0x34, 0x56, 0x78 } });
+		TreeNodePath nibbleShiftedPath(KeyType{ { 0x23, 0x45, 0x67, 0x80 } });
+
+		// Act + Assert:
+		test::AssertLessThanOperatorForEqualValues(path.subpath(1), nibbleShiftedPath.subpath(0, 7));
+	}
+
+	// endregion
+
 	// region subpath
 
 	TEST(TEST_CLASS, CanCreateEmptySubpathFromEmptyPath) {
@@ -464,6 +464,48 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedHash, node.hash());
 	}
 
+	BRANCH_LINK_TEST(CanSetBranchTreeNodeLinksInAnyOrder) {
+		// Arrange:
+		auto path = TreeNodePath(0x64'6F'67'00);
+		auto links = TTraits::GenerateLinks(4);
+		auto node = BranchTreeNode(path);
+
+		// Act: set links in descending order with temporary links in between and around them
+		node.setLink(links[1], 11);
+		node.setLink(links[2], 14);
+		node.setLink(links[0], 6);
+		node.setLink(links[3], 0);
+		node.clearLink(14);
+		node.clearLink(0);
+
+		// Assert:
+		EXPECT_EQ(path, node.path());
+		AssertTwoLinks<TTraits>(node, TTraits::GetHash(links[0]), TTraits::GetHash(links[1]));
+
+		auto expectedHash = CalculateTwoLinkHash({ 0x00, 0x64, 0x6F, 0x67, 0x00 }, TTraits::GetHash(links[0]), TTraits::GetHash(links[1]));
+		EXPECT_EQ(expectedHash, node.hash());
+	}
+
+	TEST(TEST_CLASS, CanMixBranchTreeNodeHashAndNodeLinks) {
+		// Arrange:
+		auto path = TreeNodePath(0x64'6F'67'00);
+		auto hashLink = HashLinkTraits::GenerateLinks(1)[0];
+		auto nodeLink = std::move(NodeLinkTraits::GenerateLinks(1)[0]);
+		auto node = BranchTreeNode(path);
+
+		// Act: add node link after hash link with lower index
+		node.setLink(hashLink, 6);
+		node.setLink(nodeLink, 11);
+
+		// Assert:
+		EXPECT_EQ(2u, node.numLinks());
+		AssertHashLink(node, 6, hashLink);
+		AssertNodeLink(node, 11, nodeLink.hash());
+
+		auto expectedHash = CalculateTwoLinkHash({ 0x00, 0x64, 0x6F, 0x67, 0x00 }, hashLink, nodeLink.hash());
+		EXPECT_EQ(expectedHash, node.hash());
+	}
+
 	BRANCH_LINK_TEST(BranchTreeNodeCompactLinksReplacesLinksWithHashLinks) {
 		// Arrange:
 		auto path = TreeNodePath(0x64'6F'67'00);
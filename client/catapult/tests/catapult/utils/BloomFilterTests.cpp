@@ -0,0 +1,299 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/BloomFilter.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS BloomFilterTests
+
+	namespace {
+		std::vector<uint64_t> GenerateRandomKeys(size_t count) {
+			std::vector<uint64_t> keys;
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(test::Random());
+
+			return keys;
+		}
+
+		BloomFilter CreateFilter(const std::vector<uint64_t>& keys, uint32_t seed) {
+			BloomFilter filter(keys.size(), seed);
+			for (auto key : keys)
+				filter.insert(key);
+
+			return filter;
+		}
+
+		std::vector<uint8_t> Serialize(const BloomFilter& filter) {
+			auto header = filter.header();
+			std::vector<uint8_t> buffer(sizeof(BloomFilterHeader) + filter.data().size());
+			std::memcpy(buffer.data(), &header, sizeof(BloomFilterHeader));
+			std::memcpy(buffer.data() + sizeof(BloomFilterHeader), filter.data().data(), filter.data().size());
+			return buffer;
+		}
+
+		void AssertEqual(const BloomFilter& expected, const BloomFilter& actual) {
+			EXPECT_EQ(expected.seed(), actual.seed());
+			EXPECT_EQ(expected.numHashFunctions(), actual.numHashFunctions());
+			EXPECT_EQ(expected.data(), actual.data());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateDefaultFilter) {
+		// Act:
+		BloomFilter filter;
+
+		// Assert:
+		EXPECT_EQ(0u, filter.seed());
+		EXPECT_EQ(BloomFilter::Default_Num_Hash_Functions, filter.numHashFunctions());
+		EXPECT_TRUE(filter.data().empty());
+
+		EXPECT_FALSE(filter.contains(0));
+		EXPECT_FALSE(filter.contains(test::Random()));
+	}
+
+	TEST(TEST_CLASS, CanCreateFilterWithCapacity) {
+		// Act:
+		BloomFilter filter(1000, 123);
+
+		// Assert:
+		EXPECT_EQ(123u, filter.seed());
+		EXPECT_EQ(BloomFilter::Default_Num_Hash_Functions, filter.numHashFunctions());
+		EXPECT_EQ(std::vector<uint8_t>(1000 * BloomFilter::Default_Bits_Per_Key / 8), filter.data());
+	}
+
+	TEST(TEST_CLASS, CanCreateFilterWithZeroCapacity) {
+		// Act:
+		BloomFilter filter(0, 123);
+
+		// Assert: filter always has at least one byte
+		EXPECT_EQ(123u, filter.seed());
+		EXPECT_EQ(std::vector<uint8_t>(1), filter.data());
+		EXPECT_FALSE(filter.contains(test::Random()));
+	}
+
+	TEST(TEST_CLASS, CanCreateFilterAroundData) {
+		// Act:
+		BloomFilter filter(123, 7, std::vector<uint8_t>{ 0x12, 0x34, 0x56 });
+
+		// Assert:
+		EXPECT_EQ(123u, filter.seed());
+		EXPECT_EQ(7u, filter.numHashFunctions());
+		EXPECT_EQ(std::vector<uint8_t>({ 0x12, 0x34, 0x56 }), filter.data());
+	}
+
+	// endregion
+
+	// region header
+
+	TEST(TEST_CLASS, HeaderDescribesFilter) {
+		// Arrange:
+		BloomFilter filter(123, 7, std::vector<uint8_t>{ 0x12, 0x34, 0x56 });
+
+		// Act:
+		auto header = filter.header();
+
+		// Assert:
+		EXPECT_EQ(3u, header.Size);
+		EXPECT_EQ(123u, header.Seed);
+		EXPECT_EQ(7u, header.NumHashFunctions);
+	}
+
+	// endregion
+
+	// region insert / contains
+
+	TEST(TEST_CLASS, InsertSetsAtMostNumHashFunctionsBits) {
+		// Arrange:
+		BloomFilter filter(100, 123);
+
+		// Act:
+		filter.insert(test::Random());
+
+		// Assert:
+		auto numSetBits = 0u;
+		for (auto byte : filter.data()) {
+			for (auto i = 0u; i < 8; ++i)
+				numSetBits += (byte >> i) & 1;
+		}
+
+		EXPECT_LT(0u, numSetBits);
+		EXPECT_GE(BloomFilter::Default_Num_Hash_Functions, numSetBits);
+	}
+
+	TEST(TEST_CLASS, CannotInsertIntoDefaultFilter) {
+		// Arrange:
+		BloomFilter filter;
+
+		// Act + Assert:
+		EXPECT_THROW(filter.insert(test::Random()), catapult_runtime_error);
+		EXPECT_TRUE(filter.data().empty());
+	}
+
+	TEST(TEST_CLASS, CannotInsertIntoFilterAroundEmptyData) {
+		// Arrange:
+		BloomFilter filter(123, 3, std::vector<uint8_t>());
+
+		// Act + Assert:
+		EXPECT_THROW(filter.insert(test::Random()), catapult_runtime_error);
+		EXPECT_TRUE(filter.data().empty());
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsTrueForAllInsertedKeys) {
+		// Arrange:
+		auto keys = GenerateRandomKeys(1000);
+
+		// Act:
+		auto filter = CreateFilter(keys, 123);
+
+		// Assert:
+		for (auto key : keys)
+			EXPECT_TRUE(filter.contains(key)) << key;
+	}
+
+	TEST(TEST_CLASS, ContainsRarelyReturnsTrueForOtherKeys) {
+		// Arrange: fill filter to capacity
+		auto filter = CreateFilter(GenerateRandomKeys(10'000), 123);
+
+		// Act:
+		auto numFalsePositives = 0u;
+		for (auto key : GenerateRandomKeys(100'000)) {
+			if (filter.contains(key))
+				++numFalsePositives;
+		}
+
+		// Assert: expected false positive rate is ~2.2%
+		EXPECT_GT(4'000u, numFalsePositives);
+	}
+
+	TEST(TEST_CLASS, FiltersWithSameSeedAreEqual) {
+		// Arrange:
+		auto keys = GenerateRandomKeys(100);
+
+		// Act:
+		auto filter1 = CreateFilter(keys, 123);
+		auto filter2 = CreateFilter(keys, 123);
+
+		// Assert:
+		AssertEqual(filter1, filter2);
+	}
+
+	TEST(TEST_CLASS, FiltersWithDifferentSeedsAreNotEqual) {
+		// Arrange:
+		auto keys = GenerateRandomKeys(100);
+
+		// Act:
+		auto filter1 = CreateFilter(keys, 123);
+		auto filter2 = CreateFilter(keys, 124);
+
+		// Assert: bit positions are randomized by seed
+		EXPECT_NE(filter1.data(), filter2.data());
+	}
+
+	// endregion
+
+	// region TryParseBloomFilter
+
+	TEST(TEST_CLASS, CanParseSerializedFilter) {
+		// Arrange: append some trailing data
+		auto keys = GenerateRandomKeys(100);
+		auto originalFilter = CreateFilter(keys, 123);
+		auto buffer = Serialize(originalFilter);
+		buffer.resize(buffer.size() + 10);
+
+		// Act:
+		BloomFilter filter;
+		size_t numBytesConsumed = 0;
+		auto result = TryParseBloomFilter(buffer, filter, numBytesConsumed);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(buffer.size() - 10, numBytesConsumed);
+		AssertEqual(originalFilter, filter);
+
+		for (auto key : keys)
+			EXPECT_TRUE(filter.contains(key)) << key;
+	}
+
+	namespace {
+		void AssertCannotParse(const std::vector<uint8_t>& buffer) {
+			// Act:
+			BloomFilter filter;
+			size_t numBytesConsumed = 0;
+			auto result = TryParseBloomFilter(buffer, filter, numBytesConsumed);
+
+			// Assert:
+			EXPECT_FALSE(result);
+			EXPECT_EQ(0u, numBytesConsumed);
+			EXPECT_TRUE(filter.data().empty());
+		}
+
+		void AssertCannotParse(uint32_t numHashFunctions, size_t dataSize, size_t bufferDataSize) {
+			// Arrange:
+			auto buffer = Serialize(BloomFilter(123, numHashFunctions, std::vector<uint8_t>(dataSize)));
+			buffer.resize(sizeof(BloomFilterHeader) + bufferDataSize);
+
+			// Act + Assert:
+			AssertCannotParse(buffer);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotParseBufferSmallerThanHeader) {
+		AssertCannotParse(std::vector<uint8_t>(sizeof(BloomFilterHeader) - 1));
+	}
+
+	TEST(TEST_CLASS, CannotParseBufferSmallerThanFilterData) {
+		AssertCannotParse(5, 100, 99);
+	}
+
+	TEST(TEST_CLASS, CannotParseFilterWithoutData) {
+		AssertCannotParse(5, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CannotParseFilterWithoutHashFunctions) {
+		AssertCannotParse(0, 100, 100);
+	}
+
+	TEST(TEST_CLASS, CannotParseFilterWithTooManyHashFunctions) {
+		AssertCannotParse(BloomFilter::Max_Hash_Functions + 1, 100, 100);
+	}
+
+	TEST(TEST_CLASS, CanParseFilterWithMaxHashFunctions) {
+		// Arrange:
+		auto buffer = Serialize(BloomFilter(123, BloomFilter::Max_Hash_Functions, std::vector<uint8_t>(100)));
+
+		// Act:
+		BloomFilter filter;
+		size_t numBytesConsumed = 0;
+		auto result = TryParseBloomFilter(buffer, filter, numBytesConsumed);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(buffer.size(), numBytesConsumed);
+		EXPECT_EQ(BloomFilter::Max_Hash_Functions, filter.numHashFunctions());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,200 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ExecutionProfile.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ExecutionProfileTests
+
+	namespace {
+		using EntryValues = ExecutionProfile::EntryValues;
+
+		void AssertEntryValues(const EntryValues& expected, const EntryValues& actual, const std::string& message = "") {
+			EXPECT_EQ(expected.Name, actual.Name) << message;
+			EXPECT_EQ(expected.NumCalls, actual.NumCalls) << message;
+			EXPECT_EQ(expected.TotalElapsedNanoseconds, actual.TotalElapsedNanoseconds) << message;
+			EXPECT_EQ(expected.MaxElapsedNanoseconds, actual.MaxElapsedNanoseconds) << message;
+		}
+	}
+
+	// region Entry
+
+	TEST(TEST_CLASS, CanCreateEntry) {
+		// Act:
+		ExecutionProfile::Entry entry("alpha");
+
+		// Assert:
+		EXPECT_EQ("alpha", entry.name());
+		AssertEntryValues({ "alpha", 0, 0, 0 }, entry.values());
+	}
+
+	TEST(TEST_CLASS, CanRecordSingleCall) {
+		// Arrange:
+		ExecutionProfile::Entry entry("alpha");
+
+		// Act:
+		entry.record(std::chrono::nanoseconds(123));
+
+		// Assert:
+		AssertEntryValues({ "alpha", 1, 123, 123 }, entry.values());
+	}
+
+	TEST(TEST_CLASS, CanRecordMultipleCalls) {
+		// Arrange:
+		ExecutionProfile::Entry entry("alpha");
+
+		// Act:
+		for (auto elapsedNanoseconds : { 50, 200, 70, 30 })
+			entry.record(std::chrono::nanoseconds(elapsedNanoseconds));
+
+		// Assert:
+		AssertEntryValues({ "alpha", 4, 350, 200 }, entry.values());
+	}
+
+	TEST(TEST_CLASS, CanRecordCallsConcurrently) {
+		// Arrange:
+		constexpr auto Num_Calls_Per_Thread = 1000u;
+		auto numThreads = 2 * test::GetNumDefaultPoolThreads();
+		ExecutionProfile::Entry entry("alpha");
+
+		// Act: each thread records calls with elapsed times [1, Num_Calls_Per_Thread] offset by its thread index
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.spawn([&entry, i]() {
+				for (auto j = 1u; j <= Num_Calls_Per_Thread; ++j)
+					entry.record(std::chrono::nanoseconds(i + j));
+			});
+		}
+
+		threads.join();
+
+		// Assert:
+		uint64_t expectedTotalElapsedNanoseconds = 0;
+		for (auto i = 0u; i < numThreads; ++i)
+			expectedTotalElapsedNanoseconds += i * Num_Calls_Per_Thread + Num_Calls_Per_Thread * (Num_Calls_Per_Thread + 1) / 2;
+
+		auto expectedMaxElapsedNanoseconds = numThreads - 1 + Num_Calls_Per_Thread;
+		AssertEntryValues(
+				{ "alpha", numThreads * Num_Calls_Per_Thread, expectedTotalElapsedNanoseconds, expectedMaxElapsedNanoseconds },
+				entry.values());
+	}
+
+	// endregion
+
+	// region ExecutionProfile
+
+	TEST(TEST_CLASS, CanCreateEmptyProfile) {
+		// Act:
+		ExecutionProfile profile;
+
+		// Assert:
+		EXPECT_EQ(0u, profile.size());
+		EXPECT_TRUE(profile.values().empty());
+	}
+
+	TEST(TEST_CLASS, CanAddEntries) {
+		// Arrange:
+		ExecutionProfile profile;
+
+		// Act:
+		const auto& entry1 = profile.entry("alpha");
+		const auto& entry2 = profile.entry("beta");
+
+		// Assert:
+		EXPECT_EQ(2u, profile.size());
+		EXPECT_EQ("alpha", entry1.name());
+		EXPECT_EQ("beta", entry2.name());
+		EXPECT_NE(&entry1, &entry2);
+	}
+
+	TEST(TEST_CLASS, EntryReturnsSameEntryForSameName) {
+		// Arrange:
+		ExecutionProfile profile;
+		auto& entry1 = profile.entry("alpha");
+
+		// Act:
+		profile.entry("beta");
+		auto& entry2 = profile.entry("alpha");
+
+		// Assert:
+		EXPECT_EQ(2u, profile.size());
+		EXPECT_EQ(&entry1, &entry2);
+	}
+
+	TEST(TEST_CLASS, EntryReferencesAreStableAcrossAdditions) {
+		// Arrange:
+		ExecutionProfile profile;
+		auto& entry = profile.entry("alpha");
+
+		// Act:
+		for (auto i = 0u; i < 1000; ++i)
+			profile.entry(std::to_string(i));
+
+		entry.record(std::chrono::nanoseconds(25));
+
+		// Assert:
+		EXPECT_EQ(1001u, profile.size());
+		EXPECT_EQ(&entry, &profile.entry("alpha"));
+		AssertEntryValues({ "alpha", 1, 25, 25 }, profile.entry("alpha").values());
+	}
+
+	TEST(TEST_CLASS, ValuesAreSortedByDecreasingTotalElapsedTime) {
+		// Arrange:
+		ExecutionProfile profile;
+		profile.entry("alpha").record(std::chrono::nanoseconds(10));
+		profile.entry("beta").record(std::chrono::nanoseconds(30));
+		profile.entry("gamma").record(std::chrono::nanoseconds(25));
+		profile.entry("gamma").record(std::chrono::nanoseconds(15));
+		profile.entry("delta");
+
+		// Act:
+		auto values = profile.values();
+
+		// Assert:
+		ASSERT_EQ(4u, values.size());
+		AssertEntryValues({ "gamma", 2, 40, 25 }, values[0], "0");
+		AssertEntryValues({ "beta", 1, 30, 30 }, values[1], "1");
+		AssertEntryValues({ "alpha", 1, 10, 10 }, values[2], "2");
+		AssertEntryValues({ "delta", 0, 0, 0 }, values[3], "3");
+	}
+
+	TEST(TEST_CLASS, ValuesWithSameTotalElapsedTimePreserveCreationOrder) {
+		// Arrange:
+		ExecutionProfile profile;
+		profile.entry("beta").record(std::chrono::nanoseconds(10));
+		profile.entry("alpha").record(std::chrono::nanoseconds(10));
+		profile.entry("gamma").record(std::chrono::nanoseconds(10));
+
+		// Act:
+		auto values = profile.values();
+
+		// Assert:
+		ASSERT_EQ(3u, values.size());
+		EXPECT_EQ("beta", values[0].Name);
+		EXPECT_EQ("alpha", values[1].Name);
+		EXPECT_EQ("gamma", values[2].Name);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,175 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	namespace {
+		void AssertSummary(const LatencySummary& expected, const LatencySummary& actual) {
+			EXPECT_EQ(expected.Count, actual.Count);
+			EXPECT_EQ(expected.Median, actual.Median);
+			EXPECT_EQ(expected.P90, actual.P90);
+			EXPECT_EQ(expected.P99, actual.P99);
+			EXPECT_EQ(expected.Max, actual.Max);
+		}
+
+		void AssertWithinRelativeError(uint64_t expected, uint64_t actual, const std::string& message) {
+			// bucketed values are never smaller than recorded values
+			EXPECT_LE(expected, actual) << message;
+			EXPECT_GE(expected + expected / LatencyHistogram::Sub_Bucket_Half_Count, actual) << message;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyHistogram) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(50));
+		EXPECT_EQ(0u, histogram.percentile(100));
+		AssertSummary({ 0, 0, 0, 0, 0 }, histogram.summarize());
+	}
+
+	// endregion
+
+	// region add
+
+	TEST(TEST_CLASS, CanAddSingleValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.add(12345);
+
+		// Assert: percentiles are capped at max, so a single value is reported exactly
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(12345u, histogram.max());
+		AssertSummary({ 1, 12345, 12345, 12345, 12345 }, histogram.summarize());
+	}
+
+	TEST(TEST_CLASS, SmallValuesAreRecordedExactly) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto i = 0u; i < LatencyHistogram::Sub_Bucket_Count; ++i)
+			histogram.add(LatencyHistogram::Sub_Bucket_Count - 1 - i);
+
+		// Assert:
+		EXPECT_EQ(32u, histogram.count());
+		EXPECT_EQ(31u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(0));
+		EXPECT_EQ(15u, histogram.percentile(50));
+		EXPECT_EQ(28u, histogram.percentile(90));
+		EXPECT_EQ(31u, histogram.percentile(99));
+		EXPECT_EQ(31u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, LargeValuesAreRecordedWithBoundedRelativeError) {
+		for (auto value : std::initializer_list<uint64_t>{ 32, 33, 100, 1'000, 12'345, 1'000'000, 1ull << 40, (1ull << 40) + 12'345 }) {
+			// Arrange: add a larger value so that percentile is not capped at max
+			LatencyHistogram histogram;
+
+			// Act:
+			histogram.add(value);
+			histogram.add(value * 4);
+
+			// Assert:
+			AssertWithinRelativeError(value, histogram.percentile(50), std::to_string(value));
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddMaxValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.add(std::numeric_limits<uint64_t>::max());
+
+		// Assert:
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.max());
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanSummarizeManyValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto i = 1u; i <= 1000; ++i)
+			histogram.add(i);
+
+		// Assert:
+		auto summary = histogram.summarize();
+		EXPECT_EQ(1000u, summary.Count);
+		AssertWithinRelativeError(500, summary.Median, "median");
+		AssertWithinRelativeError(900, summary.P90, "p90");
+		AssertWithinRelativeError(990, summary.P99, "p99");
+		EXPECT_EQ(1000u, summary.Max);
+	}
+
+	TEST(TEST_CLASS, PercentilesAreClampedToValidRange) {
+		// Arrange:
+		LatencyHistogram histogram;
+		for (auto i = 1u; i <= 10; ++i)
+			histogram.add(i);
+
+		// Act + Assert:
+		EXPECT_EQ(1u, histogram.percentile(0));
+		EXPECT_EQ(10u, histogram.percentile(100));
+		EXPECT_EQ(10u, histogram.percentile(1000));
+	}
+
+	TEST(TEST_CLASS, CanAddValuesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Values_Per_Thread = 10'000u;
+		LatencyHistogram histogram;
+
+		// Act:
+		{
+			thread::ThreadGroup threads;
+			for (auto i = 0u; i < Num_Threads; ++i) {
+				threads.spawn([&histogram, i]() {
+					for (auto j = 0u; j < Num_Values_Per_Thread; ++j)
+						histogram.add(i * Num_Values_Per_Thread + j);
+				});
+			}
+		}
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread, histogram.count());
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread - 1, histogram.max());
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread, histogram.summarize().Count);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,207 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/MemoryArena.h"
+#include "tests/TestHarness.h"
+#include <unordered_map>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS MemoryArenaTests
+
+	// region MemoryArena
+
+	TEST(TEST_CLASS, ArenaIsInitiallyEmpty) {
+		// Act:
+		MemoryArena arena;
+
+		// Assert:
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(0u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, CanAllocateFromSingleBlock) {
+		// Arrange:
+		MemoryArena arena(1024);
+
+		// Act:
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(100, 1));
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(200, 1));
+
+		// Assert: allocations are adjacent
+		EXPECT_EQ(pData1 + 100, pData2);
+		EXPECT_EQ(300u, arena.size());
+		EXPECT_EQ(1024u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, AllocationsRespectAlignment) {
+		// Arrange:
+		MemoryArena arena(1024);
+		arena.allocate(3, 1);
+
+		// Act:
+		for (auto alignment : { 2u, 4u, 8u, 16u, 64u }) {
+			auto* pData = arena.allocate(5, alignment);
+
+			// Assert:
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pData) % alignment) << alignment;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotAllocateWithInvalidAlignment) {
+		// Arrange:
+		MemoryArena arena(1024);
+
+		// Act + Assert:
+		EXPECT_THROW(arena.allocate(8, 0), catapult_invalid_argument);
+		EXPECT_THROW(arena.allocate(8, 3), catapult_invalid_argument);
+		EXPECT_THROW(arena.allocate(8, 24), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, NewBlockIsAllocatedWhenCurrentBlockIsExhausted) {
+		// Arrange:
+		MemoryArena arena(1024);
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(1000, 1));
+
+		// Act:
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(100, 1));
+		auto* pData3 = static_cast<uint8_t*>(arena.allocate(100, 1));
+
+		// Assert: second and third allocations are adjacent in second block
+		EXPECT_NE(pData1 + 1000, pData2);
+		EXPECT_EQ(pData2 + 100, pData3);
+		EXPECT_EQ(1200u, arena.size());
+		EXPECT_EQ(2048u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, LargeAllocationIsGivenDedicatedBlock) {
+		// Arrange:
+		MemoryArena arena(1024);
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(100, 1));
+
+		// Act:
+		auto* pData2 = arena.allocate(2000, 8);
+		auto* pData3 = static_cast<uint8_t*>(arena.allocate(100, 1));
+
+		// Assert: large allocation does not interrupt current block
+		EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pData2) % 8);
+		EXPECT_EQ(pData1 + 100, pData3);
+		EXPECT_EQ(2200u, arena.size());
+		EXPECT_EQ(1024u + 2007, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, CanReleaseArena) {
+		// Arrange:
+		MemoryArena arena(1024);
+		arena.allocate(1000, 1);
+		arena.allocate(2000, 1);
+
+		// Act:
+		arena.release();
+
+		// Assert:
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(0u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, CanAllocateAfterRelease) {
+		// Arrange:
+		MemoryArena arena(1024);
+		arena.allocate(1000, 1);
+		arena.release();
+
+		// Act:
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(100, 1));
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(100, 1));
+
+		// Assert:
+		EXPECT_EQ(pData1 + 100, pData2);
+		EXPECT_EQ(200u, arena.size());
+		EXPECT_EQ(1024u, arena.capacity());
+	}
+
+	// endregion
+
+	// region ArenaAllocator
+
+	TEST(TEST_CLASS, AllocatorsAroundSameArenaAreEqual) {
+		// Arrange:
+		MemoryArena arena1;
+		MemoryArena arena2;
+
+		// Act + Assert:
+		EXPECT_EQ(ArenaAllocator<int>(arena1), ArenaAllocator<int>(arena1));
+		EXPECT_EQ(ArenaAllocator<int>(arena1), ArenaAllocator<uint64_t>(arena1));
+		EXPECT_NE(ArenaAllocator<int>(arena1), ArenaAllocator<int>(arena2));
+	}
+
+	TEST(TEST_CLASS, AllocatorAllocatesSingleObjectsFromArena) {
+		// Arrange:
+		MemoryArena arena;
+		ArenaAllocator<uint64_t> allocator(arena);
+
+		// Act:
+		auto* pValue = allocator.allocate(1);
+		*pValue = 123;
+		allocator.deallocate(pValue, 1);
+
+		// Assert: memory is only reclaimed when the arena is released
+		EXPECT_EQ(sizeof(uint64_t), arena.size());
+	}
+
+	TEST(TEST_CLASS, AllocatorAllocatesArraysFromHeap) {
+		// Arrange:
+		MemoryArena arena;
+		ArenaAllocator<uint64_t> allocator(arena);
+
+		// Act:
+		auto* pValues = allocator.allocate(10);
+		for (auto i = 0u; i < 10; ++i)
+			pValues[i] = i;
+
+		allocator.deallocate(pValues, 10);
+
+		// Assert:
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(0u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, CanUseAllocatorWithStandardContainer) {
+		// Arrange:
+		MemoryArena arena;
+		using AllocatorType = ArenaAllocator<std::pair<const int, uint64_t>>;
+		using MapType = std::unordered_map<int, uint64_t, std::hash<int>, std::equal_to<int>, AllocatorType>;
+		MapType map(0, std::hash<int>(), std::equal_to<int>(), ArenaAllocator<int>(arena));
+
+		// Act:
+		for (auto i = 0; i < 1000; ++i)
+			map.emplace(i, static_cast<uint64_t>(i * i));
+
+		// Assert:
+		EXPECT_EQ(1000u, map.size());
+		for (auto i = 0; i < 1000; ++i)
+			EXPECT_EQ(static_cast<uint64_t>(i * i), map.at(i)) << i;
+
+		EXPECT_LE(1000u * (sizeof(int) + sizeof(uint64_t)), arena.size());
+	}
+
+	// endregion
+}}
@@ -118,6 +118,59 @@ namespace catapult { namespace validators {
 		EXPECT_EQ(expectedBreadcrumbs, pContext->Breadcrumbs);
 	}
 
+	namespace {
+		class CountingValidator : public stateful::NotificationValidator {
+		public:
+			CountingValidator(std::unique_ptr<const stateful::NotificationValidator>&& pValidator, size_t& numValidateCalls)
+					: m_pValidator(std::move(pValidator))
+					, m_numValidateCalls(numValidateCalls)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				++m_numValidateCalls;
+				return m_pValidator->validate(notification, context);
+			}
+
+		private:
+			std::unique_ptr<const stateful::NotificationValidator> m_pValidator;
+			size_t& m_numValidateCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, CanDecorateAllAddedValidators) {
+		// Arrange:
+		auto pContext = std::make_unique<TestContext>();
+		size_t numDecorations = 0;
+		size_t numValidateCalls = 0;
+		stateful::DemuxValidatorBuilder builder([&numDecorations, &numValidateCalls](auto&& pValidator) {
+			++numDecorations;
+			return std::make_unique<CountingValidator>(std::move(pValidator), numValidateCalls);
+		});
+
+		// Act:
+		builder
+			.add(mocks::CreateTaggedBreadcrumbValidator(2, pContext->Breadcrumbs))
+			.add(mocks::CreateTaggedBreadcrumbValidator2(3, pContext->Breadcrumbs))
+			.add(mocks::CreateTaggedBreadcrumbValidator(4, pContext->Breadcrumbs));
+		pContext->pDemuxValidator = builder.build([](auto) { return false; });
+
+		auto result = pContext->validate(7);
+
+		// Assert: all validators were decorated but only matching validators were invoked
+		EXPECT_EQ(ValidationResult::Success, result);
+		EXPECT_EQ(3u, numDecorations);
+		EXPECT_EQ(2u, numValidateCalls);
+
+		std::vector<uint16_t> expectedBreadcrumbs{ 0x0702, 0x0704 };
+		EXPECT_EQ(expectedBreadcrumbs, pContext->Breadcrumbs);
+		EXPECT_EQ(std::vector<std::string>({ "2", "3", "4" }), pContext->pDemuxValidator->names());
+	}
+
 	// endregion
 
 	// region validate
@@ -250,5 +303,52 @@ namespace catapult { namespace validators {
 		});
 	}
 
+	namespace {
+		void AssertFilteredValidatorsAreInvokedInRegistrationOrder(
+				const model::Notification& notification,
+				const Breadcrumbs& expectedSelectedNames) {
+			// Arrange: interleave validators matching all types with validators matching specific types
+			Breadcrumbs breadcrumbs;
+			stateful::DemuxValidatorBuilder builder;
+
+			auto cache = test::CreateEmptyCatapultCache();
+
+			builder
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all1"))
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all2"))
+				.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all3"));
+			auto pValidator = builder.build([](auto) { return false; });
+
+			// Act:
+			auto result = test::ValidateNotification<model::Notification>(*pValidator, notification, cache);
+
+			// Assert:
+			EXPECT_EQ(ValidationResult::Success, result);
+
+			Breadcrumbs expectedNames{ "all1", "alpha", "all2", "OMEGA", "beta", "all3" };
+			EXPECT_EQ(expectedNames, pValidator->names());
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredValidatorsAreInvokedInRegistrationOrder_MultipleMatches) {
+		AssertFilteredValidatorsAreInvokedInRegistrationOrder(
+				model::AccountPublicKeyNotification(Key()),
+				{ "all1", "alpha", "all2", "beta", "all3" });
+	}
+
+	TEST(TEST_CLASS, FilteredValidatorsAreInvokedInRegistrationOrder_SingleMatch) {
+		AssertFilteredValidatorsAreInvokedInRegistrationOrder(
+				model::AccountAddressNotification(UnresolvedAddress()),
+				{ "all1", "all2", "OMEGA", "all3" });
+	}
+
+	TEST(TEST_CLASS, FilteredValidatorsAreInvokedInRegistrationOrder_NoMatches) {
+		AssertFilteredValidatorsAreInvokedInRegistrationOrder(test::TaggedNotification(7), { "all1", "all2", "all3" });
+	}
+
 	// endregion
 }}
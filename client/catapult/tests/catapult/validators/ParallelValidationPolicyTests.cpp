@@ -20,6 +20,10 @@
 **/
 
 #include "catapult/validators/ParallelValidationPolicy.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/validators/DemuxValidatorBuilder.h"
+#include "catapult/validators/StatelessValidationStatistics.h"
 #include "tests/catapult/validators/test/ValidationPolicyTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/BasicMultiThreadedState.h"
@@ -41,6 +45,13 @@ namespace catapult { namespace validators {
 					, m_isReleased(false)
 			{}
 
+			template<typename TPolicyFactory>
+			PoolValidationPolicyPair(std::unique_ptr<thread::IoThreadPool>&& pPool, TPolicyFactory policyFactory)
+					: m_pPool(std::move(pPool))
+					, m_pValidationPolicy(policyFactory(*m_pPool))
+					, m_isReleased(false)
+			{}
+
 			~PoolValidationPolicyPair() {
 				stopAll();
 			}
@@ -464,4 +475,205 @@ namespace catapult { namespace validators {
 	}
 
 	// endregion
+
+	// region scratch policy
+
+	namespace {
+		constexpr auto Entity_Id_Notification = model::MakeNotificationType(
+				model::NotificationChannel::Validator,
+				model::FacilityCode::Core,
+				0xF1);
+		constexpr auto Excluded_Entity_Id_Notification = model::MakeNotificationType(
+				model::NotificationChannel::Validator,
+				model::FacilityCode::Core,
+				0xF2);
+		constexpr auto Observer_Entity_Id_Notification = model::MakeNotificationType(
+				model::NotificationChannel::Observer,
+				model::FacilityCode::Core,
+				0xF3);
+
+		struct EntityIdNotification : public model::Notification {
+		public:
+			EntityIdNotification(model::NotificationType type, uint64_t entityId)
+					: Notification(type, sizeof(EntityIdNotification))
+					, EntityId(entityId)
+			{}
+
+		public:
+			uint64_t EntityId;
+		};
+
+		class EntityIdNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				// Deadline is set in GenerateBlockWithTransactions and used as a unique entity id
+				auto entityId = entityInfo.cast<model::Transaction>().entity().Deadline.unwrap();
+				sub.notify(EntityIdNotification(Entity_Id_Notification, entityId));
+				sub.notify(EntityIdNotification(Excluded_Entity_Id_Notification, entityId));
+				sub.notify(EntityIdNotification(Observer_Entity_Id_Notification, entityId));
+				sub.notify(EntityIdNotification(Entity_Id_Notification, entityId));
+			}
+		};
+
+		class EntityIdValidator : public stateless::NotificationValidator {
+		public:
+			EntityIdValidator(const std::string& name, const std::set<uint64_t>& failedEntityIds, std::atomic<size_t>& numValidateCalls)
+					: m_name(name)
+					, m_failedEntityIds(failedEntityIds)
+					, m_numValidateCalls(numValidateCalls)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			ValidationResult validate(const model::Notification& notification) const override {
+				++m_numValidateCalls;
+
+				auto entityId = static_cast<const EntityIdNotification&>(notification).EntityId;
+				return m_failedEntityIds.cend() != m_failedEntityIds.find(entityId) ? ValidationResult::Failure : ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			std::set<uint64_t> m_failedEntityIds;
+			std::atomic<size_t>& m_numValidateCalls;
+		};
+
+		class ScratchPolicyTestContext {
+		public:
+			explicit ScratchPolicyTestContext(const std::set<uint64_t>& failedEntityIds = {}, uint32_t numThreads = 2)
+					: m_failedEntityIds(failedEntityIds)
+					, m_numFactoryCalls(0)
+					, m_numValidateCalls(0)
+					, m_pStatistics(std::make_shared<StatelessValidationStatistics>(std::vector<std::string>{ "alpha", "beta" }))
+					, m_policy(test::CreateStartedIoThreadPool(numThreads), [this](auto& pool) {
+						return CreateParallelValidationPolicy(
+								pool,
+								[this](const auto& decorator) { return createValidator(decorator); },
+								std::make_unique<EntityIdNotificationPublisher>(),
+								[](auto notificationType) { return Excluded_Entity_Id_Notification == notificationType; },
+								m_pStatistics);
+					})
+			{}
+
+		public:
+			const ParallelValidationPolicy& policy() {
+				return *m_policy;
+			}
+
+			size_t numFactoryCalls() const {
+				return m_numFactoryCalls;
+			}
+
+			size_t numValidateCalls() const {
+				return m_numValidateCalls;
+			}
+
+			const StatelessValidationStatistics& statistics() const {
+				return *m_pStatistics;
+			}
+
+		private:
+			std::unique_ptr<const stateless::AggregateNotificationValidator> createValidator(
+					const stateless::NotificationValidatorDecorator& decorator) {
+				++m_numFactoryCalls;
+
+				stateless::DemuxValidatorBuilder builder(decorator);
+				builder.add(std::make_unique<EntityIdValidator>("alpha", std::set<uint64_t>(), m_numValidateCalls));
+				builder.add(std::make_unique<EntityIdValidator>("beta", m_failedEntityIds, m_numValidateCalls));
+				return builder.build([](auto) { return false; });
+			}
+
+		private:
+			std::set<uint64_t> m_failedEntityIds;
+			std::atomic<size_t> m_numFactoryCalls;
+			std::atomic<size_t> m_numValidateCalls;
+			std::shared_ptr<StatelessValidationStatistics> m_pStatistics;
+			PoolValidationPolicyPair m_policy;
+		};
+	}
+
+	PARALLEL_POLICY_TEST(ScratchPolicyValidatesAllNonExcludedValidatorNotifications) {
+		// Arrange:
+		ScratchPolicyTestContext context;
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto result = TTraits::Validate(context.policy(), entityInfos.toVector()).get();
+
+		// Assert: two notifications per entity are validated by two validators
+		EXPECT_TRUE(TTraits::IsSuccess(result));
+		EXPECT_EQ(5u * 2 * 2, context.numValidateCalls());
+	}
+
+	PARALLEL_POLICY_TEST(ScratchPolicyReusesScratchAcrossBatches) {
+		// Arrange:
+		ScratchPolicyTestContext context;
+
+		// Act:
+		for (const auto& entityInfos : { test::CreateEntityInfos(1), test::CreateEntityInfos(3), test::CreateEntityInfos(8) })
+			TTraits::Validate(context.policy(), entityInfos.toVector()).get();
+
+		// Assert: one validator was created per worker thread
+		EXPECT_EQ(2u, context.numFactoryCalls());
+		EXPECT_EQ(12u * 2 * 2, context.numValidateCalls());
+	}
+
+	PARALLEL_POLICY_TEST(ScratchPolicyUpdatesStatistics) {
+		// Arrange:
+		ScratchPolicyTestContext context;
+
+		// Act:
+		for (const auto& entityInfos : { test::CreateEntityInfos(3), test::CreateEntityInfos(8) })
+			TTraits::Validate(context.policy(), entityInfos.toVector()).get();
+
+		// Assert:
+		const auto& statistics = context.statistics();
+		EXPECT_EQ(11u, statistics.numEntities());
+		EXPECT_LT(0u, statistics.elapsedTime().count() + statistics.entitiesPerSecond());
+
+		std::set<std::string> validatorNames;
+		for (const auto& validatorElapsedTime : statistics.validatorElapsedTimes())
+			validatorNames.insert(validatorElapsedTime.Name);
+
+		EXPECT_EQ(std::set<std::string>({ "alpha", "beta" }), validatorNames);
+	}
+
+	TEST(TEST_CLASS, ScratchPolicyShortCircuitsOnFailure_ShortCircuit) {
+		// Arrange:
+		ScratchPolicyTestContext context({ 1 }, 1);
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto result = ShortCircuitTraits::Validate(context.policy(), entityInfos.toVector()).get();
+
+		// Assert: validation of entity 1 short circuits after first failure and subsequent entities are skipped
+		EXPECT_EQ(ValidationResult::Failure, result);
+		EXPECT_EQ(2u * 2 + 2, context.numValidateCalls());
+		EXPECT_EQ(2u, context.statistics().numEntities());
+	}
+
+	TEST(TEST_CLASS, ScratchPolicyReturnsResultForEachEntity_All) {
+		// Arrange:
+		ScratchPolicyTestContext context({ 1, 3 });
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto results = AllTraits::Validate(context.policy(), entityInfos.toVector()).get();
+
+		// Assert:
+		auto expectedResults = std::vector<ValidationResult>{
+			ValidationResult::Success,
+			ValidationResult::Failure,
+			ValidationResult::Success,
+			ValidationResult::Failure,
+			ValidationResult::Success
+		};
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_EQ(5u, context.statistics().numEntities());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,144 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/validators/ProfilingNotificationValidator.h"
+#include "catapult/validators/ValidatorTypes.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/TaggedNotification.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/test/plugins/ValidatorTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS ProfilingNotificationValidatorTests
+
+	namespace {
+		auto CreateStatelessValidator(const std::string& name, ValidationResult result, std::vector<uint8_t>& breadcrumbs) {
+			using FunctionalValidator = stateless::FunctionalNotificationValidatorT<model::Notification>;
+			return std::make_unique<FunctionalValidator>(name, [result, &breadcrumbs](const auto& notification) {
+				breadcrumbs.push_back(static_cast<const test::TaggedNotification&>(notification).Tag);
+				return result;
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, DecoratorPreservesValidatorName) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingValidatorDecorator<>(profile, "stateless::");
+
+		// Act:
+		auto pValidator = decorator(CreateStatelessValidator("alpha", ValidationResult::Success, breadcrumbs));
+
+		// Assert:
+		EXPECT_EQ("alpha", pValidator->name());
+	}
+
+	TEST(TEST_CLASS, DecoratorCreatesProfileEntryWithPrefixedValidatorName) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingValidatorDecorator<>(profile, "stateless::");
+
+		// Act:
+		auto pValidator1 = decorator(CreateStatelessValidator("alpha", ValidationResult::Success, breadcrumbs));
+		auto pValidator2 = decorator(CreateStatelessValidator("beta", ValidationResult::Success, breadcrumbs));
+		auto pValidator3 = decorator(CreateStatelessValidator("alpha", ValidationResult::Success, breadcrumbs));
+
+		// Assert: validators with same name share a single entry
+		auto values = profile.values();
+		ASSERT_EQ(2u, values.size());
+		EXPECT_EQ("stateless::alpha", values[0].Name);
+		EXPECT_EQ("stateless::beta", values[1].Name);
+	}
+
+	TEST(TEST_CLASS, ValidateForwardsToDecoratedValidatorAndRecordsCall) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		std::vector<uint8_t> breadcrumbs;
+		auto decorator = CreateProfilingValidatorDecorator<>(profile, "");
+		auto pValidator = decorator(CreateStatelessValidator("alpha", ValidationResult::Neutral, breadcrumbs));
+
+		// Act:
+		auto result1 = test::ValidateNotification<model::Notification>(*pValidator, test::TaggedNotification(7));
+		auto result2 = test::ValidateNotification<model::Notification>(*pValidator, test::TaggedNotification(3));
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, result1);
+		EXPECT_EQ(ValidationResult::Neutral, result2);
+		EXPECT_EQ(std::vector<uint8_t>({ 7, 3 }), breadcrumbs);
+
+		auto values = profile.values();
+		ASSERT_EQ(1u, values.size());
+		EXPECT_EQ(2u, values[0].NumCalls);
+		EXPECT_LE(values[0].MaxElapsedNanoseconds, values[0].TotalElapsedNanoseconds);
+	}
+
+	TEST(TEST_CLASS, ValidateRecordsElapsedTime) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		auto decorator = CreateProfilingValidatorDecorator<>(profile, "");
+		auto pValidator = decorator(std::make_unique<stateless::FunctionalNotificationValidatorT<model::Notification>>(
+				"alpha",
+				[](const auto&) {
+					test::Sleep(5);
+					return ValidationResult::Success;
+				}));
+
+		// Act:
+		test::ValidateNotification<model::Notification>(*pValidator, test::TaggedNotification(7));
+
+		// Assert:
+		auto values = profile.values();
+		ASSERT_EQ(1u, values.size());
+		EXPECT_EQ(1u, values[0].NumCalls);
+		EXPECT_LE(5'000'000u, values[0].TotalElapsedNanoseconds);
+		EXPECT_EQ(values[0].TotalElapsedNanoseconds, values[0].MaxElapsedNanoseconds);
+	}
+
+	TEST(TEST_CLASS, ValidateForwardsContextToDecoratedStatefulValidator) {
+		// Arrange:
+		utils::ExecutionProfile profile;
+		Height contextHeight;
+		auto decorator = CreateProfilingValidatorDecorator<const ValidatorContext&>(profile, "stateful::");
+		auto pValidator = decorator(std::make_unique<stateful::FunctionalNotificationValidatorT<model::Notification>>(
+				"alpha",
+				[&contextHeight](const auto&, const auto& context) {
+					contextHeight = context.Height;
+					return ValidationResult::Failure;
+				}));
+
+		// Act:
+		auto cache = test::CreateEmptyCatapultCache();
+		auto result = test::ValidateNotification<model::Notification>(*pValidator, test::TaggedNotification(7), cache, Height(123));
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Failure, result);
+		EXPECT_EQ(Height(123), contextHeight);
+
+		auto values = profile.values();
+		ASSERT_EQ(1u, values.size());
+		EXPECT_EQ("stateful::alpha", values[0].Name);
+		EXPECT_EQ(1u, values[0].NumCalls);
+	}
+}}
@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/validators/StatelessValidationStatistics.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS StatelessValidationStatisticsTests
+
+	namespace {
+		using ValidatorElapsedTime = StatelessValidationStatistics::ValidatorElapsedTime;
+
+		void AssertValidatorElapsedTimes(
+				const std::vector<std::pair<std::string, uint64_t>>& expected,
+				const std::vector<ValidatorElapsedTime>& actual) {
+			ASSERT_EQ(expected.size(), actual.size());
+
+			for (auto i = 0u; i < expected.size(); ++i) {
+				EXPECT_EQ(expected[i].first, actual[i].Name) << "at " << i;
+				EXPECT_EQ(expected[i].second, static_cast<uint64_t>(actual[i].ElapsedTime.count())) << "at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateStatistics) {
+		// Act:
+		StatelessValidationStatistics statistics({ "alpha", "beta", "gamma" });
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "alpha", "beta", "gamma" }), statistics.validatorNames());
+		EXPECT_EQ(0u, statistics.numEntities());
+		EXPECT_EQ(std::chrono::microseconds(0), statistics.elapsedTime());
+		EXPECT_EQ(0u, statistics.entitiesPerSecond());
+		AssertValidatorElapsedTimes({ { "alpha", 0 }, { "beta", 0 }, { "gamma", 0 } }, statistics.validatorElapsedTimes());
+	}
+
+	TEST(TEST_CLASS, CanAddBatches) {
+		// Arrange:
+		StatelessValidationStatistics statistics({ "alpha" });
+
+		// Act:
+		statistics.addBatch(100, std::chrono::milliseconds(20));
+		statistics.addBatch(300, std::chrono::milliseconds(80));
+
+		// Assert:
+		EXPECT_EQ(400u, statistics.numEntities());
+		EXPECT_EQ(std::chrono::microseconds(100'000), statistics.elapsedTime());
+		EXPECT_EQ(4000u, statistics.entitiesPerSecond());
+	}
+
+	TEST(TEST_CLASS, CanAddValidatorElapsedTimes) {
+		// Arrange:
+		StatelessValidationStatistics statistics({ "alpha", "beta", "gamma" });
+
+		// Act:
+		statistics.addValidatorElapsedTimes({ std::chrono::microseconds(5), std::chrono::microseconds(7), std::chrono::microseconds(1) });
+		statistics.addValidatorElapsedTimes({ std::chrono::microseconds(6), std::chrono::microseconds(2), std::chrono::microseconds(9) });
+
+		// Assert: elapsed times are sorted by decreasing elapsed time
+		AssertValidatorElapsedTimes({ { "alpha", 11 }, { "gamma", 10 }, { "beta", 9 } }, statistics.validatorElapsedTimes());
+	}
+
+	TEST(TEST_CLASS, ValidatorElapsedTimesWithSameValuesPreserveRegistrationOrder) {
+		// Arrange:
+		StatelessValidationStatistics statistics({ "alpha", "beta", "gamma" });
+
+		// Act:
+		statistics.addValidatorElapsedTimes({ std::chrono::microseconds(3), std::chrono::microseconds(5), std::chrono::microseconds(3) });
+
+		// Assert:
+		AssertValidatorElapsedTimes({ { "beta", 5 }, { "alpha", 3 }, { "gamma", 3 } }, statistics.validatorElapsedTimes());
+	}
+
+	TEST(TEST_CLASS, CannotAddValidatorElapsedTimesWithWrongSize) {
+		// Arrange:
+		StatelessValidationStatistics statistics({ "alpha", "beta", "gamma" });
+
+		// Act + Assert:
+		EXPECT_THROW(
+				statistics.addValidatorElapsedTimes({ std::chrono::microseconds(5), std::chrono::microseconds(7) }),
+				catapult_invalid_argument);
+	}
+}}
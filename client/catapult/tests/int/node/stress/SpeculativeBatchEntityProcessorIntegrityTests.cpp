@@ -0,0 +1,288 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/extensions/ExecutionConfigurationFactory.h"
+#include "catapult/model/Elements.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/int/node/stress/test/BlockchainBuilder.h"
+#include "tests/int/node/stress/test/TransactionsBuilder.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/local/BlockStateHash.h"
+#include "tests/test/local/LocalTestUtils.h"
+#include "tests/test/nemesis/NemesisCompatibleConfiguration.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Nemesis.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS SpeculativeBatchEntityProcessorIntegrityTests
+
+	namespace {
+		using BlockchainBuilder = test::BlockchainBuilder;
+		using Blocks = BlockchainBuilder::Blocks;
+		using ValidationResults = std::vector<validators::ValidationResult>;
+
+		constexpr uint32_t Num_Speculation_Threads = 4;
+
+		// region ProcessorContext
+
+		struct BlockExecutionResult {
+			validators::ValidationResult Result;
+			Hash256 StateHash;
+		};
+
+		class ProcessorContext {
+		public:
+			ProcessorContext(const config::CatapultConfiguration& config, bool isSpeculative)
+					: m_pPluginManager(test::CreatePluginManagerWithRealPlugins(config))
+					, m_cache(m_pPluginManager->createCache())
+					, m_pPool(test::CreateStartedIoThreadPool(Num_Speculation_Threads))
+					, m_pStatistics(std::make_shared<chain::SpeculativeValidationStatistics>())
+					, m_executionConfig(extensions::CreateExecutionConfiguration(*m_pPluginManager))
+					, m_processor(isSpeculative
+							? chain::CreateSpeculativeBatchEntityProcessor(m_executionConfig, *m_pPool, m_pStatistics)
+							: chain::CreateBatchEntityProcessor(m_executionConfig)) {
+				// execute nemesis block
+				mocks::MockMemoryBlockStorage storage;
+				auto pNemesisBlock = storage.loadBlock(Height(1));
+				auto cacheDelta = m_cache.createDelta();
+				test::CalculateBlockStateHash(*pNemesisBlock, cacheDelta, *m_pPluginManager);
+				m_cache.commit(Height(1));
+			}
+
+		public:
+			const chain::SpeculativeValidationStatistics& statistics() const {
+				return *m_pStatistics;
+			}
+
+		public:
+			BlockExecutionResult execute(const model::Block& block) {
+				auto blockElement = test::BlockToBlockElement(block, test::GetNemesisGenerationHashSeed());
+				model::WeakEntityInfos entityInfos;
+				model::ExtractEntityInfos(blockElement, entityInfos);
+
+				auto cacheDelta = m_cache.createDelta();
+				auto observerState = observers::ObserverState(cacheDelta);
+				auto result = m_processor(block.Height, block.Timestamp, entityInfos, observerState);
+				auto stateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
+
+				// only commit valid blocks so that subsequent blocks are executed on top of the last valid state
+				if (validators::IsValidationResultSuccess(result))
+					m_cache.commit(block.Height);
+
+				return { result, stateHash };
+			}
+
+		private:
+			std::shared_ptr<plugins::PluginManager> m_pPluginManager;
+			cache::CatapultCache m_cache;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::shared_ptr<chain::SpeculativeValidationStatistics> m_pStatistics;
+			chain::ExecutionConfiguration m_executionConfig;
+			chain::BatchEntityProcessor m_processor;
+		};
+
+		// endregion
+
+		// region differential test utils
+
+		struct EquivalentExecutionResult {
+			ValidationResults Results;
+			uint64_t NumSpeculativeResults;
+			uint64_t NumReusedResults;
+		};
+
+		EquivalentExecutionResult AssertEquivalentExecution(const Blocks& blocks) {
+			// Arrange:
+			test::TempDirectoryGuard dataDirectoryGuard;
+			auto config = test::CreateCatapultConfigurationWithNemesisPluginExtensions(dataDirectoryGuard.name());
+			const_cast<model::BlockchainConfiguration&>(config.Blockchain).EnableVerifiableState = true;
+
+			ProcessorContext defaultContext(config, false);
+			ProcessorContext speculativeContext(config, true);
+
+			// Act:
+			ValidationResults results;
+			for (const auto& pBlock : blocks) {
+				auto expectedResult = defaultContext.execute(*pBlock);
+				auto result = speculativeContext.execute(*pBlock);
+
+				// Assert: both engines produce same results and state
+				EXPECT_EQ(expectedResult.Result, result.Result) << "at height " << pBlock->Height;
+				EXPECT_EQ(expectedResult.StateHash, result.StateHash) << "at height " << pBlock->Height;
+				EXPECT_NE(Hash256(), result.StateHash) << "at height " << pBlock->Height;
+				results.push_back(result.Result);
+			}
+
+			// - speculative validation was performed and never produced more reused results than speculative ones
+			const auto& statistics = speculativeContext.statistics();
+			EXPECT_LE(statistics.numReusedResults(), statistics.numSpeculativeResults());
+			return { results, statistics.numSpeculativeResults(), statistics.numReusedResults() };
+		}
+
+		class ChainBuilder {
+		public:
+			explicit ChainBuilder(const test::Accounts& accounts) : m_builder(accounts, m_stateHashCalculator)
+			{}
+
+		public:
+			const Blocks& blocks() const {
+				return m_blocks;
+			}
+
+		public:
+			void addBlock(const test::TransactionsBuilder& transactionsBuilder) {
+				// build all blocks on top of the previous (valid) block
+				auto builder = m_blocks.empty() ? m_builder : m_builder.createChainedBuilder(m_stateHashCalculator, *m_blocks.back());
+				m_blocks.push_back(utils::UniqueToShared(builder.asSingleBlock(transactionsBuilder)));
+			}
+
+		private:
+			test::StateHashCalculator m_stateHashCalculator; // state hashes are not calculated by builder
+			BlockchainBuilder m_builder;
+			Blocks m_blocks;
+		};
+
+		void AddFundingTransfers(test::TransactionsBuilder& transactionsBuilder, size_t numAccounts) {
+			for (auto i = 1u; i < numAccounts; ++i)
+				transactionsBuilder.addTransfer(0, i, Amount(1'000'000));
+		}
+
+		// endregion
+	}
+
+	// region transfers
+
+	NO_STRESS_TEST(TEST_CLASS, EnginesAreEquivalentForIndependentTransfers) {
+		// Arrange:
+		test::Accounts accounts(21);
+		ChainBuilder chainBuilder(accounts);
+
+		// - fund all accounts from nemesis (all transfers conflict)
+		test::TransactionsBuilder transactionsBuilder1(accounts);
+		AddFundingTransfers(transactionsBuilder1, 21);
+		chainBuilder.addBlock(transactionsBuilder1);
+
+		// - send from every funded account to a distinct account (no transfers conflict)
+		test::TransactionsBuilder transactionsBuilder2(accounts);
+		for (auto i = 1u; i <= 10; ++i)
+			transactionsBuilder2.addTransfer(i, i + 10, Amount(1'000 * i));
+
+		chainBuilder.addBlock(transactionsBuilder2);
+
+		// Act + Assert:
+		auto result = AssertEquivalentExecution(chainBuilder.blocks());
+		EXPECT_EQ(ValidationResults(2, validators::ValidationResult::Success), result.Results);
+
+		// - results of independent transfers were reused instead of being revalidated serially
+		EXPECT_LT(0u, result.NumSpeculativeResults);
+		EXPECT_LT(0u, result.NumReusedResults);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, EnginesAreEquivalentForDependentTransfers) {
+		// Arrange:
+		test::Accounts accounts(11);
+		ChainBuilder chainBuilder(accounts);
+
+		test::TransactionsBuilder transactionsBuilder1(accounts);
+		AddFundingTransfers(transactionsBuilder1, 11);
+		chainBuilder.addBlock(transactionsBuilder1);
+
+		// - forward funds along a chain of accounts (most transfers can only be funded by the previous one)
+		test::TransactionsBuilder transactionsBuilder2(accounts);
+		for (auto i = 1u; i < 10; ++i)
+			transactionsBuilder2.addTransfer(i, i + 1, Amount(500'000 * i));
+
+		chainBuilder.addBlock(transactionsBuilder2);
+
+		// Act + Assert:
+		auto result = AssertEquivalentExecution(chainBuilder.blocks());
+		EXPECT_EQ(ValidationResults(2, validators::ValidationResult::Success), result.Results);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, EnginesAreEquivalentForConflictingOverspend) {
+		// Arrange:
+		test::Accounts accounts(6);
+		ChainBuilder chainBuilder(accounts);
+
+		test::TransactionsBuilder transactionsBuilder1(accounts);
+		AddFundingTransfers(transactionsBuilder1, 6);
+		chainBuilder.addBlock(transactionsBuilder1);
+
+		// - each transfer is valid against the state at the start of the block, but the last one overspends
+		test::TransactionsBuilder transactionsBuilder2(accounts);
+		transactionsBuilder2.addTransfer(1, 2, Amount(600'000));
+		transactionsBuilder2.addTransfer(3, 4, Amount(600'000));
+		transactionsBuilder2.addTransfer(1, 5, Amount(600'000));
+		chainBuilder.addBlock(transactionsBuilder2);
+
+		// - independent transfers are still valid after the failed block
+		test::TransactionsBuilder transactionsBuilder3(accounts);
+		transactionsBuilder3.addTransfer(1, 2, Amount(600'000));
+		transactionsBuilder3.addTransfer(3, 4, Amount(600'000));
+		chainBuilder.addBlock(transactionsBuilder3);
+
+		// Act + Assert:
+		auto result = AssertEquivalentExecution(chainBuilder.blocks());
+		ASSERT_EQ(3u, result.Results.size());
+		EXPECT_EQ(validators::ValidationResult::Success, result.Results[0]);
+		EXPECT_FALSE(validators::IsValidationResultSuccess(result.Results[1]));
+		EXPECT_EQ(validators::ValidationResult::Success, result.Results[2]);
+	}
+
+	// endregion
+
+	// region namespaces and aliases
+
+	NO_STRESS_TEST(TEST_CLASS, EnginesAreEquivalentForAliasTransfers) {
+		// Arrange:
+		test::Accounts accounts(5);
+		ChainBuilder chainBuilder(accounts);
+
+		test::TransactionsBuilder transactionsBuilder1(accounts);
+		AddFundingTransfers(transactionsBuilder1, 5);
+		chainBuilder.addBlock(transactionsBuilder1);
+
+		// - register aliases in the middle of independent transfers (namespace notifications are speculation barriers)
+		test::TransactionsBuilder transactionsBuilder2(accounts);
+		transactionsBuilder2.addTransfer(1, 2, Amount(100));
+		transactionsBuilder2.addNamespace(0, "foo", BlockDuration(12), 3);
+		transactionsBuilder2.addTransfer(0, "foo", Amount(700'000));
+		transactionsBuilder2.addTransfer(4, 1, Amount(100));
+		chainBuilder.addBlock(transactionsBuilder2);
+
+		// - send via alias registered in the previous block
+		test::TransactionsBuilder transactionsBuilder3(accounts);
+		transactionsBuilder3.addTransfer(1, "foo", Amount(200));
+		transactionsBuilder3.addTransfer(2, 4, Amount(300));
+		chainBuilder.addBlock(transactionsBuilder3);
+
+		// Act + Assert:
+		auto result = AssertEquivalentExecution(chainBuilder.blocks());
+		EXPECT_EQ(ValidationResults(3, validators::ValidationResult::Success), result.Results);
+	}
+
+	// endregion
+}}
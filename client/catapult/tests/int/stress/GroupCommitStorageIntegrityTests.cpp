@@ -0,0 +1,229 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/AsyncBlockStorageWriter.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/int/stress/test/StressThreadLogger.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+#include <mutex>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS GroupCommitStorageIntegrityTests
+
+	namespace {
+		constexpr size_t Max_Blocks_Per_Batch = 40;
+
+		size_t GetNumIterations() {
+			return test::GetStressIterationCount() ? 2'000 : 100;
+		}
+
+		// region BlockElementsGenerator
+
+		class BlockElementsGenerator {
+		public:
+			BlockElementsGenerator() : m_nextHeight(Height(2))
+			{}
+
+		public:
+			Height nextHeight() const {
+				return m_nextHeight;
+			}
+
+			const Hash256& hashAt(Height height) const {
+				return m_hashes[(height - Height(2)).unwrap()];
+			}
+
+		public:
+			std::vector<std::shared_ptr<const model::BlockElement>> generate(size_t numBlocks) {
+				std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+				for (auto i = 0u; i < numBlocks; ++i) {
+					m_blocks.push_back(test::GenerateBlockWithTransactions(i % 3, m_nextHeight));
+					m_hashes.push_back(test::GenerateRandomByteArray<Hash256>());
+					auto blockElement = test::BlockToBlockElement(*m_blocks.back(), m_hashes.back());
+					blockElements.push_back(std::make_shared<model::BlockElement>(std::move(blockElement)));
+
+					m_nextHeight = m_nextHeight + Height(1);
+				}
+
+				return blockElements;
+			}
+
+		private:
+			Height m_nextHeight;
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+			std::vector<Hash256> m_hashes;
+		};
+
+		size_t NextBatchSize() {
+			return 1 + test::RandomByte() % Max_Blocks_Per_Batch;
+		}
+
+		// endregion
+
+		// region asserts
+
+		void AssertStorageContents(const std::string& directory, const BlockElementsGenerator& generator) {
+			// reopen the storage in order to only observe data that has been written to disk
+			FileBlockStorage storage(directory, test::File_Database_Batch_Size);
+
+			auto lastHeight = generator.nextHeight() - Height(1);
+			ASSERT_EQ(lastHeight, storage.chainHeight());
+
+			auto hashes = storage.loadHashesFrom(Height(2), lastHeight.unwrap());
+			ASSERT_EQ(lastHeight.unwrap() - 1, hashes.size());
+
+			auto height = Height(2);
+			for (const auto& hash : hashes) {
+				auto pBlockElement = storage.loadBlockElement(height);
+
+				EXPECT_EQ(height, pBlockElement->Block.Height);
+				EXPECT_EQ(generator.hashAt(height), pBlockElement->EntityHash) << "at " << height;
+				EXPECT_EQ(generator.hashAt(height), hash) << "at " << height;
+				height = height + Height(1);
+			}
+		}
+
+		// endregion
+	}
+
+	// region AsyncBlockStorageWriter
+
+	NO_STRESS_TEST(TEST_CLASS, WriterIsThreadSafeWithMultipleProducers) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		FileBlockStorage storage(tempDir.name(), test::File_Database_Batch_Size);
+		BlockElementsGenerator generator;
+		std::mutex generatorMutex;
+
+		// Act: producers queue batches of random sizes, which are coalesced into group commits by the writer
+		{
+			AsyncBlockStorageWriter writer(storage);
+
+			thread::ThreadGroup threads;
+			for (auto p = 0u; p < test::GetNumDefaultPoolThreads(); ++p) {
+				threads.spawn([&, p] {
+					test::StressThreadLogger logger("producer thread " + std::to_string(p));
+
+					for (auto i = 0u; i < GetNumIterations(); ++i) {
+						logger.notifyIteration(i, GetNumIterations());
+
+						// generate and queue under lock so that batches are queued in height order
+						std::lock_guard<std::mutex> lock(generatorMutex);
+						writer.saveBlocks(generator.generate(NextBatchSize()));
+					}
+				});
+			}
+
+			threads.join();
+			writer.flush();
+
+			// Sanity:
+			CATAPULT_LOG(debug) << "writer performed " << writer.numGroupCommits() << " group commits";
+			EXPECT_GE(test::GetNumDefaultPoolThreads() * GetNumIterations(), writer.numGroupCommits());
+		}
+
+		// Assert:
+		AssertStorageContents(tempDir.name(), generator);
+	}
+
+	// endregion
+
+	// region BlockStorageCache
+
+	NO_STRESS_TEST(TEST_CLASS, StorageIsThreadSafeWithMultipleReadersAndGroupCommitWriter) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto stagingDirectory = std::filesystem::path(tempDir.name()) / "staging";
+		std::filesystem::create_directory(stagingDirectory);
+
+		BlockStorageCache storage(
+				std::make_unique<FileBlockStorage>(tempDir.name(), test::File_Database_Batch_Size),
+				std::make_unique<FileBlockStorage>(
+						stagingDirectory.generic_string(),
+						test::File_Database_Batch_Size,
+						FileBlockStorageMode::None));
+
+		BlockElementsGenerator generator;
+		std::atomic_bool isWriterComplete(false);
+		std::atomic<size_t> numInconsistentReads(0);
+
+		// Act: set up reader threads that read the last block
+		thread::ThreadGroup threads;
+		for (auto r = 0u; r < test::GetNumDefaultPoolThreads(); ++r) {
+			threads.spawn([&, r] {
+				test::StressThreadLogger logger("reader thread " + std::to_string(r));
+
+				while (!isWriterComplete) {
+					auto view = storage.view();
+					auto chainHeight = view.chainHeight();
+					auto pBlockElement = view.loadBlockElement(chainHeight);
+					auto hashes = view.loadHashesFrom(chainHeight, 1);
+
+					// index must never be advanced past data that has not been written
+					if (chainHeight != pBlockElement->Block.Height || 1 != hashes.size() || pBlockElement->EntityHash != *hashes.cbegin())
+						++numInconsistentReads;
+				}
+			});
+		}
+
+		// - set up a writer thread that saves batches of random sizes and commits them
+		threads.spawn([&] {
+			test::StressThreadLogger logger("writer thread");
+
+			for (auto i = 0u; i < GetNumIterations(); ++i) {
+				logger.notifyIteration(i, GetNumIterations());
+
+				auto pendingBlockElements = generator.generate(NextBatchSize());
+				std::vector<model::BlockElement> blockElements;
+				for (const auto& pBlockElement : pendingBlockElements)
+					blockElements.push_back(*pBlockElement);
+
+				auto modifier = storage.modifier();
+				modifier.saveBlocks(blockElements);
+				modifier.commit();
+			}
+
+			isWriterComplete = true;
+		});
+
+		// - wait for all threads
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentReads);
+		EXPECT_EQ(generator.nextHeight() - Height(1), storage.view().chainHeight());
+		AssertStorageContents(tempDir.name(), generator);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,185 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/StackTimer.h"
+#include "tests/test/cache/AccountStateCacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS ParallelStateHashIntegrityTests
+
+	namespace {
+		constexpr auto Currency_Mosaic_Id = MosaicId(1234);
+
+		size_t GetNumStressAccounts() {
+			return test::GetStressIterationCount() ? 200'000 : 20'000;
+		}
+
+		template<typename TAction>
+		void RunTimedStressAction(const char* description, TAction action) {
+			CATAPULT_LOG(debug) << "START: " << description;
+
+			utils::StackTimer timer;
+			action();
+			auto elapsedMills = timer.millis();
+
+			CATAPULT_LOG(debug) << "  END: " << description << " - " << elapsedMills << "ms";
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(const std::string& directoryName)
+					: m_dbDirGuard(directoryName)
+					, m_cache(createCacheConfiguration(), test::CreateDefaultAccountStateCacheOptions(Currency_Mosaic_Id, MosaicId(2222)))
+			{}
+
+		public:
+			auto& cache() {
+				return m_cache;
+			}
+
+		private:
+			CacheConfiguration createCacheConfiguration() const {
+				auto cacheDatabaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+				cacheDatabaseConfig.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+				return CacheConfiguration(m_dbDirGuard.name(), cacheDatabaseConfig, PatriciaTreeStorageMode::Enabled);
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			AccountStateCache m_cache;
+		};
+
+		struct BatchOperations {
+			std::vector<Address> AddedAddresses;
+			std::vector<Address> ModifiedAddresses;
+			std::vector<Address> RemovedAddresses;
+		};
+
+		BatchOperations CreateBatchOperations(size_t numAdds, std::vector<Address>& knownAddresses) {
+			BatchOperations operations;
+			operations.AddedAddresses.resize(numAdds);
+			test::FillWithRandomData({
+				reinterpret_cast<uint8_t*>(operations.AddedAddresses.data()),
+				operations.AddedAddresses.size() * sizeof(Address)
+			});
+
+			// modify and remove some accounts added by previous batches
+			for (auto i = 0u; i < knownAddresses.size() / 10; ++i) {
+				auto index = test::Random() % knownAddresses.size();
+				if (0 == i % 2) {
+					operations.ModifiedAddresses.push_back(knownAddresses[index]);
+				} else {
+					operations.RemovedAddresses.push_back(knownAddresses[index]);
+					knownAddresses.erase(knownAddresses.begin() + static_cast<std::ptrdiff_t>(index));
+				}
+			}
+
+			// modified accounts must not be removed in same batch
+			for (const auto& address : operations.RemovedAddresses) {
+				auto iter = std::find(operations.ModifiedAddresses.begin(), operations.ModifiedAddresses.end(), address);
+				if (operations.ModifiedAddresses.end() != iter)
+					operations.ModifiedAddresses.erase(iter);
+			}
+
+			knownAddresses.insert(knownAddresses.end(), operations.AddedAddresses.cbegin(), operations.AddedAddresses.cend());
+			return operations;
+		}
+
+		void ApplyBatchOperations(AccountStateCacheDelta& delta, const BatchOperations& operations) {
+			for (const auto& address : operations.AddedAddresses)
+				delta.addAccount(address, Height(1));
+
+			for (const auto& address : operations.ModifiedAddresses)
+				delta.find(address).get().Balances.credit(Currency_Mosaic_Id, Amount(1));
+
+			for (const auto& address : operations.RemovedAddresses)
+				delta.queueRemove(address, Height(1));
+
+			delta.commitRemovals();
+		}
+
+		void AssertParallelMerkleRootMatchesSequentialMerkleRoot(size_t numBatches) {
+			// Arrange: create two db-backed account state caches
+			TestContext sequentialContext("seq");
+			TestContext parallelContext("par");
+
+			auto pPool = test::CreateStartedIoThreadPool();
+			std::vector<Address> knownAddresses;
+
+			for (auto i = 0u; i < numBatches; ++i) {
+				auto operations = CreateBatchOperations(GetNumStressAccounts() / numBatches, knownAddresses);
+
+				// Act: apply the same operations to both caches and calculate state hashes
+				Hash256 sequentialMerkleRoot;
+				{
+					auto delta = sequentialContext.cache().createDelta();
+					ApplyBatchOperations(*delta, operations);
+
+					RunTimedStressAction("calculating state hash sequentially", [&delta, i]() {
+						delta->updateMerkleRoot(Height(123 + i));
+					});
+
+					sequentialMerkleRoot = delta->tryGetMerkleRoot().first;
+					sequentialContext.cache().commit();
+				}
+
+				Hash256 parallelMerkleRoot;
+				{
+					auto delta = parallelContext.cache().createDelta();
+					ApplyBatchOperations(*delta, operations);
+
+					RunTimedStressAction("calculating state hash in parallel", [&delta, &pPool, i]() {
+						delta->updateMerkleRoot(Height(123 + i), *pPool);
+					});
+
+					parallelMerkleRoot = delta->tryGetMerkleRoot().first;
+					parallelContext.cache().commit();
+				}
+
+				// Assert:
+				EXPECT_NE(Hash256(), sequentialMerkleRoot) << "batch " << i;
+				EXPECT_EQ(sequentialMerkleRoot, parallelMerkleRoot) << "batch " << i;
+			}
+
+			// Assert: committed roots are equal
+			auto sequentialView = sequentialContext.cache().createView();
+			auto parallelView = parallelContext.cache().createView();
+			EXPECT_EQ(knownAddresses.size(), sequentialView->size());
+			EXPECT_EQ(knownAddresses.size(), parallelView->size());
+			EXPECT_EQ(sequentialView->tryGetMerkleRoot(), parallelView->tryGetMerkleRoot());
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, Stress_ParallelMerkleRootMatchesSequentialMerkleRoot) {
+		AssertParallelMerkleRootMatchesSequentialMerkleRoot(1);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, Stress_ParallelMerkleRootMatchesSequentialMerkleRoot_MultipleBatches) {
+		AssertParallelMerkleRootMatchesSequentialMerkleRoot(10);
+	}
+}}
@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
+#include "catapult/tree/BasePatriciaTree.h"
+#include "catapult/tree/MemoryDataSource.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/tree/PatriciaTreeTests.h"
 
@@ -62,4 +64,103 @@ namespace catapult { namespace tree {
 	}
 
 	DEFINE_PATRICIA_TREE_TESTS(RocksPatriciaTreeTraits)
+
+	// region random modifications
+
+	namespace {
+		// uses full 256-bit keys so that leaf paths span 64 nibbles
+		class HashKeyEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		template<typename TDataSource>
+		using HashKeyTree = BasePatriciaTree<HashKeyEncoder, TDataSource, utils::ArrayHasher<Hash256>>;
+
+		constexpr auto Num_Batches = 5u;
+
+		size_t GetNumModificationsPerBatch() {
+			return test::GetStressIterationCount() ? 20'000 : 2'000;
+		}
+
+		template<typename TMemoryDelta, typename TRdbDelta>
+		void ApplyRandomModifications(TMemoryDelta& memoryDelta, TRdbDelta& rdbDelta, std::vector<Hash256>& keys) {
+			for (auto i = 0u; i < GetNumModificationsPerBatch(); ++i) {
+				auto value = test::GenerateRandomByteArray<Hash256>();
+				auto keyIndex = keys.empty() ? 0 : static_cast<size_t>(test::Random() % keys.size());
+				switch (keys.empty() ? 0 : i % 4) {
+				case 1: // update existing key
+					memoryDelta.set(keys[keyIndex], value);
+					rdbDelta.set(keys[keyIndex], value);
+					break;
+
+				case 2: // remove existing key
+					memoryDelta.unset(keys[keyIndex]);
+					rdbDelta.unset(keys[keyIndex]);
+					keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(keyIndex));
+					break;
+
+				default: // add new key
+					keys.push_back(test::GenerateRandomByteArray<Hash256>());
+					memoryDelta.set(keys.back(), value);
+					rdbDelta.set(keys.back(), value);
+					break;
+				}
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, RdbBackedTreeHasSameRootsAsMemoryBackedTreeAcrossCommits) {
+		// Arrange:
+		MemoryDataSource memoryDataSource;
+		RocksPatriciaTreeTraits rdbTraits(DataSourceVerbosity::Off);
+		HashKeyTree<MemoryDataSource> memoryTree(memoryDataSource);
+		HashKeyTree<cache::PatriciaTreeRdbDataSource> rdbTree(rdbTraits.dataSource());
+
+		// Act: apply random modifications in batches, committing after each batch
+		std::vector<Hash256> keys;
+		for (auto i = 0u; i < Num_Batches; ++i) {
+			auto pMemoryDelta = memoryTree.rebase();
+			auto pRdbDelta = rdbTree.rebase();
+			ApplyRandomModifications(*pMemoryDelta, *pRdbDelta, keys);
+
+			// Assert: delta roots are equal before and after commit
+			EXPECT_EQ(pMemoryDelta->root(), pRdbDelta->root()) << "batch " << i;
+
+			memoryTree.commit();
+			rdbTree.commit();
+			EXPECT_EQ(memoryTree.root(), rdbTree.root()) << "batch " << i;
+		}
+
+		// Assert: proofs generated from a tree reloaded from rdb match proofs generated from memory
+		HashKeyTree<cache::PatriciaTreeRdbDataSource> reloadedTree(rdbTraits.dataSource(), rdbTree.root());
+		EXPECT_EQ(memoryTree.root(), reloadedTree.root());
+
+		for (auto i = 0u; i < keys.size(); i += 97) {
+			std::vector<TreeNode> memoryNodePath;
+			std::vector<TreeNode> rdbNodePath;
+			auto memoryResult = memoryTree.lookup(keys[i], memoryNodePath);
+			auto rdbResult = reloadedTree.lookup(keys[i], rdbNodePath);
+
+			EXPECT_TRUE(rdbResult.second) << "key at " << i;
+			EXPECT_EQ(memoryResult, rdbResult) << "key at " << i;
+			ASSERT_EQ(memoryNodePath.size(), rdbNodePath.size()) << "key at " << i;
+			for (auto j = 0u; j < memoryNodePath.size(); ++j) {
+				EXPECT_EQ(memoryNodePath[j].hash(), rdbNodePath[j].hash()) << "key at " << i << ", node at " << j;
+				EXPECT_EQ(memoryNodePath[j].path(), rdbNodePath[j].path()) << "key at " << i << ", node at " << j;
+			}
+		}
+	}
+
+	// endregion
 }}
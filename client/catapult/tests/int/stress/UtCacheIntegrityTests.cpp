@@ -0,0 +1,172 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/FeeUtils.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS UtCacheIntegrityTests
+
+	namespace {
+		constexpr auto Num_Shards = 8u;
+		constexpr auto Num_Readers = 4u;
+
+		uint64_t GetNumIterations() {
+			return test::GetStressIterationCount() ? 5'000 : 250;
+		}
+
+		// region view checks
+
+		template<typename TIsOrdered>
+		bool AssertFeeMultiplierOrdering(
+				const MemoryUtCacheView& view,
+				void (MemoryUtCacheView::*forEach)(const predicate<const model::TransactionInfo&>&) const,
+				TIsOrdered isOrdered) {
+			size_t count = 0;
+			auto isValid = true;
+			auto previousMultiplier = BlockFeeMultiplier();
+			(view.*forEach)([&count, &isValid, &previousMultiplier, isOrdered](const auto& transactionInfo) {
+				auto multiplier = model::CalculateTransactionMaxFeeMultiplier(*transactionInfo.pEntity);
+				if (0 != count && !isOrdered(previousMultiplier, multiplier))
+					isValid = false;
+
+				previousMultiplier = multiplier;
+				++count;
+				return true;
+			});
+
+			return isValid && view.size() == count;
+		}
+
+		bool AssertViewIsConsistent(const MemoryUtCacheView& view) {
+			// all transactions are added with increasing deadlines, so forEach (arrival order) must forward increasing deadlines
+			size_t count = 0;
+			auto isValid = true;
+			auto previousDeadline = Timestamp();
+			view.forEach([&view, &count, &isValid, &previousDeadline](const auto& transactionInfo) {
+				if (transactionInfo.pEntity->Deadline <= previousDeadline || !view.contains(transactionInfo.EntityHash))
+					isValid = false;
+
+				previousDeadline = transactionInfo.pEntity->Deadline;
+				++count;
+				return true;
+			});
+
+			return isValid
+					&& view.size() == count
+					&& view.shortHashes().size() == count
+					&& AssertFeeMultiplierOrdering(view, &MemoryUtCacheView::forEachByAscendingFeeMultiplier, std::less_equal<>())
+					&& AssertFeeMultiplierOrdering(view, &MemoryUtCacheView::forEachByDescendingFeeMultiplier, std::greater_equal<>());
+		}
+
+		// endregion
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ShardedCacheViewsAreConsistentWithConcurrentModifiers) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(GetNumIterations());
+		MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromKilobytes(1), utils::FileSize::FromMegabytes(100), Num_Shards));
+
+		std::atomic<size_t> numStartedReaders(0);
+		std::atomic<size_t> numAdded(0);
+		std::atomic_bool isAddingComplete(false);
+		std::atomic<size_t> numRemoved(0);
+		std::atomic<size_t> numViews(0);
+		std::atomic<size_t> numInconsistentViews(0);
+
+		// Act:
+		thread::ThreadGroup threads;
+
+		// - simulate tx dispatcher adding transactions one at a time
+		threads.spawn([&cache, &transactionInfos, &numStartedReaders, &numAdded, &isAddingComplete] {
+			// wait for all readers so that adds overlap with views
+			while (Num_Readers != numStartedReaders)
+				std::this_thread::yield();
+
+			for (const auto& transactionInfo : transactionInfos) {
+				cache.modifier().add(transactionInfo);
+				++numAdded;
+				std::this_thread::yield();
+			}
+
+			isAddingComplete = true;
+		});
+
+		// - simulate block dispatcher removing confirmed transactions and rebasing all others
+		threads.spawn([&cache, &numAdded, &isAddingComplete, &numRemoved] {
+			size_t numAddedAtLastRebase = 0;
+			do {
+				// simulate a new block after every ten transactions
+				if (numAdded < numAddedAtLastRebase + 10 && !isAddingComplete) {
+					std::this_thread::yield();
+					continue;
+				}
+
+				numAddedAtLastRebase = numAdded;
+				{
+					auto modifier = cache.modifier();
+					auto removedTransactionInfos = modifier.removeAll();
+					for (auto i = 0u; i < removedTransactionInfos.size(); ++i) {
+						// drop oldest transaction as confirmed
+						if (0 == i)
+							++numRemoved;
+						else
+							modifier.add(removedTransactionInfos[i]);
+					}
+
+					// remove newest transaction outside of rebase
+					if (1 < removedTransactionInfos.size() && modifier.remove(removedTransactionInfos.back().EntityHash).pEntity)
+						++numRemoved;
+				}
+			} while (!isAddingComplete);
+		});
+
+		// - simulate readers (e.g. harvester, unconfirmed transactions requests) checking view consistency
+		for (auto r = 0u; r < Num_Readers; ++r) {
+			threads.spawn([&cache, &numStartedReaders, &isAddingComplete, &numViews, &numInconsistentViews] {
+				++numStartedReaders;
+				do {
+					if (!AssertViewIsConsistent(cache.view()))
+						++numInconsistentViews;
+
+					++numViews;
+				} while (!isAddingComplete);
+			});
+		}
+
+		// - wait for all threads
+		threads.join();
+		CATAPULT_LOG(debug) << "checked " << numViews << " views (" << numRemoved << " transactions removed)";
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentViews);
+		EXPECT_LE(Num_Readers, numViews);
+
+		auto view = cache.view();
+		EXPECT_EQ(GetNumIterations() - numRemoved, view.size());
+		EXPECT_TRUE(AssertViewIsConsistent(view));
+	}
+}}
@@ -64,6 +64,11 @@ namespace catapult { namespace test {
 			CATAPULT_THROW_RUNTIME_ERROR("updateMerkleRoot is not supported");
 		}
 
+		[[noreturn]]
+		void updateMerkleRoot(Height, thread::IoThreadPool&) override {
+			CATAPULT_THROW_RUNTIME_ERROR("updateMerkleRoot is not supported");
+		}
+
 		[[noreturn]]
 		void prune(Height) override {
 			CATAPULT_THROW_RUNTIME_ERROR("prune is not supported");
@@ -415,6 +415,43 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region saveBlocks
+
+		static void AssertSavingZeroBlocksDoesNotAlterChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			pStorage->saveBlocks({});
+
+			// Assert:
+			EXPECT_EQ(Height(10), pStorage->chainHeight());
+		}
+
+		static void AssertCannotSaveBlocksMoreThanOneHeightBeyondChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto pBlock1 = GenerateBlockWithTransactions(5, Height(12));
+			auto pBlock2 = GenerateBlockWithTransactions(5, Height(13));
+
+			// Act + Assert:
+			EXPECT_THROW(pStorage->saveBlocks({ BlockToBlockElement(*pBlock1), BlockToBlockElement(*pBlock2) }), catapult_invalid_argument);
+			EXPECT_EQ(Height(10), pStorage->chainHeight());
+		}
+
+		static void AssertCannotSaveBlocksWithNonconsecutiveHeights() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto pBlock1 = GenerateBlockWithTransactions(5, Height(11));
+			auto pBlock2 = GenerateBlockWithTransactions(5, Height(13));
+
+			// Act + Assert: storages are allowed to save a prefix of the blocks, but never the block after the gap
+			EXPECT_THROW(pStorage->saveBlocks({ BlockToBlockElement(*pBlock1), BlockToBlockElement(*pBlock2) }), catapult_invalid_argument);
+			EXPECT_GE(Height(11), pStorage->chainHeight());
+		}
+
+		// endregion
+
 		// region dropBlocksAfter
 
 		static void AssertCanDropBlocksAfterHeight() {
@@ -475,6 +512,79 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region findHeight
+
+	private:
+		static void AssertCanFindHeights(const io::BlockStorage& storage, Height startHeight, Height endHeight) {
+			auto hashes = storage.loadHashesFrom(startHeight, (endHeight - startHeight).unwrap() + 1);
+			auto height = startHeight;
+			for (const auto& hash : hashes) {
+				EXPECT_EQ(height, storage.findHeight(hash)) << "at " << height;
+				height = height + Height(1);
+			}
+		}
+
+	public:
+		static void AssertFindHeight_CanFindAllSavedBlocks() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act + Assert:
+			AssertCanFindHeights(*pStorage, Height(1), Height(10));
+		}
+
+		static void AssertFindHeight_ReturnsZeroWhenHashIsUnknown() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto height = pStorage->findHeight(GenerateRandomByteArray<Hash256>());
+
+			// Assert:
+			EXPECT_EQ(Height(0), height);
+		}
+
+		static void AssertFindHeight_ReturnsZeroWhenBlockIsDropped() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto droppedHashes = pStorage->loadHashesFrom(Height(7), 4);
+
+			// Act:
+			pStorage->dropBlocksAfter(Height(6));
+
+			// Assert:
+			AssertCanFindHeights(*pStorage, Height(1), Height(6));
+			for (const auto& hash : droppedHashes)
+				EXPECT_EQ(Height(0), pStorage->findHeight(hash));
+		}
+
+		static void AssertFindHeight_CanFindBlocksSavedAfterDrop() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto droppedHashes = pStorage->loadHashesFrom(Height(7), 4);
+
+			// Act:
+			pStorage->dropBlocksAfter(Height(6));
+
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<model::BlockElement> blockElements;
+			for (auto height = Height(7); height <= Height(8); height = height + Height(1)) {
+				blocks.push_back(GenerateBlockWithTransactions(5, height));
+				blockElements.push_back(CreateBlockElementForSaveTests(*blocks.back()));
+			}
+
+			pStorage->saveBlocks(blockElements);
+
+			// Assert:
+			AssertCanFindHeights(*pStorage, Height(1), Height(8));
+			EXPECT_EQ(Height(7), pStorage->findHeight(blockElements[0].EntityHash));
+			EXPECT_EQ(Height(8), pStorage->findHeight(blockElements[1].EntityHash));
+			for (const auto& hash : droppedHashes)
+				EXPECT_EQ(Height(0), pStorage->findHeight(hash));
+		}
+
+		// endregion
+
 		// region loadBlockElement - nemesis
 
 		static void AssertStorageSeedInitiallyContainsNemesisBlock() {
@@ -592,6 +702,34 @@ namespace catapult { namespace test {
 			TLoadTraits::Assert(blockElement2, result2);
 		}
 
+
+		template<typename TLoadTraits>
+		static void AssertCanLoadMultipleSavedTogether() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(5);
+
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<model::BlockElement> blockElements;
+			for (auto i = 0u; i < 4; ++i) {
+				blocks.push_back(GenerateBlockWithTransactions(5, Height(6 + i)));
+
+				// only save statements with the first two blocks
+				const auto& block = *blocks.back();
+				auto hash = GenerateRandomByteArray<Hash256>();
+				blockElements.push_back(i < 2 ? BlockToBlockElementWithStatements(block, hash) : BlockToBlockElement(block, hash));
+			}
+
+			pStorage->saveBlocks(blockElements);
+
+			// Act + Assert:
+			EXPECT_EQ(Height(9), pStorage->chainHeight());
+
+			for (const auto& blockElement : blockElements) {
+				auto result = TLoadTraits::Load(*pStorage, blockElement.Block.Height);
+				TLoadTraits::Assert(blockElement, result);
+			}
+		}
+
 		// endregion
 
 		// region purge
@@ -665,17 +803,27 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlockAtChainHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlockMoreThanOneHeightBeyondChainHeight) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, SavingZeroBlocksDoesNotAlterChainHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlocksMoreThanOneHeightBeyondChainHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotSaveBlocksWithNonconsecutiveHeights) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeightAndSaveBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropAllBlocks) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, FindHeight_CanFindAllSavedBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, FindHeight_ReturnsZeroWhenHashIsUnknown) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, FindHeight_ReturnsZeroWhenBlockIsDropped) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, FindHeight_CanFindBlocksSavedAfterDrop) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, StorageSeedInitiallyContainsNemesisBlock) \
 	\
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtHeightLessThanChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CannotLoadAtHeightGreaterThanChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSaved) \
-	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSavedWithoutStatements)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSavedWithoutStatements) \
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSavedTogether)
 
 #define DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(TRAITS_NAME) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, PurgeDestroysStorage) \
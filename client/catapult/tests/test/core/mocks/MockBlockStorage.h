@@ -45,6 +45,10 @@ namespace catapult { namespace mocks {
 			CATAPULT_THROW_RUNTIME_ERROR("dropBlocksAfter - not supported in mock");
 		}
 
+		Height findHeight(const Hash256&) const override {
+			CATAPULT_THROW_RUNTIME_ERROR("findHeight - not supported in mock");
+		}
+
 		std::shared_ptr<const model::Block> loadBlock(Height) const override {
 			CATAPULT_THROW_RUNTIME_ERROR("loadBlock - not supported in mock");
 		}
@@ -72,6 +72,7 @@ namespace catapult { namespace test {
 
 			config.BlockDisruptorSlotCount = 4 * 1024;
 			config.BlockDisruptorMaxMemorySize = utils::FileSize::FromMegabytes(100);
+			config.BlockStreamingSignatureBatchSize = 0;
 
 			config.TransactionDisruptorSlotCount = 16 * 1024;
 			config.TransactionDisruptorMaxMemorySize = utils::FileSize::FromMegabytes(100);
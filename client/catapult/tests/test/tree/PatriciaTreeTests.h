@@ -23,6 +23,7 @@
 #include "PassThroughEncoder.h"
 #include "catapult/tree/DataSourceVerbosity.h"
 #include "catapult/tree/PatriciaTree.h"
+#include "catapult/utils/Hashers.h"
 #include "tests/TestHarness.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -1399,6 +1400,172 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region lookup (batch)
+
+	private:
+		template<typename TTree>
+		static void AssertBatchLookup(
+				const TTree& tree,
+				const std::vector<uint32_t>& keys,
+				const std::unordered_map<uint32_t, std::string>& expectedLeaves) {
+			// Act:
+			tree::PatriciaTreeMultiProof proof;
+			auto results = tree.lookup(keys, proof);
+
+			// Assert:
+			ASSERT_EQ(keys.size(), results.size());
+			ASSERT_EQ(keys.size(), proof.Paths.size());
+			for (auto i = 0u; i < keys.size(); ++i) {
+				auto message = "key at " + std::to_string(i);
+				auto expectedLeafIter = expectedLeaves.find(keys[i]);
+				auto isExpectedPresent = expectedLeaves.cend() != expectedLeafIter;
+				auto expectedValue = isExpectedPresent ? PassThroughEncoder::EncodeValue(expectedLeafIter->second) : Hash256();
+
+				// - check the lookup result
+				EXPECT_EQ(isExpectedPresent, results[i].second) << message;
+				EXPECT_EQ(expectedValue, results[i].first) << message;
+
+				// - check that the proof is verifiable
+				Hash256 value;
+				auto verificationResult = tree::VerifyMultiProofPath(proof, i, tree::TreeNodePath(keys[i]), tree.root(), value);
+				if (isExpectedPresent) {
+					EXPECT_EQ(tree::ProofVerificationResult::Present, verificationResult) << message;
+					EXPECT_EQ(expectedValue, value) << message;
+				} else {
+					EXPECT_EQ(tree::ProofVerificationResult::Absent, verificationResult) << message;
+				}
+
+				// - check that all nodes shared with the single key proof are identical
+				std::vector<tree::TreeNode> nodePath;
+				tree.lookup(keys[i], nodePath);
+				ASSERT_GE(nodePath.size(), proof.Paths[i].size()) << message;
+				for (auto j = 0u; j < proof.Paths[i].size(); ++j)
+					EXPECT_EQ(nodePath[j].hash(), proof.Nodes[proof.Paths[i][j]].hash()) << message << " at node " << j;
+			}
+
+			// - check that all nodes are distinct
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> nodeHashes;
+			for (const auto& node : proof.Nodes)
+				nodeHashes.insert(node.hash());
+
+			EXPECT_EQ(proof.Nodes.size(), nodeHashes.size());
+		}
+
+		static std::unordered_map<uint32_t, std::string> SeedPuppyTreeWithRootExtensionNode(
+				tree::PatriciaTree<PassThroughEncoder, DataSource>& tree) {
+			std::unordered_map<uint32_t, std::string> leaves{
+				{ 0x64'6F'00'00, "verb" },
+				{ 0x64'6F'67'00, "puppy" },
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x64'6F'72'73, "stallion" }
+			};
+
+			for (const auto& pair : leaves)
+				tree.set(pair.first, pair.second);
+
+			return leaves;
+		}
+
+	public:
+		static void AssertLookupBatchFailsWhenTreeIsEmpty() {
+			// Arrange:
+			TestContext context;
+
+			// Act:
+			tree::PatriciaTreeMultiProof proof;
+			auto results = context.tree().lookup({ 0x64'6F'67'00, 0x64'6F'67'65 }, proof);
+
+			// Assert:
+			ASSERT_EQ(2u, results.size());
+			EXPECT_FALSE(results[0].second);
+			EXPECT_FALSE(results[1].second);
+
+			EXPECT_TRUE(proof.Nodes.empty());
+			ASSERT_EQ(2u, proof.Paths.size());
+			EXPECT_TRUE(proof.Paths[0].empty());
+			EXPECT_TRUE(proof.Paths[1].empty());
+
+			AssertBatchLookup(context.tree(), { 0x64'6F'67'00, 0x64'6F'67'65 }, {});
+		}
+
+		static void AssertLookupBatchSucceedsWhenKeyIsTreeRoot() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x65'43'22'10, "alpha");
+
+			// Act + Assert:
+			AssertBatchLookup(context.tree(), { 0x65'43'22'10, 0x65'43'22'11 }, { { 0x65'43'22'10, "alpha" } });
+		}
+
+		static void AssertLookupBatchSucceedsWhenKeysAreInTree() {
+			// Arrange:
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+
+			// Act + Assert:
+			AssertBatchLookup(context.tree(), { 0x64'6F'67'65, 0x64'6F'00'00, 0x64'6F'72'73, 0x64'6F'67'00 }, leaves);
+		}
+
+		static void AssertLookupBatchFailsWhenKeysAreNotInTree() {
+			// Arrange: keys diverge from root extension, diverge from inner branch, have unset link and diverge from leaf
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+
+			// Act + Assert:
+			AssertBatchLookup(context.tree(), { 0x54'6F'67'00, 0x64'6F'67'44, 0x64'6F'99'65, 0x64'6F'72'74 }, leaves);
+		}
+
+		static void AssertLookupBatchCanMixFoundAndNotFoundKeys() {
+			// Arrange:
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+
+			// Act + Assert:
+			AssertBatchLookup(context.tree(), { 0x64'6F'72'73, 0x54'6F'67'00, 0x64'6F'67'00, 0x64'6F'67'44, 0x64'6F'00'00 }, leaves);
+		}
+
+		static void AssertLookupBatchSupportsDuplicateKeys() {
+			// Arrange:
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+
+			// Act + Assert:
+			AssertBatchLookup(context.tree(), { 0x64'6F'67'00, 0x64'6F'67'44, 0x64'6F'67'00, 0x64'6F'67'44 }, leaves);
+		}
+
+		static void AssertLookupBatchIncludesSharedNodesOnce() {
+			// Arrange:
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+
+			// Act:
+			tree::PatriciaTreeMultiProof proof;
+			context.tree().lookup({ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x64'6F'72'73 }, proof);
+
+			// Assert: root extension, inner branch and four leaves
+			EXPECT_EQ(6u, proof.Nodes.size());
+			ASSERT_EQ(4u, proof.Paths.size());
+			EXPECT_EQ(std::vector<uint32_t>({ 0, 1 }), proof.Paths[0]);
+			EXPECT_EQ(std::vector<uint32_t>({ 0, 2, 3 }), proof.Paths[1]);
+			EXPECT_EQ(std::vector<uint32_t>({ 0, 2, 4 }), proof.Paths[2]);
+			EXPECT_EQ(std::vector<uint32_t>({ 0, 5 }), proof.Paths[3]);
+		}
+
+		static void AssertLookupBatchCanLookupKeysInLoadedTree() {
+			// Arrange: save a tree and load it around its root hash so that all nodes are loaded from the data source
+			TestContext context;
+			auto leaves = SeedPuppyTreeWithRootExtensionNode(context.tree());
+			context.tree().saveAll();
+
+			tree::PatriciaTree<PassThroughEncoder, DataSource> loadedTree(context.dataSource());
+			ASSERT_TRUE(loadedTree.tryLoad(context.tree().root()));
+
+			// Act + Assert:
+			AssertBatchLookup(loadedTree, { 0x64'6F'72'73, 0x54'6F'67'00, 0x64'6F'67'00, 0x64'6F'67'44, 0x64'6F'00'00 }, leaves);
+		}
+
+		// endregion
+
 		// region any order tests
 
 	private:
@@ -1595,6 +1762,368 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region apply
+
+	private:
+		using ModificationPairs = std::vector<std::pair<uint32_t, std::string>>;
+
+		static ModificationPairs GetPuppyTreeWithRootBranchNodePairs() {
+			return {
+				{ 0x64'6F'00'00, "verb" },
+				{ 0x64'6F'67'00, "puppy" },
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x7A'6F'72'73, "stallion" }
+			};
+		}
+
+		template<typename TTree>
+		static void SetAll(TTree& tree, const ModificationPairs& pairs) {
+			// empty value indicates removal
+			for (const auto& pair : pairs) {
+				if (pair.second.empty())
+					tree.unset(pair.first);
+				else
+					tree.set(pair.first, pair.second);
+			}
+		}
+
+		template<typename TTree>
+		static std::vector<std::vector<size_t>> ApplyAll(TTree& tree, const ModificationPairs& pairs) {
+			std::vector<typename TTree::Modification> modifications;
+			for (const auto& pair : pairs)
+				modifications.push_back({ &pair.first, pair.second.empty() ? nullptr : &pair.second });
+
+			std::vector<std::vector<size_t>> capturedBranchIndexes;
+			tree.apply(modifications, [&capturedBranchIndexes](const auto& branchIndexes, const auto& updateBranch) {
+				capturedBranchIndexes.push_back(branchIndexes);
+
+				// update branches in reverse order to check that branches are independent
+				for (auto iter = branchIndexes.crbegin(); branchIndexes.crend() != iter; ++iter)
+					updateBranch(*iter);
+			});
+
+			return capturedBranchIndexes;
+		}
+
+		static Hash256 CalculateExpectedHashForApply(const ModificationPairs& initialPairs, const ModificationPairs& pairs) {
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), initialPairs);
+			SetAll(context.tree(), pairs);
+			return context.tree().root();
+		}
+
+		static void AssertApply(
+				const ModificationPairs& initialPairs,
+				const ModificationPairs& pairs,
+				const std::vector<std::vector<size_t>>& expectedBranchIndexes) {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForApply(initialPairs, pairs);
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), initialPairs);
+
+			// Act:
+			auto capturedBranchIndexes = ApplyAll(context.tree(), pairs);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+			EXPECT_EQ(expectedBranchIndexes, capturedBranchIndexes);
+		}
+
+	public:
+		static void AssertApplyDoesNotPartitionModificationsWhenTreeIsEmpty() {
+			AssertApply({}, GetPuppyTreeWithRootBranchNodePairs(), {});
+		}
+
+		static void AssertApplyDoesNotPartitionModificationsWhenRootIsNotBranchNode() {
+			AssertApply(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x64'6F'67'01, "random" },
+				{ 0x64'6F'00'00, "" },
+				{ 0x12'34'56'78, "beta" }
+			}, {});
+		}
+
+		static void AssertApplyCanModifyTreeWithRootBranchNode() {
+			AssertApply(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'67'01, "random" },
+				{ 0x7A'6F'72'73, "" },
+				{ 0x12'34'56'78, "beta" },
+				{ 0x64'6F'67'00, "kitten" },
+				{ 0x7A'00'00'00, "alpha" }
+			}, { { 1, 6, 7 } });
+		}
+
+		static void AssertApplyCanCollapseRootBranchNodeIntoExtensionNode() {
+			// Arrange:
+			TestContext context;
+			SetAll(context.tree(), GetPuppyTreeWithRootBranchNodePairs());
+
+			// Act:
+			auto capturedBranchIndexes = ApplyAll(context.tree(), { { 0x7A'6F'72'73, "" } });
+
+			// Assert:
+			auto checker = CreateCheckerForCanCreatePuppyTreeWithRootBranchNode(context.dataSource());
+			EXPECT_EQ(checker.get("root0"), context.tree().root());
+			EXPECT_EQ(std::vector<std::vector<size_t>>({ { 7 } }), capturedBranchIndexes);
+		}
+
+		static void AssertApplyCanCollapseRootBranchNodeIntoLeafNode() {
+			AssertApply(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'00'00, "" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "" }
+			}, { { 6 } });
+		}
+
+		static void AssertApplyCanRemoveAllValuesFromTreeWithRootBranchNode() {
+			// Arrange:
+			TestContext context;
+			SetAll(context.tree(), GetPuppyTreeWithRootBranchNodePairs());
+
+			// Act:
+			auto capturedBranchIndexes = ApplyAll(context.tree(), {
+				{ 0x64'6F'00'00, "" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "" },
+				{ 0x7A'6F'72'73, "" }
+			});
+
+			// Assert:
+			EXPECT_EQ(Hash256(), context.tree().root());
+			EXPECT_EQ(std::vector<std::vector<size_t>>({ { 6, 7 } }), capturedBranchIndexes);
+		}
+
+		static void AssertApplyIgnoresRemovalOfUnknownKeys() {
+			AssertApply(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'67'01, "" },
+				{ 0x12'34'56'78, "" }
+			}, { { 1, 6 } });
+		}
+
+		static void AssertApplyOnlyAppliesLastModificationOfKey() {
+			// Arrange: set, unset and set existing and new keys within a single batch
+			auto expectedHash = CalculateExpectedHashForApply(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'67'00, "lion" },
+				{ 0x12'34'56'78, "gamma" }
+			});
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), GetPuppyTreeWithRootBranchNodePairs());
+
+			// Act:
+			auto capturedBranchIndexes = ApplyAll(context.tree(), {
+				{ 0x64'6F'67'00, "kitten" },
+				{ 0x12'34'56'78, "beta" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x12'34'56'78, "" },
+				{ 0x64'6F'67'00, "lion" },
+				{ 0x12'34'56'78, "gamma" }
+			});
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+			EXPECT_EQ(std::vector<std::vector<size_t>>({ { 1, 6 } }), capturedBranchIndexes);
+		}
+
+		static void AssertApplyCanModifyLoadedTree() {
+			// Arrange:
+			auto pairs = ModificationPairs{ { 0x64'6F'67'01, "random" }, { 0x7A'6F'72'73, "" }, { 0x12'34'56'78, "beta" } };
+			auto expectedHash = CalculateExpectedHashForApply(GetPuppyTreeWithRootBranchNodePairs(), pairs);
+
+			RunLoadTest([&pairs, &expectedHash](auto& tree, auto&& checker) {
+				EXPECT_TRUE(tree.tryLoad(checker.get("root")));
+
+				// Act:
+				auto capturedBranchIndexes = ApplyAll(tree, pairs);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, tree.root());
+				EXPECT_EQ(std::vector<std::vector<size_t>>({ { 1, 6, 7 } }), capturedBranchIndexes);
+			});
+		}
+
+		// endregion
+
+		// region apply (batch)
+
+	private:
+		template<typename TTree>
+		static void ApplyAllAsBatch(TTree& tree, const ModificationPairs& pairs) {
+			std::vector<typename TTree::Modification> modifications;
+			for (const auto& pair : pairs)
+				modifications.push_back({ &pair.first, pair.second.empty() ? nullptr : &pair.second });
+
+			tree.apply(modifications);
+		}
+
+		static void AssertApplyBatch(const ModificationPairs& initialPairs, const ModificationPairs& pairs) {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForApply(initialPairs, pairs);
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), initialPairs);
+
+			// Act:
+			ApplyAllAsBatch(context.tree(), pairs);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+	public:
+		static void AssertApplyBatchCanCreateTreeFromEmptyTree() {
+			// Arrange:
+			TestContext context;
+
+			// Act:
+			ApplyAllAsBatch(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+
+			// Assert:
+			auto checker = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource());
+			EXPECT_EQ(checker.get("root"), context.tree().root());
+		}
+
+		static void AssertApplyBatchCanModifyTreeWithRootBranchNode() {
+			AssertApplyBatch(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'67'01, "random" },
+				{ 0x7A'6F'72'73, "" },
+				{ 0x12'34'56'78, "beta" },
+				{ 0x64'6F'67'00, "kitten" },
+				{ 0x7A'00'00'00, "alpha" }
+			});
+		}
+
+		static void AssertApplyBatchCanSplitRootExtensionNode() {
+			AssertApplyBatch(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x64'6F'67'01, "random" },
+				{ 0x64'6F'00'00, "" },
+				{ 0x12'34'56'78, "beta" },
+				{ 0x64'00'00'00, "gamma" }
+			});
+		}
+
+		static void AssertApplyBatchCanSplitRootLeafNode() {
+			AssertApplyBatch({ { 0x64'6F'67'00, "puppy" } }, {
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x64'6F'00'00, "verb" }
+			});
+		}
+
+		static void AssertApplyBatchCanCollapseRootBranchNodeIntoLeafNode() {
+			AssertApplyBatch(GetPuppyTreeWithRootBranchNodePairs(), {
+				{ 0x64'6F'00'00, "" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "" }
+			});
+		}
+
+		static void AssertApplyBatchCanRemoveAllValues() {
+			// Arrange:
+			TestContext context;
+			SetAll(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+
+			// Act:
+			ApplyAllAsBatch(context.tree(), {
+				{ 0x64'6F'00'00, "" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "" },
+				{ 0x68'6F'72'73, "" }
+			});
+
+			// Assert:
+			EXPECT_EQ(Hash256(), context.tree().root());
+		}
+
+		static void AssertApplyBatchIgnoresRemovalOfUnknownKeys() {
+			// Arrange:
+			TestContext context;
+			SetAll(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+			auto expectedHash = context.tree().root();
+
+			// Act:
+			ApplyAllAsBatch(context.tree(), { { 0x64'6F'67'01, "" }, { 0x64'6F'00'01, "" }, { 0x12'34'56'78, "" } });
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertApplyBatchOnlyAppliesLastModificationOfKey() {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForApply(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "kitten" }
+			});
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+
+			// Act:
+			ApplyAllAsBatch(context.tree(), {
+				{ 0x64'6F'67'00, "alpha" },
+				{ 0x64'6F'67'65, "" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x64'6F'67'65, "kitten" }
+			});
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertApplyBatchOnlyAppliesLastModificationOfRepeatedlySetKey() {
+			// Arrange:
+			auto expectedHash = CalculateExpectedHashForApply(GetPuppyTreeWithRootExtensionNodePairs(), {
+				{ 0x64'6F'67'00, "lion" },
+				{ 0x12'34'56'78, "gamma" }
+			});
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+
+			// Act: set, unset and set existing and new keys within a single batch
+			ApplyAllAsBatch(context.tree(), {
+				{ 0x64'6F'67'00, "kitten" },
+				{ 0x12'34'56'78, "beta" },
+				{ 0x64'6F'67'00, "" },
+				{ 0x12'34'56'78, "" },
+				{ 0x64'6F'67'00, "lion" },
+				{ 0x12'34'56'78, "gamma" }
+			});
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertApplyBatchIsEquivalentToIndividualModifications() {
+			// Arrange: use a small key space so that modifications frequently overlap existing keys
+			ModificationPairs initialPairs;
+			for (auto i = 0u; i < 200; ++i)
+				initialPairs.emplace_back(Random() % 1000, std::to_string(i));
+
+			TestContext expectedContext(tree::DataSourceVerbosity::Off);
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetAll(expectedContext.tree(), initialPairs);
+			ApplyAllAsBatch(context.tree(), initialPairs);
+
+			for (auto round = 0u; round < 10; ++round) {
+				ModificationPairs pairs;
+				std::unordered_set<uint32_t> keys;
+				for (auto i = 0u; i < 100; ++i) {
+					auto key = static_cast<uint32_t>(Random() % 1000);
+					if (keys.insert(key).second)
+						pairs.emplace_back(key, 0 == Random() % 3 ? std::string() : std::to_string(round * 1000 + i));
+				}
+
+				// Act:
+				SetAll(expectedContext.tree(), pairs);
+				ApplyAllAsBatch(context.tree(), pairs);
+
+				// Assert:
+				EXPECT_EQ(expectedContext.tree().root(), context.tree().root()) << "round " << round;
+			}
+		}
+
+		// endregion
+
 		// region setRoot
 
 	public:
@@ -1701,6 +2230,15 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsTreeRoot) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsInTree) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchFailsWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchSucceedsWhenKeyIsTreeRoot) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchSucceedsWhenKeysAreInTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchFailsWhenKeysAreNotInTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchCanMixFoundAndNotFoundKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchSupportsDuplicateKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchIncludesSharedNodesOnce) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupBatchCanLookupKeysInLoadedTree) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
@@ -1710,6 +2248,27 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeMultipleTimes) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CannotLoadTreeAroundUnknownHash) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyDoesNotPartitionModificationsWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyDoesNotPartitionModificationsWhenRootIsNotBranchNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyCanModifyTreeWithRootBranchNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyCanCollapseRootBranchNodeIntoExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyCanCollapseRootBranchNodeIntoLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyCanRemoveAllValuesFromTreeWithRootBranchNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyIgnoresRemovalOfUnknownKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyOnlyAppliesLastModificationOfKey) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyCanModifyLoadedTree) \
+	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanCreateTreeFromEmptyTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanModifyTreeWithRootBranchNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanSplitRootExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanSplitRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanCollapseRootBranchNodeIntoLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchCanRemoveAllValues) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchIgnoresRemovalOfUnknownKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchOnlyAppliesLastModificationOfKey) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchOnlyAppliesLastModificationOfRepeatedlySetKey) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyBatchIsEquivalentToIndividualModifications) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSetArbitraryRoot) \
 	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanClearTree)
@@ -52,6 +52,9 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("ops / partition,o",
 						OptionsValue<uint32_t>(m_opsPerPartition)->default_value(1000),
 						"number of operations per partition");
+				optionsBuilder("chunks / partition,c",
+						OptionsValue<uint32_t>(m_chunksPerPartition)->default_value(0),
+						"number of work stealing chunks per partition (0 disables work stealing)");
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"size of the data to generate");
@@ -65,6 +68,7 @@ namespace catapult { namespace tools { namespace benchmark {
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
+						<< "), chunks / partition (" << m_chunksPerPartition
 						<< "), data size (" << m_dataSize << ")";
 
 				auto keyPair = GenerateRandomKeyPair();
@@ -100,10 +104,23 @@ namespace catapult { namespace tools { namespace benchmark {
 					TAction action) const {
 				utils::StackLogger logger(testName, utils::LogLevel::info);
 				utils::StackTimer stopwatch;
-				thread::ParallelFor(pool.ioContext(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
-					return true;
-				}).get();
+				if (0 == m_chunksPerPartition) {
+					thread::ParallelFor(pool.ioContext(), entries, m_numPartitions, [action](auto& entry, auto) {
+						action(entry);
+						return true;
+					}).get();
+				} else {
+					thread::WorkStealingOptions options;
+					options.NumChunksPerPartition = m_chunksPerPartition;
+					thread::WorkStealingParallelForPartition(pool.ioContext(), entries, m_numPartitions, options, [action](
+							auto itBegin,
+							auto itEnd,
+							auto,
+							auto) {
+						for (auto iter = itBegin; itEnd != iter; ++iter)
+							action(*iter);
+					}).get();
+				}
 
 				auto elapsedMillis = stopwatch.millis();
 				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
@@ -118,6 +135,7 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numThreads;
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
+			uint32_t m_chunksPerPartition;
 			uint32_t m_dataSize;
 		};
 	}
@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/NetworkCensusTool.h"
+#include "tools/ToolMain.h"
+#include "tools/ToolThreadUtils.h"
+#include "catapult/extensions/RemoteDiagnosticApi.h"
+#include "catapult/utils/Functional.h"
+#include <iomanip>
+
+namespace catapult { namespace tools { namespace profile {
+
+	namespace {
+		// region node info
+
+		struct NodeInfo {
+		public:
+			explicit NodeInfo(const ionet::Node& node)
+					: Node(node)
+					, HasExecutionProfile(false)
+			{}
+
+		public:
+			ionet::Node Node;
+			bool HasExecutionProfile;
+			model::EntityRange<model::ExecutionProfileEntry> ExecutionProfile;
+		};
+
+		using NodeInfoPointer = NetworkCensusTool<NodeInfo>::NodeInfoPointer;
+
+		// endregion
+
+		// region futures
+
+		thread::future<bool> CreateExecutionProfileFuture(ionet::PacketIo& io, NodeInfo& nodeInfo) {
+			auto pApi = extensions::CreateRemoteDiagnosticApi(io);
+			return pApi->executionProfile().then([&nodeInfo](auto&& profileFuture) {
+				return UnwrapFutureAndSuppressErrors("querying execution profile", std::move(profileFuture), [&nodeInfo](auto&& entries) {
+					nodeInfo.ExecutionProfile = std::move(entries);
+					nodeInfo.HasExecutionProfile = true;
+				});
+			});
+		}
+
+		// endregion
+
+		// region formatting
+
+		void PrettyPrintExecutionProfile(const NodeInfo& nodeInfo) {
+			std::ostringstream table;
+			table << nodeInfo.Node << std::endl;
+
+			if (nodeInfo.ExecutionProfile.empty()) {
+				table << "  <no entries; is enableExecutionProfiling set?>";
+				CATAPULT_LOG(info) << table.str();
+				return;
+			}
+
+			// sort by descending total elapsed time, in case the node did not
+			std::vector<const model::ExecutionProfileEntry*> sortedEntries;
+			size_t maxNameSize = 0;
+			for (const auto& entry : nodeInfo.ExecutionProfile) {
+				sortedEntries.push_back(&entry);
+				maxNameSize = std::max<size_t>(maxNameSize, entry.NameSize);
+			}
+
+			std::stable_sort(sortedEntries.begin(), sortedEntries.end(), [](const auto* pLhs, const auto* pRhs) {
+				return pLhs->TotalElapsedNanoseconds > pRhs->TotalElapsedNanoseconds;
+			});
+
+			auto nameWidth = static_cast<int>(maxNameSize);
+			table
+					<< std::setw(nameWidth) << std::left << "name"
+					<< " | " << std::setw(12) << std::right << "calls"
+					<< " | " << std::setw(12) << "total ms"
+					<< " | " << std::setw(12) << "avg ns"
+					<< " | " << std::setw(12) << "max ns" << std::endl;
+
+			for (const auto* pEntry : sortedEntries) {
+				auto averageNanoseconds = 0 == pEntry->NumCalls ? 0 : pEntry->TotalElapsedNanoseconds / pEntry->NumCalls;
+				table
+						<< std::setw(nameWidth) << std::left << std::string(pEntry->NamePtr(), pEntry->NameSize)
+						<< " | " << std::setw(12) << std::right << pEntry->NumCalls
+						<< " | " << std::setw(12) << pEntry->TotalElapsedNanoseconds / 1'000'000
+						<< " | " << std::setw(12) << averageNanoseconds
+						<< " | " << std::setw(12) << pEntry->MaxElapsedNanoseconds << std::endl;
+			}
+
+			CATAPULT_LOG(info) << table.str();
+		}
+
+		// endregion
+
+		class ProfileTool : public NetworkCensusTool<NodeInfo> {
+		public:
+			ProfileTool() : NetworkCensusTool("Profile")
+			{}
+
+		private:
+			void prepareAdditionalOptions(OptionsBuilder&) override
+			{}
+
+			std::vector<thread::future<bool>> getNodeInfoFutures(
+					const Options&,
+					thread::IoThreadPool&,
+					ionet::PacketIo& io,
+					const model::NodeIdentity&,
+					NodeInfo& nodeInfo) override {
+				std::vector<thread::future<bool>> infoFutures;
+				infoFutures.emplace_back(CreateExecutionProfileFuture(io, nodeInfo));
+				return infoFutures;
+			}
+
+			size_t processNodeInfos(const std::vector<NodeInfoPointer>& nodeInfos) override {
+				CATAPULT_LOG(info) << "--- EXECUTION PROFILE for known peers ---";
+				for (const auto& pNodeInfo : nodeInfos)
+					PrettyPrintExecutionProfile(*pNodeInfo);
+
+				return utils::Sum(nodeInfos, [](const auto& pNodeInfo) {
+					return pNodeInfo->HasExecutionProfile ? 0 : 1u;
+				});
+			}
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::profile::ProfileTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}